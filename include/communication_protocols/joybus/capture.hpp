@@ -0,0 +1,61 @@
+#ifndef COMMUNICATION_PROTOCOLS_JOYBUS__CAPTURE_HPP
+#define COMMUNICATION_PROTOCOLS_JOYBUS__CAPTURE_HPP
+
+#include "pico/stdlib.h"
+#include "hardware/pio.h"
+
+/*
+ * Self-capturing Joybus line analyzer.
+ * A spare PIO state machine samples the data pin at JOYBUS_CAPTURE_SAMPLE_HZ into a DMA ring buffer.
+ * Joybus core marks trigger position with a single register read, core1 stops the capture
+ * once half of the buffer is filled after the trigger and dumps it over stdio UART.
+ * Decode dumps with tools/joybus_capture_decode.py.
+ */
+
+// Trigger sources
+#define JOYBUS_CAPTURE_TRIGGER_POLL 0x01 // Every poll command
+#define JOYBUS_CAPTURE_TRIGGER_UNEXPECTED 0x02 // Commands not handled by enterMode
+
+#ifndef JOYBUS_CAPTURE_TRIGGER
+#define JOYBUS_CAPTURE_TRIGGER JOYBUS_CAPTURE_TRIGGER_UNEXPECTED
+#endif
+
+#ifndef JOYBUS_CAPTURE_SAMPLE_HZ
+#define JOYBUS_CAPTURE_SAMPLE_HZ 4000000 // 16 samples per 4 us Joybus bit
+#endif
+
+#define JOYBUS_CAPTURE_BUFFER_BITS 13 // 8 KB ring: 65536 samples, 16.4 ms at 4 MHz
+
+namespace CommunicationProtocols {
+namespace Joybus {
+
+#if JOYBUS_CAPTURE
+/**
+ * @short Starts continuous sampling of the data pin on a spare state machine
+ *
+ * @param pio PIO block running Joybus state machine
+ * @param pin GPIO number of the console data line pin
+ */
+void captureInit(PIO pio, uint pin);
+
+/**
+ * @short Marks trigger position if capture is armed. Safe to call from Joybus reply path.
+ *
+ * @param command Joybus command byte which caused the trigger
+ */
+void captureTrigger(uint8_t command);
+
+/**
+ * @short Stops triggered capture and dumps it to stdio. Call from core1 loop.
+ */
+void captureTask();
+#else
+inline void captureInit(PIO, uint) {}
+inline void captureTrigger(uint8_t) {}
+inline void captureTask() {}
+#endif
+
+}
+}
+
+#endif
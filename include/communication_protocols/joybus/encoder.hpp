@@ -0,0 +1,20 @@
+#ifndef COMMUNICATION_PROTOCOLS_JOYBUS__ENCODER_HPP
+#define COMMUNICATION_PROTOCOLS_JOYBUS__ENCODER_HPP
+
+#include <stdint.h>
+
+/**
+ * @short Encodes Joybus reply bytes into words for the PIO output program
+ *
+ * Every data bit becomes 2 bits (enable, value) shifted out right, stop bit is appended.
+ * Has no SDK dependencies, also built by host benchmarks.
+ *
+ * @param command Reply bytes
+ * @param len Reply length in bytes
+ * @param result Output words, len / 2 + 1 entries
+ * @param resultLen Output words count
+ */
+void convertToPio(const uint8_t *command, const int len, uint32_t *result,
+		int &resultLen);
+
+#endif
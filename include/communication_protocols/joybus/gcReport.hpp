@@ -1,7 +1,7 @@
 #ifndef COMMUNICATION_PROTOCOLS_JOYBUS__GCREPORT
 #define COMMUNICATION_PROTOCOLS_JOYBUS__GCREPORT
 
-#include "pico/stdlib.h"
+#include <stdint.h>
 
 struct __attribute__((packed)) GCReport {
 	uint8_t a :1;
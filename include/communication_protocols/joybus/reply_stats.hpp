@@ -0,0 +1,60 @@
+#ifndef COMMUNICATION_PROTOCOLS_JOYBUS__REPLY_STATS_HPP
+#define COMMUNICATION_PROTOCOLS_JOYBUS__REPLY_STATS_HPP
+
+#include <stdint.h>
+
+#if JOYBUS_REPLY_STATS
+#include "hardware/structs/systick.h"
+#endif
+
+/*
+ * Poll-to-reply time statistics.
+ * Time from last poll command byte received to reply start is measured with core0 SysTick in cycles.
+ * Every JOYBUS_REPLY_STATS_WINDOW polls Joybus core publishes min / max / mean / variance
+ * together with XIP cache access and hit counters, core1 prints them over stdio UART.
+ * Compare flash-resident and RAM-resident (SMD2GC_RAM_HOT_PATHS) builds with tools/joybus_reply_stats.py.
+ */
+
+#ifndef JOYBUS_REPLY_STATS_WINDOW
+#define JOYBUS_REPLY_STATS_WINDOW 512 // Polls per published window
+#endif
+
+namespace CommunicationProtocols {
+namespace Joybus {
+
+#if JOYBUS_REPLY_STATS
+/**
+ * @short Starts SysTick as free running cycle counter. Call on Joybus core.
+ */
+void replyStatsInit();
+
+/**
+ * @short Current SysTick value: 24-bit down counter at system clock
+ */
+inline uint32_t replyStatsTimestamp() {
+	return systick_hw->cvr;
+}
+
+/**
+ * @short Accumulates poll-to-reply time. Call after reply is queued so bookkeeping doesn't delay it.
+ *
+ * @param pollReceived Timestamp taken when poll command was received
+ * @param replyStarted Timestamp taken when reply transmission was started
+ */
+void replyStatsRecord(uint32_t pollReceived, uint32_t replyStarted);
+
+/**
+ * @short Prints published window statistics. Call from core1 loop.
+ */
+void replyStatsTask();
+#else
+inline void replyStatsInit() {}
+inline uint32_t replyStatsTimestamp() { return 0; }
+inline void replyStatsRecord(uint32_t, uint32_t) {}
+inline void replyStatsTask() {}
+#endif
+
+}
+}
+
+#endif
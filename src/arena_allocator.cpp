@@ -1,29 +1,47 @@
-#include "arena_allocator.h"
-
-#include "stdio.h"
-
-static uint8_t arena_buffer[ARENA_SIZE];
-size_t arena_offset = 0;
-
-uint8_t* arena_alloc(size_t size, size_t align)
-{
-	// Align offset upwards
-	size_t offset = (arena_offset + align - 1) & ~(align - 1);
-
-	if (offset + size > ARENA_SIZE)
-	{
-		printf("arena allocator out of space");
-		return nullptr;
-	}
-
-	uint8_t* ptr = arena_buffer + offset;
-	arena_offset = offset + size;
-
-	return ptr;
-}
-
-void arena_reset()
-{
-	arena_offset = 0;
-}
-
+#include "arena_allocator.h"
+
+#include <string.h>
+
+#include "trace.h"
+
+uint8_t arena_buffer[ARENA_SIZE];
+size_t arena_offset = 0;
+
+uint8_t* arena_alloc(size_t size, size_t align)
+{
+	// Align offset upwards
+	size_t offset = (arena_offset + align - 1) & ~(align - 1);
+
+	if (offset + size > ARENA_SIZE)
+	{
+		TRACE_ERROR(TRACE_EVENT_ARENA_OUT_OF_SPACE, 0, size, arena_offset);
+		return nullptr;
+	}
+
+	uint8_t* ptr = arena_buffer + offset;
+	arena_offset = offset + size;
+
+	return ptr;
+}
+
+void arena_reset()
+{
+	arena_offset = 0;
+}
+
+size_t arena_used()
+{
+	return arena_offset;
+}
+
+
+bool arena_load(const uint8_t* data, size_t size)
+{
+	if (size > ARENA_SIZE)
+		return false;
+
+	memcpy(arena_buffer, data, size);
+	arena_offset = size;
+
+	return true;
+}
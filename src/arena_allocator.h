@@ -1,9 +1,30 @@
-#pragma once
-
-#include <stddef.h>
-#include <stdint.h>
-
-#define ARENA_SIZE (4 * 1024)
-
-uint8_t* arena_alloc(size_t size, size_t align = 4);
-void arena_reset();
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define ARENA_SIZE (4 * 1024)
+
+uint8_t* arena_alloc(size_t size, size_t align = 4);
+void arena_reset();
+size_t arena_used();
+
+// Arena relative reference. Data linked with references instead of pointers is relocatable:
+// arena contents can be saved and loaded back with arena_load() at any address.
+typedef uint16_t arena_ref;
+#define ARENA_REF_NONE 0xFFFF
+
+extern uint8_t arena_buffer[ARENA_SIZE];
+
+inline arena_ref arena_ref_of(const void* ptr)
+{
+	return ptr ? (arena_ref)((const uint8_t*)ptr - arena_buffer) : ARENA_REF_NONE;
+}
+
+inline void* arena_ptr(const arena_ref ref)
+{
+	return ref == ARENA_REF_NONE ? nullptr : arena_buffer + ref;
+}
+
+// Replace arena contents with saved data (arena_buffer, arena_used() bytes).
+bool arena_load(const uint8_t* data, size_t size);
@@ -0,0 +1,345 @@
+#include "bench_kernels.h"
+
+#include "hid_dumps.h"
+#include "hid_parser.h"
+#include "hid_gamecube_mapping.h"
+#include "hid_decoders.h"
+#include "hid_decoders/my_dualshock_4.h"
+#include "hid_decoders/dualshock_4_gimx.h"
+#include "hid_decoders/dualsence.h"
+
+#include "communication_protocols/joybus/encoder.hpp"
+
+volatile uint32_t bench_sink = 0;
+
+static void gamepad_callback(uint8_t pad, uint32_t control_type, uint32_t value)
+{
+	bench_sink = bench_sink + pad + control_type + value;
+}
+
+static void keyboard_callback(uint8_t hid_code, bool state)
+{
+	bench_sink = bench_sink + hid_code + state;
+}
+
+static void mouse_callback(int16_t dx, int16_t dy, int16_t dz, uint8_t buttons)
+{
+	bench_sink = bench_sink + dx + dy + dz + buttons;
+}
+
+typedef struct bench_descriptor
+{
+	const uint8_t* data;
+	uint16_t length;
+	const JoyPreset* preset;
+	gamepad_callback_t gamepad_callback;
+	keyboard_callback_t keyboard_callback;
+	mouse_callback_t mouse_callback;
+} bench_descriptor;
+
+typedef struct bench_report
+{
+	const bench_descriptor* descriptor;
+	const uint8_t* data;
+	uint16_t length;
+} bench_report;
+
+#define BENCH_GAMEPAD(descriptor) { descriptor, sizeof(descriptor), hid_to_gamecube_mapping, gamepad_callback, nullptr, nullptr }
+
+static const bench_descriptor dualshock4 = BENCH_GAMEPAD(dualshock4_hid_report_descriptor);
+static const bench_descriptor my_dualshock_4 = BENCH_GAMEPAD(my_dualshock_4_hid_report_descriptor);
+static const bench_descriptor dualshock_4_gimx = BENCH_GAMEPAD(dualshock_4_hid_report_descriptor_gimx_fr_wiki);
+static const bench_descriptor dualshock_3 = BENCH_GAMEPAD(dualshock_3_hid_report_descriptor);
+static const bench_descriptor dualsence = BENCH_GAMEPAD(dualsence_hid_report_descriptor);
+// Device-specific presets for other pads ahead of pad 1 mapping: descriptor parse cost by preset table size
+#define LARGE_PRESET_SIZE 240
+static JoyPreset large_preset[LARGE_PRESET_SIZE + 1]; // With end marker
+static const bench_descriptor dualsence_large_preset = { dualsence_hid_report_descriptor, sizeof(dualsence_hid_report_descriptor), large_preset, gamepad_callback, nullptr, nullptr };
+static const bench_descriptor keyboard = { keyboard_report_descriptor, sizeof(keyboard_report_descriptor), nullptr, nullptr, keyboard_callback, nullptr };
+static const bench_descriptor mouse = { mouse_report_descriptor, sizeof(mouse_report_descriptor), nullptr, nullptr, nullptr, mouse_callback };
+
+#define BENCH_REPORT(descriptor, report) { &descriptor, report, sizeof(report) }
+
+static const bench_report my_dualshock_4_x_o_pressed = BENCH_REPORT(my_dualshock_4, my_dualshock_4_hid_report_x_o_pressed);
+static const bench_report my_dualshock_4_u_x_pressed = BENCH_REPORT(my_dualshock_4, my_dualshock_4_hid_report_u_x_pressed);
+static const bench_report my_dualshock_4_options_r2_max_pressed = BENCH_REPORT(my_dualshock_4, my_dualshock_4_hid_report_options_r2_max_pressed);
+static const bench_report my_dualshock_4_lx_rx_min = BENCH_REPORT(my_dualshock_4, my_dualshock_4_hid_report_lx_rx_min);
+static const bench_report my_dualshock_4_idle = BENCH_REPORT(my_dualshock_4, my_dualshock_4_hid_report_idle);
+static const bench_report dualshock_4_gimx_report = BENCH_REPORT(dualshock_4_gimx, dualshock_4_hid_report_gimx_fr_wiki);
+static const bench_report dualsence_idle = BENCH_REPORT(dualsence, dualsence_hid_report_idle);
+static const bench_report dualsence_x_o_pressed = BENCH_REPORT(dualsence, dualsence_hid_report_x_o_pressed);
+static const bench_report dualsence_u_x_pressed = BENCH_REPORT(dualsence, dualsence_hid_report_u_x_pressed);
+static const bench_report dualsence_options_r2_max_pressed = BENCH_REPORT(dualsence, dualsence_hid_report_options_r2_max_pressed);
+static const bench_report dualsence_lx_rx_min = BENCH_REPORT(dualsence, dualsence_hid_report_lx_rx_min);
+static const bench_report keyboard_a_pressed = BENCH_REPORT(keyboard, keyboard_report_a_pressed);
+static const bench_report keyboard_none_pressed = BENCH_REPORT(keyboard, keyboard_report_none_pressed);
+static const bench_report mouse_1 = BENCH_REPORT(mouse, mouse_report_1);
+static const bench_report mouse_2 = BENCH_REPORT(mouse, mouse_report_2);
+static const bench_report mouse_3 = BENCH_REPORT(mouse, mouse_report_3);
+static const bench_report mouse_4 = BENCH_REPORT(mouse, mouse_report_4);
+
+static void run_parse_descriptor(const void* arg, uint32_t iterations)
+{
+	const bench_descriptor* descriptor = (const bench_descriptor*)arg;
+
+	for (uint32_t i = 0; i < iterations; i++)
+		bench_sink = bench_sink + ParseReportDescriptor(descriptor->data, descriptor->length, descriptor->preset);
+}
+
+static void setup_large_preset(const void*)
+{
+	uint16_t count = 0;
+
+	while (hid_to_gamecube_mapping[count].inputType != MAP_TYPE_NONE)
+		count++;
+
+	for (uint16_t i = 0; i < LARGE_PRESET_SIZE; i++)
+	{
+		const uint16_t from_end = LARGE_PRESET_SIZE - i;
+
+		if (from_end <= count)
+			large_preset[i] = hid_to_gamecube_mapping[count - from_end];
+		else
+		{
+			large_preset[i] = hid_to_gamecube_mapping[i % count];
+			large_preset[i].number = (uint8_t)(2 + i / count);
+		}
+	}
+
+	large_preset[LARGE_PRESET_SIZE] = {};
+}
+
+static void setup_parse_report(const void* arg)
+{
+	const bench_descriptor* descriptor = ((const bench_report*)arg)->descriptor;
+
+	ParseReportDescriptor(descriptor->data, descriptor->length, descriptor->preset);
+}
+
+static void run_parse_report(const void* arg, uint32_t iterations)
+{
+	const bench_report* report = (const bench_report*)arg;
+	const bench_descriptor* descriptor = report->descriptor;
+
+	for (uint32_t i = 0; i < iterations; i++)
+	{
+		bench_sink = bench_sink + ParseReport(report->data, report->length,
+			descriptor->gamepad_callback, descriptor->keyboard_callback, descriptor->mouse_callback);
+	}
+}
+
+// Time to first decoded report after mount: descriptor parsed or compiled decoder imported from cache
+static uint8_t decoder_image[2048];
+static size_t decoder_image_size = 0;
+
+static void setup_decoder_image(const void* arg)
+{
+	setup_parse_report(arg);
+	decoder_image_size = hid_parser_export(decoder_image, sizeof(decoder_image));
+}
+
+static void run_first_report_parse(const void* arg, uint32_t iterations)
+{
+	const bench_report* report = (const bench_report*)arg;
+	const bench_descriptor* descriptor = report->descriptor;
+
+	for (uint32_t i = 0; i < iterations; i++)
+	{
+		ParseReportDescriptor(descriptor->data, descriptor->length, descriptor->preset);
+		bench_sink = bench_sink + ParseReport(report->data, report->length,
+			descriptor->gamepad_callback, descriptor->keyboard_callback, descriptor->mouse_callback);
+	}
+}
+
+static void run_first_report_import(const void* arg, uint32_t iterations)
+{
+	const bench_report* report = (const bench_report*)arg;
+	const bench_descriptor* descriptor = report->descriptor;
+
+	for (uint32_t i = 0; i < iterations; i++)
+	{
+		hid_parser_import(decoder_image, decoder_image_size);
+		bench_sink = bench_sink + ParseReport(report->data, report->length,
+			descriptor->gamepad_callback, descriptor->keyboard_callback, descriptor->mouse_callback);
+	}
+}
+
+typedef struct bench_range
+{
+	int16_t minimum;
+	uint16_t maximum;
+	preset_value_type target_type;
+} bench_range;
+
+// Every conversion convert_range() implements, except passthrough
+static const bench_range ranges[] =
+{
+	{ INT8_MIN, INT8_MAX, VALUE_TYPE_UINT8 },
+	{ INT8_MIN, INT8_MAX, VALUE_TYPE_UINT16 },
+	{ INT8_MIN, INT8_MAX, VALUE_TYPE_INT16 },
+	{ 0, UINT8_MAX, VALUE_TYPE_INT8 },
+	{ 0, UINT8_MAX, VALUE_TYPE_UINT16 },
+	{ 0, UINT8_MAX, VALUE_TYPE_INT16 },
+	{ INT16_MIN, INT16_MAX, VALUE_TYPE_UINT8 },
+	{ INT16_MIN, INT16_MAX, VALUE_TYPE_INT8 },
+	{ INT16_MIN, INT16_MAX, VALUE_TYPE_UINT16 },
+	{ 0, UINT16_MAX, VALUE_TYPE_UINT8 },
+	{ 0, UINT16_MAX, VALUE_TYPE_INT8 },
+	{ 0, UINT16_MAX, VALUE_TYPE_INT16 }
+};
+
+static void run_convert_range(const void*, uint32_t iterations)
+{
+	const uint32_t count = sizeof(ranges) / sizeof(ranges[0]);
+	uint32_t index = 0;
+	uint32_t sum = 0;
+
+	for (uint32_t i = 0; i < iterations; i++)
+	{
+		const bench_range* range = &ranges[index];
+		sum += convert_range(i & 0x7F, range->minimum, range->maximum, range->target_type);
+
+		if (++index == count)
+			index = 0;
+	}
+
+	bench_sink = bench_sink + sum;
+}
+
+static void run_convert_to_pio(const void*, uint32_t iterations)
+{
+	uint8_t report[8] = { 0x00, 0x80, 128, 128, 128, 128, 0, 0 };
+	uint32_t result[5];
+	int resultLen;
+
+	for (uint32_t i = 0; i < iterations; i++)
+	{
+		report[2] = (uint8_t)i; // Different data every call
+		convertToPio(report, sizeof(report), result, resultLen);
+		bench_sink = bench_sink + result[1];
+	}
+}
+
+// Report to canonical pad: ParseReport() with canonical_pad_apply() against generated decoder (hid_decoders.h)
+typedef struct bench_decoder
+{
+	const bench_report* report;
+	hid_decoder_t decode;
+} bench_decoder;
+
+static canonical_pad bench_pad;
+
+static void canonical_pad_callback(uint8_t pad, uint32_t control_type, uint32_t value)
+{
+	if (pad == 0) // Generated decoders are single pad
+		canonical_pad_apply(&bench_pad, control_type, value);
+}
+
+static void setup_decode(const void* arg)
+{
+	setup_parse_report(((const bench_decoder*)arg)->report);
+}
+
+static void run_decode_generic(const void* arg, uint32_t iterations)
+{
+	const bench_report* report = ((const bench_decoder*)arg)->report;
+
+	for (uint32_t i = 0; i < iterations; i++)
+	{
+		bench_pad = neutralCanonicalPad;
+		bench_sink = bench_sink + ParseReport(report->data, report->length, canonical_pad_callback) + bench_pad.buttons;
+	}
+}
+
+static void run_decode_generated(const void* arg, uint32_t iterations)
+{
+	const bench_decoder* decoder = (const bench_decoder*)arg;
+	const bench_report* report = decoder->report;
+
+	for (uint32_t i = 0; i < iterations; i++)
+	{
+		bench_pad = neutralCanonicalPad;
+		bench_sink = bench_sink + decoder->decode(report->data, report->length, &bench_pad) + bench_pad.buttons;
+	}
+}
+
+// Canonical pad to GCReport: HID conditioning, trigger_click profile has threshold and button to axis entries
+static void setup_pad_profile(const void*)
+{
+	pad_profiles_init();
+	pad_profile_select(1);
+}
+
+static void run_pad_profile(const void*, uint32_t iterations)
+{
+	canonical_pad pad = neutralCanonicalPad;
+	pad.buttons = 1u << PAD_BUTTON_SOUTH | 1u << PAD_BUTTON_R2;
+
+	for (uint32_t i = 0; i < iterations; i++)
+	{
+		PAD_AXIS(&pad, PAD_AXIS_LT) = (uint8_t)i; // Different data every call
+		PAD_AXIS(&pad, PAD_AXIS_LX) = (uint8_t)(i * 7);
+		PAD_AXIS(&pad, PAD_AXIS_RY) = (uint8_t)(i * 13);
+		const GCReport gc = pad_profile_report(&pad, PAD_SOURCE_HID);
+		bench_sink = bench_sink + gc.analogL + gc.l + gc.a + gc.xStick + gc.cyStick;
+	}
+}
+
+static const bench_decoder my_dualshock_4_decoder = { &my_dualshock_4_x_o_pressed, hid_decode_my_dualshock_4 };
+static const bench_decoder dualshock_4_gimx_decoder = { &dualshock_4_gimx_report, hid_decode_dualshock_4_gimx };
+static const bench_decoder dualsence_decoder = { &dualsence_x_o_pressed, hid_decode_dualsence };
+
+#define DESCRIPTOR_KERNEL(name) { "ParseReportDescriptor/" #name, nullptr, run_parse_descriptor, &name }
+#define REPORT_KERNEL(name) { "ParseReport/" #name, setup_parse_report, run_parse_report, &name }
+#define FIRST_REPORT_KERNELS(name) \
+	{ "FirstReport/parse/" #name, nullptr, run_first_report_parse, &name }, \
+	{ "FirstReport/import/" #name, setup_decoder_image, run_first_report_import, &name }
+#define DECODE_KERNELS(name) \
+	{ "Decode/generic/" #name, setup_decode, run_decode_generic, &name##_decoder }, \
+	{ "Decode/generated/" #name, nullptr, run_decode_generated, &name##_decoder }
+
+const bench_kernel bench_kernels[] =
+{
+	DESCRIPTOR_KERNEL(dualshock4),
+	DESCRIPTOR_KERNEL(my_dualshock_4),
+	DESCRIPTOR_KERNEL(dualshock_4_gimx),
+	DESCRIPTOR_KERNEL(dualshock_3),
+	DESCRIPTOR_KERNEL(dualsence),
+	{ "ParseReportDescriptor/dualsence_large_preset", setup_large_preset, run_parse_descriptor, &dualsence_large_preset },
+	DESCRIPTOR_KERNEL(keyboard),
+	DESCRIPTOR_KERNEL(mouse),
+
+	REPORT_KERNEL(my_dualshock_4_x_o_pressed),
+	REPORT_KERNEL(my_dualshock_4_u_x_pressed),
+	REPORT_KERNEL(my_dualshock_4_options_r2_max_pressed),
+	REPORT_KERNEL(my_dualshock_4_lx_rx_min),
+	REPORT_KERNEL(my_dualshock_4_idle),
+	REPORT_KERNEL(dualshock_4_gimx_report),
+	REPORT_KERNEL(dualsence_idle),
+	REPORT_KERNEL(dualsence_x_o_pressed),
+	REPORT_KERNEL(dualsence_u_x_pressed),
+	REPORT_KERNEL(dualsence_options_r2_max_pressed),
+	REPORT_KERNEL(dualsence_lx_rx_min),
+	REPORT_KERNEL(keyboard_a_pressed),
+	REPORT_KERNEL(keyboard_none_pressed),
+	REPORT_KERNEL(mouse_1),
+	REPORT_KERNEL(mouse_2),
+	REPORT_KERNEL(mouse_3),
+	REPORT_KERNEL(mouse_4),
+
+	FIRST_REPORT_KERNELS(my_dualshock_4_x_o_pressed),
+	FIRST_REPORT_KERNELS(dualshock_4_gimx_report),
+	FIRST_REPORT_KERNELS(dualsence_x_o_pressed),
+	FIRST_REPORT_KERNELS(keyboard_a_pressed),
+
+	DECODE_KERNELS(my_dualshock_4),
+	DECODE_KERNELS(dualshock_4_gimx),
+	DECODE_KERNELS(dualsence),
+
+	{ "pad_profile_report", setup_pad_profile, run_pad_profile, nullptr },
+
+	{ "convert_range", nullptr, run_convert_range, nullptr },
+	{ "convertToPio", nullptr, run_convert_to_pio, nullptr }
+};
+
+const size_t bench_kernels_count = sizeof(bench_kernels) / sizeof(bench_kernels[0]);
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+Benchmark kernels for HID parser and Joybus encoder.
+Shared by host benchmark (hid_bench.cpp) and firmware benchmark: kernel runs operation
+under test given number of times, harness measures time.
+
+Kernels:
+- ParseReportDescriptor/<device> for every report descriptor in hid_dumps.h
+- ParseReportDescriptor/dualsence_large_preset with 240 entries preset table
+- ParseReport/<report> for every descriptor / report pair in hid_dumps.h
+- FirstReport/parse|import/<report>: descriptor parse or compiled decoder import (hid_parser_import()) followed by first report
+- Decode/generic|generated/<device>: report to canonical pad with ParseReport() and canonical_pad_apply() or generated decoder
+- pad_profile_report: canonical pad to GCReport with stick / trigger conditioning and active profile
+- convert_range for all supported source / target range pairs
+- convertToPio for 8-byte GameCube poll reply
+*/
+
+typedef struct bench_kernel
+{
+	const char* name;
+	void (*setup)(const void* arg); // Prepares parser state, nullptr if not needed
+	void (*run)(const void* arg, uint32_t iterations);
+	const void* arg;
+} bench_kernel;
+
+extern const bench_kernel bench_kernels[];
+extern const size_t bench_kernels_count;
+
+// Kernels accumulate results here so compiler can't remove computations under test.
+extern volatile uint32_t bench_sink;
@@ -0,0 +1,166 @@
+#include <stdio.h>
+
+#include "pico/stdlib.h"
+#include "pico/sync.h"
+#include "hardware/clocks.h"
+#include "hardware/structs/systick.h"
+#include "hardware/uart.h"
+
+#include "bench_kernels.h"
+#include "sega_mega_drive.h"
+#include "communication_protocols/joybus/gcReport.hpp"
+
+/*
+On-target microbenchmarks (SMD2GC_bench firmware).
+
+Runs HID parser / Joybus encoder kernels shared with host benchmark (bench_kernels.h),
+Mega Drive pad reader and GCReport handoff between cores at every clock in BENCH_CLOCKS_KHZ.
+Kernel is repeated with doubling iteration count until BENCH_MIN_TIME_US is reached, timed with time_us_64().
+Results are printed over UART1:
+	BENCH clk_mhz=<MHz> kernel=<name> iterations=<n> us=<total> cycles_per_op=<cycles>
+Compare logs of two builds with tools/bench_compare.py.
+*/
+
+static const uint32_t BENCH_CLOCKS_KHZ[] = { 125000, 150000 };
+
+#define BENCH_MIN_TIME_US 100000
+#define BENCH_SMD_SCANS 64
+
+// GCReport handoff from USB core to Joybus core, same as main.cpp
+static GCReport g_shared_report = defaultGcReport;
+static spin_lock_t* g_shared_lock = nullptr;
+
+static void run_handoff_publish(const void*, uint32_t iterations)
+{
+	GCReport report = defaultGcReport;
+
+	for (uint32_t i = 0; i < iterations; i++)
+	{
+		report.xStick = (uint8_t)i;
+
+		spin_lock_unsafe_blocking(g_shared_lock);
+		g_shared_report = report;
+		spin_unlock_unsafe(g_shared_lock);
+	}
+}
+
+static void run_handoff_read(const void*, uint32_t iterations)
+{
+	for (uint32_t i = 0; i < iterations; i++)
+	{
+		spin_lock_unsafe_blocking(g_shared_lock);
+		const GCReport report = g_shared_report;
+		spin_unlock_unsafe(g_shared_lock);
+
+		bench_sink = bench_sink + report.xStick;
+	}
+}
+
+// Reader returns last state when called within 3 ms after previous pad scan
+static void run_smd_cached(const void*, uint32_t iterations)
+{
+	for (uint32_t i = 0; i < iterations; i++)
+	{
+		const smd_state_t smd = getSegaMegaDriveReport();
+		bench_sink = bench_sink + smd.a;
+	}
+}
+
+static const bench_kernel target_kernels[] =
+{
+	{ "handoff/publish", nullptr, run_handoff_publish, nullptr },
+	{ "handoff/read", nullptr, run_handoff_read, nullptr },
+	{ "getSegaMegaDriveReport/cached", nullptr, run_smd_cached, nullptr }
+};
+
+static void print_result(const char* name, uint32_t iterations, uint64_t elapsed_us, double cycles_per_op)
+{
+	printf("BENCH clk_mhz=%lu kernel=%s iterations=%lu us=%llu cycles_per_op=%.1f\n",
+		(unsigned long)(clock_get_hz(clk_sys) / 1000000), name, (unsigned long)iterations,
+		(unsigned long long)elapsed_us, cycles_per_op);
+}
+
+static void measure(const bench_kernel* kernel)
+{
+	if (kernel->setup)
+		kernel->setup(kernel->arg);
+
+	kernel->run(kernel->arg, 1); // Fill XIP cache
+
+	uint32_t iterations = 16;
+	uint64_t elapsed_us;
+
+	while (true)
+	{
+		const uint64_t start = time_us_64();
+		kernel->run(kernel->arg, iterations);
+		elapsed_us = time_us_64() - start;
+
+		if (elapsed_us >= BENCH_MIN_TIME_US)
+			break;
+
+		iterations *= 2;
+	}
+
+	print_result(kernel->name, iterations, elapsed_us, (double)elapsed_us * clock_get_hz(clk_sys) / 1e6 / iterations);
+}
+
+// Full pad scan is rate limited by reader: wait out the limit, then time single call with SysTick.
+static void measure_smd_scan()
+{
+	uint64_t cycles = 0;
+	const uint64_t start = time_us_64();
+
+	for (uint32_t i = 0; i < BENCH_SMD_SCANS; i++)
+	{
+		busy_wait_us_32(3000);
+
+		const uint32_t before = systick_hw->cvr;
+		const smd_state_t smd = getSegaMegaDriveReport();
+		const uint32_t after = systick_hw->cvr;
+
+		cycles += (before - after) & 0x00FFFFFF; // Down counter
+		bench_sink = bench_sink + smd.a;
+	}
+
+	print_result("getSegaMegaDriveReport/scan", BENCH_SMD_SCANS, time_us_64() - start, (double)cycles / BENCH_SMD_SCANS);
+}
+
+int main()
+{
+	set_sys_clock_khz(BENCH_CLOCKS_KHZ[0], true);
+
+	stdio_uart_init();
+	stdio_init_all();
+
+	printf("SMD2GC benchmark\n");
+
+	initSegaMegaDrive();
+
+	g_shared_lock = spin_lock_init(spin_lock_claim_unused(true));
+
+	// SysTick is not used by SDK: free running 24-bit down counter at core clock
+	systick_hw->rvr = 0x00FFFFFF;
+	systick_hw->cvr = 0;
+	systick_hw->csr = M0PLUS_SYST_CSR_CLKSOURCE_BITS | M0PLUS_SYST_CSR_ENABLE_BITS;
+
+	for (uint32_t khz : BENCH_CLOCKS_KHZ)
+	{
+		uart_tx_wait_blocking(uart_default);
+		set_sys_clock_khz(khz, true);
+		uart_set_baudrate(uart_default, PICO_DEFAULT_UART_BAUD_RATE); // clk_peri follows clk_sys
+
+		for (size_t i = 0; i < bench_kernels_count; i++)
+			measure(&bench_kernels[i]);
+
+		for (const bench_kernel& kernel : target_kernels)
+			measure(&kernel);
+
+		measure_smd_scan();
+	}
+
+	printf("BENCH DONE\n");
+
+	while (true)
+		tight_loop_contents();
+}
@@ -0,0 +1,37 @@
+#include "boot_timeline.h"
+
+#if BOOT_TIMELINE
+
+#include <stdio.h>
+
+volatile uint32_t boot_timeline_us[BOOT_EVENTS];
+
+static bool g_printed;
+
+void boot_timeline_task()
+{
+	static const char* const names[BOOT_EVENTS] =
+	{
+		"joybus_armed_us", "first_probe_reply_us", "first_origin_reply_us",
+		"first_poll_reply_us", "inputs_ready_us", "first_input_reply_us"
+	};
+
+	if (g_printed || (!boot_timeline_us[BOOT_EVENT_FIRST_INPUT_REPLY] && time_us_32() < BOOT_TIMELINE_TIMEOUT_MS * 1000))
+		return;
+
+	g_printed = true;
+
+	printf("BOOT_TIMELINE");
+
+	for (uint8_t event = 0; event < BOOT_EVENTS; event++)
+	{
+		if (boot_timeline_us[event])
+			printf(" %s=%lu", names[event], (unsigned long)boot_timeline_us[event]);
+		else
+			printf(" %s=-", names[event]);
+	}
+
+	printf("\n");
+}
+
+#endif
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <stdint.h>
+
+/*
+Boot timeline: time from boot to first Joybus replies.
+
+Core0 sets system clock, hands interrupts to core1, launches it and enters Joybus mode right away:
+probe and origin replies are constant, polls are answered with neutral report until core1 sets inputs ready
+(stdio, spinlock, pad profiles, Mega Drive GPIO). USB host starts after that.
+
+Core0 records first occurrence of Joybus events, core1 prints timeline once first real input is sent
+or after BOOT_TIMELINE_TIMEOUT_MS:
+	BOOT_TIMELINE joybus_armed_us=<n> first_probe_reply_us=<n|-> first_origin_reply_us=<n|-> first_poll_reply_us=<n|-> inputs_ready_us=<n> first_input_reply_us=<n|->
+Times are time_us_32() since timer start at boot.
+*/
+
+#define BOOT_TIMELINE_TIMEOUT_MS 10000
+
+enum boot_timeline_event : uint8_t
+{
+	BOOT_EVENT_JOYBUS_ARMED, // State machine waits for first command
+	BOOT_EVENT_FIRST_PROBE_REPLY,
+	BOOT_EVENT_FIRST_ORIGIN_REPLY,
+	BOOT_EVENT_FIRST_POLL_REPLY, // Neutral report while inputs are not ready
+	BOOT_EVENT_INPUTS_READY,
+	BOOT_EVENT_FIRST_INPUT_REPLY, // First poll reply with real input
+	BOOT_EVENTS
+};
+
+#if BOOT_TIMELINE
+#include "pico/time.h"
+
+extern volatile uint32_t boot_timeline_us[BOOT_EVENTS]; // 0 - not recorded
+
+// Record first occurrence of event. Called on Joybus core, costs a load and compare after first occurrence.
+inline void boot_timeline_event(uint8_t event)
+{
+	if (!boot_timeline_us[event])
+		boot_timeline_us[event] = time_us_32();
+}
+
+// Print timeline once. Call from core1 loop.
+void boot_timeline_task();
+#else
+inline void boot_timeline_event(uint8_t) {}
+inline void boot_timeline_task() {}
+#endif
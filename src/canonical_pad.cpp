@@ -0,0 +1,337 @@
+#include "canonical_pad.h"
+
+#include <stdio.h>
+
+#include "hot_path.h"
+#include "pad_conditioning.h"
+
+#define PAD_PROFILE(name, entries, digital_triggers) { name, entries, sizeof(entries) / sizeof(entries[0]), digital_triggers }
+
+#define PAD_PROFILE_CHORD ((1u << PAD_BUTTON_SELECT) | (1u << PAD_BUTTON_START))
+
+// Mapping used before profiles: DualShock 3 / XInput / Mega Drive hardcoded mappings, hid_to_gamecube_mapping.
+static const pad_profile_entry default_profile[] =
+{
+	{ MAP_GAMECUBE_BUTTON_A, PAD_BUTTON_SOUTH, 0 },
+	{ MAP_GAMECUBE_BUTTON_B, PAD_BUTTON_EAST, 0 },
+	{ MAP_GAMECUBE_BUTTON_X, PAD_BUTTON_WEST, 0 },
+	{ MAP_GAMECUBE_BUTTON_Y, PAD_BUTTON_NORTH, 0 },
+	{ MAP_GAMECUBE_BUTTON_START, PAD_BUTTON_START, 0 },
+	{ MAP_GAMECUBE_BUTTON_START, PAD_BUTTON_HOME, 0 },
+	{ MAP_GAMECUBE_L, PAD_BUTTON_LEFT, 0 },
+	{ MAP_GAMECUBE_R, PAD_BUTTON_RIGHT, 0 },
+	{ MAP_GAMECUBE_D, PAD_BUTTON_DOWN, 0 },
+	{ MAP_GAMECUBE_U, PAD_BUTTON_UP, 0 },
+	{ MAP_GAMECUBE_BUTTON_Z, PAD_BUTTON_R1, 0 },
+	// Note: DualShock 4 generates L2/R2 press event starting from minimum force,
+	// GameCube controller generates L/R clicks after maximum force to analog L/R axes applied: see trigger_click profile.
+	{ MAP_GAMECUBE_BUTTON_L, PAD_BUTTON_L2, 0 },
+	{ MAP_GAMECUBE_BUTTON_R, PAD_BUTTON_R2, 0 },
+	{ MAP_GAMECUBE_AXIS_X, PAD_AXIS_LX, 0 },
+	{ MAP_GAMECUBE_AXIS_Y, PAD_AXIS_LY, 0 },
+	{ MAP_GAMECUBE_AXIS_CX, PAD_AXIS_RX, 0 },
+	{ MAP_GAMECUBE_AXIS_CY, PAD_AXIS_RY, 0 },
+	{ MAP_GAMECUBE_AXIS_L, PAD_AXIS_LT, 0 },
+	{ MAP_GAMECUBE_AXIS_R, PAD_AXIS_RT, 0 },
+};
+
+// L/R click at 75% of analog trigger travel, close to GameCube controller
+static const pad_profile_entry trigger_click_profile[] =
+{
+	{ MAP_GAMECUBE_BUTTON_A, PAD_BUTTON_SOUTH, 0 },
+	{ MAP_GAMECUBE_BUTTON_B, PAD_BUTTON_EAST, 0 },
+	{ MAP_GAMECUBE_BUTTON_X, PAD_BUTTON_WEST, 0 },
+	{ MAP_GAMECUBE_BUTTON_Y, PAD_BUTTON_NORTH, 0 },
+	{ MAP_GAMECUBE_BUTTON_START, PAD_BUTTON_START, 0 },
+	{ MAP_GAMECUBE_BUTTON_START, PAD_BUTTON_HOME, 0 },
+	{ MAP_GAMECUBE_L, PAD_BUTTON_LEFT, 0 },
+	{ MAP_GAMECUBE_R, PAD_BUTTON_RIGHT, 0 },
+	{ MAP_GAMECUBE_D, PAD_BUTTON_DOWN, 0 },
+	{ MAP_GAMECUBE_U, PAD_BUTTON_UP, 0 },
+	{ MAP_GAMECUBE_BUTTON_Z, PAD_BUTTON_R1, 0 },
+	{ MAP_GAMECUBE_BUTTON_L, PAD_AXIS_LT, 191 },
+	{ MAP_GAMECUBE_BUTTON_R, PAD_AXIS_RT, 191 },
+	{ MAP_GAMECUBE_AXIS_X, PAD_AXIS_LX, 0 },
+	{ MAP_GAMECUBE_AXIS_Y, PAD_AXIS_LY, 0 },
+	{ MAP_GAMECUBE_AXIS_CX, PAD_AXIS_RX, 0 },
+	{ MAP_GAMECUBE_AXIS_CY, PAD_AXIS_RY, 0 },
+	{ MAP_GAMECUBE_AXIS_L, PAD_AXIS_LT, 0 },
+	{ MAP_GAMECUBE_AXIS_R, PAD_AXIS_RT, 0 },
+};
+
+// L1/R1 click L/R, analog triggers stay analog L/R, R2 click is Z
+static const pad_profile_entry bumpers_profile[] =
+{
+	{ MAP_GAMECUBE_BUTTON_A, PAD_BUTTON_SOUTH, 0 },
+	{ MAP_GAMECUBE_BUTTON_B, PAD_BUTTON_EAST, 0 },
+	{ MAP_GAMECUBE_BUTTON_X, PAD_BUTTON_WEST, 0 },
+	{ MAP_GAMECUBE_BUTTON_Y, PAD_BUTTON_NORTH, 0 },
+	{ MAP_GAMECUBE_BUTTON_START, PAD_BUTTON_START, 0 },
+	{ MAP_GAMECUBE_BUTTON_START, PAD_BUTTON_HOME, 0 },
+	{ MAP_GAMECUBE_L, PAD_BUTTON_LEFT, 0 },
+	{ MAP_GAMECUBE_R, PAD_BUTTON_RIGHT, 0 },
+	{ MAP_GAMECUBE_D, PAD_BUTTON_DOWN, 0 },
+	{ MAP_GAMECUBE_U, PAD_BUTTON_UP, 0 },
+	{ MAP_GAMECUBE_BUTTON_Z, PAD_BUTTON_R2, 0 },
+	{ MAP_GAMECUBE_BUTTON_L, PAD_BUTTON_L1, 0 },
+	{ MAP_GAMECUBE_BUTTON_R, PAD_BUTTON_R1, 0 },
+	{ MAP_GAMECUBE_AXIS_X, PAD_AXIS_LX, 0 },
+	{ MAP_GAMECUBE_AXIS_Y, PAD_AXIS_LY, 0 },
+	{ MAP_GAMECUBE_AXIS_CX, PAD_AXIS_RX, 0 },
+	{ MAP_GAMECUBE_AXIS_CY, PAD_AXIS_RY, 0 },
+	{ MAP_GAMECUBE_AXIS_L, PAD_AXIS_LT, 0 },
+	{ MAP_GAMECUBE_AXIS_R, PAD_AXIS_RT, 0 },
+};
+
+// Face buttons by position of GameCube ones: A is south, B is west, X is east, Y is north
+static const pad_profile_entry gamecube_layout_profile[] =
+{
+	{ MAP_GAMECUBE_BUTTON_A, PAD_BUTTON_SOUTH, 0 },
+	{ MAP_GAMECUBE_BUTTON_B, PAD_BUTTON_WEST, 0 },
+	{ MAP_GAMECUBE_BUTTON_X, PAD_BUTTON_EAST, 0 },
+	{ MAP_GAMECUBE_BUTTON_Y, PAD_BUTTON_NORTH, 0 },
+	{ MAP_GAMECUBE_BUTTON_START, PAD_BUTTON_START, 0 },
+	{ MAP_GAMECUBE_BUTTON_START, PAD_BUTTON_HOME, 0 },
+	{ MAP_GAMECUBE_L, PAD_BUTTON_LEFT, 0 },
+	{ MAP_GAMECUBE_R, PAD_BUTTON_RIGHT, 0 },
+	{ MAP_GAMECUBE_D, PAD_BUTTON_DOWN, 0 },
+	{ MAP_GAMECUBE_U, PAD_BUTTON_UP, 0 },
+	{ MAP_GAMECUBE_BUTTON_Z, PAD_BUTTON_R1, 0 },
+	{ MAP_GAMECUBE_BUTTON_L, PAD_BUTTON_L2, 0 },
+	{ MAP_GAMECUBE_BUTTON_R, PAD_BUTTON_R2, 0 },
+	{ MAP_GAMECUBE_AXIS_X, PAD_AXIS_LX, 0 },
+	{ MAP_GAMECUBE_AXIS_Y, PAD_AXIS_LY, 0 },
+	{ MAP_GAMECUBE_AXIS_CX, PAD_AXIS_RX, 0 },
+	{ MAP_GAMECUBE_AXIS_CY, PAD_AXIS_RY, 0 },
+	{ MAP_GAMECUBE_AXIS_L, PAD_AXIS_LT, 0 },
+	{ MAP_GAMECUBE_AXIS_R, PAD_AXIS_RT, 0 },
+};
+
+const pad_profile pad_profiles[] =
+{
+	PAD_PROFILE("default", default_profile, false),
+	PAD_PROFILE("trigger_click", trigger_click_profile, true), // Pads without analog triggers: clicks above threshold
+	PAD_PROFILE("bumpers", bumpers_profile, false),
+	PAD_PROFILE("gamecube_layout", gamecube_layout_profile, false),
+};
+
+const uint8_t pad_profiles_count = sizeof(pad_profiles) / sizeof(pad_profiles[0]);
+
+#define PAD_PROFILE_THRESHOLDS (32 - PAD_BUTTONS) // Thresholds are extra bits above canonical buttons
+#define PAD_PROFILE_BUTTON_AXES 4
+#define PAD_PROFILE_GC_BUTTONS MAP_GAMECUBE_AXIS_X
+#define PAD_PROFILE_GC_AXES (MAP_GAMECUBE_AXIS_R - MAP_GAMECUBE_AXIS_X + 1)
+#define PAD_PROFILE_NO_AXIS 0xFF
+
+typedef struct pad_profile_threshold
+{
+	uint8_t axis; // Canonical axis index
+	uint8_t level;
+} pad_profile_threshold;
+
+typedef struct pad_profile_button_axis
+{
+	uint8_t axis; // GameCube axis index
+	uint8_t value;
+	uint32_t mask;
+} pad_profile_button_axis;
+
+typedef struct pad_profile_compiled
+{
+	uint32_t button_masks[PAD_PROFILE_GC_BUTTONS]; // Canonical buttons and thresholds per GameCube button
+	uint8_t axis_sources[PAD_PROFILE_GC_AXES]; // Canonical axis index per GameCube axis, PAD_PROFILE_NO_AXIS - neutral
+	uint8_t thresholds;
+	uint8_t button_axes;
+	bool digital_triggers;
+	pad_profile_threshold threshold[PAD_PROFILE_THRESHOLDS];
+	pad_profile_button_axis button_axis[PAD_PROFILE_BUTTON_AXES];
+} pad_profile_compiled;
+
+static pad_profile_compiled g_compiled[sizeof(pad_profiles) / sizeof(pad_profiles[0])];
+static const pad_profile_compiled* volatile g_active = &g_compiled[0];
+static volatile uint8_t g_active_index = 0;
+static volatile bool g_switched = false;
+static uint8_t g_chord_held = 0; // Bit per controller slot, core1 only
+
+static const uint8_t neutral_axes[PAD_PROFILE_GC_AXES] = { 128, 128, 128, 128, 0, 0 };
+
+void HOT_PATH(canonical_pad_apply)(canonical_pad* pad, uint32_t control_type, uint32_t value)
+{
+	if (control_type < PAD_BUTTONS)
+		pad->buttons |= 1u << control_type;
+	else if (control_type == PAD_AXIS_LY || control_type == PAD_AXIS_RY)
+		PAD_AXIS(pad, control_type) = UINT8_MAX - value;
+	else if (control_type <= PAD_AXIS_RT)
+		PAD_AXIS(pad, control_type) = value;
+}
+
+static bool compile_profile(const pad_profile* profile, pad_profile_compiled* compiled)
+{
+	*compiled = {};
+	compiled->digital_triggers = profile->digital_triggers;
+
+	for (uint8_t i = 0; i < PAD_PROFILE_GC_AXES; i++)
+		compiled->axis_sources[i] = PAD_PROFILE_NO_AXIS;
+
+	for (uint8_t i = 0; i < profile->count; i++)
+	{
+		const pad_profile_entry* entry = &profile->entries[i];
+		const bool source_axis = entry->source >= PAD_AXIS_LX && entry->source <= PAD_AXIS_RT;
+
+		if (entry->output < PAD_PROFILE_GC_BUTTONS)
+		{
+			if (!source_axis)
+				compiled->button_masks[entry->output] |= 1u << entry->source;
+			else if (compiled->thresholds < PAD_PROFILE_THRESHOLDS)
+			{
+				compiled->threshold[compiled->thresholds] = { (uint8_t)(entry->source - PAD_AXIS_LX), entry->param };
+				compiled->button_masks[entry->output] |= 1u << (PAD_BUTTONS + compiled->thresholds);
+				compiled->thresholds++;
+			}
+			else
+				return false;
+		}
+		else if (entry->output <= MAP_GAMECUBE_AXIS_R)
+		{
+			const uint8_t axis = entry->output - MAP_GAMECUBE_AXIS_X;
+
+			if (source_axis)
+				compiled->axis_sources[axis] = entry->source - PAD_AXIS_LX;
+			else if (compiled->button_axes < PAD_PROFILE_BUTTON_AXES)
+				compiled->button_axis[compiled->button_axes++] = { axis, entry->param, 1u << entry->source };
+			else
+				return false;
+		}
+	}
+
+	return true;
+}
+
+void pad_profiles_init()
+{
+	pad_conditioning_init();
+
+	for (uint8_t i = 0; i < pad_profiles_count; i++)
+	{
+		if (!compile_profile(&pad_profiles[i], &g_compiled[i]))
+			printf("PROFILE %u %s: too many threshold / button to axis entries\n", i, pad_profiles[i].name);
+	}
+
+	pad_profile_select(0);
+}
+
+uint8_t pad_profile_active()
+{
+	return g_active_index;
+}
+
+bool pad_profile_select(uint8_t index)
+{
+	if (index >= pad_profiles_count)
+		return false;
+
+	g_active_index = index;
+	g_active = &g_compiled[index]; // Single pointer store: no lock for reader on other core
+
+	return true;
+}
+
+// Digital trigger pressed with no analog travel (Mega Drive Z / C, HID pads without trigger axes) is full analog press.
+// Pads with analog triggers keep analog value: their digital L2 / R2 is pressed from minimum force.
+static void HOT_PATH(digital_triggers)(canonical_pad* pad)
+{
+	if ((pad->buttons & (1u << PAD_BUTTON_L2)) && PAD_AXIS(pad, PAD_AXIS_LT) == 0)
+		PAD_AXIS(pad, PAD_AXIS_LT) = UINT8_MAX;
+
+	if ((pad->buttons & (1u << PAD_BUTTON_R2)) && PAD_AXIS(pad, PAD_AXIS_RT) == 0)
+		PAD_AXIS(pad, PAD_AXIS_RT) = UINT8_MAX;
+}
+
+static GCReport HOT_PATH(map_profile)(const pad_profile_compiled* profile, canonical_pad* pad)
+{
+	if (profile->digital_triggers)
+		digital_triggers(pad);
+
+	uint32_t buttons = pad->buttons;
+
+	for (uint8_t i = 0; i < profile->thresholds; i++)
+		buttons |= (uint32_t)(pad->axes[profile->threshold[i].axis] > profile->threshold[i].level) << (PAD_BUTTONS + i);
+
+	const uint32_t* masks = profile->button_masks;
+	GCReport gc = defaultGcReport;
+
+	gc.a = (buttons & masks[MAP_GAMECUBE_BUTTON_A]) != 0;
+	gc.b = (buttons & masks[MAP_GAMECUBE_BUTTON_B]) != 0;
+	gc.x = (buttons & masks[MAP_GAMECUBE_BUTTON_X]) != 0;
+	gc.y = (buttons & masks[MAP_GAMECUBE_BUTTON_Y]) != 0;
+	gc.start = (buttons & masks[MAP_GAMECUBE_BUTTON_START]) != 0;
+	gc.dLeft = (buttons & masks[MAP_GAMECUBE_L]) != 0;
+	gc.dRight = (buttons & masks[MAP_GAMECUBE_R]) != 0;
+	gc.dDown = (buttons & masks[MAP_GAMECUBE_D]) != 0;
+	gc.dUp = (buttons & masks[MAP_GAMECUBE_U]) != 0;
+	gc.z = (buttons & masks[MAP_GAMECUBE_BUTTON_Z]) != 0;
+	gc.r = (buttons & masks[MAP_GAMECUBE_BUTTON_R]) != 0;
+	gc.l = (buttons & masks[MAP_GAMECUBE_BUTTON_L]) != 0;
+
+	uint8_t axes[PAD_PROFILE_GC_AXES];
+
+	for (uint8_t i = 0; i < PAD_PROFILE_GC_AXES; i++)
+	{
+		const uint8_t source = profile->axis_sources[i];
+		axes[i] = source < PAD_AXES ? pad->axes[source] : neutral_axes[i];
+	}
+
+	for (uint8_t i = 0; i < profile->button_axes; i++)
+	{
+		if (buttons & profile->button_axis[i].mask)
+			axes[profile->button_axis[i].axis] = profile->button_axis[i].value;
+	}
+
+	gc.xStick = axes[MAP_GAMECUBE_AXIS_X - MAP_GAMECUBE_AXIS_X];
+	gc.yStick = axes[MAP_GAMECUBE_AXIS_Y - MAP_GAMECUBE_AXIS_X];
+	gc.cxStick = axes[MAP_GAMECUBE_AXIS_CX - MAP_GAMECUBE_AXIS_X];
+	gc.cyStick = axes[MAP_GAMECUBE_AXIS_CY - MAP_GAMECUBE_AXIS_X];
+	gc.analogL = axes[MAP_GAMECUBE_AXIS_L - MAP_GAMECUBE_AXIS_X];
+	gc.analogR = axes[MAP_GAMECUBE_AXIS_R - MAP_GAMECUBE_AXIS_X];
+
+	return gc;
+}
+
+GCReport HOT_PATH(pad_profile_report)(const canonical_pad* pad, uint8_t source, uint8_t slot)
+{
+	const uint8_t slot_bit = 1 << (slot & 7);
+
+	canonical_pad mapped = *pad;
+	pad_condition(&mapped, source, slot);
+
+	// Chord state is read-modify-write: handled on core1 only. Mega Drive pad is read on Joybus core and has no SELECT.
+	if (source == PAD_SOURCE_MEGA_DRIVE)
+		return map_profile(g_active, &mapped);
+
+	if ((pad->buttons & PAD_PROFILE_CHORD) == PAD_PROFILE_CHORD)
+	{
+		if (!(g_chord_held & slot_bit))
+		{
+			pad_profile_select((g_active_index + 1) % pad_profiles_count);
+			g_switched = true;
+		}
+
+		g_chord_held |= slot_bit;
+		mapped.buttons &= ~PAD_PROFILE_CHORD;
+	}
+	else
+		g_chord_held &= ~slot_bit;
+
+	return map_profile(g_active, &mapped);
+}
+
+void pad_profile_task()
+{
+	if (!g_switched)
+		return;
+
+	g_switched = false;
+
+	const uint8_t index = g_active_index;
+	printf("PROFILE %u %s\n", index, pad_profiles[index].name);
+}
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "communication_protocols/joybus/gcReport.hpp"
+
+/*
+Canonical pad and GameCube mapping profiles.
+
+Every input source (HID parser and generated decoders, DualShock 3, XInput, Mega Drive) reports controls
+of one standard pad layout, single table-driven stage maps canonical pad to GCReport.
+Profiles (pad_profiles[] in canonical_pad.cpp) are compiled once at boot to button masks and axis sources.
+Sticks and triggers are conditioned per source before mapping (pad_conditioning.h).
+Holding SELECT + START switches to next profile by swapping profile pointer: report descriptor is not reparsed,
+chord buttons are not passed to GameCube while held. Chord is handled for USB sources only, which report on core1:
+Mega Drive pad (no SELECT) is mapped on Joybus core and only reads active profile pointer.
+Profiles with digital_triggers (trigger_click) make digital L2 / R2 pressed with no analog trigger travel a full analog press.
+
+Prints over stdio UART on switch:
+	PROFILE <index> <name>
+*/
+
+enum PadControls : uint8_t
+{
+	PAD_BUTTON_SOUTH, // Cross, Xbox A, Mega Drive A
+	PAD_BUTTON_EAST, // Circle, Xbox B, Mega Drive B
+	PAD_BUTTON_WEST, // Square, Xbox X, Mega Drive X
+	PAD_BUTTON_NORTH, // Triangle, Xbox Y, Mega Drive Y
+	PAD_BUTTON_L1,
+	PAD_BUTTON_R1, // Mega Drive Mode
+	PAD_BUTTON_L2, // Digital trigger, Mega Drive Z
+	PAD_BUTTON_R2, // Digital trigger, Mega Drive C
+	PAD_BUTTON_SELECT, // Share, Create, Back
+	PAD_BUTTON_START, // Options, Start
+	PAD_BUTTON_L3,
+	PAD_BUTTON_R3,
+	PAD_BUTTON_HOME, // PS, Guide
+	PAD_BUTTON_UP,
+	PAD_BUTTON_DOWN,
+	PAD_BUTTON_LEFT,
+	PAD_BUTTON_RIGHT,
+	PAD_AXIS_LX, // 0 = Left, 255 = Right
+	PAD_AXIS_LY, // 0 = Down, 255 = Up
+	PAD_AXIS_RX,
+	PAD_AXIS_RY,
+	PAD_AXIS_LT, // 0 = Released, 255 = Fully Pressed
+	PAD_AXIS_RT
+};
+
+#define PAD_BUTTONS (PAD_BUTTON_RIGHT + 1)
+#define PAD_AXES (PAD_AXIS_RT - PAD_AXIS_LX + 1)
+
+typedef struct canonical_pad
+{
+	uint32_t buttons; // 1 << PAD_BUTTON_*
+	uint8_t axes[PAD_AXES];
+} canonical_pad;
+
+#define PAD_AXIS(pad, axis) ((pad)->axes[(axis) - PAD_AXIS_LX])
+
+const canonical_pad neutralCanonicalPad = { 0, { 128, 128, 128, 128, 0, 0 } };
+
+// Canonical pad reporters, select analog conditioning (pad_conditioning.h).
+enum PadSources : uint8_t
+{
+	PAD_SOURCE_HID, // HID parser and generated decoders
+	PAD_SOURCE_DUALSHOCK3,
+	PAD_SOURCE_XINPUT,
+	PAD_SOURCE_MEGA_DRIVE // No analog controls
+};
+
+#define PAD_ANALOG_SOURCES PAD_SOURCE_MEGA_DRIVE
+
+// GameCube controls, profile outputs.
+enum GamecubeMappings : uint8_t
+{
+	MAP_GAMECUBE_BUTTON_A,
+	MAP_GAMECUBE_BUTTON_B,
+	MAP_GAMECUBE_BUTTON_X,
+	MAP_GAMECUBE_BUTTON_Y,
+	MAP_GAMECUBE_BUTTON_START,
+	MAP_GAMECUBE_R,
+	MAP_GAMECUBE_L,
+	MAP_GAMECUBE_D,
+	MAP_GAMECUBE_U,
+	MAP_GAMECUBE_BUTTON_Z,
+	MAP_GAMECUBE_BUTTON_R,
+	MAP_GAMECUBE_BUTTON_L,
+	MAP_GAMECUBE_AXIS_X,
+	MAP_GAMECUBE_AXIS_Y,
+	MAP_GAMECUBE_AXIS_CX,
+	MAP_GAMECUBE_AXIS_CY,
+	MAP_GAMECUBE_AXIS_L,
+	MAP_GAMECUBE_AXIS_R
+};
+
+// Profile entry: GameCube button from canonical button or axis above param,
+// GameCube axis from canonical axis or param while canonical button is pressed.
+// Several entries of one GameCube button are OR'ed, last entry of GameCube axis wins.
+typedef struct pad_profile_entry
+{
+	uint8_t output; // GamecubeMappings
+	uint8_t source; // PadControls
+	uint8_t param;
+} pad_profile_entry;
+
+typedef struct pad_profile
+{
+	const char* name;
+	const pad_profile_entry* entries;
+	uint8_t count;
+	bool digital_triggers; // Digital L2 / R2 pressed with no analog trigger travel is full analog press
+} pad_profile;
+
+extern const pad_profile pad_profiles[];
+extern const uint8_t pad_profiles_count;
+
+// Set canonical control from value reported by ParseReport() gamepad callback:
+// button is pressed on any value, HID Y axes (0 = Up) are flipped.
+void canonical_pad_apply(canonical_pad* pad, uint32_t control_type, uint32_t value);
+
+// Compile profiles and conditioning tables, select first profile. Call once before first pad_profile_report().
+void pad_profiles_init();
+
+// Active profile index.
+uint8_t pad_profile_active();
+
+// Select profile, returns false if index is out of range.
+bool pad_profile_select(uint8_t index);
+
+// Handle profile switch chord, condition analog controls of source and map canonical pad with active profile.
+// Chord press is tracked per controller slot (controller_slots.h), slots 0..CONTROLLER_SLOTS - 1. Call on core1, PAD_SOURCE_MEGA_DRIVE on any core.
+GCReport pad_profile_report(const canonical_pad* pad, uint8_t source, uint8_t slot = 0);
+
+// Print profile switch. Call from core1 loop.
+void pad_profile_task();
@@ -1,40 +1,34 @@
 #include "communication_protocols/joybus.hpp"
+#include "communication_protocols/joybus/capture.hpp"
+#include "communication_protocols/joybus/encoder.hpp"
+#include "communication_protocols/joybus/reply_stats.hpp"
 
 #include "hardware/gpio.h"
 
 #include "hardware/pio.h"
 #include "my_pio.pio.h"
 
-// PIO Shifts to the right by default
-// In: pushes batches of 8 shifted left, i.e we get [0x40, 0x03, rumble (the end bit is never pushed)]
-// Out: We push commands for a right shift with an enable pin, ie 5 (101) would be 0b11'10'11
-// So in doesn't need post processing but out does
-void convertToPio(const uint8_t *command, const int len, uint32_t *result,
-		int &resultLen) {
-	if (len == 0) {
-		resultLen = 0;
-		return;
-	}
-	resultLen = len / 2 + 1;
-	int i;
-	for (i = 0; i < resultLen; i++) {
-		result[i] = 0;
-	}
-	for (i = 0; i < len; i++) {
-		for (int j = 0; j < 8; j++) {
-			result[i / 2] += 1 << (2 * (8 * (i % 2) + j) + 1);
-			result[i / 2] += (!!(command[i] & (0x80u >> j)))
-					<< (2 * (8 * (i % 2) + j));
-		}
-	}
-	// End bit
-	result[len / 2] += 3 << (2 * (8 * (len % 2)));
-}
+#include "../hot_path.h"
+#include "../decoder_cache.h"
+#include "../boot_timeline.h"
+#include "../rumble.h"
 
 namespace CommunicationProtocols {
 namespace Joybus {
 
-void enterMode(std::function<GCReport()> func) {
+// Same as pio_sm_init(), built from inline SDK functions: pio_sm_init() is linked to flash
+static __force_inline void restartStateMachine(PIO pio, uint sm, uint initialPc, const pio_sm_config *config) {
+	pio_sm_set_enabled(pio, sm, false);
+	pio_sm_set_config(pio, sm, config);
+	pio_sm_clear_fifos(pio, sm);
+	pio->fdebug = ((1u << PIO_FDEBUG_TXOVER_LSB) | (1u << PIO_FDEBUG_RXUNDER_LSB) |
+			(1u << PIO_FDEBUG_TXSTALL_LSB) | (1u << PIO_FDEBUG_RXSTALL_LSB)) << sm;
+	pio_sm_restart(pio, sm);
+	pio_sm_clkdiv_restart(pio, sm);
+	pio_sm_exec(pio, sm, pio_encode_jmp(initialPc));
+}
+
+void HOT_PATH(enterMode)(std::function<GCReport()> func) {
 	gpio_init(dataPin);
 	gpio_set_dir(dataPin, GPIO_IN);
 	gpio_pull_up(dataPin);
@@ -52,30 +46,54 @@ void enterMode(std::function<GCReport()> func) {
 	sm_config_set_in_pins(&config, dataPin);
 	sm_config_set_out_pins(&config, dataPin, 1);
 	sm_config_set_set_pins(&config, dataPin, 1);
+#if PIO_USB_HOST
+	sm_config_set_clkdiv(&config, 5); // Integer divider: pio clock 120 / 5 = 24 MHz, 4.17 us bit cell (pio_usb_host.h)
+#else
 	sm_config_set_clkdiv(&config, 6); // Keep pio clock to 150 / 6 = 25 MHz
+#endif
 	sm_config_set_out_shift(&config, true, false, 32);
 	sm_config_set_in_shift(&config, false, true, 8);
 
+	pio_sm_claim(pio, 0); // Keep state machine 0 from spare state machine users
 	pio_sm_init(pio, 0, offset, &config);
 	pio_sm_set_enabled(pio, 0, true);
 
+	captureInit(pio, dataPin);
+	replyStatsInit();
+
+	boot_timeline_event(BOOT_EVENT_JOYBUS_ARMED);
+
+#if DECODER_CACHE
+	uint32_t lastCommand = time_us_32();
+#endif
+
 	while (true) {
 		uint8_t buffer[3];
+#if DECODER_CACHE
+		// Decoder cache flash writes wait for Joybus idle
+		while (pio_sm_is_rx_fifo_empty(pio, 0))
+			decoder_cache_park_idle(lastCommand);
+#endif
 		buffer[0] = pio_sm_get_blocking(pio, 0);
+#if DECODER_CACHE
+		lastCommand = time_us_32();
+#endif
 
 		if (buffer[0] == 0) { // Probe
 			uint8_t probeResponse[3] = { 0x09, 0x00, 0x03 };
 			uint32_t result[2];
 			int resultLen;
 			convertToPio(probeResponse, 3, result, resultLen);
-			sleep_us(6); // 3.75us into the bit before end bit => 6.25 to wait if the end-bit is 5us long
+			busy_wait_us_32(6); // 3.75us into the bit before end bit => 6.25 to wait if the end-bit is 5us long
 
 			pio_sm_set_enabled(pio, 0, false);
-			pio_sm_init(pio, 0, offset + save_offset_outmode, &config);
+			restartStateMachine(pio, 0, offset + save_offset_outmode, &config);
 			pio_sm_set_enabled(pio, 0, true);
 
 			for (int i = 0; i < resultLen; i++)
 				pio_sm_put_blocking(pio, 0, result[i]);
+
+			boot_timeline_event(BOOT_EVENT_FIRST_PROBE_REPLY);
 		} else if (buffer[0] == 0x41) { // Origin (NOT 0x81)
 			gpio_put(25, 1);
 			uint8_t originResponse[10] = { 0x00, 0x80, 128, 128, 128, 128, 0, 0,
@@ -86,15 +104,22 @@ void enterMode(std::function<GCReport()> func) {
 			// Here we don't wait because convertToPio takes time
 
 			pio_sm_set_enabled(pio, 0, false);
-			pio_sm_init(pio, 0, offset + save_offset_outmode, &config);
+			restartStateMachine(pio, 0, offset + save_offset_outmode, &config);
 			pio_sm_set_enabled(pio, 0, true);
 
 			for (int i = 0; i < resultLen; i++)
 				pio_sm_put_blocking(pio, 0, result[i]);
+
+			boot_timeline_event(BOOT_EVENT_FIRST_ORIGIN_REPLY);
 		} else if (buffer[0] == 0x40) { // Maybe poll //TODO Check later inputs...
 			buffer[0] = pio_sm_get_blocking(pio, 0);
 			buffer[0] = pio_sm_get_blocking(pio, 0);
+			const uint32_t pollReceived = replyStatsTimestamp();
 			gpio_put(rumblePin, buffer[0] & 1);
+			rumble_post(buffer[0] & 1);
+
+			if (JOYBUS_CAPTURE_TRIGGER & JOYBUS_CAPTURE_TRIGGER_POLL)
+				captureTrigger(0x40);
 
 			GCReport gcReport = func();
 
@@ -103,15 +128,25 @@ void enterMode(std::function<GCReport()> func) {
 			convertToPio((uint8_t*) (&gcReport), 8, result, resultLen);
 
 			pio_sm_set_enabled(pio, 0, false);
-			pio_sm_init(pio, 0, offset + save_offset_outmode, &config);
+			restartStateMachine(pio, 0, offset + save_offset_outmode, &config);
 			pio_sm_set_enabled(pio, 0, true);
+			const uint32_t replyStarted = replyStatsTimestamp();
 
 			for (int i = 0; i < resultLen; i++)
 				pio_sm_put_blocking(pio, 0, result[i]);
+
+			replyStatsRecord(pollReceived, replyStarted);
+			boot_timeline_event(BOOT_EVENT_FIRST_POLL_REPLY);
+
+			// Next poll is milliseconds away: time for decoder cache flash page program
+			decoder_cache_park_after_reply();
 		} else {
+			if (JOYBUS_CAPTURE_TRIGGER & JOYBUS_CAPTURE_TRIGGER_UNEXPECTED)
+				captureTrigger(buffer[0]);
+
 			pio_sm_set_enabled(pio, 0, false);
-			sleep_us(400);
-			pio_sm_init(pio, 0, offset + save_offset_inmode, &config);
+			busy_wait_us_32(400); // sleep_us() would add alarm to the default pool
+			restartStateMachine(pio, 0, offset + save_offset_inmode, &config);
 			pio_sm_set_enabled(pio, 0, true);
 		}
 	}
@@ -0,0 +1,130 @@
+#include "communication_protocols/joybus/capture.hpp"
+
+#if JOYBUS_CAPTURE
+
+#include <stdio.h>
+
+#include "hardware/clocks.h"
+#include "hardware/dma.h"
+#include "hardware/sync.h"
+
+#include "joybus_capture.pio.h"
+
+#include "../hot_path.h"
+
+namespace CommunicationProtocols {
+namespace Joybus {
+
+constexpr uint32_t captureBufferSize = 1u << JOYBUS_CAPTURE_BUFFER_BITS;
+constexpr uint32_t captureWords = captureBufferSize / sizeof(uint32_t);
+
+enum CaptureState : uint8_t {
+	CAPTURE_OFF,
+	CAPTURE_ARMED,
+	CAPTURE_TRIGGERED
+};
+
+// DMA ring writes wrap on buffer size boundary, so the buffer must be aligned to its size
+static uint32_t captureBuffer[captureWords] __attribute__((aligned(captureBufferSize)));
+
+static PIO capturePio;
+static int captureSm = -1;
+static int captureDma = -1;
+static uint captureOffset;
+static pio_sm_config captureConfig;
+
+static volatile uint8_t captureState = CAPTURE_OFF;
+static volatile uint32_t triggerAddress; // DMA write address at trigger
+static volatile uint32_t triggerRemaining; // DMA remaining transfer count at trigger
+static volatile uint8_t triggerCommand;
+
+static void captureStart() {
+	pio_sm_set_enabled(capturePio, captureSm, false);
+	pio_sm_init(capturePio, captureSm, captureOffset, &captureConfig);
+
+	dma_channel_config config = dma_channel_get_default_config(captureDma);
+	channel_config_set_transfer_data_size(&config, DMA_SIZE_32);
+	channel_config_set_read_increment(&config, false);
+	channel_config_set_write_increment(&config, true);
+	channel_config_set_ring(&config, true, JOYBUS_CAPTURE_BUFFER_BITS);
+	channel_config_set_dreq(&config, pio_get_dreq(capturePio, captureSm, false));
+
+	// Runs for hours at 4 MHz / 32 samples per word before transfer count expires
+	dma_channel_configure(captureDma, &config, captureBuffer, &capturePio->rxf[captureSm], 0xFFFFFFFF, true);
+
+	pio_sm_set_enabled(capturePio, captureSm, true);
+
+	captureState = CAPTURE_ARMED;
+}
+
+void captureInit(PIO pio, uint pin) {
+	captureSm = pio_claim_unused_sm(pio, false);
+	captureDma = dma_claim_unused_channel(false);
+
+	if (captureSm < 0 || captureDma < 0 || !pio_can_add_program(pio, &joybus_capture_program)) {
+		printf("Joybus capture: no free state machine, DMA channel or PIO memory\n");
+		return;
+	}
+
+	capturePio = pio;
+	captureOffset = pio_add_program(pio, &joybus_capture_program);
+
+	captureConfig = joybus_capture_program_get_default_config(captureOffset);
+	sm_config_set_in_pins(&captureConfig, pin);
+	sm_config_set_in_shift(&captureConfig, false, true, 32);
+	sm_config_set_fifo_join(&captureConfig, PIO_FIFO_JOIN_RX);
+	sm_config_set_clkdiv(&captureConfig, (float)clock_get_hz(clk_sys) / JOYBUS_CAPTURE_SAMPLE_HZ);
+
+	captureStart();
+}
+
+void HOT_PATH(captureTrigger)(uint8_t command) {
+	if (captureState != CAPTURE_ARMED)
+		return;
+
+	triggerAddress = dma_hw->ch[captureDma].write_addr;
+	triggerRemaining = dma_hw->ch[captureDma].transfer_count;
+	triggerCommand = command;
+	__dmb();
+	captureState = CAPTURE_TRIGGERED;
+}
+
+void captureTask() {
+	if (captureState != CAPTURE_TRIGGERED)
+		return;
+
+	// Keep half of the buffer before trigger, half after
+	const uint32_t wordsAfterTrigger = triggerRemaining - dma_hw->ch[captureDma].transfer_count;
+
+	if (wordsAfterTrigger < captureWords / 2)
+		return;
+
+	dma_channel_abort(captureDma);
+	pio_sm_set_enabled(capturePio, captureSm, false);
+
+	if (wordsAfterTrigger >= captureWords) {
+		// Core1 was blocked too long (e.g. blocking USB control transfer), trigger samples overwritten
+		printf("JBCAP LOST command=%02x\n", triggerCommand);
+		captureStart();
+		return;
+	}
+
+	// Oldest sample is at current write position
+	const uint32_t start = ((dma_hw->ch[captureDma].write_addr - (uint32_t)captureBuffer) / sizeof(uint32_t)) & (captureWords - 1);
+	const uint32_t trigger = ((triggerAddress - (uint32_t)captureBuffer) / sizeof(uint32_t) - start) & (captureWords - 1);
+
+	printf("JBCAP BEGIN rate=%u words=%lu trigger=%lu command=%02x\n",
+		JOYBUS_CAPTURE_SAMPLE_HZ, (unsigned long)captureWords, (unsigned long)trigger, triggerCommand);
+
+	for (uint32_t i = 0; i < captureWords; i++)
+		printf("%08lx%c", (unsigned long)captureBuffer[(start + i) & (captureWords - 1)], (i % 8 == 7) ? '\n' : ' ');
+
+	printf("JBCAP END\n");
+
+	captureStart();
+}
+
+}
+}
+
+#endif
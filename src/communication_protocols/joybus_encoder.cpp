@@ -0,0 +1,29 @@
+#include "communication_protocols/joybus/encoder.hpp"
+
+#include "../hot_path.h"
+
+// PIO Shifts to the right by default
+// In: pushes batches of 8 shifted left, i.e we get [0x40, 0x03, rumble (the end bit is never pushed)]
+// Out: We push commands for a right shift with an enable pin, ie 5 (101) would be 0b11'10'11
+// So in doesn't need post processing but out does
+void HOT_PATH(convertToPio)(const uint8_t *command, const int len, uint32_t *result,
+		int &resultLen) {
+	if (len == 0) {
+		resultLen = 0;
+		return;
+	}
+	resultLen = len / 2 + 1;
+	int i;
+	for (i = 0; i < resultLen; i++) {
+		result[i] = 0;
+	}
+	for (i = 0; i < len; i++) {
+		for (int j = 0; j < 8; j++) {
+			result[i / 2] += 1 << (2 * (8 * (i % 2) + j) + 1);
+			result[i / 2] += (!!(command[i] & (0x80u >> j)))
+					<< (2 * (8 * (i % 2) + j));
+		}
+	}
+	// End bit
+	result[len / 2] += 3 << (2 * (8 * (len % 2)));
+}
@@ -0,0 +1,108 @@
+#include "communication_protocols/joybus/reply_stats.hpp"
+
+#if JOYBUS_REPLY_STATS
+
+#include <math.h>
+#include <stdio.h>
+
+#include "hardware/clocks.h"
+#include "hardware/structs/xip_ctrl.h"
+#include "hardware/sync.h"
+
+#include "../hot_path.h"
+
+namespace CommunicationProtocols {
+namespace Joybus {
+
+constexpr uint32_t systickMask = 0x00FFFFFF;
+
+struct ReplyStats {
+	uint32_t polls;
+	uint32_t min; // Cycles
+	uint32_t max;
+	uint64_t sum;
+	uint64_t sumSquares;
+	uint32_t xipAccesses; // Both cores, whole window
+	uint32_t xipHits;
+};
+
+static ReplyStats current; // Accumulated by Joybus core
+static ReplyStats published; // Last complete window, read by core1
+static volatile uint32_t publishedSequence; // Odd while Joybus core updates published window
+static uint32_t printedSequence;
+
+static void HOT_PATH(resetWindow)() {
+	current = {};
+	current.min = UINT32_MAX;
+
+	// Any write clears counter
+	xip_ctrl_hw->ctr_acc = 0;
+	xip_ctrl_hw->ctr_hit = 0;
+}
+
+void replyStatsInit() {
+	// SysTick is not used by SDK: reload at 24-bit maximum, count core clock, no interrupt
+	systick_hw->rvr = systickMask;
+	systick_hw->cvr = 0;
+	systick_hw->csr = M0PLUS_SYST_CSR_CLKSOURCE_BITS | M0PLUS_SYST_CSR_ENABLE_BITS;
+
+	resetWindow();
+}
+
+void HOT_PATH(replyStatsRecord)(uint32_t pollReceived, uint32_t replyStarted) {
+	const uint32_t cycles = (pollReceived - replyStarted) & systickMask; // Down counter
+
+	current.polls++;
+	current.sum += cycles;
+	current.sumSquares += (uint64_t)cycles * cycles;
+
+	if (cycles < current.min)
+		current.min = cycles;
+	if (cycles > current.max)
+		current.max = cycles;
+
+	if (current.polls < JOYBUS_REPLY_STATS_WINDOW)
+		return;
+
+	current.xipAccesses = xip_ctrl_hw->ctr_acc;
+	current.xipHits = xip_ctrl_hw->ctr_hit;
+
+	publishedSequence = publishedSequence + 1;
+	__dmb();
+	published = current;
+	__dmb();
+	publishedSequence = publishedSequence + 1;
+
+	resetWindow();
+}
+
+void replyStatsTask() {
+	const uint32_t sequence = publishedSequence;
+
+	if (sequence == printedSequence || (sequence & 1))
+		return;
+
+	__dmb();
+	const ReplyStats stats = published;
+	__dmb();
+
+	if (publishedSequence != sequence)
+		return; // Window published while copying, take next one
+
+	printedSequence = sequence;
+
+	const double nsPerCycle = 1e9 / clock_get_hz(clk_sys);
+	const double mean = (double)stats.sum / stats.polls;
+	const double variance = (double)stats.sumSquares / stats.polls - mean * mean;
+
+	printf("JBSTAT polls=%lu min_ns=%.0f max_ns=%.0f mean_ns=%.1f stddev_ns=%.1f xip_acc=%lu xip_hit=%lu\n",
+		(unsigned long)stats.polls,
+		stats.min * nsPerCycle, stats.max * nsPerCycle,
+		mean * nsPerCycle, sqrt(variance > 0 ? variance : 0) * nsPerCycle,
+		(unsigned long)stats.xipAccesses, (unsigned long)stats.xipHits);
+}
+
+}
+}
+
+#endif
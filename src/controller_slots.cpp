@@ -0,0 +1,108 @@
+#include "controller_slots.h"
+
+#include "pico/stdlib.h"
+#include "pico/sync.h"
+
+#include "hot_path.h"
+
+static GCReport g_slots[CONTROLLER_SLOTS];
+static spin_lock_t* g_lock = nullptr;
+static uint8_t g_claimed = 0; // Core1 only
+static uint8_t g_joybus_slot = CONTROLLER_SLOTS; // Slot answered to console, written on core1 under lock
+
+void controller_slots_init()
+{
+	uint lock_num = spin_lock_claim_unused(true);  // Low-level: returns uint ID; panic if none free
+	if (lock_num == (uint)-1) // No free locks (rare, but check)
+	{
+		panic("No free spinlocks available!");
+	}
+	g_lock = spin_lock_init(lock_num);   // High-level: convert uint to spin_lock_t*
+
+	for (GCReport& slot : g_slots)
+		slot = defaultGcReport;
+}
+
+void HOT_PATH(controller_slot_publish)(uint8_t slot, const GCReport& report)
+{
+	if (slot >= CONTROLLER_SLOTS)
+		return;
+
+	spin_lock_unsafe_blocking(g_lock);
+	g_slots[slot] = report;
+	spin_unlock_unsafe(g_lock);
+}
+
+GCReport HOT_PATH(controller_slot_read)(uint8_t slot)
+{
+	if (slot >= CONTROLLER_SLOTS)
+		return defaultGcReport;
+
+	spin_lock_unsafe_blocking(g_lock);
+	const GCReport report = g_slots[slot];
+	spin_unlock_unsafe(g_lock);
+
+	return report;
+}
+
+GCReport HOT_PATH(controller_slot_read_joybus)()
+{
+	spin_lock_unsafe_blocking(g_lock);
+	const GCReport report = g_joybus_slot < CONTROLLER_SLOTS ? g_slots[g_joybus_slot] : defaultGcReport;
+	spin_unlock_unsafe(g_lock);
+
+	return report;
+}
+
+// Joybus keeps its slot while claimed, otherwise moves to lowest claimed slot.
+static void update_joybus_slot()
+{
+	uint8_t slot = g_joybus_slot;
+
+	if (slot >= CONTROLLER_SLOTS || !(g_claimed & (1u << slot)))
+	{
+		for (slot = 0; slot < CONTROLLER_SLOTS && !(g_claimed & (1u << slot)); slot++)
+			;
+	}
+
+	spin_lock_unsafe_blocking(g_lock);
+	g_joybus_slot = slot;
+	spin_unlock_unsafe(g_lock);
+}
+
+uint8_t controller_slots_claim(uint8_t count)
+{
+	if (!count || count > CONTROLLER_SLOTS)
+		return CONTROLLER_SLOTS;
+
+	const uint8_t mask = (uint8_t)((1u << count) - 1);
+
+	for (uint8_t first = 0; first + count <= CONTROLLER_SLOTS; first++)
+	{
+		if (!(g_claimed & (mask << first)))
+		{
+			g_claimed |= (uint8_t)(mask << first);
+			update_joybus_slot();
+
+			return first;
+		}
+	}
+
+	return CONTROLLER_SLOTS;
+}
+
+void controller_slots_release(uint8_t first, uint8_t count)
+{
+	for (uint8_t slot = first; slot < first + count && slot < CONTROLLER_SLOTS; slot++)
+	{
+		g_claimed &= (uint8_t)~(1u << slot);
+		controller_slot_publish(slot, defaultGcReport);
+	}
+
+	update_joybus_slot();
+}
+
+uint8_t controller_slots_claimed()
+{
+	return g_claimed;
+}
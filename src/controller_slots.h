@@ -0,0 +1,41 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "communication_protocols/joybus/gcReport.hpp"
+
+/*
+Controller slots: latest GCReport of every pad, shared between USB host core and Joybus core.
+
+Every mounted device claims consecutive free slots, lowest first, one per pad: HID joystick / gamepad application
+collection (hid_parser_report_pads()), XInput interface instance (Xbox 360 wireless receiver). Pad N of device publishes
+to its first slot + N on its own reports, at full report rate, so devices on both USB ports never overwrite each other.
+
+Joybus port answers with one slot: the lowest claimed slot when nothing was answered, kept while its device stays mounted.
+When that slot is released Joybus moves to the lowest slot still claimed, so a pad left on the other USB port reaches
+console. Pads in other slots are decoded and published but don't reach console. Slot freed by unmount is neutral
+and is claimed by next mounted device.
+*/
+
+#define CONTROLLER_SLOTS 4
+
+// Claim spinlock and set slots to neutral report. Call on core1 before inputs are ready.
+void controller_slots_init();
+
+// Slots beyond CONTROLLER_SLOTS are ignored.
+void controller_slot_publish(uint8_t slot, const GCReport& report);
+
+GCReport controller_slot_read(uint8_t slot);
+
+// Report answered to console, neutral report while no slot is claimed.
+GCReport controller_slot_read_joybus();
+
+// Claim count consecutive free slots for pads of mounted device. Call on core1.
+// Returns first slot, CONTROLLER_SLOTS if there is no room.
+uint8_t controller_slots_claim(uint8_t count);
+
+// Release slots claimed by unmounted device and set them to neutral report. Call on core1.
+void controller_slots_release(uint8_t first, uint8_t count);
+
+// Bitmask of claimed slots.
+uint8_t controller_slots_claimed();
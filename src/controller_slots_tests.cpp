@@ -0,0 +1,65 @@
+#include <cassert>
+#include <string.h>
+
+#include "controller_slots.h"
+
+/*
+Test of controller slot claiming and of the slot answered to console (controller_slot_read_joybus()) when devices
+on both USB ports are plugged and unplugged in any order. Spinlocks are sim/include stand-ins.
+*/
+
+static bool same_report(const GCReport& a, const GCReport& b)
+{
+	return !memcmp(&a, &b, sizeof(GCReport));
+}
+
+int main()
+{
+	controller_slots_init();
+	assert(same_report(controller_slot_read_joybus(), defaultGcReport));
+
+	GCReport pad_a = defaultGcReport;
+	pad_a.a = 1;
+	GCReport pad_b = defaultGcReport;
+	pad_b.b = 1;
+	GCReport pad_c = defaultGcReport;
+	pad_c.x = 1;
+
+	// Claim A, claim B, release A: console gets B instead of released slot
+	const uint8_t slot_a = controller_slots_claim(1);
+	const uint8_t slot_b = controller_slots_claim(1);
+	assert(slot_a == 0 && slot_b == 1);
+
+	controller_slot_publish(slot_a, pad_a);
+	controller_slot_publish(slot_b, pad_b);
+	assert(same_report(controller_slot_read_joybus(), pad_a));
+
+	controller_slots_release(slot_a, 1);
+	assert(same_report(controller_slot_read(slot_a), defaultGcReport));
+	assert(same_report(controller_slot_read_joybus(), pad_b));
+
+	// Device plugged meanwhile takes the free lower slot, console stays on B
+	const uint8_t slot_c = controller_slots_claim(1);
+	assert(slot_c == 0);
+
+	controller_slot_publish(slot_c, pad_c);
+	assert(same_report(controller_slot_read_joybus(), pad_b));
+
+	controller_slots_release(slot_b, 1);
+	assert(same_report(controller_slot_read_joybus(), pad_c));
+
+	controller_slots_release(slot_c, 1);
+	assert(!controller_slots_claimed());
+	assert(same_report(controller_slot_read_joybus(), defaultGcReport));
+
+	// Multi-pad device claims consecutive slots, no room for more pads than free slots
+	const uint8_t slot_single = controller_slots_claim(1);
+	const uint8_t slot_multi = controller_slots_claim(3);
+	assert(slot_single == 0 && slot_multi == 1);
+	assert(controller_slots_claim(1) == CONTROLLER_SLOTS);
+
+	controller_slots_release(slot_single, 1);
+	assert(controller_slots_claim(2) == CONTROLLER_SLOTS);
+
+	return 0;
+}
@@ -0,0 +1,270 @@
+#include "decoder_cache.h"
+
+#if DECODER_CACHE
+
+#include <stdio.h>
+#include <string.h>
+
+#include "pico/stdlib.h"
+#include "hardware/flash.h"
+#include "hardware/sync.h"
+
+#include "tusb.h"
+
+#include "hid_parser.h"
+
+#define DECODER_CACHE_OFFSET (PICO_FLASH_SIZE_BYTES - DECODER_CACHE_SECTORS * FLASH_SECTOR_SIZE)
+#define DECODER_CACHE_SIZE (DECODER_CACHE_SECTORS * FLASH_SECTOR_SIZE)
+#define DECODER_CACHE_MAGIC 0x43444D53 // "SMDC", erased flash reads 0xFFFFFFFF
+
+typedef struct decoder_cache_record
+{
+	uint32_t magic;
+	uint16_t vid;
+	uint16_t pid;
+	uint32_t hash; // hid_parser_hash()
+	uint16_t size; // Image bytes following header
+	uint16_t pages; // Record length in flash pages
+	uint32_t check; // FNV-1a of image: detects record interrupted by power loss
+} decoder_cache_record;
+
+volatile uint8_t decoder_cache_request = DECODER_CACHE_REQUEST_NONE;
+uint32_t decoder_cache_last_reply_us = 0;
+uint8_t decoder_cache_wide_polls = 0;
+static volatile bool g_parked = false;
+
+static uint32_t g_append = 0; // Log end offset, DECODER_CACHE_SIZE if log is full or corrupted
+
+// Record waiting for write
+static uint8_t g_pending[DECODER_CACHE_RECORD_PAGES * FLASH_PAGE_SIZE];
+static uint16_t g_pending_pages = 0; // 0 - no record
+static uint16_t g_pending_written = 0;
+
+static uint8_t g_erase_next = DECODER_CACHE_SECTORS; // Next sector to erase, DECODER_CACHE_SECTORS if none
+
+static uint64_t g_mount_us = 0; // Mount start, 0 if first report time is printed
+static bool g_hit = false;
+
+static const uint8_t* log_data(uint32_t offset)
+{
+	return (const uint8_t*)(XIP_BASE + DECODER_CACHE_OFFSET + offset);
+}
+
+static uint32_t image_check(const uint8_t* image, uint16_t size)
+{
+	uint32_t hash = 2166136261u;
+
+	for (uint16_t i = 0; i < size; i++)
+		hash = (hash ^ image[i]) * 16777619u;
+
+	return hash;
+}
+
+static bool record_valid(const decoder_cache_record* record)
+{
+	return record->pages && record->pages <= DECODER_CACHE_RECORD_PAGES &&
+		sizeof(decoder_cache_record) + record->size <= record->pages * FLASH_PAGE_SIZE;
+}
+
+void decoder_cache_init()
+{
+	g_append = 0;
+
+	while (g_append < DECODER_CACHE_SIZE)
+	{
+		decoder_cache_record record;
+		memcpy(&record, log_data(g_append), sizeof(record));
+
+		if (record.magic != DECODER_CACHE_MAGIC)
+			break; // Erased page: log end
+
+		if (!record_valid(&record))
+		{
+			g_append = DECODER_CACHE_SIZE; // Corrupted, erase log on next store
+			break;
+		}
+
+		g_append += record.pages * FLASH_PAGE_SIZE;
+	}
+}
+
+// Latest record with key, nullptr if none.
+static const uint8_t* find_record(uint16_t vid, uint16_t pid, uint32_t hash)
+{
+	const uint8_t* found = nullptr;
+
+	for (uint32_t offset = 0; offset < g_append && offset < DECODER_CACHE_SIZE; )
+	{
+		decoder_cache_record record;
+		memcpy(&record, log_data(offset), sizeof(record));
+
+		if (record.magic != DECODER_CACHE_MAGIC || !record_valid(&record))
+			break;
+
+		const uint8_t* image = log_data(offset) + sizeof(record);
+
+		if (record.vid == vid && record.pid == pid && record.hash == hash && record.check == image_check(image, record.size))
+			found = log_data(offset);
+
+		offset += record.pages * FLASH_PAGE_SIZE;
+	}
+
+	// Record not written yet
+	if (g_pending_pages)
+	{
+		decoder_cache_record record;
+		memcpy(&record, g_pending, sizeof(record));
+
+		if (record.vid == vid && record.pid == pid && record.hash == hash)
+			found = g_pending;
+	}
+
+	return found;
+}
+
+bool decoder_cache_load(uint16_t vid, uint16_t pid, uint32_t hash)
+{
+	g_mount_us = time_us_64();
+
+	const uint8_t* data = find_record(vid, pid, hash);
+
+	decoder_cache_record record;
+
+	if (data)
+		memcpy(&record, data, sizeof(record));
+
+	g_hit = data && hid_parser_import(data + sizeof(record), record.size);
+
+	if (g_hit)
+	{
+		printf("DECODER_CACHE hit vid=%04x pid=%04x hash=%08lx mount_us=%lu\n",
+			vid, pid, (unsigned long)hash, (unsigned long)(time_us_64() - g_mount_us));
+	}
+
+	return g_hit;
+}
+
+void decoder_cache_store(uint16_t vid, uint16_t pid, uint32_t hash)
+{
+	printf("DECODER_CACHE miss vid=%04x pid=%04x hash=%08lx mount_us=%lu\n",
+		vid, pid, (unsigned long)hash, (unsigned long)(time_us_64() - g_mount_us));
+
+	if (g_pending_pages)
+		return; // Previous record is being written, store on next mount
+
+	decoder_cache_record record = {};
+
+	const size_t size = hid_parser_export(g_pending + sizeof(record), sizeof(g_pending) - sizeof(record));
+
+	if (!size)
+		return; // Too large for cache
+
+	record.magic = DECODER_CACHE_MAGIC;
+	record.vid = vid;
+	record.pid = pid;
+	record.hash = hash;
+	record.size = (uint16_t)size;
+	record.pages = (uint16_t)((sizeof(record) + size + FLASH_PAGE_SIZE - 1) / FLASH_PAGE_SIZE);
+	record.check = image_check(g_pending + sizeof(record), record.size);
+
+	memcpy(g_pending, &record, sizeof(record));
+	memset(g_pending + sizeof(record) + size, 0xFF, record.pages * FLASH_PAGE_SIZE - sizeof(record) - size);
+
+	g_pending_written = 0;
+	g_pending_pages = record.pages;
+
+	// Log full: start over
+	if (g_append + record.pages * FLASH_PAGE_SIZE > DECODER_CACHE_SIZE)
+		g_erase_next = 0;
+}
+
+void decoder_cache_report_decoded()
+{
+	if (!g_mount_us)
+		return;
+
+	printf("DECODER_CACHE first_report_us=%lu %s\n", (unsigned long)(time_us_64() - g_mount_us), g_hit ? "hit" : "miss");
+
+	g_mount_us = 0;
+}
+
+// USB host interrupts are off during flash operations: mounted device would miss transfers or be reset.
+static bool usb_device_mounted()
+{
+	for (uint8_t dev_addr = 1; dev_addr < USB_DEVICE_ADDRESSES; dev_addr++)
+	{
+		if (tuh_mounted(dev_addr))
+			return true;
+	}
+
+	return false;
+}
+
+void decoder_cache_task()
+{
+	if (decoder_cache_request == DECODER_CACHE_REQUEST_NONE)
+	{
+		if (g_parked)
+			return; // Core0 is leaving park after previous operation
+
+		if ((g_erase_next < DECODER_CACHE_SECTORS || g_pending_pages) && usb_device_mounted())
+			return;
+
+		if (g_erase_next < DECODER_CACHE_SECTORS)
+			decoder_cache_request = DECODER_CACHE_REQUEST_ERASE;
+		else if (g_pending_pages)
+			decoder_cache_request = DECODER_CACHE_REQUEST_PROGRAM;
+
+		return;
+	}
+
+	if (!g_parked)
+		return; // Wait for core0
+
+	// Device mounted while core0 was on its way to park: release core0 without flash operation, request again after unplug
+	if (usb_device_mounted())
+	{
+		decoder_cache_request = DECODER_CACHE_REQUEST_NONE;
+		return;
+	}
+
+	const uint32_t interrupts = save_and_disable_interrupts(); // Interrupt handlers can run from flash
+
+	if (decoder_cache_request == DECODER_CACHE_REQUEST_ERASE)
+	{
+		flash_range_erase(DECODER_CACHE_OFFSET + g_erase_next * FLASH_SECTOR_SIZE, FLASH_SECTOR_SIZE);
+
+		if (++g_erase_next == DECODER_CACHE_SECTORS)
+			g_append = 0;
+	}
+	else
+	{
+		flash_range_program(DECODER_CACHE_OFFSET + g_append, g_pending + g_pending_written * FLASH_PAGE_SIZE, FLASH_PAGE_SIZE);
+
+		g_append += FLASH_PAGE_SIZE;
+
+		if (++g_pending_written == g_pending_pages)
+			g_pending_pages = 0;
+	}
+
+	restore_interrupts(interrupts);
+
+	__compiler_memory_barrier();
+	decoder_cache_request = DECODER_CACHE_REQUEST_NONE; // Release core0
+}
+
+void __not_in_flash_func(decoder_cache_park)()
+{
+	const uint32_t interrupts = save_and_disable_interrupts();
+
+	g_parked = true;
+
+	while (decoder_cache_request != DECODER_CACHE_REQUEST_NONE)
+		tight_loop_contents();
+
+	g_parked = false;
+
+	restore_interrupts(interrupts);
+}
+
+#endif
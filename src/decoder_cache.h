@@ -0,0 +1,110 @@
+#pragma once
+
+#include <stdint.h>
+
+/*
+Compiled HID decoder cache in flash.
+
+Parsed report descriptor (hid_parser_export() image) is appended to log in the last flash sectors,
+keyed by VID/PID and hid_parser_hash() of descriptor and preset table.
+On remount decoder_cache_load() imports decoder and ParseReportDescriptor() is skipped.
+
+Flash can't be read through XIP while it is programmed or erased, so core0 parks in SRAM with interrupts off
+at points where Joybus can wait, core1 runs flash operation with interrupts off meanwhile:
+- right after poll reply is queued to PIO, page program only (0.4 ms typical, 3 ms max): only when the last
+  DECODER_CACHE_WIDE_POLLS poll periods were at least DECODER_CACHE_PROGRAM_WINDOW_US, measured from park end;
+- waiting for command after DECODER_CACHE_IDLE_US without Joybus traffic: page program or sector erase (up to 400 ms).
+USB host interrupts are off during flash operations too, so operations are requested only while no USB device is mounted:
+record of a mounted device is written after it is unplugged. Core0 may park only after a device was mounted, so mount is
+checked again once core0 is parked: the request is then dropped and core0 released without flash operation.
+Device attached during the operation is enumerated after it.
+Not built with PIO_USB_HOST: PIO-USB SOF / frame interrupt can't stop for flash operations.
+Records are appended page aligned, log sectors are erased only when log is full.
+Log is not reserved by linker: firmware image must end below DECODER_CACHE_OFFSET.
+
+Prints over stdio UART:
+	DECODER_CACHE hit|miss vid=<hex> pid=<hex> hash=<hex> mount_us=<import or parse time>
+	DECODER_CACHE first_report_us=<time from mount to first decoded report> hit|miss
+*/
+
+#define DECODER_CACHE_SECTORS 2
+#define DECODER_CACHE_RECORD_PAGES 5 // Record header + image up to 1260 bytes
+#define DECODER_CACHE_IDLE_US 1000000
+#define DECODER_CACHE_PROGRAM_WINDOW_US 4000 // Page program 3 ms max, park and reply margin
+#define DECODER_CACHE_WIDE_POLLS 8
+
+#if DECODER_CACHE && PIO_USB_HOST
+#error "Decoder cache flash operations stop PIO-USB host interrupts, build with SMD2GC_DECODER_CACHE=OFF"
+#endif
+
+#if DECODER_CACHE
+#include "hardware/timer.h"
+
+// Find log end. Call on core1 before USB host start.
+void decoder_cache_init();
+
+// Import cached decoder. Call from tuh_hid_mount_cb(), returns false on cache miss.
+bool decoder_cache_load(uint16_t vid, uint16_t pid, uint32_t hash);
+
+// Queue decoder parsed on cache miss for write once no USB device is mounted. Call right after ParseReportDescriptor().
+void decoder_cache_store(uint16_t vid, uint16_t pid, uint32_t hash);
+
+// Print time to first decoded report after mount once. Call after ParseReport().
+void decoder_cache_report_decoded();
+
+// Run queued flash operation when core0 is parked. Call from core1 loop.
+void decoder_cache_task();
+
+// Flash operation requested by core1, see decoder_cache_request_type.
+extern volatile uint8_t decoder_cache_request;
+
+// Core0 poll window tracking: last reply or park end time, consecutive poll periods of at least DECODER_CACHE_PROGRAM_WINDOW_US.
+extern uint32_t decoder_cache_last_reply_us;
+extern uint8_t decoder_cache_wide_polls;
+
+// Core0: park in SRAM until requested flash operation is done.
+void decoder_cache_park();
+
+enum decoder_cache_request_type : uint8_t
+{
+	DECODER_CACHE_REQUEST_NONE,
+	DECODER_CACHE_REQUEST_PROGRAM, // Single page
+	DECODER_CACHE_REQUEST_ERASE // Single sector
+};
+
+// Core0: call right after every poll reply is queued.
+inline void decoder_cache_park_after_reply()
+{
+	const uint32_t now = time_us_32();
+
+	if (now - decoder_cache_last_reply_us < DECODER_CACHE_PROGRAM_WINDOW_US)
+		decoder_cache_wide_polls = 0;
+	else if (decoder_cache_wide_polls < DECODER_CACHE_WIDE_POLLS)
+		decoder_cache_wide_polls++;
+
+	decoder_cache_last_reply_us = now;
+
+	if (decoder_cache_request == DECODER_CACHE_REQUEST_PROGRAM && decoder_cache_wide_polls == DECODER_CACHE_WIDE_POLLS)
+	{
+		decoder_cache_park();
+
+		// Polls missed while parked are not seen: measure next period from park end
+		decoder_cache_last_reply_us = time_us_32();
+		decoder_cache_wide_polls = 0;
+	}
+}
+
+// Core0: call while waiting for command, last_command_us - time_us_32() of last command.
+inline void decoder_cache_park_idle(uint32_t last_command_us)
+{
+	if (decoder_cache_request != DECODER_CACHE_REQUEST_NONE && time_us_32() - last_command_us > DECODER_CACHE_IDLE_US)
+		decoder_cache_park();
+}
+#else
+inline void decoder_cache_init() {}
+inline bool decoder_cache_load(uint16_t, uint16_t, uint32_t) { return false; }
+inline void decoder_cache_store(uint16_t, uint16_t, uint32_t) {}
+inline void decoder_cache_report_decoded() {}
+inline void decoder_cache_task() {}
+inline void decoder_cache_park_after_reply() {}
+#endif
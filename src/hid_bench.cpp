@@ -0,0 +1,317 @@
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <stdint.h>
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+#include "arena_allocator.h"
+#include "bench_kernels.h"
+
+/*
+Host benchmark for HID parser and Joybus encoder kernels (bench_kernels.h).
+
+Usage:
+	HID_Parser_Bench [--json] [--filter text] [--min-time-ms 200] [--iterations n]
+	                 [--baseline file] [--tolerance percent] [--time-report-only] [--write-baseline file]
+
+Every kernel is run with doubling iteration count until --min-time-ms is reached (or exactly --iterations times).
+Reports time per operation, arena bytes in use and heap allocations per kernel.
+With --baseline fails if a kernel is slower than baseline by more than --tolerance percent,
+or uses more arena bytes / heap allocations than baseline.
+Baseline times are host and load dependent: with --time-report-only slower kernels are printed only
+and arena bytes / heap allocations are checked (CTest), absolute time check is the manual HID_Parser_Bench_Check target.
+*/
+
+static size_t g_heap_allocations = 0;
+
+void* operator new(size_t size)
+{
+	g_heap_allocations++;
+
+	if (void* ptr = malloc(size ? size : 1))
+		return ptr;
+
+	throw std::bad_alloc();
+}
+
+void* operator new[](size_t size)
+{
+	return operator new(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+	free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+	free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept
+{
+	free(ptr);
+}
+
+void operator delete[](void* ptr, size_t) noexcept
+{
+	free(ptr);
+}
+
+typedef struct bench_result
+{
+	std::string name;
+	uint64_t iterations;
+	double ns_per_op;
+	size_t arena_bytes;
+	size_t heap_allocations;
+} bench_result;
+
+typedef struct bench_options
+{
+	bool json = false;
+	const char* filter = nullptr;
+	double min_time_ms = 200.0;
+	uint64_t iterations = 0;
+	const char* baseline = nullptr;
+	double tolerance = 100.0;
+	bool time_report_only = false;
+	const char* write_baseline = nullptr;
+} bench_options;
+
+static double run_timed(const bench_kernel* kernel, uint64_t iterations)
+{
+	const auto start = std::chrono::steady_clock::now();
+
+	while (iterations)
+	{
+		const uint32_t chunk = iterations > UINT32_MAX ? UINT32_MAX : (uint32_t)iterations;
+		kernel->run(kernel->arg, chunk);
+		iterations -= chunk;
+	}
+
+	return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+}
+
+static bench_result measure(const bench_kernel* kernel, const bench_options& options)
+{
+	arena_reset(); // Arena bytes of previous kernel don't count
+
+	if (kernel->setup)
+		kernel->setup(kernel->arg);
+
+	kernel->run(kernel->arg, 1); // Warm up caches
+
+	const size_t heap_allocations = g_heap_allocations;
+
+	uint64_t iterations = options.iterations ? options.iterations : 1000;
+	double elapsed_ns = run_timed(kernel, iterations);
+
+	while (!options.iterations && elapsed_ns < options.min_time_ms * 1e6)
+	{
+		iterations *= 2;
+		elapsed_ns = run_timed(kernel, iterations);
+	}
+
+	bench_result result;
+	result.heap_allocations = g_heap_allocations - heap_allocations; // Before name string allocation
+	result.name = kernel->name;
+	result.iterations = iterations;
+	result.ns_per_op = elapsed_ns / iterations;
+	result.arena_bytes = arena_used();
+
+	return result;
+}
+
+static void print_text(const std::vector<bench_result>& results)
+{
+	printf("%-56s %12s %10s %6s %7s\n", "kernel", "iterations", "ns/op", "arena", "allocs");
+
+	for (const bench_result& result : results)
+	{
+		printf("%-56s %12llu %10.2f %6zu %7zu\n", result.name.c_str(), (unsigned long long)result.iterations,
+			result.ns_per_op, result.arena_bytes, result.heap_allocations);
+	}
+}
+
+static void print_json(const std::vector<bench_result>& results)
+{
+	printf("{\n  \"kernels\": [\n");
+
+	for (size_t i = 0; i < results.size(); i++)
+	{
+		const bench_result& result = results[i];
+		printf("    { \"name\": \"%s\", \"iterations\": %llu, \"ns_per_op\": %.3f, \"arena_bytes\": %zu, \"heap_allocations\": %zu }%s\n",
+			result.name.c_str(), (unsigned long long)result.iterations, result.ns_per_op,
+			result.arena_bytes, result.heap_allocations, i + 1 < results.size() ? "," : "");
+	}
+
+	printf("  ]\n}\n");
+}
+
+static bool write_baseline(const char* path, const std::vector<bench_result>& results)
+{
+	FILE* file = fopen(path, "w");
+
+	if (!file)
+	{
+		fprintf(stderr, "Can't write baseline %s\n", path);
+		return false;
+	}
+
+	fprintf(file, "# kernel ns_per_op arena_bytes heap_allocations\n");
+
+	for (const bench_result& result : results)
+		fprintf(file, "%s %.2f %zu %zu\n", result.name.c_str(), result.ns_per_op, result.arena_bytes, result.heap_allocations);
+
+	fclose(file);
+
+	return true;
+}
+
+// Returns count of regressions, -1 if baseline can't be read.
+static int check_baseline(const char* path, const std::vector<bench_result>& results, double tolerance, bool time_report_only)
+{
+	FILE* file = fopen(path, "r");
+
+	if (!file)
+	{
+		fprintf(stderr, "Can't read baseline %s\n", path);
+		return -1;
+	}
+
+	int regressions = 0;
+	char line[256];
+
+	while (fgets(line, sizeof(line), file))
+	{
+		char name[128];
+		double ns_per_op;
+		size_t arena_bytes, heap_allocations;
+
+		if (line[0] == '#' || sscanf(line, "%127s %lf %zu %zu", name, &ns_per_op, &arena_bytes, &heap_allocations) != 4)
+			continue;
+
+		for (const bench_result& result : results)
+		{
+			if (result.name != name)
+				continue;
+
+			const double limit = ns_per_op * (1.0 + tolerance / 100.0);
+
+			if (result.ns_per_op > limit)
+			{
+				fprintf(stderr, "%s %s: %.2f ns/op, baseline %.2f ns/op (limit %.2f)\n", time_report_only ? "SLOWER" : "REGRESSION",
+					name, result.ns_per_op, ns_per_op, limit);
+
+				if (!time_report_only)
+					regressions++;
+			}
+
+			if (result.arena_bytes > arena_bytes)
+			{
+				fprintf(stderr, "REGRESSION %s: %zu arena bytes, baseline %zu\n", name, result.arena_bytes, arena_bytes);
+				regressions++;
+			}
+
+			if (result.heap_allocations > heap_allocations)
+			{
+				fprintf(stderr, "REGRESSION %s: %zu heap allocations, baseline %zu\n", name, result.heap_allocations, heap_allocations);
+				regressions++;
+			}
+		}
+	}
+
+	fclose(file);
+
+	return regressions;
+}
+
+static bool parse_options(int argc, char** argv, bench_options& options)
+{
+	for (int i = 1; i < argc; i++)
+	{
+		const char* arg = argv[i];
+		const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+
+		if (!strcmp(arg, "--json"))
+		{
+			options.json = true;
+			continue;
+		}
+
+		if (!strcmp(arg, "--time-report-only"))
+		{
+			options.time_report_only = true;
+			continue;
+		}
+
+		if (!value)
+			return false;
+
+		if (!strcmp(arg, "--filter"))
+			options.filter = value;
+		else if (!strcmp(arg, "--min-time-ms"))
+			options.min_time_ms = atof(value);
+		else if (!strcmp(arg, "--iterations"))
+			options.iterations = strtoull(value, nullptr, 10);
+		else if (!strcmp(arg, "--baseline"))
+			options.baseline = value;
+		else if (!strcmp(arg, "--tolerance"))
+			options.tolerance = atof(value);
+		else if (!strcmp(arg, "--write-baseline"))
+			options.write_baseline = value;
+		else
+			return false;
+
+		i++;
+	}
+
+	return true;
+}
+
+int main(int argc, char** argv)
+{
+	bench_options options;
+
+	if (!parse_options(argc, argv, options))
+	{
+		fprintf(stderr, "Usage: %s [--json] [--filter text] [--min-time-ms ms] [--iterations n] "
+			"[--baseline file] [--tolerance percent] [--time-report-only] [--write-baseline file]\n", argv[0]);
+		return 2;
+	}
+
+	std::vector<bench_result> results;
+
+	for (size_t i = 0; i < bench_kernels_count; i++)
+	{
+		const bench_kernel* kernel = &bench_kernels[i];
+
+		if (options.filter && !strstr(kernel->name, options.filter))
+			continue;
+
+		results.push_back(measure(kernel, options));
+	}
+
+	if (options.json)
+		print_json(results);
+	else
+		print_text(results);
+
+	if (options.write_baseline && !write_baseline(options.write_baseline, results))
+		return 1;
+
+	if (options.baseline)
+	{
+		const int regressions = check_baseline(options.baseline, results, options.tolerance, options.time_report_only);
+
+		if (regressions)
+			return 1;
+	}
+
+	return 0;
+}
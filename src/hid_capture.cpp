@@ -0,0 +1,154 @@
+#include "hid_capture.h"
+
+#if HID_CAPTURE
+
+#include <stdio.h>
+#include <string.h>
+
+#include "pico/stdlib.h"
+
+typedef struct hid_capture_descriptor_entry
+{
+	uint8_t dev_addr;
+	uint8_t instance;
+	uint16_t vid;
+	uint16_t pid;
+	uint16_t len; // 0 - unused entry
+	uint8_t data[HID_CAPTURE_DESCRIPTOR_SIZE];
+} hid_capture_descriptor_entry;
+
+typedef struct hid_capture_record
+{
+	uint32_t timestamp; // us
+	uint8_t dev_addr;
+	uint8_t instance;
+	uint8_t len;
+	uint8_t data[HID_CAPTURE_REPORT_SIZE];
+} hid_capture_record;
+
+static hid_capture_descriptor_entry g_descriptors[HID_CAPTURE_DESCRIPTORS];
+static hid_capture_record g_records[HID_CAPTURE_REPORTS];
+
+static uint32_t g_head = 0; // Next record to write
+static uint32_t g_count = 0;
+static uint32_t g_overwritten = 0;
+static uint32_t g_truncated = 0;
+
+void hid_capture_descriptor(uint8_t dev_addr, uint8_t instance, uint16_t vid, uint16_t pid, const uint8_t* desc, uint16_t desc_len)
+{
+	hid_capture_descriptor_entry* entry = nullptr;
+
+	// Same interface remounted, free entry, or oldest entry 0
+	for (hid_capture_descriptor_entry& candidate : g_descriptors)
+	{
+		if (candidate.len && candidate.dev_addr == dev_addr && candidate.instance == instance)
+		{
+			entry = &candidate;
+			break;
+		}
+
+		if (!candidate.len && !entry)
+			entry = &candidate;
+	}
+
+	if (!entry)
+		entry = &g_descriptors[0];
+
+	if (desc_len > HID_CAPTURE_DESCRIPTOR_SIZE)
+	{
+		desc_len = HID_CAPTURE_DESCRIPTOR_SIZE;
+		g_truncated++;
+	}
+
+	entry->dev_addr = dev_addr;
+	entry->instance = instance;
+	entry->vid = vid;
+	entry->pid = pid;
+	entry->len = desc ? desc_len : 0;
+
+	if (desc)
+		memcpy(entry->data, desc, desc_len);
+}
+
+void hid_capture_report(uint8_t dev_addr, uint8_t instance, const uint8_t* report, uint16_t len)
+{
+	hid_capture_record* record = &g_records[g_head];
+
+	if (len > HID_CAPTURE_REPORT_SIZE)
+	{
+		len = HID_CAPTURE_REPORT_SIZE;
+		g_truncated++;
+	}
+
+	record->timestamp = time_us_32();
+	record->dev_addr = dev_addr;
+	record->instance = instance;
+	record->len = (uint8_t)len;
+	memcpy(record->data, report, len);
+
+	g_head = (g_head + 1) % HID_CAPTURE_REPORTS;
+
+	if (g_count < HID_CAPTURE_REPORTS)
+		g_count++;
+	else
+		g_overwritten++;
+}
+
+static void print_hex(const uint8_t* data, uint32_t len)
+{
+	for (uint32_t i = 0; i < len; i++)
+		printf("%02x", data[i]);
+
+	printf("\n");
+}
+
+static void dump()
+{
+	uint32_t descriptors = 0;
+
+	for (const hid_capture_descriptor_entry& entry : g_descriptors)
+		descriptors += entry.len != 0;
+
+	printf("HIDCAP BEGIN descriptors=%lu reports=%lu overwritten=%lu truncated=%lu\n",
+		descriptors, g_count, g_overwritten, g_truncated);
+
+	for (const hid_capture_descriptor_entry& entry : g_descriptors)
+	{
+		if (!entry.len)
+			continue;
+
+		printf("HIDCAP DESC dev=%u inst=%u vid=%04x pid=%04x ", entry.dev_addr, entry.instance, entry.vid, entry.pid);
+		print_hex(entry.data, entry.len);
+	}
+
+	// Oldest record first
+	uint32_t index = (g_head + HID_CAPTURE_REPORTS - g_count) % HID_CAPTURE_REPORTS;
+
+	for (uint32_t i = 0; i < g_count; i++)
+	{
+		const hid_capture_record* record = &g_records[index];
+
+		printf("HIDCAP REPORT t=%lu dev=%u inst=%u ", record->timestamp, record->dev_addr, record->instance);
+		print_hex(record->data, record->len);
+
+		index = (index + 1) % HID_CAPTURE_REPORTS;
+	}
+
+	printf("HIDCAP END\n");
+
+	// Descriptors are kept: mounted devices are not reported again
+	g_head = 0;
+	g_count = 0;
+	g_overwritten = 0;
+	g_truncated = 0;
+}
+
+void hid_capture_task()
+{
+	const int key = getchar_timeout_us(0);
+
+	if (key == 'd')
+		dump();
+}
+
+#endif
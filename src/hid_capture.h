@@ -0,0 +1,42 @@
+#pragma once
+
+#include <stdint.h>
+
+/*
+HID report capture for parser regression tests.
+
+Records report descriptor, VID/PID of every mounted HID interface and timestamped reports
+into RAM ring, oldest reports are overwritten when ring is full.
+Key 'd' received over stdio UART dumps capture, replay it on host with HID_Replay (src/hid_replay.cpp).
+
+Dump format:
+	HIDCAP BEGIN descriptors=<n> reports=<n> overwritten=<n> truncated=<n>
+	HIDCAP DESC dev=<n> inst=<n> vid=<hex> pid=<hex> <descriptor bytes hex>
+	HIDCAP REPORT t=<us> dev=<n> inst=<n> <report bytes hex>
+	HIDCAP END
+
+Note: USB host task is stalled while dump is printed, capture starts over after dump.
+*/
+
+#ifndef HID_CAPTURE_REPORTS
+#define HID_CAPTURE_REPORTS 256
+#endif
+
+#define HID_CAPTURE_DESCRIPTORS 4
+#define HID_CAPTURE_DESCRIPTOR_SIZE 512
+#define HID_CAPTURE_REPORT_SIZE 64 // Full speed interrupt endpoint max packet size
+
+#if HID_CAPTURE
+// Record report descriptor of mounted interface. Call from tuh_hid_mount_cb().
+void hid_capture_descriptor(uint8_t dev_addr, uint8_t instance, uint16_t vid, uint16_t pid, const uint8_t* desc, uint16_t desc_len);
+
+// Record received report. Call from tuh_hid_report_received_cb().
+void hid_capture_report(uint8_t dev_addr, uint8_t instance, const uint8_t* report, uint16_t len);
+
+// Dump capture on 'd' key. Call from core1 loop.
+void hid_capture_task();
+#else
+inline void hid_capture_descriptor(uint8_t, uint8_t, uint16_t, uint16_t, const uint8_t*, uint16_t) {}
+inline void hid_capture_report(uint8_t, uint8_t, const uint8_t*, uint16_t) {}
+inline void hid_capture_task() {}
+#endif
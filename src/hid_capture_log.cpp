@@ -0,0 +1,98 @@
+#include "hid_capture_log.h"
+
+#include <cstring>
+#include <stdio.h>
+
+static bool parse_hex(const char* text, std::vector<uint8_t>& data)
+{
+	data.clear();
+
+	while (*text && *text != '\r' && *text != '\n')
+	{
+		unsigned int byte;
+
+		if (sscanf(text, "%2x", &byte) != 1 || !text[1])
+			return false;
+
+		data.push_back((uint8_t)byte);
+		text += 2;
+	}
+
+	return true;
+}
+
+bool hid_capture_log_read(const char* path, std::vector<hid_capture_log_descriptor>& descriptors, std::vector<hid_capture_log_report>& reports)
+{
+	FILE* file = fopen(path, "r");
+
+	if (!file)
+	{
+		fprintf(stderr, "Can't read capture %s\n", path);
+		return false;
+	}
+
+	static char line[4096];
+	bool in_capture = false;
+
+	while (fgets(line, sizeof(line), file))
+	{
+		// UART log may hold other output on the same line before capture
+		const char* text = strstr(line, "HIDCAP ");
+
+		if (!text)
+			continue;
+
+		unsigned int dev_addr, instance, vid, pid;
+		unsigned long timestamp;
+		int offset = 0;
+
+		if (!strncmp(text, "HIDCAP BEGIN", 12))
+		{
+			in_capture = true;
+		}
+		else if (!strncmp(text, "HIDCAP END", 10))
+		{
+			in_capture = false;
+		}
+		else if (in_capture && sscanf(text, "HIDCAP DESC dev=%u inst=%u vid=%x pid=%x %n", &dev_addr, &instance, &vid, &pid, &offset) == 4 && offset)
+		{
+			hid_capture_log_descriptor descriptor;
+			descriptor.dev_addr = (uint8_t)dev_addr;
+			descriptor.instance = (uint8_t)instance;
+			descriptor.vid = (uint16_t)vid;
+			descriptor.pid = (uint16_t)pid;
+
+			if (!parse_hex(text + offset, descriptor.data))
+				fprintf(stderr, "Bad descriptor line: %s", text);
+			else
+				descriptors.push_back(descriptor);
+		}
+		else if (in_capture && sscanf(text, "HIDCAP REPORT t=%lu dev=%u inst=%u %n", &timestamp, &dev_addr, &instance, &offset) == 3 && offset)
+		{
+			hid_capture_log_report report;
+			report.timestamp = (uint32_t)timestamp;
+			report.dev_addr = (uint8_t)dev_addr;
+			report.instance = (uint8_t)instance;
+
+			if (!parse_hex(text + offset, report.data))
+				fprintf(stderr, "Bad report line: %s", text);
+			else
+				reports.push_back(report);
+		}
+	}
+
+	fclose(file);
+
+	return true;
+}
+
+const hid_capture_log_descriptor* hid_capture_log_find_descriptor(const std::vector<hid_capture_log_descriptor>& descriptors, uint8_t dev_addr, uint8_t instance)
+{
+	for (const hid_capture_log_descriptor& descriptor : descriptors)
+	{
+		if (descriptor.dev_addr == dev_addr && descriptor.instance == instance)
+			return &descriptor;
+	}
+
+	return nullptr;
+}
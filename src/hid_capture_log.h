@@ -0,0 +1,31 @@
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+
+/*
+Host reader of HID capture dumps (hid_capture.h) in UART log, shared by HID_Replay and simulator.
+*/
+
+typedef struct hid_capture_log_descriptor
+{
+	uint8_t dev_addr;
+	uint8_t instance;
+	uint16_t vid;
+	uint16_t pid;
+	std::vector<uint8_t> data;
+} hid_capture_log_descriptor;
+
+typedef struct hid_capture_log_report
+{
+	uint32_t timestamp;
+	uint8_t dev_addr;
+	uint8_t instance;
+	std::vector<uint8_t> data;
+} hid_capture_log_report;
+
+// Read all HIDCAP dumps in UART log. Returns false if file can't be read.
+bool hid_capture_log_read(const char* path, std::vector<hid_capture_log_descriptor>& descriptors, std::vector<hid_capture_log_report>& reports);
+
+// Descriptor of report interface, nullptr if not captured.
+const hid_capture_log_descriptor* hid_capture_log_find_descriptor(const std::vector<hid_capture_log_descriptor>& descriptors, uint8_t dev_addr, uint8_t instance);
@@ -0,0 +1,598 @@
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <stdint.h>
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+#include "hid_parser.h"
+#include "hid_gamecube_mapping.h"
+#include "hid_capture_log.h"
+#include "hid_dumps.h"
+
+/*
+Generator of fixed layout HID report decoders (src/hid_decoders.h).
+
+Usage:
+	HID_Decoder_Gen --name name (--dump descriptor --vid hex --pid hex | --capture uart.log [--dev n] [--inst n])
+	                [--output file] [--check file]
+
+Parses report descriptor from hid_dumps.h (--dump) or HIDCAP dump in UART log (--capture) with firmware
+hid_to_gamecube_mapping preset and prints header with decoder function
+	bool hid_decode_<name>(const uint8_t* report, uint16_t len, canonical_pad* pad)
+Field offsets, masks and range conversions are constants, result matches ParseReport() with canonical_pad_apply():
+same return value, same canonical pad changes.
+Decoder writes single canonical pad, multi-pad descriptors (hid_parser_report_pads()) are rejected.
+With --check fails if generated header differs from file: decoder is out of date with parser or preset table.
+*/
+
+typedef struct gen_options
+{
+	const char* name = nullptr;
+	const char* dump = nullptr;
+	const char* capture = nullptr;
+	int dev = -1;
+	int inst = -1;
+	long vid = -1;
+	long pid = -1;
+	const char* output = nullptr;
+	const char* check = nullptr;
+} gen_options;
+
+typedef struct gen_dump
+{
+	const char* name;
+	const uint8_t* data;
+	uint16_t size;
+} gen_dump;
+
+#define GEN_DUMP(name) { #name, name, sizeof(name) }
+
+static const gen_dump g_dumps[] =
+{
+	GEN_DUMP(dualshock4_hid_report_descriptor),
+	GEN_DUMP(my_dualshock_4_hid_report_descriptor),
+	GEN_DUMP(dualshock_4_hid_report_descriptor_gimx_fr_wiki),
+	GEN_DUMP(dualshock_3_hid_report_descriptor),
+	GEN_DUMP(dualsence_hid_report_descriptor),
+};
+
+// PadControls name of control set by canonical_pad_apply(), nullptr if control is ignored.
+static const char* pad_control(uint8_t control, bool* axis, bool* inverted)
+{
+	static const char* const controls[] =
+	{
+		"PAD_BUTTON_SOUTH", "PAD_BUTTON_EAST", "PAD_BUTTON_WEST", "PAD_BUTTON_NORTH",
+		"PAD_BUTTON_L1", "PAD_BUTTON_R1", "PAD_BUTTON_L2", "PAD_BUTTON_R2",
+		"PAD_BUTTON_SELECT", "PAD_BUTTON_START", "PAD_BUTTON_L3", "PAD_BUTTON_R3", "PAD_BUTTON_HOME",
+		"PAD_BUTTON_UP", "PAD_BUTTON_DOWN", "PAD_BUTTON_LEFT", "PAD_BUTTON_RIGHT",
+		"PAD_AXIS_LX", "PAD_AXIS_LY", "PAD_AXIS_RX", "PAD_AXIS_RY", "PAD_AXIS_LT", "PAD_AXIS_RT"
+	};
+
+	static_assert(sizeof(controls) / sizeof(controls[0]) == PAD_AXIS_RT + 1, "PadControls changed");
+
+	if (control >= sizeof(controls) / sizeof(controls[0]))
+		return nullptr;
+
+	*axis = control >= PAD_AXIS_LX;
+	*inverted = control == PAD_AXIS_LY || control == PAD_AXIS_RY;
+
+	return controls[control];
+}
+
+// Bit field extraction expression, same bits as processSeg() loop.
+static std::string extract_expression(uint16_t start_bit, uint8_t size)
+{
+	if (!size)
+		return "0";
+
+	const uint16_t first_byte = start_bit >> 3;
+	const uint8_t shift = start_bit & 0x07;
+	const uint8_t bytes = (shift + size + 7) >> 3;
+	const bool wide = shift + size > 32;
+
+	std::string expression;
+	char part[64];
+
+	for (uint8_t i = 0; i < bytes; i++)
+	{
+		if (i)
+			snprintf(part, sizeof(part), " | (%s)report[%u] << %u", wide ? "uint64_t" : "uint32_t", first_byte + i, i * 8);
+		else
+			snprintf(part, sizeof(part), "%sreport[%u]", bytes > 1 ? (wide ? "(uint64_t)" : "(uint32_t)") : "", first_byte);
+
+		expression += part;
+	}
+
+	if (shift)
+	{
+		snprintf(part, sizeof(part), bytes > 1 ? "(%s) >> %u" : "%s >> %u", expression.c_str(), shift);
+		expression = part;
+	}
+
+	if (wide)
+		expression = "(uint32_t)(" + expression + ")";
+
+	if (size < 32 && shift + size != bytes * 8u)
+	{
+		snprintf(part, sizeof(part), "0x%lX", (unsigned long)((1ul << size) - 1));
+		expression = ((shift || wide || bytes > 1) ? "(" + expression + ")" : expression) + " & " + part;
+	}
+
+	return expression;
+}
+
+// convert_range() with constant range, false if conversion is not implemented there.
+static bool range_expression(int16_t minimum, uint16_t maximum, uint16_t target_type, std::string* expression)
+{
+	uint16_t source_type = VALUE_TYPE_CUSTOM;
+
+	if ((minimum == 0) && (maximum == UINT8_MAX))
+		source_type = VALUE_TYPE_UINT8;
+	else if ((minimum == INT8_MIN) && (maximum == INT8_MAX))
+		source_type = VALUE_TYPE_INT8;
+	else if ((minimum == 0) && (maximum == UINT16_MAX))
+		source_type = VALUE_TYPE_UINT16;
+	if ((minimum == INT16_MIN) && (maximum == INT16_MAX))
+		source_type = VALUE_TYPE_INT16;
+
+	static const struct
+	{
+		uint16_t source;
+		uint16_t target;
+		const char* expression;
+	} conversions[] =
+	{
+		{ VALUE_TYPE_INT8, VALUE_TYPE_UINT8, "(int32_t)v + 128" },
+		{ VALUE_TYPE_INT8, VALUE_TYPE_UINT16, "((int32_t)v + 128) << 8" },
+		{ VALUE_TYPE_INT8, VALUE_TYPE_INT16, "(int32_t)v << 8" },
+		{ VALUE_TYPE_UINT8, VALUE_TYPE_INT8, "(int32_t)v - 0x80" },
+		{ VALUE_TYPE_UINT8, VALUE_TYPE_UINT16, "v << 8" },
+		{ VALUE_TYPE_UINT8, VALUE_TYPE_INT16, "(int32_t)(v << 8) - 0x8000" },
+		{ VALUE_TYPE_INT16, VALUE_TYPE_UINT8, "((int32_t)v + 0x8000) >> 8" },
+		{ VALUE_TYPE_INT16, VALUE_TYPE_INT8, "(int32_t)v >> 8" },
+		{ VALUE_TYPE_INT16, VALUE_TYPE_UINT16, "(int32_t)v + 0x8000" },
+		{ VALUE_TYPE_UINT16, VALUE_TYPE_UINT8, "v >> 8" },
+		{ VALUE_TYPE_UINT16, VALUE_TYPE_INT8, "(int32_t)(v >> 8) - 0x80" },
+		{ VALUE_TYPE_UINT16, VALUE_TYPE_INT16, "(int32_t)v - 0x8000" },
+	};
+
+	if (source_type == target_type)
+	{
+		*expression = "v";
+		return true;
+	}
+
+	for (const auto& conversion : conversions)
+	{
+		if (conversion.source == source_type && conversion.target == target_type)
+		{
+			*expression = conversion.expression;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+// Decoder statements for segment, empty if segment has no GameCube effect. Returns false if segment can't be generated.
+// Field read is skipped if v holds same field already (hat switch segments).
+static bool segment_code(const hid_parser_segment_info& segment, std::string* code, std::string* loaded)
+{
+	code->clear();
+
+	if (segment.outputChannel != MAP_GAMEPAD)
+		return true;
+
+	if (segment.inputType != MAP_TYPE_THRESHOLD_ABOVE && segment.inputType != MAP_TYPE_THRESHOLD_BELOW &&
+		segment.inputType != MAP_TYPE_EQUAL && segment.inputType != MAP_TYPE_AXIS)
+		return true;
+
+	bool axis, inverted;
+	const char* control = pad_control(segment.outputControl, &axis, &inverted);
+
+	if (!control)
+		return true;
+
+	if (segment.reportSize > 32)
+	{
+		fprintf(stderr, "Segment at bit %u: report size %u not supported\n", segment.startBit, segment.reportSize);
+		return false;
+	}
+
+	char line[256];
+
+	// canonical_pad_apply() sets button on any axis value
+	if (segment.inputType == MAP_TYPE_AXIS && !axis)
+	{
+		snprintf(line, sizeof(line), "\t\tpad->buttons |= 1u << %s;\n", control);
+		*code = line;
+
+		return true;
+	}
+
+	const bool sign = segment.logicalMinimum < 0;
+
+	std::string load;
+
+	if (segment.reportSize > 1)
+		snprintf(line, sizeof(line), "\t\tv = %s; // Bits %u..%u\n", extract_expression(segment.startBit, segment.reportSize).c_str(),
+			segment.startBit, segment.startBit + segment.reportSize - 1);
+	else
+		snprintf(line, sizeof(line), "\t\tv = %s; // Bit %u\n", extract_expression(segment.startBit, segment.reportSize).c_str(), segment.startBit);
+
+	load = line;
+
+	if (sign && segment.reportSize && segment.reportSize < 32)
+	{
+		snprintf(line, sizeof(line), "\t\tv = (uint32_t)((int32_t)(v << %u) >> %u);\n", 32 - segment.reportSize, 32 - segment.reportSize);
+		load += line;
+	}
+
+	if (load != *loaded)
+		*code += load;
+
+	*loaded = load;
+
+	std::string value; // Value passed to canonical_pad_apply()
+
+	if (segment.inputType == MAP_TYPE_AXIS)
+	{
+		std::string conversion;
+
+		if (!range_expression(segment.logicalMinimum, segment.logicalMaximum, segment.inputParam, &conversion))
+		{
+			fprintf(stderr, "Segment at bit %u: logical range %d..%u not supported by convert_range()\n",
+				segment.startBit, segment.logicalMinimum, segment.logicalMaximum);
+			return false;
+		}
+
+		value = "(uint8_t)(" + conversion + ")";
+
+		if (inverted)
+			value = "(uint8_t)(UINT8_MAX - " + value + ")";
+
+		snprintf(line, sizeof(line), "\t\tPAD_AXIS(pad, %s) = %s;\n", control, value.c_str());
+		*code += line;
+
+		return true;
+	}
+
+	std::string condition;
+
+	if (segment.inputType == MAP_TYPE_EQUAL)
+	{
+		snprintf(line, sizeof(line), "v == %u", segment.inputParam);
+		condition = line;
+	}
+	else
+	{
+		snprintf(line, sizeof(line), "map_to_uint8(%s, %d, %u) %s %u", sign ? "(int32_t)v" : "v", segment.logicalMinimum, segment.logicalMaximum,
+			segment.inputType == MAP_TYPE_THRESHOLD_ABOVE ? ">" : "<", segment.inputParam);
+		condition = line;
+	}
+
+	if (axis)
+		snprintf(line, sizeof(line), "\t\tPAD_AXIS(pad, %s) = (%s) ? %u : PAD_AXIS(pad, %s);\n", control, condition.c_str(), inverted ? UINT8_MAX - 1 : 1, control);
+	else
+		snprintf(line, sizeof(line), "\t\tpad->buttons |= (uint32_t)(%s) << %s;\n", condition.c_str(), control);
+
+	*code += line;
+
+	return true;
+}
+
+static bool report_code(uint16_t index, const hid_parser_report_info& report, std::string* code)
+{
+	std::vector<hid_parser_segment_info> segments(hid_parser_segments(index, nullptr, 0));
+	hid_parser_segments(index, segments.data(), (uint16_t)segments.size());
+
+	char line[128];
+
+	snprintf(line, sizeof(line), "\t\tif (len < %u)\n\t\t\treturn false;\n\n", (report.length + 7u) >> 3);
+	*code = line;
+
+	bool used = false;
+	std::string loaded;
+
+	for (const hid_parser_segment_info& segment : segments)
+	{
+		std::string statements;
+
+		if (!segment_code(segment, &statements, &loaded))
+			return false;
+
+		if (statements.empty())
+			continue;
+
+		if (!used)
+			*code += "\t\tuint32_t v;\n\n";
+
+		*code += statements;
+		used = true;
+	}
+
+	if (used)
+		*code += "\n";
+
+	*code += "\t\treturn true;\n";
+
+	return true;
+}
+
+static bool generate(const gen_options& options, uint16_t vid, uint16_t pid, const uint8_t* descriptor, uint16_t size, std::string* header)
+{
+	if (!ParseReportDescriptor(descriptor, size, hid_to_gamecube_mapping))
+	{
+		fprintf(stderr, "Can't parse report descriptor\n");
+		return false;
+	}
+
+	std::vector<hid_parser_report_info> reports(hid_parser_reports(nullptr, 0));
+	hid_parser_reports(reports.data(), (uint16_t)reports.size());
+
+	if (reports.empty())
+	{
+		fprintf(stderr, "No input reports in descriptor\n");
+		return false;
+	}
+
+	for (const hid_parser_report_info& report : reports)
+	{
+		if (report.pads & ~1u)
+		{
+			fprintf(stderr, "Report %02x maps controls of second or further pad, multi-pad devices use generic parser\n", report.reportID);
+			return false;
+		}
+	}
+
+	const char* source = options.dump;
+
+	if (!source)
+	{
+		source = strrchr(options.capture, '/');
+		source = source ? source + 1 : options.capture;
+	}
+
+	std::string upper = options.name;
+
+	for (char& c : upper)
+		c = (char)toupper((unsigned char)c);
+
+	char line[1024];
+
+	snprintf(line, sizeof(line),
+		"#pragma once\n"
+		"\n"
+		"// Generated by HID_Decoder_Gen (src/hid_decoder_gen.cpp) from %s with hid_to_gamecube_mapping, do not edit.\n"
+		"\n"
+		"#include \"../hid_parser.h\"\n"
+		"#include \"../canonical_pad.h\"\n"
+		"\n"
+		"#define HID_DECODER_%s_VID 0x%04x\n"
+		"#define HID_DECODER_%s_PID 0x%04x\n"
+		"#define HID_DECODER_%s_HASH 0x%08lx // hid_parser_hash() of %u byte descriptor\n"
+		"\n"
+		"inline bool hid_decode_%s(const uint8_t* report, uint16_t len, canonical_pad* pad)\n"
+		"{\n",
+		source, upper.c_str(), vid, upper.c_str(), pid,
+		upper.c_str(), (unsigned long)hid_parser_hash(descriptor, size, hid_to_gamecube_mapping), size, options.name);
+	*header = line;
+
+	if (hid_parser_uses_report_ids())
+	{
+		*header += "\tif (!len)\n\t\treturn false;\n\n";
+		*header += "\tswitch (report[0])\n\t{\n";
+
+		for (uint16_t i = 0; i < reports.size(); i++)
+		{
+			bool shadowed = false; // ParseReport() uses first report with ID
+
+			for (uint16_t j = 0; j < i; j++)
+				shadowed |= reports[j].reportID == reports[i].reportID;
+
+			if (shadowed)
+				continue;
+
+			std::string code;
+
+			if (!report_code(i, reports[i], &code))
+				return false;
+
+			snprintf(line, sizeof(line), "\tcase 0x%02x:\n\t{\n", reports[i].reportID);
+			*header += line;
+			*header += code;
+			*header += "\t}\n";
+		}
+
+		*header += "\tdefault:\n\t\treturn false;\n\t}\n";
+	}
+	else
+	{
+		std::string code;
+
+		if (!report_code(0, reports[0], &code))
+			return false;
+
+		// One tab less: no switch
+		for (size_t i = 0; i < code.size(); i++)
+		{
+			if (code[i] == '\t' && (i == 0 || code[i - 1] == '\n'))
+				continue;
+
+			*header += code[i];
+		}
+	}
+
+	*header += "}\n";
+
+	return true;
+}
+
+static bool parse_options(int argc, char** argv, gen_options& options)
+{
+	for (int i = 1; i < argc; i++)
+	{
+		const char* arg = argv[i];
+		const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+
+		if (!value)
+			return false;
+
+		if (!strcmp(arg, "--name"))
+			options.name = value;
+		else if (!strcmp(arg, "--dump"))
+			options.dump = value;
+		else if (!strcmp(arg, "--capture"))
+			options.capture = value;
+		else if (!strcmp(arg, "--dev"))
+			options.dev = atoi(value);
+		else if (!strcmp(arg, "--inst"))
+			options.inst = atoi(value);
+		else if (!strcmp(arg, "--vid"))
+			options.vid = strtol(value, nullptr, 16);
+		else if (!strcmp(arg, "--pid"))
+			options.pid = strtol(value, nullptr, 16);
+		else if (!strcmp(arg, "--output"))
+			options.output = value;
+		else if (!strcmp(arg, "--check"))
+			options.check = value;
+		else
+			return false;
+
+		i++;
+	}
+
+	if (!options.name || !options.dump == !options.capture)
+		return false;
+
+	return !options.dump || (options.vid >= 0 && options.pid >= 0);
+}
+
+static bool read_file(const char* path, std::string* content)
+{
+	FILE* file = fopen(path, "rb");
+
+	if (!file)
+		return false;
+
+	char buffer[4096];
+	size_t size;
+
+	while ((size = fread(buffer, 1, sizeof(buffer), file)) > 0)
+		content->append(buffer, size);
+
+	fclose(file);
+
+	return true;
+}
+
+int main(int argc, char** argv)
+{
+	gen_options options;
+
+	if (!parse_options(argc, argv, options))
+	{
+		fprintf(stderr, "Usage: %s --name name (--dump descriptor --vid hex --pid hex | --capture uart.log [--dev n] [--inst n]) "
+			"[--output file] [--check file]\n", argv[0]);
+		return 2;
+	}
+
+	std::vector<uint8_t> descriptor;
+	uint16_t vid = (uint16_t)options.vid, pid = (uint16_t)options.pid;
+
+	if (options.dump)
+	{
+		for (const gen_dump& dump : g_dumps)
+		{
+			if (!strcmp(dump.name, options.dump))
+				descriptor.assign(dump.data, dump.data + dump.size);
+		}
+
+		if (descriptor.empty())
+		{
+			fprintf(stderr, "Unknown descriptor %s\n", options.dump);
+			return 1;
+		}
+	}
+	else
+	{
+		std::vector<hid_capture_log_descriptor> descriptors;
+		std::vector<hid_capture_log_report> reports;
+
+		if (!hid_capture_log_read(options.capture, descriptors, reports))
+		{
+			fprintf(stderr, "Can't read capture %s\n", options.capture);
+			return 1;
+		}
+
+		for (const hid_capture_log_descriptor& captured : descriptors)
+		{
+			if ((options.dev < 0 || captured.dev_addr == options.dev) && (options.inst < 0 || captured.instance == options.inst))
+			{
+				descriptor = captured.data;
+				vid = options.vid >= 0 ? vid : captured.vid;
+				pid = options.pid >= 0 ? pid : captured.pid;
+				break;
+			}
+		}
+
+		if (descriptor.empty())
+		{
+			fprintf(stderr, "No matching descriptor in capture %s\n", options.capture);
+			return 1;
+		}
+	}
+
+	std::string header;
+
+	if (!generate(options, vid, pid, descriptor.data(), (uint16_t)descriptor.size(), &header))
+		return 1;
+
+	if (options.check)
+	{
+		std::string expected;
+
+		if (!read_file(options.check, &expected))
+		{
+			fprintf(stderr, "Can't read %s\n", options.check);
+			return 1;
+		}
+
+		// Checkout may convert line endings
+		std::string normalized;
+
+		for (char c : expected)
+		{
+			if (c != '\r')
+				normalized += c;
+		}
+
+		if (normalized != header)
+		{
+			fprintf(stderr, "%s is out of date, regenerate with HID_Decoder_Gen --output\n", options.check);
+			return 1;
+		}
+
+		return 0;
+	}
+
+	if (options.output)
+	{
+		FILE* file = fopen(options.output, "wb");
+
+		if (!file)
+		{
+			fprintf(stderr, "Can't write %s\n", options.output);
+			return 1;
+		}
+
+		fputs(header.c_str(), file);
+		fclose(file);
+	}
+	else
+		fputs(header.c_str(), stdout);
+
+	return 0;
+}
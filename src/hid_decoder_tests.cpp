@@ -0,0 +1,150 @@
+#include <cassert>
+#include <cstring>
+#include <stdio.h>
+
+#include "hid_dumps.h"
+#include "hid_parser.h"
+#include "hid_gamecube_mapping.h"
+#include "hid_decoders.h"
+
+/*
+Differential test of generated decoders (hid_decoders.h) against ParseReport() with canonical_pad_apply():
+dump reports and randomly mutated / truncated reports must give same return value and same canonical pad.
+*/
+
+typedef struct decoder_test_report
+{
+	const uint8_t* data;
+	uint16_t size;
+} decoder_test_report;
+
+typedef struct decoder_test_case
+{
+	const char* name;
+	uint16_t vid;
+	uint16_t pid;
+	const uint8_t* descriptor;
+	uint16_t descriptor_size;
+	decoder_test_report reports[8];
+} decoder_test_case;
+
+#define TEST_REPORT(report) { report, sizeof(report) }
+
+static const decoder_test_case g_cases[] =
+{
+	{ "my_dualshock_4", 0x054c, 0x05c4, my_dualshock_4_hid_report_descriptor, sizeof(my_dualshock_4_hid_report_descriptor),
+		{
+			TEST_REPORT(my_dualshock_4_hid_report_x_o_pressed),
+			TEST_REPORT(my_dualshock_4_hid_report_u_x_pressed),
+			TEST_REPORT(my_dualshock_4_hid_report_options_r2_max_pressed),
+			TEST_REPORT(my_dualshock_4_hid_report_lx_rx_min),
+			TEST_REPORT(my_dualshock_4_hid_report_idle),
+		}
+	},
+	{ "dualshock_4_gimx", 0x054c, 0x05c4, dualshock_4_hid_report_descriptor_gimx_fr_wiki, sizeof(dualshock_4_hid_report_descriptor_gimx_fr_wiki),
+		{
+			TEST_REPORT(dualshock_4_hid_report_gimx_fr_wiki),
+			TEST_REPORT(my_dualshock_4_hid_report_x_o_pressed),
+		}
+	},
+	{ "dualsence", 0x054c, 0x0ce6, dualsence_hid_report_descriptor, sizeof(dualsence_hid_report_descriptor),
+		{
+			TEST_REPORT(dualsence_hid_report_idle),
+			TEST_REPORT(dualsence_hid_report_x_o_pressed),
+			TEST_REPORT(dualsence_hid_report_u_x_pressed),
+			TEST_REPORT(dualsence_hid_report_options_r2_max_pressed),
+			TEST_REPORT(dualsence_hid_report_lx_rx_min),
+		}
+	},
+};
+
+#define MUTATIONS 20000
+
+static canonical_pad g_parsed;
+
+static void gamepad_callback(uint8_t pad, uint32_t control_type, uint32_t value)
+{
+	if (pad == 0) // Generated decoders are for single pad devices
+		canonical_pad_apply(&g_parsed, control_type, value);
+}
+
+static uint32_t g_random = 0x12345678;
+
+static uint32_t random_next()
+{
+	// xorshift32
+	g_random ^= g_random << 13;
+	g_random ^= g_random >> 17;
+	g_random ^= g_random << 5;
+
+	return g_random;
+}
+
+static void compare(const decoder_test_case& test, hid_decoder_t decoder, const uint8_t* report, uint16_t len)
+{
+	g_parsed = neutralCanonicalPad;
+	const bool parsed = ParseReport(report, len, gamepad_callback);
+
+	canonical_pad decoded = neutralCanonicalPad;
+	const bool decoded_ok = decoder(report, len, &decoded);
+
+	if (parsed != decoded_ok || g_parsed.buttons != decoded.buttons || memcmp(g_parsed.axes, decoded.axes, sizeof(decoded.axes)))
+	{
+		printf("%s: decoder differs from ParseReport(), report id %02x len %u\n", test.name, report[0], len);
+		assert(false);
+	}
+}
+
+int main()
+{
+	for (const decoder_test_case& test : g_cases)
+	{
+		const uint32_t hash = hid_parser_hash(test.descriptor, test.descriptor_size, hid_to_gamecube_mapping);
+		const hid_decoder_t decoder = hid_decoder_find(test.vid, test.pid, hash);
+
+		assert(decoder);
+		assert(!hid_decoder_find(test.vid, test.pid, hash ^ 1)); // Changed descriptor or preset: generic parser
+		assert(!hid_decoder_find(test.vid, test.pid ^ 1, hash));
+
+		assert(ParseReportDescriptor(test.descriptor, test.descriptor_size, hid_to_gamecube_mapping));
+
+		uint16_t reports = 0;
+
+		while (reports < sizeof(test.reports) / sizeof(test.reports[0]) && test.reports[reports].data)
+			reports++;
+
+		for (uint16_t i = 0; i < reports; i++)
+			compare(test, decoder, test.reports[i].data, test.reports[i].size);
+
+		uint8_t buffer[128];
+
+		for (uint32_t i = 0; i < MUTATIONS; i++)
+		{
+			const decoder_test_report& base = test.reports[random_next() % reports];
+
+			memset(buffer, 0, sizeof(buffer));
+			memcpy(buffer, base.data, base.size);
+
+			const uint32_t changes = 1 + random_next() % 8;
+
+			for (uint32_t change = 0; change < changes; change++)
+				buffer[random_next() % base.size] = (uint8_t)random_next();
+
+			// Other report IDs
+			if (!(random_next() % 8))
+				buffer[0] = (uint8_t)random_next();
+
+			// Short reports
+			uint16_t len = base.size;
+
+			if (!(random_next() % 8))
+				len = 1 + random_next() % base.size;
+
+			compare(test, decoder, buffer, len);
+		}
+
+		printf("%s: %u reports, %u mutations match ParseReport()\n", test.name, reports, MUTATIONS);
+	}
+
+	return 0;
+}
@@ -0,0 +1,47 @@
+#include "hid_decoders.h"
+
+#if HID_DECODERS
+
+#include "hot_path.h"
+
+#include "hid_decoders/my_dualshock_4.h"
+#include "hid_decoders/dualshock_4_gimx.h"
+#include "hid_decoders/dualsence.h"
+
+typedef struct hid_decoder_entry
+{
+	uint16_t vid;
+	uint16_t pid;
+	uint32_t hash;
+	hid_decoder_t decode;
+} hid_decoder_entry;
+
+// Called through pointer: wrappers place decoders in SRAM with RAM_HOT_PATHS
+#define HID_DECODER(name, upper) \
+	static bool HOT_PATH(decode_##name)(const uint8_t* report, uint16_t len, canonical_pad* pad) { return hid_decode_##name(report, len, pad); }
+#define HID_DECODER_ENTRY(name, upper) \
+	{ HID_DECODER_##upper##_VID, HID_DECODER_##upper##_PID, HID_DECODER_##upper##_HASH, decode_##name }
+
+HID_DECODER(my_dualshock_4, MY_DUALSHOCK_4)
+HID_DECODER(dualshock_4_gimx, DUALSHOCK_4_GIMX)
+HID_DECODER(dualsence, DUALSENCE)
+
+static const hid_decoder_entry g_decoders[] =
+{
+	HID_DECODER_ENTRY(my_dualshock_4, MY_DUALSHOCK_4),
+	HID_DECODER_ENTRY(dualshock_4_gimx, DUALSHOCK_4_GIMX),
+	HID_DECODER_ENTRY(dualsence, DUALSENCE),
+};
+
+hid_decoder_t hid_decoder_find(uint16_t vid, uint16_t pid, uint32_t hash)
+{
+	for (const hid_decoder_entry& entry : g_decoders)
+	{
+		if (entry.vid == vid && entry.pid == pid && entry.hash == hash)
+			return entry.decode;
+	}
+
+	return nullptr;
+}
+
+#endif
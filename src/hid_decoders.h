@@ -0,0 +1,27 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "canonical_pad.h"
+
+/*
+Generated fixed layout HID report decoders (headers in src/hid_decoders, HID_Decoder_Gen).
+
+Decoder replaces ParseReport() with canonical_pad_apply() for known pad: report fields are read at constant
+offsets with constant masks and range conversions, no segment list walk and no per control callback.
+Decoder is picked at mount by VID/PID and hid_parser_hash() of report descriptor and hid_to_gamecube_mapping,
+other devices and changed presets fall back to generic parser.
+
+Regenerate decoders after parser or hid_to_gamecube_mapping change, HID_Decoder_Gen tests fail otherwise:
+	HID_Decoder_Gen --name dualsence --dump dualsence_hid_report_descriptor --vid 054c --pid 0ce6 --output hid_decoders/dualsence.h
+*/
+
+// Decode report into canonical pad, returns false if report is not decoded (same as ParseReport()).
+typedef bool (*hid_decoder_t)(const uint8_t* report, uint16_t len, canonical_pad* pad);
+
+#if HID_DECODERS
+// Generated decoder for device and descriptor, nullptr if none.
+hid_decoder_t hid_decoder_find(uint16_t vid, uint16_t pid, uint32_t hash);
+#else
+inline hid_decoder_t hid_decoder_find(uint16_t, uint16_t, uint32_t) { return nullptr; }
+#endif
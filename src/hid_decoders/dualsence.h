@@ -0,0 +1,81 @@
+#pragma once
+
+// Generated by HID_Decoder_Gen (src/hid_decoder_gen.cpp) from dualsence_hid_report_descriptor with hid_to_gamecube_mapping, do not edit.
+
+#include "../hid_parser.h"
+#include "../canonical_pad.h"
+
+#define HID_DECODER_DUALSENCE_VID 0x054c
+#define HID_DECODER_DUALSENCE_PID 0x0ce6
+#define HID_DECODER_DUALSENCE_HASH 0x749e7ce4 // hid_parser_hash() of 273 byte descriptor
+
+inline bool hid_decode_dualsence(const uint8_t* report, uint16_t len, canonical_pad* pad)
+{
+	if (!len)
+		return false;
+
+	switch (report[0])
+	{
+	case 0x01:
+	{
+		if (len < 64)
+			return false;
+
+		uint32_t v;
+
+		v = report[9] >> 7; // Bit 79
+		pad->buttons |= (uint32_t)(map_to_uint8(v, 0, 1) > 0) << PAD_BUTTON_R3;
+		v = (report[9] >> 6) & 0x1; // Bit 78
+		pad->buttons |= (uint32_t)(map_to_uint8(v, 0, 1) > 0) << PAD_BUTTON_L3;
+		v = (report[9] >> 5) & 0x1; // Bit 77
+		pad->buttons |= (uint32_t)(map_to_uint8(v, 0, 1) > 0) << PAD_BUTTON_START;
+		v = (report[9] >> 4) & 0x1; // Bit 76
+		pad->buttons |= (uint32_t)(map_to_uint8(v, 0, 1) > 0) << PAD_BUTTON_SELECT;
+		v = (report[9] >> 3) & 0x1; // Bit 75
+		pad->buttons |= (uint32_t)(map_to_uint8(v, 0, 1) > 0) << PAD_BUTTON_R2;
+		v = (report[9] >> 2) & 0x1; // Bit 74
+		pad->buttons |= (uint32_t)(map_to_uint8(v, 0, 1) > 0) << PAD_BUTTON_L2;
+		v = (report[9] >> 1) & 0x1; // Bit 73
+		pad->buttons |= (uint32_t)(map_to_uint8(v, 0, 1) > 0) << PAD_BUTTON_R1;
+		v = report[9] & 0x1; // Bit 72
+		pad->buttons |= (uint32_t)(map_to_uint8(v, 0, 1) > 0) << PAD_BUTTON_L1;
+		v = report[8] >> 7; // Bit 71
+		pad->buttons |= (uint32_t)(map_to_uint8(v, 0, 1) > 0) << PAD_BUTTON_NORTH;
+		v = (report[8] >> 6) & 0x1; // Bit 70
+		pad->buttons |= (uint32_t)(map_to_uint8(v, 0, 1) > 0) << PAD_BUTTON_EAST;
+		v = (report[8] >> 5) & 0x1; // Bit 69
+		pad->buttons |= (uint32_t)(map_to_uint8(v, 0, 1) > 0) << PAD_BUTTON_SOUTH;
+		v = (report[8] >> 4) & 0x1; // Bit 68
+		pad->buttons |= (uint32_t)(map_to_uint8(v, 0, 1) > 0) << PAD_BUTTON_WEST;
+		v = report[8] & 0xF; // Bits 64..67
+		pad->buttons |= (uint32_t)(v == 7) << PAD_BUTTON_UP;
+		pad->buttons |= (uint32_t)(v == 7) << PAD_BUTTON_LEFT;
+		pad->buttons |= (uint32_t)(v == 6) << PAD_BUTTON_LEFT;
+		pad->buttons |= (uint32_t)(v == 5) << PAD_BUTTON_LEFT;
+		pad->buttons |= (uint32_t)(v == 5) << PAD_BUTTON_DOWN;
+		pad->buttons |= (uint32_t)(v == 4) << PAD_BUTTON_DOWN;
+		pad->buttons |= (uint32_t)(v == 3) << PAD_BUTTON_DOWN;
+		pad->buttons |= (uint32_t)(v == 3) << PAD_BUTTON_RIGHT;
+		pad->buttons |= (uint32_t)(v == 2) << PAD_BUTTON_RIGHT;
+		pad->buttons |= (uint32_t)(v == 1) << PAD_BUTTON_RIGHT;
+		pad->buttons |= (uint32_t)(v == 1) << PAD_BUTTON_UP;
+		pad->buttons |= (uint32_t)(v == 0) << PAD_BUTTON_UP;
+		v = report[6]; // Bits 48..55
+		PAD_AXIS(pad, PAD_AXIS_RT) = (uint8_t)(v);
+		v = report[5]; // Bits 40..47
+		PAD_AXIS(pad, PAD_AXIS_LT) = (uint8_t)(v);
+		v = report[4]; // Bits 32..39
+		PAD_AXIS(pad, PAD_AXIS_RY) = (uint8_t)(UINT8_MAX - (uint8_t)(v));
+		v = report[3]; // Bits 24..31
+		PAD_AXIS(pad, PAD_AXIS_RX) = (uint8_t)(v);
+		v = report[2]; // Bits 16..23
+		PAD_AXIS(pad, PAD_AXIS_LY) = (uint8_t)(UINT8_MAX - (uint8_t)(v));
+		v = report[1]; // Bits 8..15
+		PAD_AXIS(pad, PAD_AXIS_LX) = (uint8_t)(v);
+
+		return true;
+	}
+	default:
+		return false;
+	}
+}
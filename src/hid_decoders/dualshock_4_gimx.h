@@ -0,0 +1,81 @@
+#pragma once
+
+// Generated by HID_Decoder_Gen (src/hid_decoder_gen.cpp) from dualshock_4_hid_report_descriptor_gimx_fr_wiki with hid_to_gamecube_mapping, do not edit.
+
+#include "../hid_parser.h"
+#include "../canonical_pad.h"
+
+#define HID_DECODER_DUALSHOCK_4_GIMX_VID 0x054c
+#define HID_DECODER_DUALSHOCK_4_GIMX_PID 0x05c4
+#define HID_DECODER_DUALSHOCK_4_GIMX_HASH 0xf95f8c58 // hid_parser_hash() of 467 byte descriptor
+
+inline bool hid_decode_dualshock_4_gimx(const uint8_t* report, uint16_t len, canonical_pad* pad)
+{
+	if (!len)
+		return false;
+
+	switch (report[0])
+	{
+	case 0x01:
+	{
+		if (len < 64)
+			return false;
+
+		uint32_t v;
+
+		v = report[9]; // Bits 72..79
+		PAD_AXIS(pad, PAD_AXIS_RT) = (uint8_t)(v);
+		v = report[8]; // Bits 64..71
+		PAD_AXIS(pad, PAD_AXIS_LT) = (uint8_t)(v);
+		v = report[6] >> 7; // Bit 55
+		pad->buttons |= (uint32_t)(map_to_uint8(v, 0, 1) > 0) << PAD_BUTTON_R3;
+		v = (report[6] >> 6) & 0x1; // Bit 54
+		pad->buttons |= (uint32_t)(map_to_uint8(v, 0, 1) > 0) << PAD_BUTTON_L3;
+		v = (report[6] >> 5) & 0x1; // Bit 53
+		pad->buttons |= (uint32_t)(map_to_uint8(v, 0, 1) > 0) << PAD_BUTTON_START;
+		v = (report[6] >> 4) & 0x1; // Bit 52
+		pad->buttons |= (uint32_t)(map_to_uint8(v, 0, 1) > 0) << PAD_BUTTON_SELECT;
+		v = (report[6] >> 3) & 0x1; // Bit 51
+		pad->buttons |= (uint32_t)(map_to_uint8(v, 0, 1) > 0) << PAD_BUTTON_R2;
+		v = (report[6] >> 2) & 0x1; // Bit 50
+		pad->buttons |= (uint32_t)(map_to_uint8(v, 0, 1) > 0) << PAD_BUTTON_L2;
+		v = (report[6] >> 1) & 0x1; // Bit 49
+		pad->buttons |= (uint32_t)(map_to_uint8(v, 0, 1) > 0) << PAD_BUTTON_R1;
+		v = report[6] & 0x1; // Bit 48
+		pad->buttons |= (uint32_t)(map_to_uint8(v, 0, 1) > 0) << PAD_BUTTON_L1;
+		v = report[5] >> 7; // Bit 47
+		pad->buttons |= (uint32_t)(map_to_uint8(v, 0, 1) > 0) << PAD_BUTTON_NORTH;
+		v = (report[5] >> 6) & 0x1; // Bit 46
+		pad->buttons |= (uint32_t)(map_to_uint8(v, 0, 1) > 0) << PAD_BUTTON_EAST;
+		v = (report[5] >> 5) & 0x1; // Bit 45
+		pad->buttons |= (uint32_t)(map_to_uint8(v, 0, 1) > 0) << PAD_BUTTON_SOUTH;
+		v = (report[5] >> 4) & 0x1; // Bit 44
+		pad->buttons |= (uint32_t)(map_to_uint8(v, 0, 1) > 0) << PAD_BUTTON_WEST;
+		v = report[5] & 0xF; // Bits 40..43
+		pad->buttons |= (uint32_t)(v == 7) << PAD_BUTTON_UP;
+		pad->buttons |= (uint32_t)(v == 7) << PAD_BUTTON_LEFT;
+		pad->buttons |= (uint32_t)(v == 6) << PAD_BUTTON_LEFT;
+		pad->buttons |= (uint32_t)(v == 5) << PAD_BUTTON_LEFT;
+		pad->buttons |= (uint32_t)(v == 5) << PAD_BUTTON_DOWN;
+		pad->buttons |= (uint32_t)(v == 4) << PAD_BUTTON_DOWN;
+		pad->buttons |= (uint32_t)(v == 3) << PAD_BUTTON_DOWN;
+		pad->buttons |= (uint32_t)(v == 3) << PAD_BUTTON_RIGHT;
+		pad->buttons |= (uint32_t)(v == 2) << PAD_BUTTON_RIGHT;
+		pad->buttons |= (uint32_t)(v == 1) << PAD_BUTTON_RIGHT;
+		pad->buttons |= (uint32_t)(v == 1) << PAD_BUTTON_UP;
+		pad->buttons |= (uint32_t)(v == 0) << PAD_BUTTON_UP;
+		v = report[4]; // Bits 32..39
+		PAD_AXIS(pad, PAD_AXIS_RY) = (uint8_t)(UINT8_MAX - (uint8_t)(v));
+		v = report[3]; // Bits 24..31
+		PAD_AXIS(pad, PAD_AXIS_RX) = (uint8_t)(v);
+		v = report[2]; // Bits 16..23
+		PAD_AXIS(pad, PAD_AXIS_LY) = (uint8_t)(UINT8_MAX - (uint8_t)(v));
+		v = report[1]; // Bits 8..15
+		PAD_AXIS(pad, PAD_AXIS_LX) = (uint8_t)(v);
+
+		return true;
+	}
+	default:
+		return false;
+	}
+}
@@ -1,715 +1,715 @@
-﻿#pragma once
-
-#include <stdint.h>
-
-// https://github.com/DJm00n/ControllersInfo/tree/master/dualshock4
-
-// array size is 507
-static const uint8_t dualshock4_hid_report_descriptor[] = {
-  0x05, 0x01, 0x09, 0x05, 0xa1, 0x01, 0x85, 0x01, 0x09, 0x30, 0x09, 0x31, 0x09, 0x32, 0x09, 0x35,
-  0x15, 0x00, 0x26, 0xff, 0x00, 0x75, 0x08, 0x95, 0x04, 0x81, 0x02, 0x09, 0x39, 0x15, 0x00, 0x25,
-  0x07, 0x35, 0x00, 0x46, 0x3b, 0x01, 0x65, 0x14, 0x75, 0x04, 0x95, 0x01, 0x81, 0x42, 0x65, 0x00,
-  0x05, 0x09, 0x19, 0x01, 0x29, 0x0e, 0x15, 0x00, 0x25, 0x01, 0x75, 0x01, 0x95, 0x0e, 0x81, 0x02,
-  0x06, 0x00, 0xff, 0x09, 0x20, 0x75, 0x06, 0x95, 0x01, 0x15, 0x00, 0x25, 0x7f, 0x81, 0x02, 0x05,
-  0x01, 0x09, 0x33, 0x09, 0x34, 0x15, 0x00, 0x26, 0xff, 0x00, 0x75, 0x08, 0x95, 0x02, 0x81, 0x02,
-  0x06, 0x00, 0xff, 0x09, 0x21, 0x95, 0x36, 0x81, 0x02, 0x85, 0x05, 0x09, 0x22, 0x95, 0x1f, 0x91,
-  0x02, 0x85, 0x04, 0x09, 0x23, 0x95, 0x24, 0xb1, 0x02, 0x85, 0x02, 0x09, 0x24, 0x95, 0x24, 0xb1,
-  0x02, 0x85, 0x08, 0x09, 0x25, 0x95, 0x03, 0xb1, 0x02, 0x85, 0x10, 0x09, 0x26, 0x95, 0x04, 0xb1,
-  0x02, 0x85, 0x11, 0x09, 0x27, 0x95, 0x02, 0xb1, 0x02, 0x85, 0x12, 0x06, 0x02, 0xff, 0x09, 0x21,
-  0x95, 0x0f, 0xb1, 0x02, 0x85, 0x13, 0x09, 0x22, 0x95, 0x16, 0xb1, 0x02, 0x85, 0x14, 0x06, 0x05,
-  0xff, 0x09, 0x20, 0x95, 0x10, 0xb1, 0x02, 0x85, 0x15, 0x09, 0x21, 0x95, 0x2c, 0xb1, 0x02, 0x06,
-  0x80, 0xff, 0x85, 0x80, 0x09, 0x20, 0x95, 0x06, 0xb1, 0x02, 0x85, 0x81, 0x09, 0x21, 0x95, 0x06,
-  0xb1, 0x02, 0x85, 0x82, 0x09, 0x22, 0x95, 0x05, 0xb1, 0x02, 0x85, 0x83, 0x09, 0x23, 0x95, 0x01,
-  0xb1, 0x02, 0x85, 0x84, 0x09, 0x24, 0x95, 0x04, 0xb1, 0x02, 0x85, 0x85, 0x09, 0x25, 0x95, 0x06,
-  0xb1, 0x02, 0x85, 0x86, 0x09, 0x26, 0x95, 0x06, 0xb1, 0x02, 0x85, 0x87, 0x09, 0x27, 0x95, 0x23,
-  0xb1, 0x02, 0x85, 0x88, 0x09, 0x28, 0x95, 0x3f, 0xb1, 0x02, 0x85, 0x89, 0x09, 0x29, 0x95, 0x02,
-  0xb1, 0x02, 0x85, 0x90, 0x09, 0x30, 0x95, 0x05, 0xb1, 0x02, 0x85, 0x91, 0x09, 0x31, 0x95, 0x03,
-  0xb1, 0x02, 0x85, 0x92, 0x09, 0x32, 0x95, 0x03, 0xb1, 0x02, 0x85, 0x93, 0x09, 0x33, 0x95, 0x0c,
-  0xb1, 0x02, 0x85, 0x94, 0x09, 0x34, 0x95, 0x3f, 0xb1, 0x02, 0x85, 0xa0, 0x09, 0x40, 0x95, 0x06,
-  0xb1, 0x02, 0x85, 0xa1, 0x09, 0x41, 0x95, 0x01, 0xb1, 0x02, 0x85, 0xa2, 0x09, 0x42, 0x95, 0x01,
-  0xb1, 0x02, 0x85, 0xa3, 0x09, 0x43, 0x95, 0x30, 0xb1, 0x02, 0x85, 0xa4, 0x09, 0x44, 0x95, 0x0d,
-  0xb1, 0x02, 0x85, 0xf0, 0x09, 0x47, 0x95, 0x3f, 0xb1, 0x02, 0x85, 0xf1, 0x09, 0x48, 0x95, 0x3f,
-  0xb1, 0x02, 0x85, 0xf2, 0x09, 0x49, 0x95, 0x0f, 0xb1, 0x02, 0x85, 0xa7, 0x09, 0x4a, 0x95, 0x01,
-  0xb1, 0x02, 0x85, 0xa8, 0x09, 0x4b, 0x95, 0x01, 0xb1, 0x02, 0x85, 0xa9, 0x09, 0x4c, 0x95, 0x08,
-  0xb1, 0x02, 0x85, 0xaa, 0x09, 0x4e, 0x95, 0x01, 0xb1, 0x02, 0x85, 0xab, 0x09, 0x4f, 0x95, 0x39,
-  0xb1, 0x02, 0x85, 0xac, 0x09, 0x50, 0x95, 0x39, 0xb1, 0x02, 0x85, 0xad, 0x09, 0x51, 0x95, 0x0b,
-  0xb1, 0x02, 0x85, 0xae, 0x09, 0x52, 0x95, 0x01, 0xb1, 0x02, 0x85, 0xaf, 0x09, 0x53, 0x95, 0x02,
-  0xb1, 0x02, 0x85, 0xb0, 0x09, 0x54, 0x95, 0x3f, 0xb1, 0x02, 0x85, 0xe0, 0x09, 0x57, 0x95, 0x02,
-  0xb1, 0x02, 0x85, 0xb3, 0x09, 0x55, 0x95, 0x3f, 0xb1, 0x02, 0x85, 0xb4, 0x09, 0x55, 0x95, 0x3f,
-  0xb1, 0x02, 0x85, 0xb5, 0x09, 0x56, 0x95, 0x3f, 0xb1, 0x02, 0x85, 0xd0, 0x09, 0x58, 0x95, 0x3f,
-  0xb1, 0x02, 0x85, 0xd4, 0x09, 0x59, 0x95, 0x3f, 0xb1, 0x02, 0xc0
-};
-
-/*
-//----------------------------------------------------------------------------------------------
-Own dumps https://github.com/proboterror
-
-DualShock 4
-
-Device Descriptor :
-12 01 00 02 00 00 00 40 4C 05 C4 05 00 01 01 02
-00 01
-
-DeviceClass:0
-VendorID:54c
-ProductID:5c4
-bcdDevice:1000x054C 0x05C4 0x0100
-Config Descriptor :
-09 02 29 00 01 01 00 C0 FA 09 04 00 00 02 03 00
-00 00 09 21 11 01 00 01 22 E3 01 07 05 84 03 40
-00 05 07 05 03 03 40 00 05
-
-descrType:4
-descrType:21
-descrType:5
-descrType:5gcd ok 41
-
-Interface 0:
-InterfaceProtocol: 0
-
-Interface 0 Report Descriptor
-05 01 09 05 A1 01 85 01 09 30 09 31 09 32 09 35
-15 00 26 FF 00 75 08 95 04 81 02 09 39 15 00 25
-07 35 00 46 3B 01 65 14 75 04 95 01 81 42 65 00
-05 09 19 01 29 0E 15 00 25 01 75 01 95 0E 81 02
-06 00 FF 09 20 75 06 95 01 15 00 25 7F 81 02 05
-01 09 33 09 34 15 00 26 FF 00 75 08 95 02 81 02
-06 00 FF 09 21 95 36 81 02 85 05 09 22 95 1F 91
-02 85 04 09 23 95 24 B1 02 85 02 09 24 95 24 B1
-02 85 08 09 25 95 03 B1 02 85 10 09 26 95 04 B1
-02 85 11 09 27 95 02 B1 02 85 12 06 02 FF 09 21
-95 0F B1 02 85 13 09 22 95 16 B1 02 85 14 06 05
-FF 09 20 95 10 B1 02 85 15 09 21 95 2C B1 02 06
-80 FF 85 80 09 20 95 06 B1 02 85 81 09 21 95 06
-B1 02 85 82 09 22 95 05 B1 02 85 83 09 23 95 01
-B1 02 85 84 09 24 95 04 B1 02 85 85 09 25 95 06
-B1 02 85 86 09 26 95 06 B1 02 85 87 09 27 95 23
-B1 02 85 88 09 28 95 22 B1 02 85 89 09 29 95 02
-B1 02 85 90 09 30 95 05 B1 02 85 91 09 31 95 03
-B1 02 85 92 09 32 95 03 B1 02 85 93 09 33 95 0C
-B1 02 85 A0 09 40 95 06 B1 02 85 A1 09 41 95 01
-B1 02 85 A2 09 42 95 01 B1 02 85 A3 09 43 95 30
-B1 02 85 A4 09 44 95 0D B1 02 85 A5 09 45 95 15
-B1 02 85 A6 09 46 95 15 B1 02 85 F0 09 47 95 3F
-B1 02 85 F1 09 48 95 3F B1 02 85 F2 09 49 95 0F
-B1 02 85 A7 09 4A 95 01 B1 02 85 A8 09 4B 95 01
-B1 02 85 A9 09 4C 95 08 B1 02 85 AA 09 4E 95 01
-B1 02 85 AB 09 4F 95 39 B1 02 85 AC 09 50 95 39
-B1 02 85 AD 09 51 95 0B B1 02 85 AE 09 52 95 01
-B1 02 85 AF 09 53 95 02 B1 02 85 B0 09 54 95 3F
-B1 02 85 B1 09 55 95 02 B1 02 85 B2 09 56 95 02
-B1 02 C0
-// 483 bytes
-
-//-----------------------------------------------------------------
-Keyboard Red Square Keyrox TKL Classic RSQ-20024
-
-Device Descriptor :
-12 01 10 01 00 00 00 08 16 04 45 C3 00 00 00 02
-00 01
-
-
-DeviceClass:0
-VendorID : 416
-ProductID : c345
-bcdDevice : 00x0416 0xC345 0x0000
-Config Descriptor :
-09 02 5B 00 03 01 00 A0 C8 09 04 00 00 01 03 01
-01 00 09 21 10 01 00 01 22 41 00 07 05 81 03 08
-00 01 09 04 01 00 01 03 00 00 00 09 21 10 01 00
-01 22 BE 00 07 05 82 03 20 00 01 09 04 02 00 02
-03 00 00 00 09 21 10 01 00 01 22 20 00 07 05 83
-03 40 00 01 07 05 04 03 40 00 01
-
-
-Interface 0 :
-InterfaceProtocol : 1
-
-Interface 0 Report Descriptor // Note: this is generic HID keyboard descriptor
-05 01 09 06 A1 01 05 07 19 E0 29 E7 15 00 25 01
-75 01 95 08 81 02 95 01 75 08 81 01 95 05 75 01
-05 08 19 01 29 05 91 02 95 01 75 03 91 01 95 06
-75 08 15 00 26 FF 00 05 07 19 00 2A 97 00 81 00
-C0
-
-Interface 1:
-InterfaceProtocol: 0
-
-Interface 1 Report Descriptor
-05 01 09 80 A1 01 85 01 19 81 29 83 15 00 25 01
-75 01 95 03 81 02 95 05 81 01 C0 05 0C 09 01 A1
-01 85 02 15 00 25 01 09 E9 09 EA 09 E2 09 CD 19
-B5 29 B8 75 01 95 08 81 02 0A 8A 01 0A 21 02 0A
-2A 02 1A 23 02 2A 27 02 81 02 0A 83 01 0A 96 01
-0A 92 01 0A 9E 01 0A 94 01 0A 06 02 09 B2 09 B4
-81 02 C0 05 01 09 06 A1 01 85 03 05 07 75 01 95
-A0 15 00 25 01 19 00 29 9F 81 02 C0 05 01 09 02
-A1 01 85 04 09 01 A1 00 05 09 19 01 29 05 15 00
-25 01 75 01 95 05 81 02 75 03 95 01 81 01 05 01
-09 30 09 31 16 01 80 26 FF 7F 75 10 95 02 81 06
-09 38 15 81 25 7F 75 08 95 01 81 06 C0 C0
-
-Report 3, usage 6, length 168:
-startbit 8, it 5, ip 0, chan 0, cont 0, size 1, count a0
-
-Report 4, usage 2, length 56 :
-startbit 48, it 3, ip 0, chan 1, cont 6, size 8, count 1
-startbit 32, it 3, ip 0, chan 1, cont 5, size 10, count 2
-startbit 16, it 3, ip 0, chan 1, cont 4, size 10, count 2
-startbit 8, it 5, ip 0, chan 1, cont 1, size 1, count 5
-
-Interface 2:
-InterfaceProtocol: 0
-
-Interface 2 Report Descriptor
-06 1B FF 09 91 A1 01 85 01 19 00 2A FF 00 15 00
-26 FF 00 75 08 95 3F 81 02 19 00 29 FF 91 02 C0
-
-Key A pressed report:
-00 00 04 00 00 00 00 00
-
-//-----------------------------------------------------------
-Keyboard A4Teach FStyler FX51
-
-Device Descriptor :
-12 01 00 02 00 00 00 08 DA 09 68 22 05 00 01 02
-00 01
-
-DeviceClass:0
-VendorID:9da
-ProductID:2268
-bcdDevice:50x09DA 0x2268 0x0005
-Config Descriptor :
-09 02 3B 00 02 01 00 A0 32 09 04 00 00 01 03 01
-01 00 09 21 11 01 00 01 22 4F 00 07 05 81 03 08
-00 0A 09 04 01 00 01 03 00 00 00 09 21 11 01 00
-01 22 34 00 07 05 82 03 03 00 0A
-
-Interface 0:
-InterfaceProtocol: 1
-
-Interface 0 Report Descriptor -
-05 01 09 06 A1 01 05 07 19 E0 29 E7 15 00 25 01
-75 01 95 08 81 02 95 01 75 08 81 01 95 05 75 01
-05 08 19 01 29 05 91 02 95 01 75 03 91 01 95 06
-75 08 15 00 26 FF 00 05 07 19 00 2A FF 00 81 00
-05 0C 09 00 15 80 25 7F 75 08 95 08 B1 02 C0
-
-Interface 1:
-InterfaceProtocol: 0
-
-Interface 1 Report Descriptor
-05 0C 09 01 A1 01 85 01 19 00 2A 3C 02 15 00 26
-3C 02 95 01 75 10 81 00 C0 05 01 09 80 A1 01 85
-02 19 81 29 83 15 00 25 01 75 01 95 03 81 02 95
-05 81 01 C0
-
-Report A pressed:
-00 00 04 00 00 00 00 00
-
-//----------------------------------------------------------------
-Mouse Logitech LZ247D5 + Unified Receiver LZ24780-DJ M/N:C-U0007
-
-Device Descriptor :
-12 01 00 02 00 00 00 08 6D 04 2B C5 01 12 01 02
-00 01
-
-DeviceClass:0
-VendorID:46d
-ProductID:c52b
-bcdDevice:12010x046D 0xC52B 0x1201
-Config Descriptor :
-09 02 54 00 03 01 04 A0 31 09 04 00 00 01 03 01
-01 00 09 21 11 01 00 01 22 3B 00 07 05 81 03 08
-00 08 09 04 01 00 01 03 01 02 00 09 21 11 01 00
-01 22 94 00 07 05 82 03 08 00 02 09 04 02 00 01
-03 00 00 00 09 21 11 01 00 01 22 62 00 07 05 83
-03 20 00 02
-
-Interface 0:
-InterfaceProtocol: 1
-
-Interface 0 Report Descriptor
-05 01 09 06 A1 01 05 07 19 E0 29 E7 15 00 25 01
-75 01 95 08 81 02 81 03 95 05 05 08 19 01 29 05
-91 02 95 01 75 03 91 01 95 06 75 08 15 00 26 A4
-00 05 07 19 00 2A A4 00 81 00 C0
-
-Interface 1:
-InterfaceProtocol: 2
-
-Interface 1 Report Descriptor // Buttons, X, Y, Wheel; Report ID 2
-05 01 09 02 A1 01 85 02 09 01 A1 00 05 09 19 01
-29 10 15 00 25 01 95 10 75 01 81 02 05 01 16 01
-F8 26 FF 07 75 0C 95 02 09 30 09 31 81 06 15 81
-25 7F 75 08 95 01 09 38 81 06 05 0C 0A 38 02 95
-01 81 06 C0 C0 05 0C 09 01 A1 01 85 03 75 10 95
-02 15 01 26 8C 02 19 01 2A 8C 02 81 00 C0 05 01
-09 80 A1 01 85 04 75 02 95 01 15 01 25 03 09 82
-09 81 09 83 81 60 75 06 81 03 C0 06 BC FF 09 88
-A1 01 85 08 19 01 29 FF 15 01 26 FF 00 75 08 95
-01 81 00 C0
-
-Report 2, usage 2, length 64:
-startbit 56, it 0, ip 0, chan 0, cont 0, size 8, count 1
-startbit 48, it 3, ip 0, chan 1, cont 6, size 8, count 1
-startbit 36, it 3, ip 0, chan 1, cont 5, size c, count 2
-startbit 24, it 3, ip 0, chan 1, cont 4, size c, count 2
-startbit 8, it 5, ip 0, chan 1, cont 1, size 1, count 10
-
-Interface 2:
-InterfaceProtocol: 0
-
-Interface 2 Report Descriptor
-06 00 FF 09 01 A1 01 85 10 75 08 95 06 15 00 26
-FF 00 09 01 81 00 09 01 91 00 C0 06 00 FF 09 02
-A1 01 85 11 75 08 95 13 15 00 26 FF 00 09 02 81
-00 09 02 91 00 C0 06 00 FF 09 04 A1 01 85 20 75
-08 95 0E 15 00 26 FF 00 09 41 81 00 09 41 91 00
-85 21 95 1F 15 00 26 FF 00 09 42 81 00 09 42 91
-00 C0
-
-02 01 00 00 00 00 00 00
-
-128 96 0 1I1
-02 00 00 00 00 00 00 00
-
-128 96 0 0I1
-02 02 00 00 00 00 00 00
-
-128 96 0 2I1
-02 00 00 00 00 00 00 00
-
-128 96 0 0I1
-02 00 00 00 00 00 FF 00
-*/
-
-static const uint8_t keyboard_report_descriptor[] = {
-	0x05, 0x01, 0x09, 0x06, 0xA1, 0x01, 0x05, 0x07, 0x19, 0xE0, 0x29, 0xE7, 0x15, 0x00, 0x25, 0x01,
-	0x75, 0x01, 0x95, 0x08, 0x81, 0x02, 0x95, 0x01, 0x75, 0x08, 0x81, 0x01, 0x95, 0x05, 0x75, 0x01,
-	0x05, 0x08, 0x19, 0x01, 0x29, 0x05, 0x91, 0x02, 0x95, 0x01, 0x75, 0x03, 0x91, 0x01, 0x95, 0x06,
-	0x75, 0x08, 0x15, 0x00, 0x26, 0xFF, 0x00, 0x05, 0x07, 0x19, 0x00, 0x2A, 0xFF, 0x00, 0x81, 0x00,
-	0x05, 0x0C, 0x09, 0x00, 0x15, 0x80, 0x25, 0x7F, 0x75, 0x08, 0x95, 0x08, 0xB1, 0x02, 0xC0
-};
-
-static const uint8_t keyboard_report_a_pressed[] = {
-	0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00 // Key 'A' pressed
-};
-
-static const uint8_t keyboard_report_none_pressed[] = {
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
-
-static const uint8_t mouse_report_descriptor[] = {
-	0x05, 0x01, 0x09, 0x02, 0xA1, 0x01, 0x85, 0x02, 0x09, 0x01, 0xA1, 0x00, 0x05, 0x09, 0x19, 0x01, 
-	0x29, 0x10, 0x15, 0x00, 0x25, 0x01, 0x95, 0x10, 0x75, 0x01, 0x81, 0x02, 0x05, 0x01, 0x16, 0x01, 
-	0xF8, 0x26, 0xFF, 0x07, 0x75, 0x0C, 0x95, 0x02, 0x09, 0x30, 0x09, 0x31, 0x81, 0x06, 0x15, 0x81, 
-	0x25, 0x7F, 0x75, 0x08, 0x95, 0x01, 0x09, 0x38, 0x81, 0x06, 0x05, 0x0C, 0x0A, 0x38, 0x02, 0x95, 
-	0x01, 0x81, 0x06, 0xC0, 0xC0, 0x05, 0x0C, 0x09, 0x01, 0xA1, 0x01, 0x85, 0x03, 0x75, 0x10, 0x95, 
-	0x02, 0x15, 0x01, 0x26, 0x8C, 0x02, 0x19, 0x01, 0x2A, 0x8C, 0x02, 0x81, 0x00, 0xC0, 0x05, 0x01, 
-	0x09, 0x80, 0xA1, 0x01, 0x85, 0x04, 0x75, 0x02, 0x95, 0x01, 0x15, 0x01, 0x25, 0x03, 0x09, 0x82, 
-	0x09, 0x81, 0x09, 0x83, 0x81, 0x60, 0x75, 0x06, 0x81, 0x03, 0xC0, 0x06, 0xBC, 0xFF, 0x09, 0x88, 
-	0xA1, 0x01, 0x85, 0x08, 0x19, 0x01, 0x29, 0xFF, 0x15, 0x01, 0x26, 0xFF, 0x00, 0x75, 0x08, 0x95, 
-	0x01, 0x81, 0x00, 0xC0
-};
-
-static const uint8_t mouse_report_1[] = {
-	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
-
-static const uint8_t mouse_report_2[] = {
-	0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 // Left button pressed
-};
-
-static const uint8_t mouse_report_3[] = {
-	0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 // Right button pressed
-};
-
-static const uint8_t mouse_report_4[] = {
-	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00 // Mouse wheel axis delta -1
-};
-
-// CUH-ZCT1E 4-472-348-31 F1
-// 478 bytes
-static const uint8_t my_dualshock_4_hid_report_descriptor[] = {
-	0x05, 0x01, 0x09, 0x05, 0xA1, 0x01, 0x85, 0x01, 0x09, 0x30, 0x09, 0x31, 0x09, 0x32, 0x09, 0x35,
-	0x15, 0x00, 0x26, 0xFF, 0x00, 0x75, 0x08, 0x95, 0x04, 0x81, 0x02, 0x09, 0x39, 0x15, 0x00, 0x25,
-	0x07, 0x35, 0x00, 0x46, 0x3B, 0x01, 0x65, 0x14, 0x75, 0x04, 0x95, 0x01, 0x81, 0x42, 0x65, 0x00,
-	0x05, 0x09, 0x19, 0x01, 0x29, 0x0E, 0x15, 0x00, 0x25, 0x01, 0x75, 0x01, 0x95, 0x0E, 0x81, 0x02,
-	0x06, 0x00, 0xFF, 0x09, 0x20, 0x75, 0x06, 0x95, 0x01, 0x15, 0x00, 0x25, 0x7F, 0x81, 0x02, 0x05,
-	0x01, 0x09, 0x33, 0x09, 0x34, 0x15, 0x00, 0x26, 0xFF, 0x00, 0x75, 0x08, 0x95, 0x02, 0x81, 0x02,
-	0x06, 0x00, 0xFF, 0x09, 0x21, 0x95, 0x36, 0x81, 0x02, 0x85, 0x05, 0x09, 0x22, 0x95, 0x1F, 0x91,
-	0x02, 0x85, 0x04, 0x09, 0x23, 0x95, 0x24, 0xB1, 0x02, 0x85, 0x02, 0x09, 0x24, 0x95, 0x24, 0xB1,
-	0x02, 0x85, 0x08, 0x09, 0x25, 0x95, 0x03, 0xB1, 0x02, 0x85, 0x10, 0x09, 0x26, 0x95, 0x04, 0xB1,
-	0x02, 0x85, 0x11, 0x09, 0x27, 0x95, 0x02, 0xB1, 0x02, 0x85, 0x12, 0x06, 0x02, 0xFF, 0x09, 0x21,
-	0x95, 0x0F, 0xB1, 0x02, 0x85, 0x13, 0x09, 0x22, 0x95, 0x16, 0xB1, 0x02, 0x85, 0x14, 0x06, 0x05,
-	0xFF, 0x09, 0x20, 0x95, 0x10, 0xB1, 0x02, 0x85, 0x15, 0x09, 0x21, 0x95, 0x2C, 0xB1, 0x02, 0x06,
-	0x80, 0xFF, 0x85, 0x80, 0x09, 0x20, 0x95, 0x06, 0xB1, 0x02, 0x85, 0x81, 0x09, 0x21, 0x95, 0x06,
-	0xB1, 0x02, 0x85, 0x82, 0x09, 0x22, 0x95, 0x05, 0xB1, 0x02, 0x85, 0x83, 0x09, 0x23, 0x95, 0x01,
-	0xB1, 0x02, 0x85, 0x84, 0x09, 0x24, 0x95, 0x04, 0xB1, 0x02, 0x85, 0x85, 0x09, 0x25, 0x95, 0x06,
-	0xB1, 0x02, 0x85, 0x86, 0x09, 0x26, 0x95, 0x06, 0xB1, 0x02, 0x85, 0x87, 0x09, 0x27, 0x95, 0x23,
-	0xB1, 0x02, 0x85, 0x88, 0x09, 0x28, 0x95, 0x22, 0xB1, 0x02, 0x85, 0x89, 0x09, 0x29, 0x95, 0x02,
-	0xB1, 0x02, 0x85, 0x90, 0x09, 0x30, 0x95, 0x05, 0xB1, 0x02, 0x85, 0x91, 0x09, 0x31, 0x95, 0x03,
-	0xB1, 0x02, 0x85, 0x92, 0x09, 0x32, 0x95, 0x03, 0xB1, 0x02, 0x85, 0x93, 0x09, 0x33, 0x95, 0x0C,
-	0xB1, 0x02, 0x85, 0xA0, 0x09, 0x40, 0x95, 0x06, 0xB1, 0x02, 0x85, 0xA1, 0x09, 0x41, 0x95, 0x01,
-	0xB1, 0x02, 0x85, 0xA2, 0x09, 0x42, 0x95, 0x01, 0xB1, 0x02, 0x85, 0xA3, 0x09, 0x43, 0x95, 0x30,
-	0xB1, 0x02, 0x85, 0xA4, 0x09, 0x44, 0x95, 0x0D, 0xB1, 0x02, 0x85, 0xA5, 0x09, 0x45, 0x95, 0x15,
-	0xB1, 0x02, 0x85, 0xA6, 0x09, 0x46, 0x95, 0x15, 0xB1, 0x02, 0x85, 0xF0, 0x09, 0x47, 0x95, 0x3F,
-	0xB1, 0x02, 0x85, 0xF1, 0x09, 0x48, 0x95, 0x3F, 0xB1, 0x02, 0x85, 0xF2, 0x09, 0x49, 0x95, 0x0F,
-	0xB1, 0x02, 0x85, 0xA7, 0x09, 0x4A, 0x95, 0x01, 0xB1, 0x02, 0x85, 0xA8, 0x09, 0x4B, 0x95, 0x01,
-	0xB1, 0x02, 0x85, 0xA9, 0x09, 0x4C, 0x95, 0x08, 0xB1, 0x02, 0x85, 0xAA, 0x09, 0x4E, 0x95, 0x01,
-	0xB1, 0x02, 0x85, 0xAB, 0x09, 0x4F, 0x95, 0x39, 0xB1, 0x02, 0x85, 0xAC, 0x09, 0x50, 0x95, 0x39,
-	0xB1, 0x02, 0x85, 0xAD, 0x09, 0x51, 0x95, 0x0B, 0xB1, 0x02, 0x85, 0xAE, 0x09, 0x52, 0x95, 0x01,
-	0xB1, 0x02, 0x85, 0xAF, 0x09, 0x53, 0x95, 0x02, 0xB1, 0x02, 0x85, 0xB0, 0x09, 0x54, 0x95, 0x3F,
-	0xB1, 0x02, 0x85, 0xB1, 0x09, 0x55, 0x95, 0x02, 0xB1, 0x02, 0x85, 0xB2, 0x09, 0x56, 0x95, 0x02,
-	0xB1, 0x02, 0xC0
-};
-
-static const uint8_t my_dualshock_4_hid_report_x_o_pressed[] = {
-	0x01, 0x7E, 0x83, 0x7E, 0x7F, 0x68, 0x00, 0xF4, 0x00, 0x00, 0xC6, 0x84, 0x04, 0x1E, 0x00, 0xE7,
-	0xFF, 0xF5, 0xFF, 0x66, 0x02, 0xDD, 0x1D, 0x42, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x00,
-	0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
-	0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00
-};
-
-static const uint8_t my_dualshock_4_hid_report_u_x_pressed[] = {
-	0x01, 0x83, 0x81, 0x7E, 0x7E, 0x20, 0x00, 0xD0, 0x00, 0x00, 0x7E, 0x09, 0x06, 0x08, 0x00, 0x00,
-	0x00, 0x02, 0x00, 0x65, 0x03, 0x75, 0x1F, 0xE0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x00,
-	0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
-	0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00
-};
-
-static const uint8_t my_dualshock_4_hid_report_options_r2_max_pressed[] = {
-	0x01, 0x83, 0x7C, 0x7E, 0x7E, 0x08, 0x28, 0xEC, 0x00, 0xFF, 0xF8, 0xAD, 0x07, 0xFB, 0xFF, 0x00,
-	0x00, 0xFC, 0xFF, 0x72, 0x01, 0x6F, 0x1A, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x00,
-	0x00, 0x01, 0x72, 0x81, 0x37, 0x87, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
-	0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00
-};
-
-static const uint8_t my_dualshock_4_hid_report_lx_rx_min[] = {
-	0x01, 0x00, 0x5E, 0x00, 0x7F, 0x08, 0x00, 0xA8, 0x00, 0x00, 0x11, 0x05, 0x08, 0x07, 0x00, 0x03,
-	0x00, 0xF4, 0xFF, 0xDC, 0x01, 0x91, 0x1F, 0x28, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x00,
-	0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
-	0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00
-};
-
-static const uint8_t my_dualshock_4_hid_report_idle[] = {
-	0x01, 0x7E, 0x83, 0x7E, 0x7F, 0x08, 0x00, 0xA8, 0x00, 0x00, 0x3E, 0x48, 0x03, 0x25, 0x00, 0x02,
-	0x00, 0xDA, 0xFF, 0x9F, 0xFA, 0x4F, 0x1D, 0x55, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x00,
-	0x00, 0x01, 0x65, 0x01, 0x48, 0x01, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
-	0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00
-};
-
-// https://gimx.fr/wiki/index.php?title=DualShock_4#Sample_Report
-
-static const uint8_t dualshock_4_hid_report_descriptor_gimx_fr_wiki[] = {
-0x05, 0x01,        // Usage Page (Generic Desktop Ctrls)
-0x09, 0x05,        // Usage (Game Pad)
-0xA1, 0x01,        // Collection (Application)
-0x85, 0x01,        //   Report ID (1)
-0x09, 0x30,        //   Usage (X)
-0x09, 0x31,        //   Usage (Y)
-0x09, 0x32,        //   Usage (Z)
-0x09, 0x35,        //   Usage (Rz)
-0x15, 0x00,        //   Logical Minimum (0)
-0x26, 0xFF, 0x00,  //   Logical Maximum (255)
-0x75, 0x08,        //   Report Size (8)
-0x95, 0x04,        //   Report Count (4)
-0x81, 0x02,        //   Input (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position)
-0x09, 0x39,        //   Usage (Hat switch)
-0x15, 0x00,        //   Logical Minimum (0)
-0x25, 0x07,        //   Logical Maximum (7)
-0x35, 0x00,        //   Physical Minimum (0)
-0x46, 0x3B, 0x01,  //   Physical Maximum (315)
-0x65, 0x14,        //   Unit (System: English Rotation, Length: Centimeter)
-0x75, 0x04,        //   Report Size (4)
-0x95, 0x01,        //   Report Count (1)
-0x81, 0x42,        //   Input (Data,Var,Abs,No Wrap,Linear,Preferred State,Null State)
-0x65, 0x00,        //   Unit (None)
-0x05, 0x09,        //   Usage Page (Button)
-0x19, 0x01,        //   Usage Minimum (0x01)
-0x29, 0x0E,        //   Usage Maximum (0x0E)
-0x15, 0x00,        //   Logical Minimum (0)
-0x25, 0x01,        //   Logical Maximum (1)
-0x75, 0x01,        //   Report Size (1)
-0x95, 0x0E,        //   Report Count (14)
-0x81, 0x02,        //   Input (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position)
-0x06, 0x00, 0xFF,  //   Usage Page (Vendor Defined 0xFF00)
-0x09, 0x20,        //   Usage (0x20)
-0x75, 0x06,        //   Report Size (6)
-0x95, 0x01,        //   Report Count (1)
-0x15, 0x00,        //   Logical Minimum (0)
-0x25, 0x7F,        //   Logical Maximum (127)
-0x81, 0x02,        //   Input (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position)
-0x05, 0x01,        //   Usage Page (Generic Desktop Ctrls)
-0x09, 0x33,        //   Usage (Rx)
-0x09, 0x34,        //   Usage (Ry)
-0x15, 0x00,        //   Logical Minimum (0)
-0x26, 0xFF, 0x00,  //   Logical Maximum (255)
-0x75, 0x08,        //   Report Size (8)
-0x95, 0x02,        //   Report Count (2)
-0x81, 0x02,        //   Input (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position)
-0x06, 0x00, 0xFF,  //   Usage Page (Vendor Defined 0xFF00)
-0x09, 0x21,        //   Usage (0x21)
-0x95, 0x36,        //   Report Count (54)
-0x81, 0x02,        //   Input (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position)
-0x85, 0x05,        //   Report ID (5)
-0x09, 0x22,        //   Usage (0x22)
-0x95, 0x1F,        //   Report Count (31)
-0x91, 0x02,        //   Output (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
-0x85, 0x04,        //   Report ID (4)
-0x09, 0x23,        //   Usage (0x23)
-0x95, 0x24,        //   Report Count (36)
-0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
-0x85, 0x02,        //   Report ID (2)
-0x09, 0x24,        //   Usage (0x24)
-0x95, 0x24,        //   Report Count (36)
-0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
-0x85, 0x08,        //   Report ID (8)
-0x09, 0x25,        //   Usage (0x25)
-0x95, 0x03,        //   Report Count (3)
-0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
-0x85, 0x10,        //   Report ID (16)
-0x09, 0x26,        //   Usage (0x26)
-0x95, 0x04,        //   Report Count (4)
-0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
-0x85, 0x11,        //   Report ID (17)
-0x09, 0x27,        //   Usage (0x27)
-0x95, 0x02,        //   Report Count (2)
-0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
-0x85, 0x12,        //   Report ID (18)
-0x06, 0x02, 0xFF,  //   Usage Page (Vendor Defined 0xFF02)
-0x09, 0x21,        //   Usage (0x21)
-0x95, 0x0F,        //   Report Count (15)
-0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
-0x85, 0x13,        //   Report ID (19)
-0x09, 0x22,        //   Usage (0x22)
-0x95, 0x16,        //   Report Count (22)
-0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
-0x85, 0x14,        //   Report ID (20)
-0x06, 0x05, 0xFF,  //   Usage Page (Vendor Defined 0xFF05)
-0x09, 0x20,        //   Usage (0x20)
-0x95, 0x10,        //   Report Count (16)
-0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
-0x85, 0x15,        //   Report ID (21)
-0x09, 0x21,        //   Usage (0x21)
-0x95, 0x2C,        //   Report Count (44)
-0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
-0x06, 0x80, 0xFF,  //   Usage Page (Vendor Defined 0xFF80)
-0x85, 0x80,        //   Report ID (128)
-0x09, 0x20,        //   Usage (0x20)
-0x95, 0x06,        //   Report Count (6)
-0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
-0x85, 0x81,        //   Report ID (129)
-0x09, 0x21,        //   Usage (0x21)
-0x95, 0x06,        //   Report Count (6)
-0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
-0x85, 0x82,        //   Report ID (130)
-0x09, 0x22,        //   Usage (0x22)
-0x95, 0x05,        //   Report Count (5)
-0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
-0x85, 0x83,        //   Report ID (131)
-0x09, 0x23,        //   Usage (0x23)
-0x95, 0x01,        //   Report Count (1)
-0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
-0x85, 0x84,        //   Report ID (132)
-0x09, 0x24,        //   Usage (0x24)
-0x95, 0x04,        //   Report Count (4)
-0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
-0x85, 0x85,        //   Report ID (133)
-0x09, 0x25,        //   Usage (0x25)
-0x95, 0x06,        //   Report Count (6)
-0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
-0x85, 0x86,        //   Report ID (134)
-0x09, 0x26,        //   Usage (0x26)
-0x95, 0x06,        //   Report Count (6)
-0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
-0x85, 0x87,        //   Report ID (135)
-0x09, 0x27,        //   Usage (0x27)
-0x95, 0x23,        //   Report Count (35)
-0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
-0x85, 0x88,        //   Report ID (136)
-0x09, 0x28,        //   Usage (0x28)
-0x95, 0x22,        //   Report Count (34)
-0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
-0x85, 0x89,        //   Report ID (137)
-0x09, 0x29,        //   Usage (0x29)
-0x95, 0x02,        //   Report Count (2)
-0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
-0x85, 0x90,        //   Report ID (144)
-0x09, 0x30,        //   Usage (0x30)
-0x95, 0x05,        //   Report Count (5)
-0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
-0x85, 0x91,        //   Report ID (145)
-0x09, 0x31,        //   Usage (0x31)
-0x95, 0x03,        //   Report Count (3)
-0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
-0x85, 0x92,        //   Report ID (146)
-0x09, 0x32,        //   Usage (0x32)
-0x95, 0x03,        //   Report Count (3)
-0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
-0x85, 0x93,        //   Report ID (147)
-0x09, 0x33,        //   Usage (0x33)
-0x95, 0x0C,        //   Report Count (12)
-0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
-0x85, 0xA0,        //   Report ID (160)
-0x09, 0x40,        //   Usage (0x40)
-0x95, 0x06,        //   Report Count (6)
-0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
-0x85, 0xA1,        //   Report ID (161)
-0x09, 0x41,        //   Usage (0x41)
-0x95, 0x01,        //   Report Count (1)
-0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
-0x85, 0xA2,        //   Report ID (162)
-0x09, 0x42,        //   Usage (0x42)
-0x95, 0x01,        //   Report Count (1)
-0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
-0x85, 0xA3,        //   Report ID (163)
-0x09, 0x43,        //   Usage (0x43)
-0x95, 0x30,        //   Report Count (48)
-0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
-0x85, 0xA4,        //   Report ID (164)
-0x09, 0x44,        //   Usage (0x44)
-0x95, 0x0D,        //   Report Count (13)
-0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
-0x85, 0xA5,        //   Report ID (165)
-0x09, 0x45,        //   Usage (0x45)
-0x95, 0x15,        //   Report Count (21)
-0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
-0x85, 0xA6,        //   Report ID (166)
-0x09, 0x46,        //   Usage (0x46)
-0x95, 0x15,        //   Report Count (21)
-0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
-0x85, 0xF0,        //   Report ID (240)
-0x09, 0x47,        //   Usage (0x47)
-0x95, 0x3F,        //   Report Count (63)
-0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
-0x85, 0xF1,        //   Report ID (241)
-0x09, 0x48,        //   Usage (0x48)
-0x95, 0x3F,        //   Report Count (63)
-0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
-0x85, 0xF2,        //   Report ID (242)
-0x09, 0x49,        //   Usage (0x49)
-0x95, 0x0F,        //   Report Count (15)
-0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
-0x85, 0xA7,        //   Report ID (167)
-0x09, 0x4A,        //   Usage (0x4A)
-0x95, 0x01,        //   Report Count (1)
-0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
-0x85, 0xA8,        //   Report ID (168)
-0x09, 0x4B,        //   Usage (0x4B)
-0x95, 0x01,        //   Report Count (1)
-0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
-0x85, 0xA9,        //   Report ID (169)
-0x09, 0x4C,        //   Usage (0x4C)
-0x95, 0x08,        //   Report Count (8)
-0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
-0x85, 0xAA,        //   Report ID (170)
-0x09, 0x4E,        //   Usage (0x4E)
-0x95, 0x01,        //   Report Count (1)
-0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
-0x85, 0xAB,        //   Report ID (171)
-0x09, 0x4F,        //   Usage (0x4F)
-0x95, 0x39,        //   Report Count (57)
-0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
-0x85, 0xAC,        //   Report ID (172)
-0x09, 0x50,        //   Usage (0x50)
-0x95, 0x39,        //   Report Count (57)
-0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
-0x85, 0xAD,        //   Report ID (173)
-0x09, 0x51,        //   Usage (0x51)
-0x95, 0x0B,        //   Report Count (11)
-0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
-0x85, 0xAE,        //   Report ID (174)
-0x09, 0x52,        //   Usage (0x52)
-0x95, 0x01,        //   Report Count (1)
-0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
-0x85, 0xAF,        //   Report ID (175)
-0x09, 0x53,        //   Usage (0x53)
-0x95, 0x02,        //   Report Count (2)
-0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
-0x85, 0xB0,        //   Report ID (176)
-0x09, 0x54,        //   Usage (0x54)
-0x95, 0x3F,        //   Report Count (63)
-0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
-0xC0               // End Collection
-};
-// 467 bytes
-
-static const uint8_t dualshock_4_hid_report_gimx_fr_wiki[] = {
-	0x01, 0x81, 0x80, 0x83, 0x7A, 0x08, 0x00, 0x00, 0x00, 0x00, 0x93, 0x5F, 0xFB, 0xD2, 0xFF, 0xDA,
-	0xFF, 0xD8, 0xFF, 0x4F, 0xEE, 0x14, 0x1B, 0x99, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
-	0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
-	0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00,
-};
-
-// DualShock 3 CECHZC2R
-static const uint8_t dualshock_3_hid_report_descriptor[] = {
-	0x05, 0x01, 0x09, 0x04, 0xA1, 0x01, 0xA1, 0x02, 0x85, 0x01, 0x75, 0x08, 0x95, 0x01, 0x15, 0x00,
-	0x26, 0xFF, 0x00, 0x81, 0x03, 0x75, 0x01, 0x95, 0x13, 0x15, 0x00, 0x25, 0x01, 0x35, 0x00, 0x45,
-	0x01, 0x05, 0x09, 0x19, 0x01, 0x29, 0x13, 0x81, 0x02, 0x75, 0x01, 0x95, 0x0D, 0x06, 0x00, 0xFF,
-	0x81, 0x03, 0x15, 0x00, 0x26, 0xFF, 0x00, 0x05, 0x01, 0x09, 0x01, 0xA1, 0x00, 0x75, 0x08, 0x95,
-	0x04, 0x35, 0x00, 0x46, 0xFF, 0x00, 0x09, 0x30, 0x09, 0x31, 0x09, 0x32, 0x09, 0x35, 0x81, 0x02,
-	0xC0, 0x05, 0x01, 0x75, 0x08, 0x95, 0x27, 0x09, 0x01, 0x81, 0x02, 0x75, 0x08, 0x95, 0x30, 0x09,
-	0x01, 0x91, 0x02, 0x75, 0x08, 0x95, 0x30, 0x09, 0x01, 0xB1, 0x02, 0xC0, 0xA1, 0x02, 0x85, 0x02,
-	0x75, 0x08, 0x95, 0x30, 0x09, 0x01, 0xB1, 0x02, 0xC0, 0xA1, 0x02, 0x85, 0xEE, 0x75, 0x08, 0x95,
-	0x30, 0x09, 0x01, 0xB1, 0x02, 0xC0, 0xA1, 0x02, 0x85, 0xEF, 0x75, 0x08, 0x95, 0x30, 0x09, 0x01,
-	0xB1, 0x02, 0xC0, 0xC0
-};
-
-// PS5 DualSence CFI-ZCT1W
-static const uint8_t dualsence_hid_report_descriptor[] = {
-	0x05, 0x01, 0x09, 0x05, 0xA1, 0x01, 0x85, 0x01, 0x09, 0x30, 0x09, 0x31, 0x09, 0x32, 0x09, 0x35,
-	0x09, 0x33, 0x09, 0x34, 0x15, 0x00, 0x26, 0xFF, 0x00, 0x75, 0x08, 0x95, 0x06, 0x81, 0x02, 0x06,
-	0x00, 0xFF, 0x09, 0x20, 0x95, 0x01, 0x81, 0x02, 0x05, 0x01, 0x09, 0x39, 0x15, 0x00, 0x25, 0x07,
-	0x35, 0x00, 0x46, 0x3B, 0x01, 0x65, 0x14, 0x75, 0x04, 0x95, 0x01, 0x81, 0x42, 0x65, 0x00, 0x05,
-	0x09, 0x19, 0x01, 0x29, 0x0F, 0x15, 0x00, 0x25, 0x01, 0x75, 0x01, 0x95, 0x0F, 0x81, 0x02, 0x06,
-	0x00, 0xFF, 0x09, 0x21, 0x95, 0x0D, 0x81, 0x02, 0x06, 0x00, 0xFF, 0x09, 0x22, 0x15, 0x00, 0x26,
-	0xFF, 0x00, 0x75, 0x08, 0x95, 0x34, 0x81, 0x02, 0x85, 0x02, 0x09, 0x23, 0x95, 0x2F, 0x91, 0x02,
-	0x85, 0x05, 0x09, 0x33, 0x95, 0x28, 0xB1, 0x02, 0x85, 0x08, 0x09, 0x34, 0x95, 0x2F, 0xB1, 0x02,
-	0x85, 0x09, 0x09, 0x24, 0x95, 0x13, 0xB1, 0x02, 0x85, 0x0A, 0x09, 0x25, 0x95, 0x1A, 0xB1, 0x02,
-	0x85, 0x20, 0x09, 0x26, 0x95, 0x3F, 0xB1, 0x02, 0x85, 0x21, 0x09, 0x27, 0x95, 0x04, 0xB1, 0x02,
-	0x85, 0x22, 0x09, 0x40, 0x95, 0x3F, 0xB1, 0x02, 0x85, 0x80, 0x09, 0x28, 0x95, 0x3F, 0xB1, 0x02,
-	0x85, 0x81, 0x09, 0x29, 0x95, 0x3F, 0xB1, 0x02, 0x85, 0x82, 0x09, 0x2A, 0x95, 0x09, 0xB1, 0x02,
-	0x85, 0x83, 0x09, 0x2B, 0x95, 0x3F, 0xB1, 0x02, 0x85, 0x84, 0x09, 0x2C, 0x95, 0x3F, 0xB1, 0x02,
-	0x85, 0x85, 0x09, 0x2D, 0x95, 0x02, 0xB1, 0x02, 0x85, 0xA0, 0x09, 0x2E, 0x95, 0x01, 0xB1, 0x02,
-	0x85, 0xE0, 0x09, 0x2F, 0x95, 0x3F, 0xB1, 0x02, 0x85, 0xF0, 0x09, 0x30, 0x95, 0x3F, 0xB1, 0x02,
-	0x85, 0xF1, 0x09, 0x31, 0x95, 0x3F, 0xB1, 0x02, 0x85, 0xF2, 0x09, 0x32, 0x95, 0x0F, 0xB1, 0x02,
-	0x85, 0xF4, 0x09, 0x35, 0x95, 0x3F, 0xB1, 0x02, 0x85, 0xF5, 0x09, 0x36, 0x95, 0x03, 0xB1, 0x02,
-	0xC0
-};
-
-static const uint8_t dualsence_hid_report_idle[] = {
-	0x01, 0x80, 0x81, 0x7F, 0x7E, 0x00, 0x00, 0x3F, 0x08, 0x00, 0x00, 0x00, 0x86, 0x86, 0x20, 0xB6,
-	0xFF, 0xFF, 0x06, 0x00, 0xFE, 0xFF, 0xC9, 0xF8, 0x8D, 0x1E, 0xDE, 0x05, 0xD2, 0x0E, 0xAB, 0x00,
-	0xFF, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x09, 0x09, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0xF0, 0x9C, 0xAB, 0x00, 0x28, 0x08, 0x00, 0xA5, 0x21, 0x2F, 0x7E, 0x50, 0x97, 0x23, 0x48
-};
-
-static const uint8_t dualsence_hid_report_x_o_pressed[] = {
-	0x01, 0x7F, 0x83, 0x7F, 0x7E, 0x00, 0x00, 0xA3, 0x68, 0x00, 0x00, 0x00, 0x61, 0xF7, 0xBC, 0xF3,
-	0x03, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0x29, 0xFE, 0xB9, 0x1F, 0x60, 0x03, 0x5E, 0xA1, 0x31, 0x02,
-	0x01, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x09, 0x09, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x50, 0x2D, 0x32, 0x02, 0x28, 0x08, 0x00, 0xF6, 0xB0, 0x94, 0x0A, 0x5D, 0x86, 0xC1, 0xA8
-};
-
-static const uint8_t dualsence_hid_report_u_x_pressed[] = {
-	0x01, 0x7F, 0x83, 0x7F, 0x7E, 0x00, 0x00, 0x87, 0x20, 0x00, 0x00, 0x00, 0x45, 0xF9, 0xBC, 0xF3,
-	0xFE, 0xFF, 0x07, 0x00, 0x06, 0x00, 0xBF, 0xFC, 0x89, 0x1F, 0x4F, 0x04, 0x0B, 0x3A, 0x97, 0x1D,
-	0x04, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x09, 0x09, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0xE0, 0xC1, 0x97, 0x1D, 0x28, 0x08, 0x00, 0x46, 0x0F, 0x9F, 0xC1, 0xE7, 0x19, 0x56, 0x0E
-};
-
-static const uint8_t dualsence_hid_report_options_r2_max_pressed[] = {
-	0x01, 0x7F, 0x82, 0x7F, 0x7E, 0x00, 0xFF, 0x2F, 0x08, 0x28, 0x00, 0x00, 0xED, 0xFA, 0xBC, 0xF3,
-	0x01, 0x00, 0x03, 0x00, 0x00, 0x00, 0xBF, 0xFB, 0xFA, 0x1A, 0x5B, 0xF0, 0xEC, 0x16, 0xAA, 0x48,
-	0x06, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x09, 0x09, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0xB7, 0xA4, 0xAA, 0x48, 0x28, 0x08, 0x00, 0x28, 0xE5, 0x40, 0xF2, 0xFF, 0xEA, 0xAD, 0xBB
-};
-
-static const uint8_t dualsence_hid_report_lx_rx_min[] = {
-	0x01, 0x08, 0x5B, 0x01, 0x6A, 0x00, 0x00, 0xA5, 0x08, 0x00, 0x00, 0x00, 0x63, 0xFC, 0xBC, 0xF3,
-	0xFD, 0xFF, 0x02, 0x00, 0xFE, 0xFF, 0x49, 0x01, 0xAE, 0x1F, 0x74, 0x03, 0x4D, 0x2A, 0xA8, 0x74,
-	0x08, 0x80, 0x2B, 0x57, 0x1A, 0x80, 0x00, 0x00, 0x00, 0xD5, 0x09, 0x09, 0x00, 0x00, 0x00, 0x00,
-	0x00, 0x70, 0xBA, 0xA8, 0x74, 0x28, 0x08, 0x00, 0x64, 0x7D, 0x33, 0x47, 0x63, 0xD8, 0xD5, 0x2F
+﻿#pragma once
+
+#include <stdint.h>
+
+// https://github.com/DJm00n/ControllersInfo/tree/master/dualshock4
+
+// array size is 507
+static const uint8_t dualshock4_hid_report_descriptor[] = {
+  0x05, 0x01, 0x09, 0x05, 0xa1, 0x01, 0x85, 0x01, 0x09, 0x30, 0x09, 0x31, 0x09, 0x32, 0x09, 0x35,
+  0x15, 0x00, 0x26, 0xff, 0x00, 0x75, 0x08, 0x95, 0x04, 0x81, 0x02, 0x09, 0x39, 0x15, 0x00, 0x25,
+  0x07, 0x35, 0x00, 0x46, 0x3b, 0x01, 0x65, 0x14, 0x75, 0x04, 0x95, 0x01, 0x81, 0x42, 0x65, 0x00,
+  0x05, 0x09, 0x19, 0x01, 0x29, 0x0e, 0x15, 0x00, 0x25, 0x01, 0x75, 0x01, 0x95, 0x0e, 0x81, 0x02,
+  0x06, 0x00, 0xff, 0x09, 0x20, 0x75, 0x06, 0x95, 0x01, 0x15, 0x00, 0x25, 0x7f, 0x81, 0x02, 0x05,
+  0x01, 0x09, 0x33, 0x09, 0x34, 0x15, 0x00, 0x26, 0xff, 0x00, 0x75, 0x08, 0x95, 0x02, 0x81, 0x02,
+  0x06, 0x00, 0xff, 0x09, 0x21, 0x95, 0x36, 0x81, 0x02, 0x85, 0x05, 0x09, 0x22, 0x95, 0x1f, 0x91,
+  0x02, 0x85, 0x04, 0x09, 0x23, 0x95, 0x24, 0xb1, 0x02, 0x85, 0x02, 0x09, 0x24, 0x95, 0x24, 0xb1,
+  0x02, 0x85, 0x08, 0x09, 0x25, 0x95, 0x03, 0xb1, 0x02, 0x85, 0x10, 0x09, 0x26, 0x95, 0x04, 0xb1,
+  0x02, 0x85, 0x11, 0x09, 0x27, 0x95, 0x02, 0xb1, 0x02, 0x85, 0x12, 0x06, 0x02, 0xff, 0x09, 0x21,
+  0x95, 0x0f, 0xb1, 0x02, 0x85, 0x13, 0x09, 0x22, 0x95, 0x16, 0xb1, 0x02, 0x85, 0x14, 0x06, 0x05,
+  0xff, 0x09, 0x20, 0x95, 0x10, 0xb1, 0x02, 0x85, 0x15, 0x09, 0x21, 0x95, 0x2c, 0xb1, 0x02, 0x06,
+  0x80, 0xff, 0x85, 0x80, 0x09, 0x20, 0x95, 0x06, 0xb1, 0x02, 0x85, 0x81, 0x09, 0x21, 0x95, 0x06,
+  0xb1, 0x02, 0x85, 0x82, 0x09, 0x22, 0x95, 0x05, 0xb1, 0x02, 0x85, 0x83, 0x09, 0x23, 0x95, 0x01,
+  0xb1, 0x02, 0x85, 0x84, 0x09, 0x24, 0x95, 0x04, 0xb1, 0x02, 0x85, 0x85, 0x09, 0x25, 0x95, 0x06,
+  0xb1, 0x02, 0x85, 0x86, 0x09, 0x26, 0x95, 0x06, 0xb1, 0x02, 0x85, 0x87, 0x09, 0x27, 0x95, 0x23,
+  0xb1, 0x02, 0x85, 0x88, 0x09, 0x28, 0x95, 0x3f, 0xb1, 0x02, 0x85, 0x89, 0x09, 0x29, 0x95, 0x02,
+  0xb1, 0x02, 0x85, 0x90, 0x09, 0x30, 0x95, 0x05, 0xb1, 0x02, 0x85, 0x91, 0x09, 0x31, 0x95, 0x03,
+  0xb1, 0x02, 0x85, 0x92, 0x09, 0x32, 0x95, 0x03, 0xb1, 0x02, 0x85, 0x93, 0x09, 0x33, 0x95, 0x0c,
+  0xb1, 0x02, 0x85, 0x94, 0x09, 0x34, 0x95, 0x3f, 0xb1, 0x02, 0x85, 0xa0, 0x09, 0x40, 0x95, 0x06,
+  0xb1, 0x02, 0x85, 0xa1, 0x09, 0x41, 0x95, 0x01, 0xb1, 0x02, 0x85, 0xa2, 0x09, 0x42, 0x95, 0x01,
+  0xb1, 0x02, 0x85, 0xa3, 0x09, 0x43, 0x95, 0x30, 0xb1, 0x02, 0x85, 0xa4, 0x09, 0x44, 0x95, 0x0d,
+  0xb1, 0x02, 0x85, 0xf0, 0x09, 0x47, 0x95, 0x3f, 0xb1, 0x02, 0x85, 0xf1, 0x09, 0x48, 0x95, 0x3f,
+  0xb1, 0x02, 0x85, 0xf2, 0x09, 0x49, 0x95, 0x0f, 0xb1, 0x02, 0x85, 0xa7, 0x09, 0x4a, 0x95, 0x01,
+  0xb1, 0x02, 0x85, 0xa8, 0x09, 0x4b, 0x95, 0x01, 0xb1, 0x02, 0x85, 0xa9, 0x09, 0x4c, 0x95, 0x08,
+  0xb1, 0x02, 0x85, 0xaa, 0x09, 0x4e, 0x95, 0x01, 0xb1, 0x02, 0x85, 0xab, 0x09, 0x4f, 0x95, 0x39,
+  0xb1, 0x02, 0x85, 0xac, 0x09, 0x50, 0x95, 0x39, 0xb1, 0x02, 0x85, 0xad, 0x09, 0x51, 0x95, 0x0b,
+  0xb1, 0x02, 0x85, 0xae, 0x09, 0x52, 0x95, 0x01, 0xb1, 0x02, 0x85, 0xaf, 0x09, 0x53, 0x95, 0x02,
+  0xb1, 0x02, 0x85, 0xb0, 0x09, 0x54, 0x95, 0x3f, 0xb1, 0x02, 0x85, 0xe0, 0x09, 0x57, 0x95, 0x02,
+  0xb1, 0x02, 0x85, 0xb3, 0x09, 0x55, 0x95, 0x3f, 0xb1, 0x02, 0x85, 0xb4, 0x09, 0x55, 0x95, 0x3f,
+  0xb1, 0x02, 0x85, 0xb5, 0x09, 0x56, 0x95, 0x3f, 0xb1, 0x02, 0x85, 0xd0, 0x09, 0x58, 0x95, 0x3f,
+  0xb1, 0x02, 0x85, 0xd4, 0x09, 0x59, 0x95, 0x3f, 0xb1, 0x02, 0xc0
+};
+
+/*
+//----------------------------------------------------------------------------------------------
+Own dumps https://github.com/proboterror
+
+DualShock 4
+
+Device Descriptor :
+12 01 00 02 00 00 00 40 4C 05 C4 05 00 01 01 02
+00 01
+
+DeviceClass:0
+VendorID:54c
+ProductID:5c4
+bcdDevice:1000x054C 0x05C4 0x0100
+Config Descriptor :
+09 02 29 00 01 01 00 C0 FA 09 04 00 00 02 03 00
+00 00 09 21 11 01 00 01 22 E3 01 07 05 84 03 40
+00 05 07 05 03 03 40 00 05
+
+descrType:4
+descrType:21
+descrType:5
+descrType:5gcd ok 41
+
+Interface 0:
+InterfaceProtocol: 0
+
+Interface 0 Report Descriptor
+05 01 09 05 A1 01 85 01 09 30 09 31 09 32 09 35
+15 00 26 FF 00 75 08 95 04 81 02 09 39 15 00 25
+07 35 00 46 3B 01 65 14 75 04 95 01 81 42 65 00
+05 09 19 01 29 0E 15 00 25 01 75 01 95 0E 81 02
+06 00 FF 09 20 75 06 95 01 15 00 25 7F 81 02 05
+01 09 33 09 34 15 00 26 FF 00 75 08 95 02 81 02
+06 00 FF 09 21 95 36 81 02 85 05 09 22 95 1F 91
+02 85 04 09 23 95 24 B1 02 85 02 09 24 95 24 B1
+02 85 08 09 25 95 03 B1 02 85 10 09 26 95 04 B1
+02 85 11 09 27 95 02 B1 02 85 12 06 02 FF 09 21
+95 0F B1 02 85 13 09 22 95 16 B1 02 85 14 06 05
+FF 09 20 95 10 B1 02 85 15 09 21 95 2C B1 02 06
+80 FF 85 80 09 20 95 06 B1 02 85 81 09 21 95 06
+B1 02 85 82 09 22 95 05 B1 02 85 83 09 23 95 01
+B1 02 85 84 09 24 95 04 B1 02 85 85 09 25 95 06
+B1 02 85 86 09 26 95 06 B1 02 85 87 09 27 95 23
+B1 02 85 88 09 28 95 22 B1 02 85 89 09 29 95 02
+B1 02 85 90 09 30 95 05 B1 02 85 91 09 31 95 03
+B1 02 85 92 09 32 95 03 B1 02 85 93 09 33 95 0C
+B1 02 85 A0 09 40 95 06 B1 02 85 A1 09 41 95 01
+B1 02 85 A2 09 42 95 01 B1 02 85 A3 09 43 95 30
+B1 02 85 A4 09 44 95 0D B1 02 85 A5 09 45 95 15
+B1 02 85 A6 09 46 95 15 B1 02 85 F0 09 47 95 3F
+B1 02 85 F1 09 48 95 3F B1 02 85 F2 09 49 95 0F
+B1 02 85 A7 09 4A 95 01 B1 02 85 A8 09 4B 95 01
+B1 02 85 A9 09 4C 95 08 B1 02 85 AA 09 4E 95 01
+B1 02 85 AB 09 4F 95 39 B1 02 85 AC 09 50 95 39
+B1 02 85 AD 09 51 95 0B B1 02 85 AE 09 52 95 01
+B1 02 85 AF 09 53 95 02 B1 02 85 B0 09 54 95 3F
+B1 02 85 B1 09 55 95 02 B1 02 85 B2 09 56 95 02
+B1 02 C0
+// 483 bytes
+
+//-----------------------------------------------------------------
+Keyboard Red Square Keyrox TKL Classic RSQ-20024
+
+Device Descriptor :
+12 01 10 01 00 00 00 08 16 04 45 C3 00 00 00 02
+00 01
+
+
+DeviceClass:0
+VendorID : 416
+ProductID : c345
+bcdDevice : 00x0416 0xC345 0x0000
+Config Descriptor :
+09 02 5B 00 03 01 00 A0 C8 09 04 00 00 01 03 01
+01 00 09 21 10 01 00 01 22 41 00 07 05 81 03 08
+00 01 09 04 01 00 01 03 00 00 00 09 21 10 01 00
+01 22 BE 00 07 05 82 03 20 00 01 09 04 02 00 02
+03 00 00 00 09 21 10 01 00 01 22 20 00 07 05 83
+03 40 00 01 07 05 04 03 40 00 01
+
+
+Interface 0 :
+InterfaceProtocol : 1
+
+Interface 0 Report Descriptor // Note: this is generic HID keyboard descriptor
+05 01 09 06 A1 01 05 07 19 E0 29 E7 15 00 25 01
+75 01 95 08 81 02 95 01 75 08 81 01 95 05 75 01
+05 08 19 01 29 05 91 02 95 01 75 03 91 01 95 06
+75 08 15 00 26 FF 00 05 07 19 00 2A 97 00 81 00
+C0
+
+Interface 1:
+InterfaceProtocol: 0
+
+Interface 1 Report Descriptor
+05 01 09 80 A1 01 85 01 19 81 29 83 15 00 25 01
+75 01 95 03 81 02 95 05 81 01 C0 05 0C 09 01 A1
+01 85 02 15 00 25 01 09 E9 09 EA 09 E2 09 CD 19
+B5 29 B8 75 01 95 08 81 02 0A 8A 01 0A 21 02 0A
+2A 02 1A 23 02 2A 27 02 81 02 0A 83 01 0A 96 01
+0A 92 01 0A 9E 01 0A 94 01 0A 06 02 09 B2 09 B4
+81 02 C0 05 01 09 06 A1 01 85 03 05 07 75 01 95
+A0 15 00 25 01 19 00 29 9F 81 02 C0 05 01 09 02
+A1 01 85 04 09 01 A1 00 05 09 19 01 29 05 15 00
+25 01 75 01 95 05 81 02 75 03 95 01 81 01 05 01
+09 30 09 31 16 01 80 26 FF 7F 75 10 95 02 81 06
+09 38 15 81 25 7F 75 08 95 01 81 06 C0 C0
+
+Report 3, usage 6, length 168:
+startbit 8, it 5, ip 0, chan 0, cont 0, size 1, count a0
+
+Report 4, usage 2, length 56 :
+startbit 48, it 3, ip 0, chan 1, cont 6, size 8, count 1
+startbit 32, it 3, ip 0, chan 1, cont 5, size 10, count 2
+startbit 16, it 3, ip 0, chan 1, cont 4, size 10, count 2
+startbit 8, it 5, ip 0, chan 1, cont 1, size 1, count 5
+
+Interface 2:
+InterfaceProtocol: 0
+
+Interface 2 Report Descriptor
+06 1B FF 09 91 A1 01 85 01 19 00 2A FF 00 15 00
+26 FF 00 75 08 95 3F 81 02 19 00 29 FF 91 02 C0
+
+Key A pressed report:
+00 00 04 00 00 00 00 00
+
+//-----------------------------------------------------------
+Keyboard A4Teach FStyler FX51
+
+Device Descriptor :
+12 01 00 02 00 00 00 08 DA 09 68 22 05 00 01 02
+00 01
+
+DeviceClass:0
+VendorID:9da
+ProductID:2268
+bcdDevice:50x09DA 0x2268 0x0005
+Config Descriptor :
+09 02 3B 00 02 01 00 A0 32 09 04 00 00 01 03 01
+01 00 09 21 11 01 00 01 22 4F 00 07 05 81 03 08
+00 0A 09 04 01 00 01 03 00 00 00 09 21 11 01 00
+01 22 34 00 07 05 82 03 03 00 0A
+
+Interface 0:
+InterfaceProtocol: 1
+
+Interface 0 Report Descriptor -
+05 01 09 06 A1 01 05 07 19 E0 29 E7 15 00 25 01
+75 01 95 08 81 02 95 01 75 08 81 01 95 05 75 01
+05 08 19 01 29 05 91 02 95 01 75 03 91 01 95 06
+75 08 15 00 26 FF 00 05 07 19 00 2A FF 00 81 00
+05 0C 09 00 15 80 25 7F 75 08 95 08 B1 02 C0
+
+Interface 1:
+InterfaceProtocol: 0
+
+Interface 1 Report Descriptor
+05 0C 09 01 A1 01 85 01 19 00 2A 3C 02 15 00 26
+3C 02 95 01 75 10 81 00 C0 05 01 09 80 A1 01 85
+02 19 81 29 83 15 00 25 01 75 01 95 03 81 02 95
+05 81 01 C0
+
+Report A pressed:
+00 00 04 00 00 00 00 00
+
+//----------------------------------------------------------------
+Mouse Logitech LZ247D5 + Unified Receiver LZ24780-DJ M/N:C-U0007
+
+Device Descriptor :
+12 01 00 02 00 00 00 08 6D 04 2B C5 01 12 01 02
+00 01
+
+DeviceClass:0
+VendorID:46d
+ProductID:c52b
+bcdDevice:12010x046D 0xC52B 0x1201
+Config Descriptor :
+09 02 54 00 03 01 04 A0 31 09 04 00 00 01 03 01
+01 00 09 21 11 01 00 01 22 3B 00 07 05 81 03 08
+00 08 09 04 01 00 01 03 01 02 00 09 21 11 01 00
+01 22 94 00 07 05 82 03 08 00 02 09 04 02 00 01
+03 00 00 00 09 21 11 01 00 01 22 62 00 07 05 83
+03 20 00 02
+
+Interface 0:
+InterfaceProtocol: 1
+
+Interface 0 Report Descriptor
+05 01 09 06 A1 01 05 07 19 E0 29 E7 15 00 25 01
+75 01 95 08 81 02 81 03 95 05 05 08 19 01 29 05
+91 02 95 01 75 03 91 01 95 06 75 08 15 00 26 A4
+00 05 07 19 00 2A A4 00 81 00 C0
+
+Interface 1:
+InterfaceProtocol: 2
+
+Interface 1 Report Descriptor // Buttons, X, Y, Wheel; Report ID 2
+05 01 09 02 A1 01 85 02 09 01 A1 00 05 09 19 01
+29 10 15 00 25 01 95 10 75 01 81 02 05 01 16 01
+F8 26 FF 07 75 0C 95 02 09 30 09 31 81 06 15 81
+25 7F 75 08 95 01 09 38 81 06 05 0C 0A 38 02 95
+01 81 06 C0 C0 05 0C 09 01 A1 01 85 03 75 10 95
+02 15 01 26 8C 02 19 01 2A 8C 02 81 00 C0 05 01
+09 80 A1 01 85 04 75 02 95 01 15 01 25 03 09 82
+09 81 09 83 81 60 75 06 81 03 C0 06 BC FF 09 88
+A1 01 85 08 19 01 29 FF 15 01 26 FF 00 75 08 95
+01 81 00 C0
+
+Report 2, usage 2, length 64:
+startbit 56, it 0, ip 0, chan 0, cont 0, size 8, count 1
+startbit 48, it 3, ip 0, chan 1, cont 6, size 8, count 1
+startbit 36, it 3, ip 0, chan 1, cont 5, size c, count 2
+startbit 24, it 3, ip 0, chan 1, cont 4, size c, count 2
+startbit 8, it 5, ip 0, chan 1, cont 1, size 1, count 10
+
+Interface 2:
+InterfaceProtocol: 0
+
+Interface 2 Report Descriptor
+06 00 FF 09 01 A1 01 85 10 75 08 95 06 15 00 26
+FF 00 09 01 81 00 09 01 91 00 C0 06 00 FF 09 02
+A1 01 85 11 75 08 95 13 15 00 26 FF 00 09 02 81
+00 09 02 91 00 C0 06 00 FF 09 04 A1 01 85 20 75
+08 95 0E 15 00 26 FF 00 09 41 81 00 09 41 91 00
+85 21 95 1F 15 00 26 FF 00 09 42 81 00 09 42 91
+00 C0
+
+02 01 00 00 00 00 00 00
+
+128 96 0 1I1
+02 00 00 00 00 00 00 00
+
+128 96 0 0I1
+02 02 00 00 00 00 00 00
+
+128 96 0 2I1
+02 00 00 00 00 00 00 00
+
+128 96 0 0I1
+02 00 00 00 00 00 FF 00
+*/
+
+static const uint8_t keyboard_report_descriptor[] = {
+	0x05, 0x01, 0x09, 0x06, 0xA1, 0x01, 0x05, 0x07, 0x19, 0xE0, 0x29, 0xE7, 0x15, 0x00, 0x25, 0x01,
+	0x75, 0x01, 0x95, 0x08, 0x81, 0x02, 0x95, 0x01, 0x75, 0x08, 0x81, 0x01, 0x95, 0x05, 0x75, 0x01,
+	0x05, 0x08, 0x19, 0x01, 0x29, 0x05, 0x91, 0x02, 0x95, 0x01, 0x75, 0x03, 0x91, 0x01, 0x95, 0x06,
+	0x75, 0x08, 0x15, 0x00, 0x26, 0xFF, 0x00, 0x05, 0x07, 0x19, 0x00, 0x2A, 0xFF, 0x00, 0x81, 0x00,
+	0x05, 0x0C, 0x09, 0x00, 0x15, 0x80, 0x25, 0x7F, 0x75, 0x08, 0x95, 0x08, 0xB1, 0x02, 0xC0
+};
+
+static const uint8_t keyboard_report_a_pressed[] = {
+	0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00 // Key 'A' pressed
+};
+
+static const uint8_t keyboard_report_none_pressed[] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+static const uint8_t mouse_report_descriptor[] = {
+	0x05, 0x01, 0x09, 0x02, 0xA1, 0x01, 0x85, 0x02, 0x09, 0x01, 0xA1, 0x00, 0x05, 0x09, 0x19, 0x01, 
+	0x29, 0x10, 0x15, 0x00, 0x25, 0x01, 0x95, 0x10, 0x75, 0x01, 0x81, 0x02, 0x05, 0x01, 0x16, 0x01, 
+	0xF8, 0x26, 0xFF, 0x07, 0x75, 0x0C, 0x95, 0x02, 0x09, 0x30, 0x09, 0x31, 0x81, 0x06, 0x15, 0x81, 
+	0x25, 0x7F, 0x75, 0x08, 0x95, 0x01, 0x09, 0x38, 0x81, 0x06, 0x05, 0x0C, 0x0A, 0x38, 0x02, 0x95, 
+	0x01, 0x81, 0x06, 0xC0, 0xC0, 0x05, 0x0C, 0x09, 0x01, 0xA1, 0x01, 0x85, 0x03, 0x75, 0x10, 0x95, 
+	0x02, 0x15, 0x01, 0x26, 0x8C, 0x02, 0x19, 0x01, 0x2A, 0x8C, 0x02, 0x81, 0x00, 0xC0, 0x05, 0x01, 
+	0x09, 0x80, 0xA1, 0x01, 0x85, 0x04, 0x75, 0x02, 0x95, 0x01, 0x15, 0x01, 0x25, 0x03, 0x09, 0x82, 
+	0x09, 0x81, 0x09, 0x83, 0x81, 0x60, 0x75, 0x06, 0x81, 0x03, 0xC0, 0x06, 0xBC, 0xFF, 0x09, 0x88, 
+	0xA1, 0x01, 0x85, 0x08, 0x19, 0x01, 0x29, 0xFF, 0x15, 0x01, 0x26, 0xFF, 0x00, 0x75, 0x08, 0x95, 
+	0x01, 0x81, 0x00, 0xC0
+};
+
+static const uint8_t mouse_report_1[] = {
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+static const uint8_t mouse_report_2[] = {
+	0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 // Left button pressed
+};
+
+static const uint8_t mouse_report_3[] = {
+	0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 // Right button pressed
+};
+
+static const uint8_t mouse_report_4[] = {
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00 // Mouse wheel axis delta -1
+};
+
+// CUH-ZCT1E 4-472-348-31 F1
+// 478 bytes
+static const uint8_t my_dualshock_4_hid_report_descriptor[] = {
+	0x05, 0x01, 0x09, 0x05, 0xA1, 0x01, 0x85, 0x01, 0x09, 0x30, 0x09, 0x31, 0x09, 0x32, 0x09, 0x35,
+	0x15, 0x00, 0x26, 0xFF, 0x00, 0x75, 0x08, 0x95, 0x04, 0x81, 0x02, 0x09, 0x39, 0x15, 0x00, 0x25,
+	0x07, 0x35, 0x00, 0x46, 0x3B, 0x01, 0x65, 0x14, 0x75, 0x04, 0x95, 0x01, 0x81, 0x42, 0x65, 0x00,
+	0x05, 0x09, 0x19, 0x01, 0x29, 0x0E, 0x15, 0x00, 0x25, 0x01, 0x75, 0x01, 0x95, 0x0E, 0x81, 0x02,
+	0x06, 0x00, 0xFF, 0x09, 0x20, 0x75, 0x06, 0x95, 0x01, 0x15, 0x00, 0x25, 0x7F, 0x81, 0x02, 0x05,
+	0x01, 0x09, 0x33, 0x09, 0x34, 0x15, 0x00, 0x26, 0xFF, 0x00, 0x75, 0x08, 0x95, 0x02, 0x81, 0x02,
+	0x06, 0x00, 0xFF, 0x09, 0x21, 0x95, 0x36, 0x81, 0x02, 0x85, 0x05, 0x09, 0x22, 0x95, 0x1F, 0x91,
+	0x02, 0x85, 0x04, 0x09, 0x23, 0x95, 0x24, 0xB1, 0x02, 0x85, 0x02, 0x09, 0x24, 0x95, 0x24, 0xB1,
+	0x02, 0x85, 0x08, 0x09, 0x25, 0x95, 0x03, 0xB1, 0x02, 0x85, 0x10, 0x09, 0x26, 0x95, 0x04, 0xB1,
+	0x02, 0x85, 0x11, 0x09, 0x27, 0x95, 0x02, 0xB1, 0x02, 0x85, 0x12, 0x06, 0x02, 0xFF, 0x09, 0x21,
+	0x95, 0x0F, 0xB1, 0x02, 0x85, 0x13, 0x09, 0x22, 0x95, 0x16, 0xB1, 0x02, 0x85, 0x14, 0x06, 0x05,
+	0xFF, 0x09, 0x20, 0x95, 0x10, 0xB1, 0x02, 0x85, 0x15, 0x09, 0x21, 0x95, 0x2C, 0xB1, 0x02, 0x06,
+	0x80, 0xFF, 0x85, 0x80, 0x09, 0x20, 0x95, 0x06, 0xB1, 0x02, 0x85, 0x81, 0x09, 0x21, 0x95, 0x06,
+	0xB1, 0x02, 0x85, 0x82, 0x09, 0x22, 0x95, 0x05, 0xB1, 0x02, 0x85, 0x83, 0x09, 0x23, 0x95, 0x01,
+	0xB1, 0x02, 0x85, 0x84, 0x09, 0x24, 0x95, 0x04, 0xB1, 0x02, 0x85, 0x85, 0x09, 0x25, 0x95, 0x06,
+	0xB1, 0x02, 0x85, 0x86, 0x09, 0x26, 0x95, 0x06, 0xB1, 0x02, 0x85, 0x87, 0x09, 0x27, 0x95, 0x23,
+	0xB1, 0x02, 0x85, 0x88, 0x09, 0x28, 0x95, 0x22, 0xB1, 0x02, 0x85, 0x89, 0x09, 0x29, 0x95, 0x02,
+	0xB1, 0x02, 0x85, 0x90, 0x09, 0x30, 0x95, 0x05, 0xB1, 0x02, 0x85, 0x91, 0x09, 0x31, 0x95, 0x03,
+	0xB1, 0x02, 0x85, 0x92, 0x09, 0x32, 0x95, 0x03, 0xB1, 0x02, 0x85, 0x93, 0x09, 0x33, 0x95, 0x0C,
+	0xB1, 0x02, 0x85, 0xA0, 0x09, 0x40, 0x95, 0x06, 0xB1, 0x02, 0x85, 0xA1, 0x09, 0x41, 0x95, 0x01,
+	0xB1, 0x02, 0x85, 0xA2, 0x09, 0x42, 0x95, 0x01, 0xB1, 0x02, 0x85, 0xA3, 0x09, 0x43, 0x95, 0x30,
+	0xB1, 0x02, 0x85, 0xA4, 0x09, 0x44, 0x95, 0x0D, 0xB1, 0x02, 0x85, 0xA5, 0x09, 0x45, 0x95, 0x15,
+	0xB1, 0x02, 0x85, 0xA6, 0x09, 0x46, 0x95, 0x15, 0xB1, 0x02, 0x85, 0xF0, 0x09, 0x47, 0x95, 0x3F,
+	0xB1, 0x02, 0x85, 0xF1, 0x09, 0x48, 0x95, 0x3F, 0xB1, 0x02, 0x85, 0xF2, 0x09, 0x49, 0x95, 0x0F,
+	0xB1, 0x02, 0x85, 0xA7, 0x09, 0x4A, 0x95, 0x01, 0xB1, 0x02, 0x85, 0xA8, 0x09, 0x4B, 0x95, 0x01,
+	0xB1, 0x02, 0x85, 0xA9, 0x09, 0x4C, 0x95, 0x08, 0xB1, 0x02, 0x85, 0xAA, 0x09, 0x4E, 0x95, 0x01,
+	0xB1, 0x02, 0x85, 0xAB, 0x09, 0x4F, 0x95, 0x39, 0xB1, 0x02, 0x85, 0xAC, 0x09, 0x50, 0x95, 0x39,
+	0xB1, 0x02, 0x85, 0xAD, 0x09, 0x51, 0x95, 0x0B, 0xB1, 0x02, 0x85, 0xAE, 0x09, 0x52, 0x95, 0x01,
+	0xB1, 0x02, 0x85, 0xAF, 0x09, 0x53, 0x95, 0x02, 0xB1, 0x02, 0x85, 0xB0, 0x09, 0x54, 0x95, 0x3F,
+	0xB1, 0x02, 0x85, 0xB1, 0x09, 0x55, 0x95, 0x02, 0xB1, 0x02, 0x85, 0xB2, 0x09, 0x56, 0x95, 0x02,
+	0xB1, 0x02, 0xC0
+};
+
+static const uint8_t my_dualshock_4_hid_report_x_o_pressed[] = {
+	0x01, 0x7E, 0x83, 0x7E, 0x7F, 0x68, 0x00, 0xF4, 0x00, 0x00, 0xC6, 0x84, 0x04, 0x1E, 0x00, 0xE7,
+	0xFF, 0xF5, 0xFF, 0x66, 0x02, 0xDD, 0x1D, 0x42, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x00,
+	0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+	0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00
+};
+
+static const uint8_t my_dualshock_4_hid_report_u_x_pressed[] = {
+	0x01, 0x83, 0x81, 0x7E, 0x7E, 0x20, 0x00, 0xD0, 0x00, 0x00, 0x7E, 0x09, 0x06, 0x08, 0x00, 0x00,
+	0x00, 0x02, 0x00, 0x65, 0x03, 0x75, 0x1F, 0xE0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x00,
+	0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+	0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00
+};
+
+static const uint8_t my_dualshock_4_hid_report_options_r2_max_pressed[] = {
+	0x01, 0x83, 0x7C, 0x7E, 0x7E, 0x08, 0x28, 0xEC, 0x00, 0xFF, 0xF8, 0xAD, 0x07, 0xFB, 0xFF, 0x00,
+	0x00, 0xFC, 0xFF, 0x72, 0x01, 0x6F, 0x1A, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x00,
+	0x00, 0x01, 0x72, 0x81, 0x37, 0x87, 0x05, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+	0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00
+};
+
+static const uint8_t my_dualshock_4_hid_report_lx_rx_min[] = {
+	0x01, 0x00, 0x5E, 0x00, 0x7F, 0x08, 0x00, 0xA8, 0x00, 0x00, 0x11, 0x05, 0x08, 0x07, 0x00, 0x03,
+	0x00, 0xF4, 0xFF, 0xDC, 0x01, 0x91, 0x1F, 0x28, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x00,
+	0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+	0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00
+};
+
+static const uint8_t my_dualshock_4_hid_report_idle[] = {
+	0x01, 0x7E, 0x83, 0x7E, 0x7F, 0x08, 0x00, 0xA8, 0x00, 0x00, 0x3E, 0x48, 0x03, 0x25, 0x00, 0x02,
+	0x00, 0xDA, 0xFF, 0x9F, 0xFA, 0x4F, 0x1D, 0x55, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x00,
+	0x00, 0x01, 0x65, 0x01, 0x48, 0x01, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+	0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00
+};
+
+// https://gimx.fr/wiki/index.php?title=DualShock_4#Sample_Report
+
+static const uint8_t dualshock_4_hid_report_descriptor_gimx_fr_wiki[] = {
+0x05, 0x01,        // Usage Page (Generic Desktop Ctrls)
+0x09, 0x05,        // Usage (Game Pad)
+0xA1, 0x01,        // Collection (Application)
+0x85, 0x01,        //   Report ID (1)
+0x09, 0x30,        //   Usage (X)
+0x09, 0x31,        //   Usage (Y)
+0x09, 0x32,        //   Usage (Z)
+0x09, 0x35,        //   Usage (Rz)
+0x15, 0x00,        //   Logical Minimum (0)
+0x26, 0xFF, 0x00,  //   Logical Maximum (255)
+0x75, 0x08,        //   Report Size (8)
+0x95, 0x04,        //   Report Count (4)
+0x81, 0x02,        //   Input (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position)
+0x09, 0x39,        //   Usage (Hat switch)
+0x15, 0x00,        //   Logical Minimum (0)
+0x25, 0x07,        //   Logical Maximum (7)
+0x35, 0x00,        //   Physical Minimum (0)
+0x46, 0x3B, 0x01,  //   Physical Maximum (315)
+0x65, 0x14,        //   Unit (System: English Rotation, Length: Centimeter)
+0x75, 0x04,        //   Report Size (4)
+0x95, 0x01,        //   Report Count (1)
+0x81, 0x42,        //   Input (Data,Var,Abs,No Wrap,Linear,Preferred State,Null State)
+0x65, 0x00,        //   Unit (None)
+0x05, 0x09,        //   Usage Page (Button)
+0x19, 0x01,        //   Usage Minimum (0x01)
+0x29, 0x0E,        //   Usage Maximum (0x0E)
+0x15, 0x00,        //   Logical Minimum (0)
+0x25, 0x01,        //   Logical Maximum (1)
+0x75, 0x01,        //   Report Size (1)
+0x95, 0x0E,        //   Report Count (14)
+0x81, 0x02,        //   Input (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position)
+0x06, 0x00, 0xFF,  //   Usage Page (Vendor Defined 0xFF00)
+0x09, 0x20,        //   Usage (0x20)
+0x75, 0x06,        //   Report Size (6)
+0x95, 0x01,        //   Report Count (1)
+0x15, 0x00,        //   Logical Minimum (0)
+0x25, 0x7F,        //   Logical Maximum (127)
+0x81, 0x02,        //   Input (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position)
+0x05, 0x01,        //   Usage Page (Generic Desktop Ctrls)
+0x09, 0x33,        //   Usage (Rx)
+0x09, 0x34,        //   Usage (Ry)
+0x15, 0x00,        //   Logical Minimum (0)
+0x26, 0xFF, 0x00,  //   Logical Maximum (255)
+0x75, 0x08,        //   Report Size (8)
+0x95, 0x02,        //   Report Count (2)
+0x81, 0x02,        //   Input (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position)
+0x06, 0x00, 0xFF,  //   Usage Page (Vendor Defined 0xFF00)
+0x09, 0x21,        //   Usage (0x21)
+0x95, 0x36,        //   Report Count (54)
+0x81, 0x02,        //   Input (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position)
+0x85, 0x05,        //   Report ID (5)
+0x09, 0x22,        //   Usage (0x22)
+0x95, 0x1F,        //   Report Count (31)
+0x91, 0x02,        //   Output (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
+0x85, 0x04,        //   Report ID (4)
+0x09, 0x23,        //   Usage (0x23)
+0x95, 0x24,        //   Report Count (36)
+0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
+0x85, 0x02,        //   Report ID (2)
+0x09, 0x24,        //   Usage (0x24)
+0x95, 0x24,        //   Report Count (36)
+0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
+0x85, 0x08,        //   Report ID (8)
+0x09, 0x25,        //   Usage (0x25)
+0x95, 0x03,        //   Report Count (3)
+0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
+0x85, 0x10,        //   Report ID (16)
+0x09, 0x26,        //   Usage (0x26)
+0x95, 0x04,        //   Report Count (4)
+0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
+0x85, 0x11,        //   Report ID (17)
+0x09, 0x27,        //   Usage (0x27)
+0x95, 0x02,        //   Report Count (2)
+0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
+0x85, 0x12,        //   Report ID (18)
+0x06, 0x02, 0xFF,  //   Usage Page (Vendor Defined 0xFF02)
+0x09, 0x21,        //   Usage (0x21)
+0x95, 0x0F,        //   Report Count (15)
+0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
+0x85, 0x13,        //   Report ID (19)
+0x09, 0x22,        //   Usage (0x22)
+0x95, 0x16,        //   Report Count (22)
+0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
+0x85, 0x14,        //   Report ID (20)
+0x06, 0x05, 0xFF,  //   Usage Page (Vendor Defined 0xFF05)
+0x09, 0x20,        //   Usage (0x20)
+0x95, 0x10,        //   Report Count (16)
+0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
+0x85, 0x15,        //   Report ID (21)
+0x09, 0x21,        //   Usage (0x21)
+0x95, 0x2C,        //   Report Count (44)
+0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
+0x06, 0x80, 0xFF,  //   Usage Page (Vendor Defined 0xFF80)
+0x85, 0x80,        //   Report ID (128)
+0x09, 0x20,        //   Usage (0x20)
+0x95, 0x06,        //   Report Count (6)
+0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
+0x85, 0x81,        //   Report ID (129)
+0x09, 0x21,        //   Usage (0x21)
+0x95, 0x06,        //   Report Count (6)
+0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
+0x85, 0x82,        //   Report ID (130)
+0x09, 0x22,        //   Usage (0x22)
+0x95, 0x05,        //   Report Count (5)
+0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
+0x85, 0x83,        //   Report ID (131)
+0x09, 0x23,        //   Usage (0x23)
+0x95, 0x01,        //   Report Count (1)
+0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
+0x85, 0x84,        //   Report ID (132)
+0x09, 0x24,        //   Usage (0x24)
+0x95, 0x04,        //   Report Count (4)
+0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
+0x85, 0x85,        //   Report ID (133)
+0x09, 0x25,        //   Usage (0x25)
+0x95, 0x06,        //   Report Count (6)
+0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
+0x85, 0x86,        //   Report ID (134)
+0x09, 0x26,        //   Usage (0x26)
+0x95, 0x06,        //   Report Count (6)
+0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
+0x85, 0x87,        //   Report ID (135)
+0x09, 0x27,        //   Usage (0x27)
+0x95, 0x23,        //   Report Count (35)
+0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
+0x85, 0x88,        //   Report ID (136)
+0x09, 0x28,        //   Usage (0x28)
+0x95, 0x22,        //   Report Count (34)
+0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
+0x85, 0x89,        //   Report ID (137)
+0x09, 0x29,        //   Usage (0x29)
+0x95, 0x02,        //   Report Count (2)
+0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
+0x85, 0x90,        //   Report ID (144)
+0x09, 0x30,        //   Usage (0x30)
+0x95, 0x05,        //   Report Count (5)
+0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
+0x85, 0x91,        //   Report ID (145)
+0x09, 0x31,        //   Usage (0x31)
+0x95, 0x03,        //   Report Count (3)
+0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
+0x85, 0x92,        //   Report ID (146)
+0x09, 0x32,        //   Usage (0x32)
+0x95, 0x03,        //   Report Count (3)
+0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
+0x85, 0x93,        //   Report ID (147)
+0x09, 0x33,        //   Usage (0x33)
+0x95, 0x0C,        //   Report Count (12)
+0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
+0x85, 0xA0,        //   Report ID (160)
+0x09, 0x40,        //   Usage (0x40)
+0x95, 0x06,        //   Report Count (6)
+0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
+0x85, 0xA1,        //   Report ID (161)
+0x09, 0x41,        //   Usage (0x41)
+0x95, 0x01,        //   Report Count (1)
+0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
+0x85, 0xA2,        //   Report ID (162)
+0x09, 0x42,        //   Usage (0x42)
+0x95, 0x01,        //   Report Count (1)
+0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
+0x85, 0xA3,        //   Report ID (163)
+0x09, 0x43,        //   Usage (0x43)
+0x95, 0x30,        //   Report Count (48)
+0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
+0x85, 0xA4,        //   Report ID (164)
+0x09, 0x44,        //   Usage (0x44)
+0x95, 0x0D,        //   Report Count (13)
+0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
+0x85, 0xA5,        //   Report ID (165)
+0x09, 0x45,        //   Usage (0x45)
+0x95, 0x15,        //   Report Count (21)
+0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
+0x85, 0xA6,        //   Report ID (166)
+0x09, 0x46,        //   Usage (0x46)
+0x95, 0x15,        //   Report Count (21)
+0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
+0x85, 0xF0,        //   Report ID (240)
+0x09, 0x47,        //   Usage (0x47)
+0x95, 0x3F,        //   Report Count (63)
+0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
+0x85, 0xF1,        //   Report ID (241)
+0x09, 0x48,        //   Usage (0x48)
+0x95, 0x3F,        //   Report Count (63)
+0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
+0x85, 0xF2,        //   Report ID (242)
+0x09, 0x49,        //   Usage (0x49)
+0x95, 0x0F,        //   Report Count (15)
+0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
+0x85, 0xA7,        //   Report ID (167)
+0x09, 0x4A,        //   Usage (0x4A)
+0x95, 0x01,        //   Report Count (1)
+0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
+0x85, 0xA8,        //   Report ID (168)
+0x09, 0x4B,        //   Usage (0x4B)
+0x95, 0x01,        //   Report Count (1)
+0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
+0x85, 0xA9,        //   Report ID (169)
+0x09, 0x4C,        //   Usage (0x4C)
+0x95, 0x08,        //   Report Count (8)
+0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
+0x85, 0xAA,        //   Report ID (170)
+0x09, 0x4E,        //   Usage (0x4E)
+0x95, 0x01,        //   Report Count (1)
+0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
+0x85, 0xAB,        //   Report ID (171)
+0x09, 0x4F,        //   Usage (0x4F)
+0x95, 0x39,        //   Report Count (57)
+0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
+0x85, 0xAC,        //   Report ID (172)
+0x09, 0x50,        //   Usage (0x50)
+0x95, 0x39,        //   Report Count (57)
+0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
+0x85, 0xAD,        //   Report ID (173)
+0x09, 0x51,        //   Usage (0x51)
+0x95, 0x0B,        //   Report Count (11)
+0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
+0x85, 0xAE,        //   Report ID (174)
+0x09, 0x52,        //   Usage (0x52)
+0x95, 0x01,        //   Report Count (1)
+0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
+0x85, 0xAF,        //   Report ID (175)
+0x09, 0x53,        //   Usage (0x53)
+0x95, 0x02,        //   Report Count (2)
+0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
+0x85, 0xB0,        //   Report ID (176)
+0x09, 0x54,        //   Usage (0x54)
+0x95, 0x3F,        //   Report Count (63)
+0xB1, 0x02,        //   Feature (Data,Var,Abs,No Wrap,Linear,Preferred State,No Null Position,Non-volatile)
+0xC0               // End Collection
+};
+// 467 bytes
+
+static const uint8_t dualshock_4_hid_report_gimx_fr_wiki[] = {
+	0x01, 0x81, 0x80, 0x83, 0x7A, 0x08, 0x00, 0x00, 0x00, 0x00, 0x93, 0x5F, 0xFB, 0xD2, 0xFF, 0xDA,
+	0xFF, 0xD8, 0xFF, 0x4F, 0xEE, 0x14, 0x1B, 0x99, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
+	0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+	0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00,
+};
+
+// DualShock 3 CECHZC2R
+static const uint8_t dualshock_3_hid_report_descriptor[] = {
+	0x05, 0x01, 0x09, 0x04, 0xA1, 0x01, 0xA1, 0x02, 0x85, 0x01, 0x75, 0x08, 0x95, 0x01, 0x15, 0x00,
+	0x26, 0xFF, 0x00, 0x81, 0x03, 0x75, 0x01, 0x95, 0x13, 0x15, 0x00, 0x25, 0x01, 0x35, 0x00, 0x45,
+	0x01, 0x05, 0x09, 0x19, 0x01, 0x29, 0x13, 0x81, 0x02, 0x75, 0x01, 0x95, 0x0D, 0x06, 0x00, 0xFF,
+	0x81, 0x03, 0x15, 0x00, 0x26, 0xFF, 0x00, 0x05, 0x01, 0x09, 0x01, 0xA1, 0x00, 0x75, 0x08, 0x95,
+	0x04, 0x35, 0x00, 0x46, 0xFF, 0x00, 0x09, 0x30, 0x09, 0x31, 0x09, 0x32, 0x09, 0x35, 0x81, 0x02,
+	0xC0, 0x05, 0x01, 0x75, 0x08, 0x95, 0x27, 0x09, 0x01, 0x81, 0x02, 0x75, 0x08, 0x95, 0x30, 0x09,
+	0x01, 0x91, 0x02, 0x75, 0x08, 0x95, 0x30, 0x09, 0x01, 0xB1, 0x02, 0xC0, 0xA1, 0x02, 0x85, 0x02,
+	0x75, 0x08, 0x95, 0x30, 0x09, 0x01, 0xB1, 0x02, 0xC0, 0xA1, 0x02, 0x85, 0xEE, 0x75, 0x08, 0x95,
+	0x30, 0x09, 0x01, 0xB1, 0x02, 0xC0, 0xA1, 0x02, 0x85, 0xEF, 0x75, 0x08, 0x95, 0x30, 0x09, 0x01,
+	0xB1, 0x02, 0xC0, 0xC0
+};
+
+// PS5 DualSence CFI-ZCT1W
+static const uint8_t dualsence_hid_report_descriptor[] = {
+	0x05, 0x01, 0x09, 0x05, 0xA1, 0x01, 0x85, 0x01, 0x09, 0x30, 0x09, 0x31, 0x09, 0x32, 0x09, 0x35,
+	0x09, 0x33, 0x09, 0x34, 0x15, 0x00, 0x26, 0xFF, 0x00, 0x75, 0x08, 0x95, 0x06, 0x81, 0x02, 0x06,
+	0x00, 0xFF, 0x09, 0x20, 0x95, 0x01, 0x81, 0x02, 0x05, 0x01, 0x09, 0x39, 0x15, 0x00, 0x25, 0x07,
+	0x35, 0x00, 0x46, 0x3B, 0x01, 0x65, 0x14, 0x75, 0x04, 0x95, 0x01, 0x81, 0x42, 0x65, 0x00, 0x05,
+	0x09, 0x19, 0x01, 0x29, 0x0F, 0x15, 0x00, 0x25, 0x01, 0x75, 0x01, 0x95, 0x0F, 0x81, 0x02, 0x06,
+	0x00, 0xFF, 0x09, 0x21, 0x95, 0x0D, 0x81, 0x02, 0x06, 0x00, 0xFF, 0x09, 0x22, 0x15, 0x00, 0x26,
+	0xFF, 0x00, 0x75, 0x08, 0x95, 0x34, 0x81, 0x02, 0x85, 0x02, 0x09, 0x23, 0x95, 0x2F, 0x91, 0x02,
+	0x85, 0x05, 0x09, 0x33, 0x95, 0x28, 0xB1, 0x02, 0x85, 0x08, 0x09, 0x34, 0x95, 0x2F, 0xB1, 0x02,
+	0x85, 0x09, 0x09, 0x24, 0x95, 0x13, 0xB1, 0x02, 0x85, 0x0A, 0x09, 0x25, 0x95, 0x1A, 0xB1, 0x02,
+	0x85, 0x20, 0x09, 0x26, 0x95, 0x3F, 0xB1, 0x02, 0x85, 0x21, 0x09, 0x27, 0x95, 0x04, 0xB1, 0x02,
+	0x85, 0x22, 0x09, 0x40, 0x95, 0x3F, 0xB1, 0x02, 0x85, 0x80, 0x09, 0x28, 0x95, 0x3F, 0xB1, 0x02,
+	0x85, 0x81, 0x09, 0x29, 0x95, 0x3F, 0xB1, 0x02, 0x85, 0x82, 0x09, 0x2A, 0x95, 0x09, 0xB1, 0x02,
+	0x85, 0x83, 0x09, 0x2B, 0x95, 0x3F, 0xB1, 0x02, 0x85, 0x84, 0x09, 0x2C, 0x95, 0x3F, 0xB1, 0x02,
+	0x85, 0x85, 0x09, 0x2D, 0x95, 0x02, 0xB1, 0x02, 0x85, 0xA0, 0x09, 0x2E, 0x95, 0x01, 0xB1, 0x02,
+	0x85, 0xE0, 0x09, 0x2F, 0x95, 0x3F, 0xB1, 0x02, 0x85, 0xF0, 0x09, 0x30, 0x95, 0x3F, 0xB1, 0x02,
+	0x85, 0xF1, 0x09, 0x31, 0x95, 0x3F, 0xB1, 0x02, 0x85, 0xF2, 0x09, 0x32, 0x95, 0x0F, 0xB1, 0x02,
+	0x85, 0xF4, 0x09, 0x35, 0x95, 0x3F, 0xB1, 0x02, 0x85, 0xF5, 0x09, 0x36, 0x95, 0x03, 0xB1, 0x02,
+	0xC0
+};
+
+static const uint8_t dualsence_hid_report_idle[] = {
+	0x01, 0x80, 0x81, 0x7F, 0x7E, 0x00, 0x00, 0x3F, 0x08, 0x00, 0x00, 0x00, 0x86, 0x86, 0x20, 0xB6,
+	0xFF, 0xFF, 0x06, 0x00, 0xFE, 0xFF, 0xC9, 0xF8, 0x8D, 0x1E, 0xDE, 0x05, 0xD2, 0x0E, 0xAB, 0x00,
+	0xFF, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x09, 0x09, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xF0, 0x9C, 0xAB, 0x00, 0x28, 0x08, 0x00, 0xA5, 0x21, 0x2F, 0x7E, 0x50, 0x97, 0x23, 0x48
+};
+
+static const uint8_t dualsence_hid_report_x_o_pressed[] = {
+	0x01, 0x7F, 0x83, 0x7F, 0x7E, 0x00, 0x00, 0xA3, 0x68, 0x00, 0x00, 0x00, 0x61, 0xF7, 0xBC, 0xF3,
+	0x03, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0x29, 0xFE, 0xB9, 0x1F, 0x60, 0x03, 0x5E, 0xA1, 0x31, 0x02,
+	0x01, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x09, 0x09, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x50, 0x2D, 0x32, 0x02, 0x28, 0x08, 0x00, 0xF6, 0xB0, 0x94, 0x0A, 0x5D, 0x86, 0xC1, 0xA8
+};
+
+static const uint8_t dualsence_hid_report_u_x_pressed[] = {
+	0x01, 0x7F, 0x83, 0x7F, 0x7E, 0x00, 0x00, 0x87, 0x20, 0x00, 0x00, 0x00, 0x45, 0xF9, 0xBC, 0xF3,
+	0xFE, 0xFF, 0x07, 0x00, 0x06, 0x00, 0xBF, 0xFC, 0x89, 0x1F, 0x4F, 0x04, 0x0B, 0x3A, 0x97, 0x1D,
+	0x04, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x09, 0x09, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xE0, 0xC1, 0x97, 0x1D, 0x28, 0x08, 0x00, 0x46, 0x0F, 0x9F, 0xC1, 0xE7, 0x19, 0x56, 0x0E
+};
+
+static const uint8_t dualsence_hid_report_options_r2_max_pressed[] = {
+	0x01, 0x7F, 0x82, 0x7F, 0x7E, 0x00, 0xFF, 0x2F, 0x08, 0x28, 0x00, 0x00, 0xED, 0xFA, 0xBC, 0xF3,
+	0x01, 0x00, 0x03, 0x00, 0x00, 0x00, 0xBF, 0xFB, 0xFA, 0x1A, 0x5B, 0xF0, 0xEC, 0x16, 0xAA, 0x48,
+	0x06, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x09, 0x09, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xB7, 0xA4, 0xAA, 0x48, 0x28, 0x08, 0x00, 0x28, 0xE5, 0x40, 0xF2, 0xFF, 0xEA, 0xAD, 0xBB
+};
+
+static const uint8_t dualsence_hid_report_lx_rx_min[] = {
+	0x01, 0x08, 0x5B, 0x01, 0x6A, 0x00, 0x00, 0xA5, 0x08, 0x00, 0x00, 0x00, 0x63, 0xFC, 0xBC, 0xF3,
+	0xFD, 0xFF, 0x02, 0x00, 0xFE, 0xFF, 0x49, 0x01, 0xAE, 0x1F, 0x74, 0x03, 0x4D, 0x2A, 0xA8, 0x74,
+	0x08, 0x80, 0x2B, 0x57, 0x1A, 0x80, 0x00, 0x00, 0x00, 0xD5, 0x09, 0x09, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x70, 0xBA, 0xA8, 0x74, 0x28, 0x08, 0x00, 0x64, 0x7D, 0x33, 0x47, 0x63, 0xD8, 0xD5, 0x2F
 };
\ No newline at end of file
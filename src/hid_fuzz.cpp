@@ -0,0 +1,506 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <stdint.h>
+#include <stdio.h>
+#include <vector>
+
+#include "arena_allocator.h"
+#include "hid_dumps.h"
+#include "hid_parser.h"
+#include "hid_gamecube_mapping.h"
+
+/*
+Report descriptor fuzzer: mutated descriptors from hid_dumps.h seed corpus (and long usage ranges descriptor) through ParseReportDescriptor()
+and random reports of every parsed report through ParseReport().
+
+Usage:
+	HID_Parser_Fuzz [--iterations n] [--seed n] [--max-len bytes] [--parse-budget-us n] [--decode-budget-us n]
+	                [--arena-budget bytes] [--log file] [--crash-dir dir] [--input file]
+
+Every input is parsed, then every parsed report gets random contents, random Report ID and random length.
+Records per input descriptor parse time, slowest report decode time and arena high-water mark (--log: one line per input).
+Fails when an input exceeds a budget or breaks an invariant, failing descriptor is written to --crash-dir
+and can be rerun with --input. Time budgets are checked only when given (0 - off): CTest runs with iteration and
+arena budgets only, time budgets are for manual runs (HID_Parser_Fuzz_Timed target) on an idle machine. Results are printed to stderr, parser output is discarded. Memory safety is checked by sanitizers (HID_FUZZ_SANITIZERS build option).
+
+Mutated descriptors which give a new (reports, segments, arena bytes) outcome are added to corpus.
+Times are host times: over-budget inputs are timed again and the fastest run counts.
+*/
+
+typedef struct fuzz_options
+{
+	uint32_t iterations = 20000;
+	uint32_t seed = 1;
+	uint16_t max_len = 1024; // Firmware reads descriptors into CFG_TUH_ENUMERATION_BUFSIZE (512) bytes
+	double parse_budget_us = 0; // Off
+	double decode_budget_us = 0; // Off
+	size_t arena_budget = ARENA_SIZE;
+	const char* log = nullptr;
+	const char* crash_dir = nullptr;
+	const char* input = nullptr;
+} fuzz_options;
+
+typedef struct fuzz_result
+{
+	bool parsed;
+	uint16_t reports;
+	uint16_t segments;
+	size_t arena_bytes;
+	double parse_us;
+	double decode_us; // Slowest report
+} fuzz_result;
+
+#define REPORT_INFO_MAX 64
+#define REPORT_MAX_LEN ((UINT16_MAX + 7) / 8 + 8) // Longest report: 16-bit length in bits, longer reports
+#define RETIMES 5
+#define CORPUS_MAX 256
+
+typedef std::vector<uint8_t> fuzz_input;
+
+static uint32_t g_random;
+
+static uint32_t random_next()
+{
+	// xorshift32
+	g_random ^= g_random << 13;
+	g_random ^= g_random >> 17;
+	g_random ^= g_random << 5;
+
+	return g_random;
+}
+
+static uint32_t random_below(uint32_t limit)
+{
+	return limit ? random_next() % limit : 0;
+}
+
+// Items with edge case values spliced into descriptors
+static const uint8_t g_items[][6] = // Length, item bytes
+{
+	{ 2, 0x05, 0x01 }, // Usage Page (Generic Desktop)
+	{ 2, 0x05, 0x09 }, // Usage Page (Button)
+	{ 2, 0x09, 0x05 }, // Usage (Game Pad)
+	{ 2, 0x09, 0x04 }, // Usage (Joystick)
+	{ 2, 0xA1, 0x01 }, // Collection (Application)
+	{ 1, 0xC0 }, // End Collection
+	{ 2, 0x85, 0x01 }, // Report ID (1)
+	{ 2, 0x85, 0xFF }, // Report ID (255)
+	{ 2, 0x75, 0x00 }, // Report Size (0)
+	{ 2, 0x75, 0x01 }, // Report Size (1)
+	{ 2, 0x75, 0x20 }, // Report Size (32)
+	{ 2, 0x75, 0xFF }, // Report Size (255)
+	{ 2, 0x95, 0x00 }, // Report Count (0)
+	{ 2, 0x95, 0xFF }, // Report Count (255)
+	{ 2, 0x15, 0x80 }, // Logical Minimum (-128)
+	{ 5, 0x17, 0x00, 0x00, 0x00, 0x80 }, // Logical Minimum (INT32_MIN)
+	{ 5, 0x27, 0xFF, 0xFF, 0xFF, 0x7F }, // Logical Maximum (INT32_MAX)
+	{ 2, 0x19, 0x00 }, // Usage Minimum (0)
+	{ 2, 0x19, 0x01 }, // Usage Minimum (1)
+	{ 3, 0x2A, 0xFF, 0xFF }, // Usage Maximum (65535)
+	{ 5, 0x2B, 0xFF, 0xFF, 0xFF, 0xFF }, // Usage Maximum (UINT32_MAX)
+	{ 3, 0x0A, 0x30, 0x01 }, // Usage (0x130)
+	{ 2, 0x09, 0x30 }, // Usage (X)
+	{ 2, 0x81, 0x02 }, // Input (Data, Variable, Absolute)
+	{ 2, 0x81, 0x00 }, // Input (Data, Array)
+	{ 2, 0x81, 0x03 }, // Input (Constant)
+};
+
+static void mutate(fuzz_input& data, const std::vector<fuzz_input>& corpus, const uint16_t max_len)
+{
+	const uint32_t mutations = 1 + random_below(8);
+
+	for (uint32_t mutation = 0; mutation < mutations; mutation++)
+	{
+		const size_t size = data.size();
+		const size_t position = random_below((uint32_t)size + 1);
+
+		switch (random_below(8))
+		{
+		case 0: // Flip bit
+			if (size)
+				data[position % size] ^= 1 << random_below(8);
+			break;
+
+		case 1: // Random byte
+			if (size)
+				data[position % size] = (uint8_t)random_next();
+			break;
+
+		case 2: // Insert random byte
+			data.insert(data.begin() + position, (uint8_t)random_next());
+			break;
+
+		case 3: // Delete range
+			if (size)
+				data.erase(data.begin() + position % size, data.begin() + std::min(size, position % size + 1 + random_below(8)));
+			break;
+
+		case 4: // Repeat range, e.g. Input items
+		{
+			if (!size)
+				break;
+
+			const size_t start = position % size;
+			const size_t length = std::min(size - start, (size_t)1 + random_below(16));
+			const fuzz_input range(data.begin() + start, data.begin() + start + length);
+			const uint32_t repeats = 1 + random_below(32);
+
+			for (uint32_t repeat = 0; repeat < repeats; repeat++)
+				data.insert(data.begin() + start, range.begin(), range.end());
+
+			break;
+		}
+
+		case 5: // Splice range of other corpus entry
+		{
+			const fuzz_input& other = corpus[random_below((uint32_t)corpus.size())];
+
+			if (other.empty())
+				break;
+
+			const size_t start = random_below((uint32_t)other.size());
+			const size_t length = std::min(other.size() - start, (size_t)1 + random_below(64));
+
+			data.insert(data.begin() + position, other.begin() + start, other.begin() + start + length);
+			break;
+		}
+
+		case 6: // Insert edge case item
+		{
+			const uint8_t* item = g_items[random_below(sizeof(g_items) / sizeof(g_items[0]))];
+			data.insert(data.begin() + position, item + 1, item + 1 + item[0]);
+			break;
+		}
+
+		case 7: // Truncate
+			data.resize(position);
+			break;
+		}
+	}
+
+	if (data.size() > max_len)
+		data.resize(max_len);
+}
+
+static double elapsed_us(const std::chrono::steady_clock::time_point start)
+{
+	return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+}
+
+static const char* g_failure = nullptr;
+
+static void gamepad_callback(uint8_t pad, uint32_t, uint32_t)
+{
+	if (pad >= HID_PARSER_MAX_PADS)
+		g_failure = "gamepad callback pad out of range";
+}
+
+static void keyboard_callback(uint8_t, bool)
+{
+}
+
+static void mouse_callback(int16_t, int16_t, int16_t, uint8_t)
+{
+}
+
+static double parse(const fuzz_input& data, bool& parsed)
+{
+	const auto start = std::chrono::steady_clock::now();
+	parsed = ParseReportDescriptor(data.data(), (uint16_t)data.size(), hid_to_gamecube_mapping);
+
+	return elapsed_us(start);
+}
+
+// Random contents for every report, slowest ParseReport() time.
+static double decode(const hid_parser_report_info* reports, const uint16_t count)
+{
+	static uint8_t report[REPORT_MAX_LEN];
+	double slowest_us = 0.0;
+
+	// Zero length report
+	ParseReport(report, 0, gamepad_callback, keyboard_callback, mouse_callback);
+
+	for (uint16_t index = 0; index < count && index < REPORT_INFO_MAX; index++)
+	{
+		const uint16_t length = (reports[index].length + 7) / 8;
+
+		for (uint32_t i = 0; i < length + 8u; i++)
+			report[i] = (uint8_t)random_next();
+
+		if (hid_parser_uses_report_ids() && random_below(4))
+			report[0] = reports[index].reportID;
+
+		// Exact, truncated or longer report
+		const uint32_t lengths[] = { length, random_below(length + 1u), std::min<uint32_t>(REPORT_MAX_LEN, length + random_below(8)) };
+
+		for (const uint32_t len : lengths)
+		{
+			hid_parser_report_pads(report, len);
+
+			const auto start = std::chrono::steady_clock::now();
+			ParseReport(report, len, gamepad_callback, keyboard_callback, mouse_callback);
+			slowest_us = std::max(slowest_us, elapsed_us(start));
+		}
+	}
+
+	return slowest_us;
+}
+
+static fuzz_result run(const fuzz_input& data)
+{
+	fuzz_result result = {};
+
+	result.parse_us = parse(data, result.parsed);
+	result.arena_bytes = arena_used();
+
+	hid_parser_report_info reports[REPORT_INFO_MAX];
+	result.reports = hid_parser_reports(reports, REPORT_INFO_MAX);
+
+	for (uint16_t index = 0; index < result.reports && index < REPORT_INFO_MAX; index++)
+		result.segments += hid_parser_segments(index, nullptr, 0);
+
+	result.decode_us = decode(reports, result.reports);
+
+	return result;
+}
+
+// Fastest of RETIMES runs: host scheduling noise is not a budget failure.
+static void retime(const fuzz_input& data, fuzz_result* result)
+{
+	for (uint32_t i = 0; i < RETIMES; i++)
+	{
+		const fuzz_result again = run(data);
+		result->parse_us = std::min(result->parse_us, again.parse_us);
+		result->decode_us = std::min(result->decode_us, again.decode_us);
+	}
+}
+
+static const char* check_budget(const fuzz_result& result, const fuzz_options& options)
+{
+	if (options.parse_budget_us > 0 && result.parse_us > options.parse_budget_us)
+		return "parse time over budget";
+
+	if (options.decode_budget_us > 0 && result.decode_us > options.decode_budget_us)
+		return "decode time over budget";
+
+	if (result.arena_bytes > options.arena_budget)
+		return "arena bytes over budget";
+
+	return nullptr;
+}
+
+static void save_crash(const fuzz_options& options, const fuzz_input& data, const uint32_t iteration)
+{
+	if (!options.crash_dir)
+		return;
+
+	char path[512];
+	snprintf(path, sizeof(path), "%s/hid_fuzz_%u_%u.bin", options.crash_dir, options.seed, iteration);
+
+	if (FILE* file = fopen(path, "wb"))
+	{
+		fwrite(data.data(), 1, data.size(), file);
+		fclose(file);
+		fprintf(stderr, "Saved %s\n", path);
+	}
+}
+
+static bool read_input(const char* path, fuzz_input* data)
+{
+	FILE* file = fopen(path, "rb");
+
+	if (!file)
+	{
+		fprintf(stderr, "Can't read %s\n", path);
+		return false;
+	}
+
+	uint8_t buffer[4096];
+	size_t size;
+
+	while ((size = fread(buffer, 1, sizeof(buffer), file)) > 0)
+		data->insert(data->end(), buffer, buffer + size);
+
+	fclose(file);
+
+	if (data->size() > UINT16_MAX)
+		data->resize(UINT16_MAX);
+
+	return true;
+}
+
+static bool parse_options(int argc, char** argv, fuzz_options* options)
+{
+	for (int i = 1; i < argc; i++)
+	{
+		const char* arg = argv[i];
+		const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+
+		if (!value)
+		{
+			fprintf(stderr, "Unknown option or missing value: %s\n", arg);
+			return false;
+		}
+
+		if (!strcmp(arg, "--iterations"))
+			options->iterations = (uint32_t)strtoul(value, nullptr, 10);
+		else if (!strcmp(arg, "--seed"))
+			options->seed = (uint32_t)strtoul(value, nullptr, 10);
+		else if (!strcmp(arg, "--max-len"))
+			options->max_len = (uint16_t)std::min(strtoul(value, nullptr, 10), (unsigned long)UINT16_MAX);
+		else if (!strcmp(arg, "--parse-budget-us"))
+			options->parse_budget_us = atof(value);
+		else if (!strcmp(arg, "--decode-budget-us"))
+			options->decode_budget_us = atof(value);
+		else if (!strcmp(arg, "--arena-budget"))
+			options->arena_budget = strtoul(value, nullptr, 10);
+		else if (!strcmp(arg, "--log"))
+			options->log = value;
+		else if (!strcmp(arg, "--crash-dir"))
+			options->crash_dir = value;
+		else if (!strcmp(arg, "--input"))
+			options->input = value;
+		else
+		{
+			fprintf(stderr, "Unknown option: %s\n", arg);
+			return false;
+		}
+
+		i++;
+	}
+
+	return true;
+}
+
+// Long usage ranges, repeated by mutator: parse time must not depend on range length
+static const uint8_t usage_ranges_descriptor[] =
+{
+	0x05, 0x01, 0x09, 0x05, 0xA1, 0x01, // Usage Page (Generic Desktop), Usage (Game Pad), Collection (Application)
+	0x05, 0x09, 0x75, 0x01, 0x95, 0xFF, // Usage Page (Button), Report Size (1), Report Count (255)
+	0x19, 0x00, 0x2A, 0xFE, 0xFF, 0x81, 0x02, // Usage Minimum (0), Usage Maximum (65534), Input
+	0x05, 0x08, // Usage Page (LEDs): no presets
+	0x19, 0x00, 0x2A, 0xFE, 0xFF, 0x81, 0x02,
+	0xC0
+};
+
+#define SEED(descriptor) fuzz_input(descriptor, descriptor + sizeof(descriptor))
+
+int main(int argc, char** argv)
+{
+	fuzz_options options;
+
+	if (!parse_options(argc, argv, &options))
+		return 2;
+
+	g_random = options.seed ? options.seed : 1;
+
+	// Parser debug prints (e.g. CreateSeg warnings) for every mutated descriptor, results go to stderr
+#ifdef _WIN32
+	freopen("NUL", "w", stdout);
+#else
+	freopen("/dev/null", "w", stdout);
+#endif
+
+	std::vector<fuzz_input> corpus =
+	{
+		SEED(dualshock4_hid_report_descriptor),
+		SEED(keyboard_report_descriptor),
+		SEED(mouse_report_descriptor),
+		SEED(my_dualshock_4_hid_report_descriptor),
+		SEED(dualshock_4_hid_report_descriptor_gimx_fr_wiki),
+		SEED(dualshock_3_hid_report_descriptor),
+		SEED(dualsence_hid_report_descriptor),
+		SEED(usage_ranges_descriptor),
+	};
+
+	FILE* log = nullptr;
+
+	if (options.log && !(log = fopen(options.log, "w")))
+	{
+		fprintf(stderr, "Can't write %s\n", options.log);
+		return 2;
+	}
+
+	if (log)
+		fprintf(log, "# iteration len parsed reports segments arena_bytes parse_us decode_us\n");
+
+	std::vector<uint64_t> outcomes;
+	fuzz_result worst = {};
+	uint32_t parsed = 0;
+
+	const uint32_t seeds = (uint32_t)corpus.size();
+	const uint32_t iterations = options.input ? 1 : seeds + options.iterations;
+
+	for (uint32_t iteration = 0; iteration < iterations; iteration++)
+	{
+		fuzz_input data;
+
+		if (options.input)
+		{
+			if (!read_input(options.input, &data))
+				return 2;
+		}
+		else if (iteration < seeds)
+			data = corpus[iteration];
+		else
+		{
+			data = corpus[random_below((uint32_t)corpus.size())];
+			mutate(data, corpus, options.max_len);
+		}
+
+		fuzz_result result = run(data);
+
+		const char* failure = g_failure;
+
+		if (!failure && check_budget(result, options))
+		{
+			retime(data, &result);
+			failure = g_failure ? g_failure : check_budget(result, options);
+		}
+
+		if (log)
+		{
+			fprintf(log, "%u %zu %u %u %u %zu %.2f %.2f\n", iteration, data.size(), result.parsed, result.reports,
+				result.segments, result.arena_bytes, result.parse_us, result.decode_us);
+		}
+
+		if (failure)
+		{
+			fprintf(stderr, "FAIL iteration %u: %s (len %zu, parse %.2f us, decode %.2f us, arena %zu bytes)\n",
+				iteration, failure, data.size(), result.parse_us, result.decode_us, result.arena_bytes);
+
+			save_crash(options, data, iteration);
+
+			if (log)
+				fclose(log);
+
+			return 1;
+		}
+
+		parsed += result.parsed;
+		worst.parse_us = std::max(worst.parse_us, result.parse_us);
+		worst.decode_us = std::max(worst.decode_us, result.decode_us);
+		worst.arena_bytes = std::max(worst.arena_bytes, result.arena_bytes);
+
+		// New outcome: keep input as mutation base
+		const uint64_t outcome = ((uint64_t)result.reports << 48) | ((uint64_t)result.segments << 32) | result.arena_bytes;
+
+		if (result.parsed && corpus.size() < CORPUS_MAX && std::find(outcomes.begin(), outcomes.end(), outcome) == outcomes.end())
+		{
+			outcomes.push_back(outcome);
+
+			if (iteration >= seeds)
+				corpus.push_back(data);
+		}
+	}
+
+	if (log)
+		fclose(log);
+
+	fprintf(stderr, "%u inputs, %u parsed, corpus %zu, max parse %.2f us, max decode %.2f us, max arena %zu bytes\n",
+		iterations, parsed, corpus.size(), worst.parse_us, worst.decode_us, worst.arena_bytes);
+
+	return 0;
+}
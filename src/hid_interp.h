@@ -0,0 +1,89 @@
+#pragma once
+
+#include <stdint.h>
+
+/*
+RP2040 SIO interpolator backend of HID report field extraction (processSeg() in hid_parser.cpp).
+
+Built with HID_PARSER_INTERP (-DSMD2GC_HID_INTERP=ON), portable bit loop and convert_range() otherwise.
+Field of up to 32 bits not crossing 4 bytes window is loaded once, INTERP0 lane 0 shifts, masks
+and sign-extends it. 8 / 16-bit axes mapped to uint8 are shifted and masked to top byte by same lane instead
+of convert_range(): top byte is always in uint8 range, no clamp is needed, signed fields are biased by 128 with xor.
+
+Interpolators are per core and INTERP0 is used by parser core (core1) only. Host builds use bit-exact software model
+(interp_model.h), HID_Interp_Tests checks it against portable extraction.
+*/
+
+#if HID_PARSER_INTERP
+#if PICO_ON_DEVICE
+#include "hardware/interp.h"
+
+#define INTERP_CTRL_SHIFT_LSB SIO_INTERP0_CTRL_LANE0_SHIFT_LSB
+#define INTERP_CTRL_MASK_LSB_LSB SIO_INTERP0_CTRL_LANE0_MASK_LSB_LSB
+#define INTERP_CTRL_MASK_MSB_LSB SIO_INTERP0_CTRL_LANE0_MASK_MSB_LSB
+#define INTERP_CTRL_SIGNED_BITS SIO_INTERP0_CTRL_LANE0_SIGNED_BITS
+
+typedef interp_hw_t hid_interp_t;
+#define HID_INTERP_FIELD interp0
+
+inline uint32_t hid_interp_peek0(hid_interp_t* interp) { return interp->peek[0]; }
+#else
+#include "interp_model.h"
+
+typedef interp_model hid_interp_t;
+extern interp_model hid_interp_models[2];
+#define HID_INTERP_FIELD (&hid_interp_models[0])
+
+inline uint32_t hid_interp_peek0(hid_interp_t* interp) { return interp_model_peek(interp, 0); }
+#endif
+
+// Field is in 4 bytes window.
+inline bool hid_interp_fits(const uint16_t start_bit, const uint8_t size)
+{
+	return size && (start_bit & 7) + size <= 32;
+}
+
+// Little endian load of bytes covering field, never past field end.
+inline uint32_t hid_interp_window(const uint8_t* data, const uint16_t start_bit, const uint8_t size)
+{
+	const uint8_t* bytes = data + (start_bit >> 3);
+	const uint8_t count = ((start_bit & 7) + size + 7) >> 3;
+
+	uint32_t window = bytes[0];
+
+	if (count > 1)
+		window |= (uint32_t)bytes[1] << 8;
+	if (count > 2)
+		window |= (uint32_t)bytes[2] << 16;
+	if (count > 3)
+		window |= (uint32_t)bytes[3] << 24;
+
+	return window;
+}
+
+// Field value, sign-extended if is_signed. Requires hid_interp_fits().
+inline uint32_t hid_interp_field(const uint8_t* data, const uint16_t start_bit, const uint8_t size, const bool is_signed)
+{
+	hid_interp_t* interp = HID_INTERP_FIELD;
+
+	interp->ctrl[0] = (uint32_t)(start_bit & 7) << INTERP_CTRL_SHIFT_LSB | (uint32_t)(size - 1) << INTERP_CTRL_MASK_MSB_LSB
+		| (is_signed ? INTERP_CTRL_SIGNED_BITS : 0);
+	interp->base[0] = 0;
+	interp->accum[0] = hid_interp_window(data, start_bit, size);
+
+	return hid_interp_peek0(interp);
+}
+
+// 8 or 16-bit axis to uint8 like convert_range() to VALUE_TYPE_UINT8: top byte, signed fields biased by 128.
+// Requires hid_interp_fits().
+inline uint8_t hid_interp_axis(const uint8_t* data, const uint16_t start_bit, const uint8_t size, const bool is_signed)
+{
+	hid_interp_t* interp = HID_INTERP_FIELD;
+
+	interp->ctrl[0] = (uint32_t)((start_bit & 7) + size - 8) << INTERP_CTRL_SHIFT_LSB | 7u << INTERP_CTRL_MASK_MSB_LSB;
+	interp->base[0] = 0;
+	interp->accum[0] = hid_interp_window(data, start_bit, size);
+
+	return (uint8_t)hid_interp_peek0(interp) ^ (is_signed ? 0x80 : 0);
+}
+#endif
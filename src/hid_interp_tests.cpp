@@ -0,0 +1,183 @@
+#include <cassert>
+#include <cstring>
+#include <stdio.h>
+
+#include "hid_parser.h"
+#include "hid_interp.h"
+
+/*
+Test of interpolator model (interp_model.h) and interpolator backend of report field extraction (hid_interp.h):
+every field offset / size and every 8 / 16-bit axis value against portable bit loop and convert_range().
+*/
+
+static uint32_t reference_field(const uint8_t* data, uint16_t start_bit, uint8_t size, bool is_signed)
+{
+	uint32_t value = 0;
+
+	for (uint8_t i = 0; i < size; i++, start_bit++)
+		value |= (uint32_t)((data[start_bit >> 3] >> (start_bit & 7)) & 1) << i;
+
+	if (is_signed && (value & (1u << (size - 1))))
+		value |= UINT32_MAX << (size - 1);
+
+	return value;
+}
+
+static void test_model()
+{
+	interp_model interp = {};
+	interp.accum[0] = 0x00000080;
+	interp.ctrl[0] = 4 << INTERP_CTRL_SHIFT_LSB | 3 << INTERP_CTRL_MASK_MSB_LSB;
+	assert(interp_model_peek(&interp, 0) == 0x8);
+
+	interp.ctrl[0] |= INTERP_CTRL_SIGNED_BITS;
+	assert(interp_model_peek(&interp, 0) == 0xFFFFFFF8);
+
+	interp.base[0] = 10;
+	assert(interp_model_peek(&interp, 0) == 2);
+
+	// Mask LSB above 0
+	interp.accum[1] = 0xABCD;
+	interp.ctrl[1] = 4 << INTERP_CTRL_MASK_LSB_LSB | 11 << INTERP_CTRL_MASK_MSB_LSB;
+	assert(interp_model_peek(&interp, 1) == 0xBC0);
+
+	interp.base[2] = 1000;
+	assert(interp_model_peek(&interp, INTERP_PEEK_FULL) == 1000 + 0xFFFFFFF8 + 0xBC0);
+
+	interp.ctrl[1] |= INTERP_CTRL_ADD_RAW_BITS;
+	interp.base[1] = 1;
+	assert(interp_model_peek(&interp, 1) == 0xABCE);
+	assert(interp_model_peek(&interp, INTERP_PEEK_FULL) == 1000 + 0xFFFFFFF8 + 0xBC0); // FULL result is not raw
+
+	// Clamp: INTERP1 lane 0 only, base is not added
+	interp = {};
+	interp.accum[0] = 0x9C; // -100
+	interp.base[0] = (uint32_t)-50;
+	interp.base[1] = 50;
+	interp.ctrl[0] = 7 << INTERP_CTRL_MASK_MSB_LSB | INTERP_CTRL_SIGNED_BITS | INTERP_CTRL_CLAMP_BITS;
+	assert(interp_model_peek(&interp, 0) == (uint32_t)-150); // No clamp on INTERP0: -100 + base
+
+	interp.clamp = true;
+	assert(interp_model_peek(&interp, 0) == (uint32_t)-50);
+
+	interp.accum[0] = 0x7F;
+	assert(interp_model_peek(&interp, 0) == 50);
+
+	interp.accum[0] = 0x10;
+	assert(interp_model_peek(&interp, 0) == 0x10);
+
+	interp.ctrl[0] &= ~INTERP_CTRL_SIGNED_BITS; // Unsigned compare
+	interp.accum[0] = 0x9C;
+	interp.base[0] = 0;
+	interp.base[1] = 0x80;
+	assert(interp_model_peek(&interp, 0) == 0x80);
+}
+
+static uint32_t g_random = 0x2468ACE1;
+
+static uint32_t random_next()
+{
+	// xorshift32
+	g_random ^= g_random << 13;
+	g_random ^= g_random >> 17;
+	g_random ^= g_random << 5;
+
+	return g_random;
+}
+
+static void test_fields()
+{
+	uint32_t checked = 0;
+
+	for (uint32_t round = 0; round < 256; round++)
+	{
+		uint8_t data[8];
+
+		for (uint8_t& byte : data)
+			byte = (uint8_t)random_next();
+
+		for (uint16_t start_bit = 0; start_bit < 32; start_bit++)
+		{
+			for (uint8_t size = 1; size <= 32; size++)
+			{
+				if (!hid_interp_fits(start_bit, size))
+					continue;
+
+				for (uint8_t is_signed = 0; is_signed < 2; is_signed++)
+				{
+					if (hid_interp_field(data, start_bit, size, is_signed) != reference_field(data, start_bit, size, is_signed))
+					{
+						printf("field start %u size %u signed %d differs\n", start_bit, size, is_signed);
+						assert(false);
+					}
+
+					checked++;
+				}
+			}
+		}
+	}
+
+	assert(!hid_interp_fits(0, 0));
+	assert(!hid_interp_fits(1, 32));
+	assert(hid_interp_fits(7, 25));
+
+	printf("fields: %u checked\n", checked);
+}
+
+typedef struct axis_type
+{
+	int16_t minimum;
+	uint16_t maximum;
+	uint8_t size;
+} axis_type;
+
+static void test_axes()
+{
+	static const axis_type types[] =
+	{
+		{ 0, UINT8_MAX, 8 },
+		{ INT8_MIN, INT8_MAX, 8 },
+		{ 0, UINT16_MAX, 16 },
+		{ INT16_MIN, INT16_MAX, 16 },
+	};
+
+	uint32_t checked = 0;
+
+	for (const axis_type& type : types)
+	{
+		const bool is_signed = type.minimum < 0;
+
+		for (uint32_t value = 0; value < (1u << type.size); value++)
+		{
+			for (uint8_t offset = 0; offset < 8; offset++)
+			{
+				uint8_t data[4];
+				const uint32_t window = value << offset | (random_next() & ((1u << offset) - 1)) | random_next() << (offset + type.size);
+				memcpy(data, &window, sizeof(data));
+
+				const uint32_t field = reference_field(data, offset, type.size, is_signed);
+				const uint8_t expected = (uint8_t)convert_range(field, type.minimum, type.maximum, VALUE_TYPE_UINT8);
+
+				if (hid_interp_axis(data, offset, type.size, is_signed) != expected)
+				{
+					printf("axis %d..%u value %x offset %u: %02x, convert_range %02x\n", type.minimum, type.maximum, value, offset,
+						hid_interp_axis(data, offset, type.size, is_signed), expected);
+					assert(false);
+				}
+
+				checked++;
+			}
+		}
+	}
+
+	printf("axes: %u checked\n", checked);
+}
+
+int main()
+{
+	test_model();
+	test_fields();
+	test_axes();
+
+	return 0;
+}
@@ -1,1267 +1,1785 @@
-﻿#include <new>
-#include <cassert>
-#include <cstring>
-#include <stdint.h>
-#include <stdio.h>
-
-#include "hid_parser.h"
-
-#include "arena_allocator.h"
-#include "hid_dumps.h"
-
-#define LITTLE_ENDIAN 0 // RP2040 is little endian / Intel x86 is big endian
-
-/*
-Reference:
-USB Device Class Definition for Human Interface Devices (HID)
-Version 1.11
-https://www.usb.org/sites/default/files/documents/hid1_11.pdf
-
-5.3 Generic Item Format
-An item is piece of information about the device. All items have a one-byte prefix
-that contains the item tag, item type, and item size.
-
-Bits   23 22 21 20 19 18 17 16 15 14 13 12 11 10 9 8  7 6 5 4  3 2   1 0
-       ┌──────────────────────┐┌────────────────────┐┌───────┬─────┬─────┐
-Parts  │        [data]        ││       [data]       ││ bTag  │bType│bSize│
-       └──────────────────────┘└────────────────────┘└───────┴─────┴─────┘
-Bytes             2                       1                   0
-
-There are two basic types of items: short　items and long items.
-If the item is a short item, its optional data size may be 0, 1,　2, or 4 bytes.
-
-5.4 Item Parser
-From the parser’s point of view, a HID class device looks like the following　figure:
-
-                                    ┌────────────────────┐
-                                    │    Application     │
-                                    │    Collection      │
-                                    └────────────────────┘
-                                              │
-                             ┌────────────────┴──────────────────────┐
-                             ▼                                       ▼
-                    ┌────────────────┐                       ┌────────────────┐
-                    │   Collection   │                       │     Report     │
-                    └────────────────┘                       └────────────────┘
-                             │                                       │
-                   ┌─────────┴──────────┐                            │
-                   ▼                    ▼                            ▼
-           ┌──────────────┐    ┌──────────────┐          ┌────────────────────────┐
-           │    Report    │    │    Report    │          │ Main Item              │
-           └──────────────┘    └──────────────┘          │ Report Size            │
-                   │                    │                │ Report Count           │
-                   ▼                    ▼                └────────────────────────┘
-        ┌─────────────────────┐ ┌─────────────────────┐              │
-        │ Main Item           │ │ Main Item           │       ┌──────┴───────┐
-        │ Report Size         │ │ Report Size         │       │              │
-        │ Report Count        │ │ Report Count        │       ▼              ▼
-        │ Logical Minimum     │ │ Logical Minimum     │  ┌─────────┐    ┌─────────┐
-        │ Logical Maximum     │ │ Logical Maximum     │  │  Usage  │    │  Usage  │
-        └─────────────────────┘ └─────────────────────┘  └─────────┘    └─────────┘
-                   │                       │
-         ┌─────────┴─────────┐             │
-         ▼         ▼         ▼             ▼
-     ┌───────┐ ┌───────┐ ┌───────┐     ┌───────┐
-     │ Usage │ │ Usage │ │ Usage │     │ Usage │
-     └───────┘ └───────┘ └───────┘     └───────┘
-
-When a Main item is found, a new report structure is allocated and initialized
-with the current item state table. All Local items are then removed from the
-item state table, but Global items remain. In this way, Global items set the
-default value for subsequent new Main items. A device with several similar
-controls—for example, six axes—would need to define the Global items only
-once prior to the first Main item.
-
-Note: Main items are associated with a collection by the order in which they
-are declared. A new collection starts when the parser reaches a Collection
-item. The item parser associates with a collection all Main items defined
-between the Collection item and the next End Collection item.
-
-- When a Push item is encountered, the item state table is copied and placed on
-a stack for later retrieval.
-
-- When a Pop item is found, the item state table is replaced with the top table
-from the stack.
-
-
-There are three item types: Main, Global, and Local.
-
-There are five Main item tags currently defined:
-Input item tag:
-	Refers to the data from one or more similar controls on a device.
-	For example, variable data such as reading the position of a single axis
-	or a group of levers or array data such as one or more push buttons or switches.
-Output item tag:
-	Refers to the data to one or more similar controls on a device
-	such as setting the position of a single axis or a group of levers (variable data).
-	Or, it can represent data to one or more LEDs (array data).
-- Feature item tag:
-	Describes device input and output not intended for consumption by the end user.
-	For example, a software feature or Control Panel toggle.
-- Collection item tag:
-	A meaningful grouping of Input, Output, and Feature items.
-	For example, mouse, keyboard, joystick, and pointer.
-- End Collection item tag:
-	A terminating item used to specify the end of a collection of items.
-
-Main Items are the ones that actually declare real data fields (Input, Output, Feature) or structure the descriptor (Collection, End Collection).
-They consume the current global item state (Report Size, Report Count, Logical Min/Max, Usage Page, etc.) and generate the actual report fields at that moment.
-
-Complete list of all Main Items from the official USB HID 1.11/1.12 specification:
-----------------------------------------------------------------------------------------------------
-Tag (hex)	Item Name	Data Size		Meaning & Flags (bits 0–9)					Common Usage
-----------------------------------------------------------------------------------------------------
-0x80	Input		1, 2, or 4 bytes	Defines an input report field 				Mouse/buttons, keyboard keys, joystick axes, sensor values
-										Bit 0: Constant (0) vs Data (1)
-										Bit 1: Variable (0) vs Array (1)
-										Bit 2: Absolute (0) vs Relative (1)
-										Bit 3: No Wrap (0) vs Wrap (1)
-										Bit 4: Linear (0) vs Non-Linear (1)
-										Bit 5: Preferred State (0) vs No Preferred (1)
-										Bit 6: No Null Position (0) vs Null State (1)
-										Bit 7: Reserved (was Non-Volatile)
-										Bit 8: Bit Field (0) vs Buffered Bytes (1)
-										Bit 9–31: Reserved
-
-0x90	Output		1, 2, or 4 bytes	Defines an output report field (e.g. LEDs, rumble)
-										Same flag bits as Input						Keyboard LEDs, force-feedback, display backlight
-
-0xB0	Feature		1, 2, or 4 bytes	Bi-directional field, used for configuration
-										Same flag bits as Input/Output				DPI setting, battery level, calibration data, vendor config
-
-0xA0	Collection	1 byte				Begins a collection							Almost always 0x01 (Application) for top-level
-										0x00 Physical (group of axes)
-										0x01 Application (mouse, keyboard)
-										0x02 Logical (interrelated data)
-										0x03 Report
-										0x04 Named Array
-										0x05 Usage Switch
-										0x06 Usage Modifier
-										0x80–0xFF Vendor-defined
-
-0xC0	End Collection	0 bytes			Closes the most recent Collection			Mandatory pair with every Collection
-----------------------------------------------------------------------------------------------------
-
-Most Commonly Used Flag Combinations
------------------------------------------------------------
-Name						Hex		Binary flags	Meaning
-									(bits 0–8)
------------------------------------------------------------
-Data, Variable, Absolute	0x02	000000010		Normal controls (mouse X/Y, analog triggers)
-Data, Array, Absolute		0x00	000000000		Keyboard key arrays, button pages
-Constant, Variable, Abs		0x03	000000011		Padding bits
-Constant, Array, Abs		0x01	000000001		Padding bytes (reserved byte in keyboard report)
-Data, Variable, Relative	0x06	000001100		Mouse wheel, relative axes
-Data, Variable, Abs,
-NoWrap, Linear, NoNull		0x02 (most common)		Standard absolute axis
------------------------------------------------------------
-
-Global items affect the interpretation of all subsequent items in the report descriptor until a new global item of the same type overrides it.
-
-Complete list of all Global Items defined in the USB HID Device Class Definition (HID 1.11 and later), with their tags, data size, and meaning:
-------------------------------------------------------------------------------------------------------------------------------
-Tag (hex)	Item Name			Data Size	Description													Typical Values / Notes
-------------------------------------------------------------------------------------------------------------------------------
-0x04		Usage Page			1, 2, 4		Defines the usage page for subsequent Usage items			0x0001 (Generic Desktop), 0x0007 (Keyboard), 0x0009 (Button), 0xFF00 (Vendor-defined), etc.
-0x14		Logical Minimum		1, 2, 4		Minimum value for logical (signed) data						e.g., -127, 0, -1
-0x24		Logical Maximum		1, 2, 4		Maximum value for logical (signed) data						e.g., 127, 1, 255
-0x34		Physical Minimum	1, 2, 4		Minimum value for physical data (after applying scale/bias)	Rarely used
-0x44		Physical Maximum	1, 2, 4		Maximum value for physical data								Rarely used
-0x54		Unit Exponent		1			Signed exponent for units (base-10)							-8 to +7 (e.g., 0x0F = -1 → divide by 10)
-0x64		Unit				1, 2, 4		Defines the unit and system (SI, English, etc.)				e.g., 0x00000001 (None), 0xF0D12131 (degrees Celsius)
-0x74		Report Size			1, 2, 4		Size of each field in bits									1, 8, 16, 32 most common
-0x84		Report ID			1			Prefixes reports with an 8-bit ID (0 = no ID)				1–255; required if multiple report formats
-0x94		Report Count		1, 2, 4		Number of fields of Report Size that follow					e.g., 6 for 6 keys in a keyboard report
-0xA4		Push				0			Pushes current global state stack onto stack				Used for saving state
-0xB4		Pop					0			Restores global state from top of stack						Used after Push
-------------------------------------------------------------------------------------------------------------------------------
-
-Quick Reference Table (most commonly used)
----------------------------------------------------------------------
-Item				Tag		Typical Data Values		When to change it
----------------------------------------------------------------------
-Usage Page			4		0x01, 0x07, 0x08,		When switching between keyboard, mouse, consumer, vendor
-							0x09, 0x0C, 0xFF00
-Logical Minimum		14		0, -1, -127				For signed values or when 0 isn't the minimum
-Logical Maximum		24		1, 255, 32767			Almost always needed
-Report Size			74		1, 8, 16, 32			Every time field size changes
-Report Count		94		1, 3, 6, 8, etc.		Every time number of repeated fields changes
-Report ID			84		1–255					Only if you have multiple report formats
----------------------------------------------------------------------
-
-Local items apply only to the very next Main item (Input, Output, or Feature) that follows them.
-After that Main item is processed, all local items are cleared and reset to “undefined” again.
-
-Here is the complete list of all Local Items defined in the USB HID 1.11/1.12 specification:
--------------------------------------------------------------------------
-Tag (hex)	Item Name	Data Size		Meaning	Typical Values / Examples
--------------------------------------------------------------------------
-0x08	Usage				1, 2, 4		Identifies what the upcoming field actually is	0x30 (X), 0x31 (Y), 0x04 (Keyboard a/A), 0x07 (Battery Strength)
-0x18	Usage Minimum		1, 2, 4		Lowest Usage value in a range (used with arrays or delimited sets)	0xE0 (Left Control), 0x01 (Button 1)
-0x28	Usage Maximum		1, 2, 4		Highest Usage value in a range	0xE7 (Right GUI), 0x08 (Button 8)
-0x38	Designator Index	1, 2, 4		Physical identifier (which finger, which hand, etc.) – rarely used	0x01 (First finger)
-0x48	Designator Minimum	1, 2, 4		Start of designator range	—
-0x58	Designator Maximum	1, 2, 4		End of designator range	—
-0x68	String Index		1, 2, 4		Index into the string descriptor table (for human-readable names)	1 = first string, etc.
-0x78	String Minimum		1, 2, 4		Start of string index range	—
-0x88	String Maximum		1, 2, 4		End of string index range	—
-0x98	Delimiter			1			Used to create multiple logical collections with the same local items (rare)	0x01 = open set, 0x00 = close set
--------------------------------------------------------------------------
-
-How Local Items Are Consumed
-Local items → Main item → Local items are discarded
-
-Example:
-0x05, 0x01,        // Usage Page (Generic Desktop)          ← Global
-0x09, 0x30,        // Usage (X)                             ← Local
-0x09, 0x31,        // Usage (Y)                             ← Local  ← still active
-0x81, 0x02,        // Input (Data,Var,Abs)                  ← Main consumes both Usages → now local state empty again
-
-The Two Most Important Patterns:
-
-1. Variable fields (one Usage per field) – most common for axes, triggers, etc.
-0x09, 0x30,        // Usage (X)                ← Local
-0x09, 0x31,        // Usage (Y)                ← Local
-0x09, 0x32,        // Usage (Z)                ← Local
-0x95, 0x03,        // Report Count (3)         ← Global
-0x81, 0x02,        // Input (Data,Var,Abs)     ← Main → three separate fields: X, Y, Z
-
-2. Array fields (range of Usages) – used for keyboards, button pages, consumer keys
-0x19, 0x01,        // Usage Minimum (Button 1)          ← Local
-0x29, 0x0C,        // Usage Maximum (Button 12)         ← Local
-0x95, 0x0C,        // Report Count (12)                 ← Global
-0x75, 0x08,        // Report Size (8)                   ← Global
-0x81, 0x00,        // Input (Data,Array,Abs)            ← Main → 12-byte array of button indices
-
-Note:
-Collection and End Collection are Main items that do not declare report data, therefore they do not consume local items.
-
-The only thing that can give a meaning to a Collection is a Usage that appears immediately before the Collection (still a local item),
-but the parser treats it specially: it is moved from the local state table into the collection’s own state before the local table is cleared.
-
-0x09, 0x02,        // Usage (Mouse)                 ← Local Usage
-0xA1, 0x01,        // Collection (Application)      ← This Collection now "owns" the Usage "Mouse"
-*/
-
-// Extend 2's complement number sign
-#define SIGNEX(v, sb) ((v) | (((v) & (1 << (sb))) ? ~((1 << (sb))-1) : 0))
-
-// Custom values for storing HID item format
-enum hid_item_format
-{
-	HID_ITEM_FORMAT_SHORT,
-	HID_ITEM_FORMAT_LONG
-};
-
-typedef struct _HID_ITEM_INFO
-{
-	uint8_t format; // hid_item_format
-	uint8_t size;
-	uint8_t type; // hid_item_type: MAIN, GLOBAL, LOCAL
-	uint8_t tag; // hid_main_item_tag
-
-	union
-	{
-		uint8_t  u8;
-		int8_t   s8;
-		uint16_t u16;
-		int16_t  s16;
-		uint32_t u32;
-		int32_t  s32;
-
-		const uint8_t* longdata;
-	} value;
-
-} HID_ITEM;
-
-static uint16_t GetUnaligned16(const uint8_t* start)
-{
-#if LITTLE_ENDIAN
-	return *(uint16_t*)start;
-#else
-	uint16_t dat = (*start) | (*(start + 1) << 8);
-
-	return dat;
-#endif
-}
-
-static uint32_t GetUnaligned32(const uint8_t* start)
-{
-#if LITTLE_ENDIAN
-	return *(uint32_t*)start;
-#else
-	uint32_t dat = (uint32_t)(*start) | ((uint32_t)(*(start + 1)) << 8) | ((uint32_t)(*(start + 2)) << 16) | ((uint32_t)(*(start + 3)) << 24);
-
-	return dat;
-#endif
-}
-
-static uint32_t ItemUData(HID_ITEM* itemInfo)
-{
-	switch (itemInfo->size)
-	{
-	case 1:
-		return itemInfo->value.u8;
-	case 2:
-		return itemInfo->value.u16;
-	case 4:
-		return itemInfo->value.u32;
-	}
-
-	return 0;
-}
-
-static int32_t ItemSData(HID_ITEM* itemInfo)
-{
-	switch (itemInfo->size)
-	{
-	case 1:
-		return SIGNEX(itemInfo->value.s8, 7);
-	case 2:
-		return SIGNEX(itemInfo->value.s16, 15);
-	case 4:
-		return itemInfo->value.s32;
-	}
-
-	return 0;
-}
-
-/*
-  Parsing introduction:
-  https://docs.kernel.org/hid/hidintro.html
-  https://docs.kernel.org/hid/hidreport-parsing.html
-  https://www.usb.org/sites/default/files/documents/hid1_11.pdf
-*/
-// Returns pointer to next item
-const uint8_t* fetch_item(const uint8_t* start, const uint8_t* end, HID_ITEM* item)
-{
-/*
-Bits   23 22 21 20 19 18 17 16 15 14 13 12 11 10 9 8  7 6 5 4  3 2   1 0
-       ┌──────────────────────┐┌────────────────────┐┌───────┬─────┬─────┐
-Parts  │        [data]        ││       [data]       ││ bTag  │bType│bSize│
-       └──────────────────────┘└────────────────────┘└───────┴─────┴─────┘
-Bytes             2                       1                   0
-
-Item firs byte:
-	2 bits for the length of the item,
-	2 bits for the type of the item and
-	4 bits for the tag / function
-*/
-	if (end - start <= 0)
-		return nullptr;
-
-	const uint8_t first = *start++;
-
-	item->type = (first >> 2) & 0x03; // 2 bits for the type
-
-	item->tag = (first >> 4) & 0x0F; // 4 bits for function
-
-	if (item->tag == HID_ITEM_TAG_LONG) // Long items - HID 1.11 section 6.2.2.3
-	{
-		item->format = HID_ITEM_FORMAT_LONG;
-
-		if (end - start < 2)
-			return nullptr;
-
-		item->size = *start++;
-		item->tag = *start++;
-
-		if (end - start < item->size)
-			return nullptr;
-
-		item->value.longdata = start;
-		start += item->size;
-
-		return start;
-	}
-	else
-	{
-		item->format = HID_ITEM_FORMAT_SHORT; // Short Items - HID 1.11 section 6.2.2.2
-		item->size = first & 0x03; // 2 bits for size
-
-		switch (item->size)
-		{
-		case 0:
-			return start;
-
-		case 1:
-			if (end - start < 1)
-				return nullptr;
-
-			item->value.u8 = *start++;
-
-			return start;
-
-		case 2:
-			if (end - start < 2)
-				return nullptr;
-
-			item->value.u16 = GetUnaligned16(start);
-			start += 2;
-
-			return start;
-
-		case 3:
-			item->size++;
-
-			if (end - start < 4)
-				return nullptr;
-
-			item->value.u32 = GetUnaligned32(start);
-			start += 4;
-
-			return start;
-		}
-	}
-
-	return nullptr;
-}
-
-// defines a mapping between a HID segment and an output event
-typedef struct HID_SEG
-{
-	uint16_t startBit;
-
-	// Mouse or keyboard or Kempston joystick
-	uint8_t outputChannel;
-
-	// for keyboard, this is the HID scancode of the key associated with this control
-	// for mouse, this is one of the values of MAP_MOUSE_x
-	// for gamepad, this is target mapped value (target gamepad button / axis)
-	uint8_t outputControl;
-
-	// How this control gets interpreted - MAP_TYPE_x
-	uint8_t inputType;
-
-	// Param has different meanings depending on InputType
-	uint16_t inputParam;
-
-	// Assume HID item size does not exceed 16 bit for X/Y axes to save embedded memory and CPU cycles.
-	// However, by specification it can be 32 bit.
-	int16_t logicalMinimum;
-	uint16_t logicalMaximum;
-
-	uint8_t reportSize; // Item size in bits
-
-	uint8_t reportCount; // Used for bitfields / arrays
-
-	uint32_t value; // User value used in mapping function
-
-	struct HID_SEG* next;
-} HID_SEG;
-
-#define KEYBOARD_STATE_SIZE 256/8 // bit map for currently pressed keys (0-256)
-
-typedef struct keyboard_state
-{
-	uint8_t keys[KEYBOARD_STATE_SIZE];
-	uint8_t old_keys[KEYBOARD_STATE_SIZE];
-} keyboard_state;
-
-typedef struct _HID_REPORT
-{
-	uint8_t reportID;
-
-	uint16_t appUsage; // generic_page_input_usage
-	uint16_t appUsagePage; // hid_usage_pages
-	uint16_t length; // in bits
-
-	keyboard_state keyboard;
-
-	HID_SEG* segments;
-
-	struct _HID_REPORT* next;
-} HID_REPORT;
-
-bool g_interface_uses_reports = false;
-HID_REPORT* g_reports = nullptr;
-
-typedef struct _HID_GLOBAL
-{
-	uint16_t usagePage; // Up to 4 bytes by spec
-	int32_t logicalMinimum;
-	uint32_t logicalMaximum;
-	int16_t physicalMinimum; // Up to 4 bytes by spec. Ignored.
-	uint16_t physicalMaximum;
-	uint8_t reportID;
-	uint8_t reportSize; // Current item size in bits
-	uint8_t reportCount; // Current item reports count
-} HID_GLOBAL;
-
-typedef struct _HID_LOCAL
-{
-	uint32_t usage;
-	uint32_t usageMin;
-	uint32_t usageMax;
-} HID_LOCAL;
-
-// There is no fixed limit in the HID specification.
-// Most parsers limit to 255 usages per MAIN item.
-// In practice do not exceed 10.
-#define MAX_USAGE_NUM 16
-
-typedef struct ParseState
-{
-	HID_GLOBAL hidGlobal;
-	HID_LOCAL hidLocal;
-	uint16_t startBit;
-	uint16_t appUsage; // Stored LOCAL Usage for Collection (Application) (generic_page_input_usage)
-	uint16_t appUsagePage; // Stored GLOBAL Usage Page for Collection (Application) (hid_usage_pages)
-	uint8_t joyNum;
-	uint8_t usages[MAX_USAGE_NUM];
-	uint8_t usagesCount;
-} ParseState;
-
-ParseState g_HIDParseState = {};
-
-void hid_parser_reset_state()
-{
-	arena_reset();
-
-	g_interface_uses_reports = false;
-	g_reports = nullptr;
-	g_HIDParseState = {};
-}
-
-HID_SEG* CreateSeg(HID_REPORT* rep, const uint16_t startbit)
-{
-	HID_SEG* segment = new(arena_alloc(sizeof(HID_SEG))) HID_SEG{};
-
-	segment->next = rep->segments;
-	rep->segments = segment;
-
-	segment->startBit = startbit;
-	segment->reportCount = g_HIDParseState.hidGlobal.reportCount;
-	segment->reportSize = g_HIDParseState.hidGlobal.reportSize;
-
-	if (segment->reportSize > 16)
-	{
-		printf("\nWarning: CreateSeg: 32-bit HID value");
-	}
-
-	segment->logicalMinimum = (int16_t)g_HIDParseState.hidGlobal.logicalMinimum; // reduce range from 32 to 16 bit
-	segment->logicalMaximum = (uint16_t)g_HIDParseState.hidGlobal.logicalMaximum;
-
-	return segment;
-}
-
-//search though preset to see if this matches a mapping
-void CreateMapping(HID_REPORT* rep, const JoyPreset* preset, const uint16_t startbit)
-{
-	// Empty structure used as end of JoyPreset array.
-	// Can be used with more safe array indexing, with end marker deleted.
-	while (preset->inputType != MAP_TYPE_NONE)
-	{
-		if (preset->inputUsagePage == g_HIDParseState.hidGlobal.usagePage &&
-			preset->inputUsage == g_HIDParseState.hidLocal.usage &&
-			preset->number == g_HIDParseState.joyNum)
-		{
-			HID_SEG* segment = CreateSeg(rep, startbit);
-			segment->outputChannel = preset->outputChannel;
-			segment->outputControl = preset->outputControl;
-			segment->inputType = preset->inputType;
-			segment->inputParam = preset->inputParam;
-		}
-
-		preset++;
-	}
-}
-
-void CreateBitfieldMapping(HID_REPORT* rep, const JoyPreset* preset)
-{
-	uint16_t startbit = g_HIDParseState.startBit;
-
-	if (g_HIDParseState.appUsagePage == REPORT_USAGE_PAGE_GENERIC_DESKTOP)
-	{
-		if (g_HIDParseState.appUsage == REPORT_USAGE_KEYBOARD)
-		{
-			if (g_HIDParseState.hidGlobal.usagePage == REPORT_USAGE_PAGE_KEYBOARD)
-			{
-				HID_SEG* segment = CreateSeg(rep, startbit);
-				// Keyboard - 1 bit per key (usually for modifier field)
-				segment->outputChannel = MAP_KEYBOARD;
-				segment->outputControl = g_HIDParseState.hidLocal.usageMin;
-				segment->inputType = MAP_TYPE_BITFIELD;
-			}
-		}
-		else if (g_HIDParseState.appUsage == REPORT_USAGE_MOUSE)
-		{
-			if (g_HIDParseState.hidGlobal.usagePage == REPORT_USAGE_PAGE_BUTTON)
-			{
-				HID_SEG* segment = CreateSeg(rep, startbit);
-				// Mouse - 1 bit per button
-				segment->outputChannel = MAP_MOUSE;
-				segment->outputControl = g_HIDParseState.hidLocal.usageMin;
-				segment->inputType = MAP_TYPE_BITFIELD;
-			}
-		}
-		else if (g_HIDParseState.appUsage == REPORT_USAGE_JOYSTICK || g_HIDParseState.appUsage == REPORT_USAGE_GAMEPAD)
-		{
-			for (uint8_t i = g_HIDParseState.hidLocal.usageMin; i < g_HIDParseState.hidLocal.usageMax; i++)
-			{
-				g_HIDParseState.hidLocal.usage = i; // used as global variable for parameter passing
-				CreateMapping(rep, preset, startbit);
-
-				startbit += g_HIDParseState.hidGlobal.reportSize;
-			}
-		}
-	}
-}
-
-void CreateUsageMapping(HID_REPORT* rep, const JoyPreset* preset)
-{
-	uint16_t startbit = g_HIDParseState.startBit;
-
-	// need to make a seg for each found usage
-	for (uint8_t i = 0; i < g_HIDParseState.usagesCount; i++)
-	{
-		if (g_HIDParseState.appUsagePage == REPORT_USAGE_PAGE_GENERIC_DESKTOP)
-		{
-			if (g_HIDParseState.appUsage == REPORT_USAGE_MOUSE)
-			{
-				HID_SEG* segment = CreateSeg(rep, startbit);
-
-				startbit += g_HIDParseState.hidGlobal.reportSize;
-
-				if (g_HIDParseState.hidGlobal.usagePage == REPORT_USAGE_PAGE_GENERIC_DESKTOP)
-				{
-					segment->outputChannel = MAP_MOUSE;
-					switch (g_HIDParseState.usages[i])
-					{
-					case REPORT_USAGE_X:
-						// Mouse - value field
-						segment->outputControl = MAP_MOUSE_X;
-						segment->inputType = MAP_TYPE_SCALE;
-						break;
-
-					case REPORT_USAGE_Y:
-						// Mouse - value field
-						segment->outputControl = MAP_MOUSE_Y;
-						segment->inputType = MAP_TYPE_SCALE;
-						break;
-
-					case REPORT_USAGE_WHEEL:
-						// Mouse - value field
-						segment->outputControl = MAP_MOUSE_WHEEL;
-						segment->inputType = MAP_TYPE_SCALE;
-						break;
-					}
-				}
-			}
-			else if (g_HIDParseState.appUsage == REPORT_USAGE_JOYSTICK || g_HIDParseState.appUsage == REPORT_USAGE_GAMEPAD)
-			{
-				g_HIDParseState.hidLocal.usage = g_HIDParseState.usages[i]; // used as global variable for parameter passing
-				CreateMapping(rep, preset, startbit);
-
-				startbit += g_HIDParseState.hidGlobal.reportSize;
-			}
-		}
-	}
-}
-
-void CreateArrayMapping(HID_REPORT* rep)
-{
-	uint16_t startbit = g_HIDParseState.startBit;
-
-	if (g_HIDParseState.appUsagePage == REPORT_USAGE_PAGE_GENERIC_DESKTOP &&
-		g_HIDParseState.appUsage == REPORT_USAGE_KEYBOARD &&
-		g_HIDParseState.hidGlobal.usagePage == REPORT_USAGE_PAGE_KEYBOARD)
-	{
-		// need to make a seg for each report array item
-		for (uint8_t i = 0; i < g_HIDParseState.hidGlobal.reportCount; i++)
-		{
-			HID_SEG* segment = CreateSeg(rep, startbit);
-			segment->outputChannel = MAP_KEYBOARD;
-			segment->inputType = MAP_TYPE_ARRAY;
-
-			startbit += g_HIDParseState.hidGlobal.reportSize;
-		}
-	}
-}
-
-void DumpHID(HID_REPORT* report)
-{
-	while (report)
-	{
-		HID_SEG* seg = report->segments;
-
-		printf("Report: usage %x, length %u: \n",  report->appUsage, report->length);
-
-		while (seg)
-		{
-			printf("startBit %u, inputType %hx, inputParam %x, outputChannel %hx, outputControl %hx, size %hx, count %hx\n",
-				seg->startBit, seg->inputType, seg->inputParam, 
-				seg->outputChannel, seg->outputControl,
-				seg->reportSize, seg->reportCount);
-
-			seg = seg->next;
-		}
-
-		report = report->next;
-	}
-}
-
-bool ParseReportDescriptor(const uint8_t* descriptor, const uint16_t len, const JoyPreset* preset)
-{
-	hid_parser_reset_state();
-
-	HID_GLOBAL* hidGlobal = &g_HIDParseState.hidGlobal;
-	HID_LOCAL* hidLocal = &g_HIDParseState.hidLocal;
-
-	hidLocal->usageMax = 0xFFFF;
-	hidLocal->usageMin = 0xFFFF;
-
-	HID_ITEM item;
-
-	HID_REPORT* currHidReport = nullptr;
-
-	uint8_t collectionDepth = 0;
-
-	const uint8_t* start = descriptor;
-	const uint8_t* end = start + len;
-
-	while ((start = fetch_item(start, end, &item)))
-	{
-		if (item.format != HID_ITEM_FORMAT_SHORT)
-		{
-			return false; // Long HID items not supported.
-		}
-
-		switch (item.type)
-		{
-		case HID_TYPE_MAIN:
-			if (item.tag == HID_MAIN_ITEM_TAG_INPUT)
-			{
-				if (
-					g_HIDParseState.appUsagePage == REPORT_USAGE_PAGE_GENERIC_DESKTOP &&
-						(
-						g_HIDParseState.appUsage == REPORT_USAGE_JOYSTICK ||
-						g_HIDParseState.appUsage == REPORT_USAGE_GAMEPAD ||
-						g_HIDParseState.appUsage == REPORT_USAGE_KEYBOARD ||
-						g_HIDParseState.appUsage == REPORT_USAGE_MOUSE
-						)
-					)
-				{
-					if (currHidReport == nullptr)
-					{
-						// Start new report within descriptor
-						currHidReport = new(arena_alloc(sizeof(HID_REPORT))) HID_REPORT{};
-						currHidReport->reportID = hidGlobal->reportID;
-
-						currHidReport->next = g_reports; // Add new report to list head. Note: For report parsing lookup better to add to list tail.
-						g_reports = currHidReport;
-
-						currHidReport->appUsagePage = g_HIDParseState.appUsagePage;
-						currHidReport->appUsage = g_HIDParseState.appUsage;
-
-						if ((g_HIDParseState.appUsage == REPORT_USAGE_JOYSTICK || g_HIDParseState.appUsage == REPORT_USAGE_GAMEPAD))
-							g_HIDParseState.joyNum++;
-					}
-
-					if (ItemUData(&item) & HID_INPUT_VARIABLE)
-					{
-						// we found some discrete usages, get to it
-						if (g_HIDParseState.usagesCount)
-						{
-							CreateUsageMapping(currHidReport, preset);
-						}
-						// if no usages found, maybe a bitfield
-						else if (hidLocal->usageMin != 0xFFFF && hidLocal->usageMax != 0xFFFF &&
-							hidGlobal->reportSize == 1)
-						{
-							CreateBitfieldMapping(currHidReport, preset);
-						}
-						else
-						{
-							// Input Variable MAIN item with no usages / usage min/max declared.
-						}
-					}
-					else // Item is array style, whole range appears in every segment
-					{
-						CreateArrayMapping(currHidReport);
-					}
-				}
-
-				g_HIDParseState.startBit += (uint16_t)hidGlobal->reportSize * (uint16_t)hidGlobal->reportCount;
-
-				if (currHidReport)
-					currHidReport->length = g_HIDParseState.startBit;
-			}
-			else if (item.tag == HID_MAIN_ITEM_TAG_COLLECTION_START)
-			{
-				collectionDepth++;
-
-				if (ItemUData(&item) == HID_COLLECTION_APPLICATION_)
-				{
-					// Make a note of this application collection's usage/page
-					// (so we know what sort of device this is)
-					g_HIDParseState.appUsage = hidLocal->usage;
-
-					g_HIDParseState.appUsagePage = hidGlobal->usagePage;
-				}
-			}
-			else if (item.tag == HID_MAIN_ITEM_TAG_COLLECTION_END)
-			{
-				collectionDepth--;
-
-				// Only advance app if we're at the root level
-				if (collectionDepth == 0)
-				{
-					g_HIDParseState.appUsage = 0x00;
-					g_HIDParseState.appUsagePage = 0x00;
-				}
-			}
-
-			// Output and Feature MAIN items are ignored.
-
-			g_HIDParseState.usagesCount = 0; // reset parser state / LOCAL Usage list after MAIN Input item 
-			// Local items → Main item → Local items are discarded
-			hidLocal->usage = 0x00;
-			hidLocal->usageMax = 0xFFFF;
-			hidLocal->usageMin = 0xFFFF;
-			break;
-
-		case HID_TYPE_GLOBAL:
-			switch (item.tag)
-			{
-			case HID_GLOBAL_ITEM_TAG_REPORT_ID:
-				g_interface_uses_reports = true;
-				// report id
-				g_HIDParseState.startBit = 0;
-				g_HIDParseState.startBit += item.size * 8; // Report starts with report ID
-
-				hidGlobal->reportID = ItemUData(&item);
-				currHidReport = nullptr; // start new report
-				break;
-
-			case HID_GLOBAL_ITEM_TAG_LOGICAL_MINIMUM:
-				hidGlobal->logicalMinimum = ItemSData(&item);
-				break;
-
-			case HID_GLOBAL_ITEM_TAG_LOGICAL_MAXIMUM:
-				if (hidGlobal->logicalMinimum < 0)
-					hidGlobal->logicalMaximum = ItemSData(&item);
-				else
-					hidGlobal->logicalMaximum = ItemUData(&item);
-				break;
-
-			case HID_GLOBAL_ITEM_TAG_PHYSICAL_MINIMUM:
-				hidGlobal->physicalMinimum = ItemSData(&item);
-				break;
-
-			case HID_GLOBAL_ITEM_TAG_PHYSICAL_MAXIMUM:
-				if (hidGlobal->physicalMinimum < 0)
-					hidGlobal->physicalMaximum = ItemSData(&item);
-				else
-					hidGlobal->physicalMaximum = ItemUData(&item);
-				break;
-
-			case HID_GLOBAL_ITEM_TAG_REPORT_SIZE:
-				hidGlobal->reportSize = ItemUData(&item);
-				break;
-
-			case HID_GLOBAL_ITEM_TAG_REPORT_COUNT:
-				hidGlobal->reportCount = ItemUData(&item);
-				break;
-
-			case HID_GLOBAL_ITEM_TAG_USAGE_PAGE:
-				hidGlobal->usagePage = ItemUData(&item);
-				break;
-
-			default:
-				break;
-			}
-
-			break;
-
-		case HID_TYPE_LOCAL:
-			if (item.tag == HID_LOCAL_ITEM_TAG_USAGE)
-			{
-				hidLocal->usage = ItemUData(&item);
-
-				if (g_HIDParseState.usagesCount < MAX_USAGE_NUM)
-				{
-					g_HIDParseState.usages[g_HIDParseState.usagesCount] = ItemUData(&item);
-					g_HIDParseState.usagesCount++;
-				}
-			}
-			else if (item.tag == HID_LOCAL_ITEM_TAG_USAGE_MIN)
-				hidLocal->usageMin = ItemUData(&item);
-			else if (item.tag == HID_LOCAL_ITEM_TAG_USAGE_MAX)
-				hidLocal->usageMax = ItemUData(&item);
-
-			break;
-		}
-
-		if (start == end)
-		{
-			 return true;
-		}
-	}
-
-	return false;
-}
-
-uint32_t convert_range(const uint32_t value, const int16_t minimum, const uint16_t maximum, const preset_value_type target_type)
-{
-	preset_value_type source_type = VALUE_TYPE_CUSTOM;
-
-	if ((minimum == 0) && (maximum == UINT8_MAX))
-		source_type = VALUE_TYPE_UINT8;
-	else if ((minimum == INT8_MIN) && (maximum == INT8_MAX))
-		source_type = VALUE_TYPE_INT8;
-	else if ((minimum == 0) && (maximum == UINT16_MAX))
-		source_type = VALUE_TYPE_UINT16;
-	if ((minimum == INT16_MIN) && (maximum == INT16_MAX))
-		source_type = VALUE_TYPE_INT16;
-
-	// uint16 -> uint16
-	// int16 -> int16
-	// uint8 -> uint8
-	// int8 -> int8
-	if (source_type == target_type)
-		return value;
-
-	if (source_type == VALUE_TYPE_INT8)
-	{
-		if (target_type == VALUE_TYPE_UINT8) // int8 -> uint8
-			return ((int32_t)value) + 128;
-		else if (target_type == VALUE_TYPE_UINT16) // int8 -> uint16
-			return ((int32_t)value + 128) << 8;
-		else if (target_type == VALUE_TYPE_INT16) // int8 -> int16
-			return ((int32_t)value) << 8;
-	}
-	else if (source_type == VALUE_TYPE_UINT8)
-	{
-		if (target_type == VALUE_TYPE_INT8) // uint8 -> int8
-			return ((int32_t)value) - 0x80;
-		else if (target_type == VALUE_TYPE_UINT16) // uint8 -> uint16
-			return value << 8;
-		else if (target_type == VALUE_TYPE_INT16) // uint8 -> int16
-			return ((int32_t)(value << 8)) - 0x8000;
-	}
-	else if (source_type == VALUE_TYPE_INT16)
-	{
-		if (target_type == VALUE_TYPE_UINT8) // int16 -> uint8
-			return ((int32_t)value + 0x8000) >> 8;
-		if (target_type == VALUE_TYPE_INT8) // int16 -> int8
-			return ((int32_t)value) >> 8;
-		else if (target_type == VALUE_TYPE_UINT16) // int16 -> uint16
-			return ((int32_t)value) + 0x8000;
-	}
-	else if (source_type == VALUE_TYPE_UINT16)
-	{
-		if (target_type == VALUE_TYPE_UINT8)// uint16 -> uint8
-			return value >> 8;
-		else if (target_type == VALUE_TYPE_INT8) // uint16 -> int8
-			return ((int32_t)(value >> 8)) - 0x80;
-		else if (target_type == VALUE_TYPE_INT16)// uint16 -> int16
-			return ((int32_t)value) - 0x8000;
-	}
-
-	// uint32_t and int32_t input types not implemented.
-	// Custom input ranges not implemented.
-	assert(false);
-
-	return 0;
-}
-
-#define SetKey(key, report) (report->keyboard.keys[key >> 3] |= 1 << (key & 0x07))
-
-typedef struct Mouse
-{
-	int16_t dx, dy, dz;
-	uint8_t buttons;
-	bool changed;
-} Mouse;
-
-static Mouse g_mouse;
-
-void MouseSet(uint8_t button, bool state)
-{
-	if (state)
-		g_mouse.buttons |= 1 << button;
-	else
-		g_mouse.buttons &= ~(1 << button);
-
-	g_mouse.changed = true;
-}
-
-void MouseMove(int32_t dx, int32_t dy, int32_t dz)
-{
-	g_mouse.dx += dx;
-	g_mouse.dy += dy;
-	g_mouse.dz += dz;
-
-	g_mouse.changed = true;
-}
-
-void processSeg(HID_SEG* segment, HID_REPORT* report, const uint8_t* data, gamepad_callback_t gamepad_callback)
-{
-	if (segment->inputType == MAP_TYPE_BITFIELD)
-	{
-		const uint16_t endbit = segment->startBit + segment->reportCount;
-		uint8_t key_index = segment->outputControl;
-
-		for (uint16_t cnt = segment->startBit; cnt < endbit; cnt++)
-		{
-			bool pressed = false;
-
-			// find byte
-			const uint8_t* currByte = data + ((cnt) >> 3);
-
-			// find bit
-			if (*currByte & (0x01 << (cnt & 0x07)))
-				pressed = true;
-
-			if (segment->outputChannel == MAP_KEYBOARD)
-			{
-				if (pressed)
-					SetKey(key_index, report);
-			}
-			else if (segment->outputChannel == MAP_MOUSE)
-			{
-				switch (key_index)
-				{
-				case MAP_MOUSE_BUTTON1:
-					MouseSet(0, pressed);
-					break;
-				case MAP_MOUSE_BUTTON2:
-					MouseSet(1, pressed);
-					break;
-				case MAP_MOUSE_BUTTON3:
-					MouseSet(2, pressed);
-					break;
-				case MAP_MOUSE_BUTTON4:
-					MouseSet(3, pressed);
-					break;
-				case MAP_MOUSE_BUTTON5:
-					MouseSet(4, pressed);
-					break;
-				}
-			}
-
-			key_index++;
-		}
-	}
-	else if (segment->inputType) // i.e. not MAP_TYPE_NONE
-	{
-		uint32_t value = 0;
-
-		// bits may be across any byte alignment
-		// so do the neccesary shifting to get it to all fit in a uint32_t
-		uint16_t currentBit = segment->startBit;
-
-		for (uint8_t i = 0; i < segment->reportSize; i++)
-		{
-			// Calculate byte position and bit offset within the byte
-			const uint8_t shiftbits = currentBit % 8;
-			const uint8_t startbyte = currentBit / 8;
-
-			// Extract the bit
-			const uint8_t bit = (data[startbyte] >> shiftbits) & 0x01;
-
-			// Add the bit to the result
-			value |= (uint32_t)bit << i;
-
-			currentBit++;
-		}
-
-		const bool sign = segment->logicalMinimum < 0;
-		// if it's a signed integer we need to extend the sign
-		if (sign)
-			value = SIGNEX(value, segment->reportSize - 1);
-
-		bool triggered = false;
-
-		// Received HID value should be re-interpreted depending on Logical Minimum / Logical Maximum and Report Size in USB HID report descriptor.
-		// Example:
-		// Minimum 0xFF (-1), Maximum 0x01 (1), Report Size 0x08: value is signed int8_t in -1..1 range.
-		// Minimum 0x81 (-127), Maximum 0x7F (127), Report Size 0x08: value is signed int8_t in -127..127 range.
-		// Minimum 0x00 (0), Maximum 0xFF (255), Report Size 0x08: value is signed uint8_t in 0..255 range.
-
-		// Note: Logical Minimum/Maximum can describe 16/32-bit ranges but require extended encoding
-		// (0x81 for 16-bit, 0x82 for 32-bit), can be checked with Report Size.
-
-		// Note: InputParam field in JoyPreset user presets is written assuming REPORT_USAGE_X / Y / Z / Rz
-		// are unsigned 8-bit values in 0..255 range.
-		// In practice they can be signed in -1..1 range for example, or 0..12000 / 0..65535 / -32768..32767 range with 16-bit ReportSize, or even 32-bit.
-
-		// Map received value to 0..255 range depending on Logical Minimum / Logical Maximum.
-		// ToDo: only map values with currSeg->InputUsage == REPORT_USAGE_X/Y
-		if (segment->inputType == MAP_TYPE_THRESHOLD_ABOVE)
-		{
-			if (sign)
-			{
-				const uint8_t mapped_value = map_to_uint8((int32_t)value, segment->logicalMinimum, segment->logicalMaximum);
-
-				triggered = (mapped_value > segment->inputParam);
-			}
-			else
-			{
-				const uint8_t mapped_value = map_to_uint8(value, segment->logicalMinimum, segment->logicalMaximum);
-
-				triggered = (mapped_value > segment->inputParam);
-			}
-		}
-		else if (segment->inputType == MAP_TYPE_THRESHOLD_BELOW)
-		{
-
-			if (sign)
-			{
-				const uint8_t mapped_value = map_to_uint8((int32_t)value, segment->logicalMinimum, segment->logicalMaximum);
-
-				triggered = (mapped_value < segment->inputParam);
-			}
-			else
-			{
-				const uint8_t mapped_value = map_to_uint8(value, segment->logicalMinimum, segment->logicalMaximum);
-
-				triggered = (mapped_value < segment->inputParam);
-			}
-		}
-		else if (segment->inputType == MAP_TYPE_EQUAL)
-		{
-			triggered = (value == segment->inputParam);
-		}
-
-		if (triggered)
-		{
-			if (segment->outputChannel == MAP_KEYBOARD)
-			{
-				SetKey(segment->outputControl, report);
-			}
-
-			if (segment->outputChannel == MAP_GAMEPAD)
-			{
-				if(gamepad_callback)
-					gamepad_callback(segment->outputControl, 1);
-			}
-		}
-		else if (segment->inputType == MAP_TYPE_AXIS)
-		{
-			if (segment->outputChannel == MAP_GAMEPAD)
-			{
-				const uint8_t axis_value = convert_range(value, segment->logicalMinimum, segment->logicalMaximum, (preset_value_type)segment->inputParam);
-
-				if(gamepad_callback)
-					gamepad_callback(segment->outputControl, axis_value);
-			}
-		}
-		else if (segment->inputType == MAP_TYPE_SCALE)
-		{
-			if (segment->outputChannel == MAP_MOUSE)
-			{
-				switch (segment->outputControl)
-				{
-				case MAP_MOUSE_X:
-					MouseMove((int32_t)value, 0, 0);
-					break;
-				case MAP_MOUSE_Y:
-					MouseMove(0, (int32_t)value, 0);
-					break;
-				case MAP_MOUSE_WHEEL:
-					MouseMove(0, 0, (int32_t)value);
-					break;
-				}
-			}
-		}
-		else if (segment->inputType == MAP_TYPE_ARRAY)
-		{
-			if (segment->outputChannel == MAP_KEYBOARD)
-			{
-				if (value)
-					SetKey((uint8_t)value, report);
-			}
-		}
-	}
-}
-
-HID_REPORT* find_report_parser(HID_REPORT* head, uint8_t reportID)
-{
-	while (head)
-	{
-		if (head->reportID == reportID)
-			return head;
-
-		head = head->next;
-	}
-
-	return nullptr;
-}
-
-bool ParseReport(const uint8_t* report, const uint32_t len,
-	gamepad_callback_t gamepad_callback, keyboard_callback_t keyboard_callback, mouse_callback_t mouse_callback)
-{
-	HID_REPORT* reportDesc = nullptr;
-
-	if (g_interface_uses_reports)
-	{
-		// first byte of report will be the report number
-		reportDesc = find_report_parser(g_reports, report[0]);
-	}
-	else
-	{
-		reportDesc = g_reports;
-	}
-
-	if (reportDesc == nullptr)
-	{
-		printf("Invalid report\n");
-		return false;
-	}
-
-	if (len < (reportDesc->length >> 3))
-	{
-		printf("Report too short - %lu bytes < %u bits\n", len, reportDesc->length);
-		return false;
-	}
-
-	HID_SEG* segment = reportDesc->segments;
-
-	while (segment)
-	{
-		processSeg(segment, reportDesc, report, gamepad_callback);
-		segment = segment->next;
-	}
-
-	if (keyboard_callback)
-	{
-		keyboard_state* keyboard = &reportDesc->keyboard;
-
-		for (uint8_t byte = 0; byte < KEYBOARD_STATE_SIZE; byte++)
-		{
-			// XOR to see if any bits are different
-			const uint8_t xorred = keyboard->keys[byte] ^ keyboard->old_keys[byte];
-
-			if (xorred)
-			{
-				for (uint8_t bit = 0; bit < 8; bit++)
-				{
-					if (xorred & (1 << bit))
-					{
-						const uint8_t hid_code = (byte << 3) | bit;
-						const bool pressed = keyboard->keys[byte] & (1 << bit);
-
-						keyboard_callback(hid_code, pressed);
-					}
-				}
-			}
-		}
-
-		memcpy(keyboard->old_keys, keyboard->keys, KEYBOARD_STATE_SIZE);
-		memset(keyboard->keys, 0, KEYBOARD_STATE_SIZE);
-	}
-
-	if (mouse_callback)
-	{
-		if (g_mouse.changed)
-		{
-			mouse_callback(g_mouse.dx, g_mouse.dy, g_mouse.dz, g_mouse.buttons);
-
-			g_mouse = {};
-		}
-	}
-
-	return true;
-}
+﻿#include <new>
+#include <cassert>
+#include <cstring>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "hid_parser.h"
+
+#include "arena_allocator.h"
+#include "hid_dumps.h"
+#include "trace.h"
+#include "hot_path.h"
+#include "hid_interp.h"
+
+#define LITTLE_ENDIAN 0 // RP2040 is little endian / Intel x86 is big endian
+
+/*
+Reference:
+USB Device Class Definition for Human Interface Devices (HID)
+Version 1.11
+https://www.usb.org/sites/default/files/documents/hid1_11.pdf
+
+5.3 Generic Item Format
+An item is piece of information about the device. All items have a one-byte prefix
+that contains the item tag, item type, and item size.
+
+Bits   23 22 21 20 19 18 17 16 15 14 13 12 11 10 9 8  7 6 5 4  3 2   1 0
+       ┌──────────────────────┐┌────────────────────┐┌───────┬─────┬─────┐
+Parts  │        [data]        ││       [data]       ││ bTag  │bType│bSize│
+       └──────────────────────┘└────────────────────┘└───────┴─────┴─────┘
+Bytes             2                       1                   0
+
+There are two basic types of items: short　items and long items.
+If the item is a short item, its optional data size may be 0, 1,　2, or 4 bytes.
+
+5.4 Item Parser
+From the parser’s point of view, a HID class device looks like the following　figure:
+
+                                    ┌────────────────────┐
+                                    │    Application     │
+                                    │    Collection      │
+                                    └────────────────────┘
+                                              │
+                             ┌────────────────┴──────────────────────┐
+                             ▼                                       ▼
+                    ┌────────────────┐                       ┌────────────────┐
+                    │   Collection   │                       │     Report     │
+                    └────────────────┘                       └────────────────┘
+                             │                                       │
+                   ┌─────────┴──────────┐                            │
+                   ▼                    ▼                            ▼
+           ┌──────────────┐    ┌──────────────┐          ┌────────────────────────┐
+           │    Report    │    │    Report    │          │ Main Item              │
+           └──────────────┘    └──────────────┘          │ Report Size            │
+                   │                    │                │ Report Count           │
+                   ▼                    ▼                └────────────────────────┘
+        ┌─────────────────────┐ ┌─────────────────────┐              │
+        │ Main Item           │ │ Main Item           │       ┌──────┴───────┐
+        │ Report Size         │ │ Report Size         │       │              │
+        │ Report Count        │ │ Report Count        │       ▼              ▼
+        │ Logical Minimum     │ │ Logical Minimum     │  ┌─────────┐    ┌─────────┐
+        │ Logical Maximum     │ │ Logical Maximum     │  │  Usage  │    │  Usage  │
+        └─────────────────────┘ └─────────────────────┘  └─────────┘    └─────────┘
+                   │                       │
+         ┌─────────┴─────────┐             │
+         ▼         ▼         ▼             ▼
+     ┌───────┐ ┌───────┐ ┌───────┐     ┌───────┐
+     │ Usage │ │ Usage │ │ Usage │     │ Usage │
+     └───────┘ └───────┘ └───────┘     └───────┘
+
+When a Main item is found, a new report structure is allocated and initialized
+with the current item state table. All Local items are then removed from the
+item state table, but Global items remain. In this way, Global items set the
+default value for subsequent new Main items. A device with several similar
+controls—for example, six axes—would need to define the Global items only
+once prior to the first Main item.
+
+Note: Main items are associated with a collection by the order in which they
+are declared. A new collection starts when the parser reaches a Collection
+item. The item parser associates with a collection all Main items defined
+between the Collection item and the next End Collection item.
+
+- When a Push item is encountered, the item state table is copied and placed on
+a stack for later retrieval.
+
+- When a Pop item is found, the item state table is replaced with the top table
+from the stack.
+
+
+There are three item types: Main, Global, and Local.
+
+There are five Main item tags currently defined:
+Input item tag:
+	Refers to the data from one or more similar controls on a device.
+	For example, variable data such as reading the position of a single axis
+	or a group of levers or array data such as one or more push buttons or switches.
+Output item tag:
+	Refers to the data to one or more similar controls on a device
+	such as setting the position of a single axis or a group of levers (variable data).
+	Or, it can represent data to one or more LEDs (array data).
+- Feature item tag:
+	Describes device input and output not intended for consumption by the end user.
+	For example, a software feature or Control Panel toggle.
+- Collection item tag:
+	A meaningful grouping of Input, Output, and Feature items.
+	For example, mouse, keyboard, joystick, and pointer.
+- End Collection item tag:
+	A terminating item used to specify the end of a collection of items.
+
+Main Items are the ones that actually declare real data fields (Input, Output, Feature) or structure the descriptor (Collection, End Collection).
+They consume the current global item state (Report Size, Report Count, Logical Min/Max, Usage Page, etc.) and generate the actual report fields at that moment.
+
+Complete list of all Main Items from the official USB HID 1.11/1.12 specification:
+----------------------------------------------------------------------------------------------------
+Tag (hex)	Item Name	Data Size		Meaning & Flags (bits 0–9)					Common Usage
+----------------------------------------------------------------------------------------------------
+0x80	Input		1, 2, or 4 bytes	Defines an input report field 				Mouse/buttons, keyboard keys, joystick axes, sensor values
+										Bit 0: Constant (0) vs Data (1)
+										Bit 1: Variable (0) vs Array (1)
+										Bit 2: Absolute (0) vs Relative (1)
+										Bit 3: No Wrap (0) vs Wrap (1)
+										Bit 4: Linear (0) vs Non-Linear (1)
+										Bit 5: Preferred State (0) vs No Preferred (1)
+										Bit 6: No Null Position (0) vs Null State (1)
+										Bit 7: Reserved (was Non-Volatile)
+										Bit 8: Bit Field (0) vs Buffered Bytes (1)
+										Bit 9–31: Reserved
+
+0x90	Output		1, 2, or 4 bytes	Defines an output report field (e.g. LEDs, rumble)
+										Same flag bits as Input						Keyboard LEDs, force-feedback, display backlight
+
+0xB0	Feature		1, 2, or 4 bytes	Bi-directional field, used for configuration
+										Same flag bits as Input/Output				DPI setting, battery level, calibration data, vendor config
+
+0xA0	Collection	1 byte				Begins a collection							Almost always 0x01 (Application) for top-level
+										0x00 Physical (group of axes)
+										0x01 Application (mouse, keyboard)
+										0x02 Logical (interrelated data)
+										0x03 Report
+										0x04 Named Array
+										0x05 Usage Switch
+										0x06 Usage Modifier
+										0x80–0xFF Vendor-defined
+
+0xC0	End Collection	0 bytes			Closes the most recent Collection			Mandatory pair with every Collection
+----------------------------------------------------------------------------------------------------
+
+Most Commonly Used Flag Combinations
+-----------------------------------------------------------
+Name						Hex		Binary flags	Meaning
+									(bits 0–8)
+-----------------------------------------------------------
+Data, Variable, Absolute	0x02	000000010		Normal controls (mouse X/Y, analog triggers)
+Data, Array, Absolute		0x00	000000000		Keyboard key arrays, button pages
+Constant, Variable, Abs		0x03	000000011		Padding bits
+Constant, Array, Abs		0x01	000000001		Padding bytes (reserved byte in keyboard report)
+Data, Variable, Relative	0x06	000001100		Mouse wheel, relative axes
+Data, Variable, Abs,
+NoWrap, Linear, NoNull		0x02 (most common)		Standard absolute axis
+-----------------------------------------------------------
+
+Global items affect the interpretation of all subsequent items in the report descriptor until a new global item of the same type overrides it.
+
+Complete list of all Global Items defined in the USB HID Device Class Definition (HID 1.11 and later), with their tags, data size, and meaning:
+------------------------------------------------------------------------------------------------------------------------------
+Tag (hex)	Item Name			Data Size	Description													Typical Values / Notes
+------------------------------------------------------------------------------------------------------------------------------
+0x04		Usage Page			1, 2, 4		Defines the usage page for subsequent Usage items			0x0001 (Generic Desktop), 0x0007 (Keyboard), 0x0009 (Button), 0xFF00 (Vendor-defined), etc.
+0x14		Logical Minimum		1, 2, 4		Minimum value for logical (signed) data						e.g., -127, 0, -1
+0x24		Logical Maximum		1, 2, 4		Maximum value for logical (signed) data						e.g., 127, 1, 255
+0x34		Physical Minimum	1, 2, 4		Minimum value for physical data (after applying scale/bias)	Rarely used
+0x44		Physical Maximum	1, 2, 4		Maximum value for physical data								Rarely used
+0x54		Unit Exponent		1			Signed exponent for units (base-10)							-8 to +7 (e.g., 0x0F = -1 → divide by 10)
+0x64		Unit				1, 2, 4		Defines the unit and system (SI, English, etc.)				e.g., 0x00000001 (None), 0xF0D12131 (degrees Celsius)
+0x74		Report Size			1, 2, 4		Size of each field in bits									1, 8, 16, 32 most common
+0x84		Report ID			1			Prefixes reports with an 8-bit ID (0 = no ID)				1–255; required if multiple report formats
+0x94		Report Count		1, 2, 4		Number of fields of Report Size that follow					e.g., 6 for 6 keys in a keyboard report
+0xA4		Push				0			Pushes current global state stack onto stack				Used for saving state
+0xB4		Pop					0			Restores global state from top of stack						Used after Push
+------------------------------------------------------------------------------------------------------------------------------
+
+Quick Reference Table (most commonly used)
+---------------------------------------------------------------------
+Item				Tag		Typical Data Values		When to change it
+---------------------------------------------------------------------
+Usage Page			4		0x01, 0x07, 0x08,		When switching between keyboard, mouse, consumer, vendor
+							0x09, 0x0C, 0xFF00
+Logical Minimum		14		0, -1, -127				For signed values or when 0 isn't the minimum
+Logical Maximum		24		1, 255, 32767			Almost always needed
+Report Size			74		1, 8, 16, 32			Every time field size changes
+Report Count		94		1, 3, 6, 8, etc.		Every time number of repeated fields changes
+Report ID			84		1–255					Only if you have multiple report formats
+---------------------------------------------------------------------
+
+Local items apply only to the very next Main item (Input, Output, or Feature) that follows them.
+After that Main item is processed, all local items are cleared and reset to “undefined” again.
+
+Here is the complete list of all Local Items defined in the USB HID 1.11/1.12 specification:
+-------------------------------------------------------------------------
+Tag (hex)	Item Name	Data Size		Meaning	Typical Values / Examples
+-------------------------------------------------------------------------
+0x08	Usage				1, 2, 4		Identifies what the upcoming field actually is	0x30 (X), 0x31 (Y), 0x04 (Keyboard a/A), 0x07 (Battery Strength)
+0x18	Usage Minimum		1, 2, 4		Lowest Usage value in a range (used with arrays or delimited sets)	0xE0 (Left Control), 0x01 (Button 1)
+0x28	Usage Maximum		1, 2, 4		Highest Usage value in a range	0xE7 (Right GUI), 0x08 (Button 8)
+0x38	Designator Index	1, 2, 4		Physical identifier (which finger, which hand, etc.) – rarely used	0x01 (First finger)
+0x48	Designator Minimum	1, 2, 4		Start of designator range	—
+0x58	Designator Maximum	1, 2, 4		End of designator range	—
+0x68	String Index		1, 2, 4		Index into the string descriptor table (for human-readable names)	1 = first string, etc.
+0x78	String Minimum		1, 2, 4		Start of string index range	—
+0x88	String Maximum		1, 2, 4		End of string index range	—
+0x98	Delimiter			1			Used to create multiple logical collections with the same local items (rare)	0x01 = open set, 0x00 = close set
+-------------------------------------------------------------------------
+
+How Local Items Are Consumed
+Local items → Main item → Local items are discarded
+
+Example:
+0x05, 0x01,        // Usage Page (Generic Desktop)          ← Global
+0x09, 0x30,        // Usage (X)                             ← Local
+0x09, 0x31,        // Usage (Y)                             ← Local  ← still active
+0x81, 0x02,        // Input (Data,Var,Abs)                  ← Main consumes both Usages → now local state empty again
+
+The Two Most Important Patterns:
+
+1. Variable fields (one Usage per field) – most common for axes, triggers, etc.
+0x09, 0x30,        // Usage (X)                ← Local
+0x09, 0x31,        // Usage (Y)                ← Local
+0x09, 0x32,        // Usage (Z)                ← Local
+0x95, 0x03,        // Report Count (3)         ← Global
+0x81, 0x02,        // Input (Data,Var,Abs)     ← Main → three separate fields: X, Y, Z
+
+2. Array fields (range of Usages) – used for keyboards, button pages, consumer keys
+0x19, 0x01,        // Usage Minimum (Button 1)          ← Local
+0x29, 0x0C,        // Usage Maximum (Button 12)         ← Local
+0x95, 0x0C,        // Report Count (12)                 ← Global
+0x75, 0x08,        // Report Size (8)                   ← Global
+0x81, 0x00,        // Input (Data,Array,Abs)            ← Main → 12-byte array of button indices
+
+Note:
+Collection and End Collection are Main items that do not declare report data, therefore they do not consume local items.
+
+The only thing that can give a meaning to a Collection is a Usage that appears immediately before the Collection (still a local item),
+but the parser treats it specially: it is moved from the local state table into the collection’s own state before the local table is cleared.
+
+0x09, 0x02,        // Usage (Mouse)                 ← Local Usage
+0xA1, 0x01,        // Collection (Application)      ← This Collection now "owns" the Usage "Mouse"
+*/
+
+// Extend 2's complement number sign
+#define SIGNEX(v, sb) ((v) | (((v) & (1u << (sb))) ? ~((1u << (sb))-1) : 0))
+
+// Custom values for storing HID item format
+enum hid_item_format
+{
+	HID_ITEM_FORMAT_SHORT,
+	HID_ITEM_FORMAT_LONG
+};
+
+typedef struct _HID_ITEM_INFO
+{
+	uint8_t format; // hid_item_format
+	uint8_t size;
+	uint8_t type; // hid_item_type: MAIN, GLOBAL, LOCAL
+	uint8_t tag; // hid_main_item_tag
+
+	union
+	{
+		uint8_t  u8;
+		int8_t   s8;
+		uint16_t u16;
+		int16_t  s16;
+		uint32_t u32;
+		int32_t  s32;
+
+		const uint8_t* longdata;
+	} value;
+
+} HID_ITEM;
+
+static uint16_t GetUnaligned16(const uint8_t* start)
+{
+#if LITTLE_ENDIAN
+	return *(uint16_t*)start;
+#else
+	uint16_t dat = (*start) | (*(start + 1) << 8);
+
+	return dat;
+#endif
+}
+
+static uint32_t GetUnaligned32(const uint8_t* start)
+{
+#if LITTLE_ENDIAN
+	return *(uint32_t*)start;
+#else
+	uint32_t dat = (uint32_t)(*start) | ((uint32_t)(*(start + 1)) << 8) | ((uint32_t)(*(start + 2)) << 16) | ((uint32_t)(*(start + 3)) << 24);
+
+	return dat;
+#endif
+}
+
+static uint32_t ItemUData(HID_ITEM* itemInfo)
+{
+	switch (itemInfo->size)
+	{
+	case 1:
+		return itemInfo->value.u8;
+	case 2:
+		return itemInfo->value.u16;
+	case 4:
+		return itemInfo->value.u32;
+	}
+
+	return 0;
+}
+
+static int32_t ItemSData(HID_ITEM* itemInfo)
+{
+	switch (itemInfo->size)
+	{
+	case 1:
+		return SIGNEX(itemInfo->value.s8, 7);
+	case 2:
+		return SIGNEX(itemInfo->value.s16, 15);
+	case 4:
+		return itemInfo->value.s32;
+	}
+
+	return 0;
+}
+
+/*
+  Parsing introduction:
+  https://docs.kernel.org/hid/hidintro.html
+  https://docs.kernel.org/hid/hidreport-parsing.html
+  https://www.usb.org/sites/default/files/documents/hid1_11.pdf
+*/
+// Returns pointer to next item
+const uint8_t* fetch_item(const uint8_t* start, const uint8_t* end, HID_ITEM* item)
+{
+/*
+Bits   23 22 21 20 19 18 17 16 15 14 13 12 11 10 9 8  7 6 5 4  3 2   1 0
+       ┌──────────────────────┐┌────────────────────┐┌───────┬─────┬─────┐
+Parts  │        [data]        ││       [data]       ││ bTag  │bType│bSize│
+       └──────────────────────┘└────────────────────┘└───────┴─────┴─────┘
+Bytes             2                       1                   0
+
+Item firs byte:
+	2 bits for the length of the item,
+	2 bits for the type of the item and
+	4 bits for the tag / function
+*/
+	if (end - start <= 0)
+		return nullptr;
+
+	const uint8_t first = *start++;
+
+	item->type = (first >> 2) & 0x03; // 2 bits for the type
+
+	item->tag = (first >> 4) & 0x0F; // 4 bits for function
+
+	if (item->tag == HID_ITEM_TAG_LONG) // Long items - HID 1.11 section 6.2.2.3
+	{
+		item->format = HID_ITEM_FORMAT_LONG;
+
+		if (end - start < 2)
+			return nullptr;
+
+		item->size = *start++;
+		item->tag = *start++;
+
+		if (end - start < item->size)
+			return nullptr;
+
+		item->value.longdata = start;
+		start += item->size;
+
+		return start;
+	}
+	else
+	{
+		item->format = HID_ITEM_FORMAT_SHORT; // Short Items - HID 1.11 section 6.2.2.2
+		item->size = first & 0x03; // 2 bits for size
+
+		switch (item->size)
+		{
+		case 0:
+			return start;
+
+		case 1:
+			if (end - start < 1)
+				return nullptr;
+
+			item->value.u8 = *start++;
+
+			return start;
+
+		case 2:
+			if (end - start < 2)
+				return nullptr;
+
+			item->value.u16 = GetUnaligned16(start);
+			start += 2;
+
+			return start;
+
+		case 3:
+			item->size++;
+
+			if (end - start < 4)
+				return nullptr;
+
+			item->value.u32 = GetUnaligned32(start);
+			start += 4;
+
+			return start;
+		}
+	}
+
+	return nullptr;
+}
+
+// defines a mapping between a HID segment and an output event
+typedef struct HID_SEG
+{
+	uint16_t startBit;
+
+	// Mouse or keyboard or Kempston joystick
+	uint8_t outputChannel;
+
+	// for keyboard, this is the HID scancode of the key associated with this control
+	// for mouse, this is one of the values of MAP_MOUSE_x
+	// for gamepad, this is target mapped value (target gamepad button / axis)
+	uint8_t outputControl;
+
+	// How this control gets interpreted - MAP_TYPE_x
+	uint8_t inputType;
+
+	// Param has different meanings depending on InputType
+	uint16_t inputParam;
+
+	uint8_t pad; // Gamepad index for MAP_GAMEPAD, 0-based joystick / gamepad application collection number
+
+	// Assume HID item size does not exceed 16 bit for X/Y axes to save embedded memory and CPU cycles.
+	// However, by specification it can be 32 bit.
+	int16_t logicalMinimum;
+	uint16_t logicalMaximum;
+
+	uint8_t reportSize; // Item size in bits
+
+	uint8_t reportCount; // Used for bitfields / arrays
+
+	uint32_t value; // User value used in mapping function
+
+	arena_ref next; // HID_SEG
+} HID_SEG;
+
+#define KEYBOARD_STATE_SIZE 256/8 // bit map for currently pressed keys (0-256)
+
+typedef struct keyboard_state
+{
+	uint8_t keys[KEYBOARD_STATE_SIZE];
+	uint8_t old_keys[KEYBOARD_STATE_SIZE];
+} keyboard_state;
+
+typedef struct _HID_REPORT
+{
+	uint8_t reportID;
+	uint8_t pads; // Bitmask of pads with MAP_GAMEPAD segments
+
+	uint16_t appUsage; // generic_page_input_usage
+	uint16_t appUsagePage; // hid_usage_pages
+	uint16_t length; // in bits
+
+	keyboard_state keyboard;
+
+	// Arena references instead of pointers keep parsed reports relocatable (hid_parser_export())
+	arena_ref segments; // HID_SEG list
+
+	arena_ref next; // _HID_REPORT
+} HID_REPORT;
+
+bool g_interface_uses_reports = false;
+arena_ref g_reports = ARENA_REF_NONE; // HID_REPORT list
+
+typedef struct _HID_GLOBAL
+{
+	uint16_t usagePage; // Up to 4 bytes by spec
+	int32_t logicalMinimum;
+	uint32_t logicalMaximum;
+	int16_t physicalMinimum; // Up to 4 bytes by spec. Ignored.
+	uint16_t physicalMaximum;
+	uint8_t reportID;
+	uint8_t reportSize; // Current item size in bits
+	uint8_t reportCount; // Current item reports count
+} HID_GLOBAL;
+
+typedef struct _HID_LOCAL
+{
+	uint32_t usage;
+	uint32_t usageMin;
+	uint32_t usageMax;
+} HID_LOCAL;
+
+// There is no fixed limit in the HID specification.
+// Most parsers limit to 255 usages per MAIN item.
+// In practice do not exceed 10.
+#define MAX_USAGE_NUM 16
+
+typedef struct ParseState
+{
+	HID_GLOBAL hidGlobal;
+	HID_LOCAL hidLocal;
+	uint16_t startBit;
+	uint16_t appUsage; // Stored LOCAL Usage for Collection (Application) (generic_page_input_usage)
+	uint16_t appUsagePage; // Stored GLOBAL Usage Page for Collection (Application) (hid_usage_pages)
+	uint8_t joyNum; // Joystick / gamepad application collections so far, current one for presets
+	uint16_t usages[MAX_USAGE_NUM];
+	uint8_t usagesCount;
+	bool arenaFull; // Descriptor does not fit arena, parsing stops
+} ParseState;
+
+ParseState g_HIDParseState = {};
+
+void hid_parser_reset_state()
+{
+	arena_reset();
+
+	g_interface_uses_reports = false;
+	g_reports = ARENA_REF_NONE;
+	g_HIDParseState = {};
+}
+
+// Returns nullptr and sets arenaFull if arena is out of space.
+HID_SEG* CreateSeg(HID_REPORT* rep, const uint16_t startbit)
+{
+	uint8_t* memory = arena_alloc(sizeof(HID_SEG));
+
+	if (!memory)
+	{
+		g_HIDParseState.arenaFull = true;
+		return nullptr;
+	}
+
+	HID_SEG* segment = new(memory) HID_SEG{};
+
+	segment->next = rep->segments;
+	rep->segments = arena_ref_of(segment);
+
+	segment->startBit = startbit;
+	segment->reportCount = g_HIDParseState.hidGlobal.reportCount;
+	segment->reportSize = g_HIDParseState.hidGlobal.reportSize;
+
+	if (segment->reportSize > 16)
+	{
+		printf("\nWarning: CreateSeg: 32-bit HID value");
+	}
+
+	if (segment->reportSize > 32)
+		segment->reportSize = 32; // Low 32 bits of longer field
+
+	segment->logicalMinimum = (int16_t)g_HIDParseState.hidGlobal.logicalMinimum; // reduce range from 32 to 16 bit
+	segment->logicalMaximum = (uint16_t)g_HIDParseState.hidGlobal.logicalMaximum;
+
+	return segment;
+}
+
+// FNV-1a
+static uint32_t hash_bytes(uint32_t hash, const void* data, const size_t size)
+{
+	const uint8_t* bytes = (const uint8_t*)data;
+
+	for (size_t i = 0; i < size; i++)
+		hash = (hash ^ bytes[i]) * 16777619u;
+
+	return hash;
+}
+
+// Preset tables up to this size are indexed, larger ones are scanned linearly.
+#define MAX_PRESET_INDEX 256
+
+// Preset table entries sorted by (pad number, usage page, usage).
+// Index is valid for table address and keys it was built for: checked on every descriptor, tables edited in place are indexed again.
+typedef struct PresetIndex
+{
+	const JoyPreset* preset; // Indexed table, nullptr if not indexed
+	uint32_t keysHash; // FNV-1a of indexed table keys
+	uint16_t count;
+	uint8_t entries[MAX_PRESET_INDEX];
+} PresetIndex;
+
+PresetIndex g_presetIndex = {};
+
+static uint64_t preset_key(const uint8_t number, const uint16_t usagePage, const uint32_t usage)
+{
+	return ((uint64_t)number << 48) | ((uint64_t)usagePage << 32) | usage;
+}
+
+static uint64_t preset_key(const JoyPreset* preset)
+{
+	return preset_key(preset->number, preset->inputUsagePage, preset->inputUsage);
+}
+
+// Stable insertion sort keeps table order of presets with same key (segments order).
+static void BuildPresetIndex(const JoyPreset* preset)
+{
+	uint32_t keysHash = 2166136261u;
+	uint16_t count = 0;
+
+	for (; preset && preset[count].inputType != MAP_TYPE_NONE && count <= MAX_PRESET_INDEX; count++)
+	{
+		const uint64_t key = preset_key(&preset[count]);
+		keysHash = hash_bytes(keysHash, &key, sizeof(key));
+	}
+
+	if (preset && g_presetIndex.preset == preset && g_presetIndex.count == count && g_presetIndex.keysHash == keysHash)
+		return;
+
+	g_presetIndex.preset = nullptr;
+	g_presetIndex.count = 0;
+
+	if (!preset || count > MAX_PRESET_INDEX)
+		return;
+
+	for (uint16_t entry = 0; entry < count; entry++)
+	{
+		const uint64_t key = preset_key(&preset[entry]);
+		uint16_t i = entry;
+
+		for (; i > 0 && preset_key(&preset[g_presetIndex.entries[i - 1]]) > key; i--)
+			g_presetIndex.entries[i] = g_presetIndex.entries[i - 1];
+
+		g_presetIndex.entries[i] = (uint8_t)entry;
+	}
+
+	g_presetIndex.count = count;
+	g_presetIndex.keysHash = keysHash;
+	g_presetIndex.preset = preset;
+}
+
+static void CreatePresetSeg(HID_REPORT* rep, const JoyPreset* preset, const uint16_t startbit)
+{
+	HID_SEG* segment = CreateSeg(rep, startbit);
+
+	if (!segment)
+		return;
+
+	segment->outputChannel = preset->outputChannel;
+	segment->outputControl = preset->outputControl;
+	segment->inputType = preset->inputType;
+	segment->inputParam = preset->inputParam;
+
+	if (segment->outputChannel == MAP_GAMEPAD)
+	{
+		segment->pad = g_HIDParseState.joyNum - 1;
+		rep->pads |= 1 << segment->pad;
+	}
+}
+
+// Binary search for first index entry with key not less than key
+static uint16_t PresetLowerBound(const JoyPreset* preset, const uint64_t key)
+{
+	uint16_t first = 0;
+	uint16_t last = g_presetIndex.count;
+
+	while (first < last)
+	{
+		const uint16_t middle = (first + last) / 2;
+
+		if (preset_key(&preset[g_presetIndex.entries[middle]]) < key)
+			first = middle + 1;
+		else
+			last = middle;
+	}
+
+	return first;
+}
+
+static void CreateIndexedMapping(HID_REPORT* rep, const JoyPreset* preset, const uint8_t number, const uint16_t startbit)
+{
+	const uint64_t key = preset_key(number, g_HIDParseState.hidGlobal.usagePage, g_HIDParseState.hidLocal.usage);
+	uint16_t first = PresetLowerBound(preset, key);
+
+	for (; first < g_presetIndex.count && preset_key(&preset[g_presetIndex.entries[first]]) == key; first++)
+		CreatePresetSeg(rep, &preset[g_presetIndex.entries[first]], startbit);
+}
+
+//search though preset to see if this matches a mapping
+void CreateMapping(HID_REPORT* rep, const JoyPreset* preset, const uint16_t startbit)
+{
+	if (g_HIDParseState.joyNum == 0 || g_HIDParseState.joyNum > HID_PARSER_MAX_PADS)
+		return;
+
+	if (preset && preset == g_presetIndex.preset)
+	{
+		CreateIndexedMapping(rep, preset, JOY_PRESET_ANY_PAD, startbit);
+		CreateIndexedMapping(rep, preset, g_HIDParseState.joyNum, startbit);
+
+		return;
+	}
+
+	// Empty structure used as end of JoyPreset array.
+	// Can be used with more safe array indexing, with end marker deleted.
+	while (preset->inputType != MAP_TYPE_NONE)
+	{
+		if (preset->inputUsagePage == g_HIDParseState.hidGlobal.usagePage &&
+			preset->inputUsage == g_HIDParseState.hidLocal.usage &&
+			(preset->number == g_HIDParseState.joyNum || preset->number == JOY_PRESET_ANY_PAD))
+		{
+			CreatePresetSeg(rep, preset, startbit);
+		}
+
+		preset++;
+	}
+}
+
+// Usage range usageMin..usageMax, one field per usage: index entries in range only, cost does not depend on range length.
+// Segments are created in CreateMapping() order for every usage: pad-independent entries first.
+static void CreateIndexedRangeMapping(HID_REPORT* rep, const JoyPreset* preset, const uint32_t usageMin, const uint32_t usageMax, const uint16_t startbit)
+{
+	const uint16_t usagePage = g_HIDParseState.hidGlobal.usagePage;
+	const uint8_t number = g_HIDParseState.joyNum;
+
+	uint16_t any = PresetLowerBound(preset, preset_key(JOY_PRESET_ANY_PAD, usagePage, usageMin));
+	uint16_t own = PresetLowerBound(preset, preset_key(number, usagePage, usageMin));
+
+	const uint64_t anyLast = preset_key(JOY_PRESET_ANY_PAD, usagePage, usageMax);
+	const uint64_t ownLast = preset_key(number, usagePage, usageMax);
+
+	while (!g_HIDParseState.arenaFull)
+	{
+		const JoyPreset* anyEntry = any < g_presetIndex.count ? &preset[g_presetIndex.entries[any]] : nullptr;
+		const JoyPreset* ownEntry = own < g_presetIndex.count ? &preset[g_presetIndex.entries[own]] : nullptr;
+
+		if (anyEntry && preset_key(anyEntry) > anyLast)
+			anyEntry = nullptr;
+
+		if (ownEntry && preset_key(ownEntry) > ownLast)
+			ownEntry = nullptr;
+
+		if (!anyEntry && !ownEntry)
+			break;
+
+		const uint32_t usage = !ownEntry || (anyEntry && anyEntry->inputUsage <= ownEntry->inputUsage) ?
+			anyEntry->inputUsage : ownEntry->inputUsage;
+		const uint16_t bit = startbit + (uint16_t)((usage - usageMin) * g_HIDParseState.hidGlobal.reportSize);
+
+		for (; any < g_presetIndex.count && preset_key(&preset[g_presetIndex.entries[any]]) == preset_key(JOY_PRESET_ANY_PAD, usagePage, usage); any++)
+			CreatePresetSeg(rep, &preset[g_presetIndex.entries[any]], bit);
+
+		for (; own < g_presetIndex.count && preset_key(&preset[g_presetIndex.entries[own]]) == preset_key(number, usagePage, usage); own++)
+			CreatePresetSeg(rep, &preset[g_presetIndex.entries[own]], bit);
+	}
+}
+
+void CreateBitfieldMapping(HID_REPORT* rep, const JoyPreset* preset)
+{
+	uint16_t startbit = g_HIDParseState.startBit;
+
+	if (g_HIDParseState.appUsagePage == REPORT_USAGE_PAGE_GENERIC_DESKTOP)
+	{
+		if (g_HIDParseState.appUsage == REPORT_USAGE_KEYBOARD)
+		{
+			if (g_HIDParseState.hidGlobal.usagePage == REPORT_USAGE_PAGE_KEYBOARD)
+			{
+				HID_SEG* segment = CreateSeg(rep, startbit);
+
+				if (!segment)
+					return;
+
+				// Keyboard - 1 bit per key (usually for modifier field)
+				segment->outputChannel = MAP_KEYBOARD;
+				segment->outputControl = g_HIDParseState.hidLocal.usageMin;
+				segment->inputType = MAP_TYPE_BITFIELD;
+			}
+		}
+		else if (g_HIDParseState.appUsage == REPORT_USAGE_MOUSE)
+		{
+			if (g_HIDParseState.hidGlobal.usagePage == REPORT_USAGE_PAGE_BUTTON)
+			{
+				HID_SEG* segment = CreateSeg(rep, startbit);
+
+				if (!segment)
+					return;
+
+				// Mouse - 1 bit per button
+				segment->outputChannel = MAP_MOUSE;
+				segment->outputControl = g_HIDParseState.hidLocal.usageMin;
+				segment->inputType = MAP_TYPE_BITFIELD;
+			}
+		}
+		else if (g_HIDParseState.appUsage == REPORT_USAGE_JOYSTICK || g_HIDParseState.appUsage == REPORT_USAGE_GAMEPAD)
+		{
+			// Usage Maximum is inclusive, one usage per field: range beyond Report Count is not declared by item
+			const uint32_t usageMin = g_HIDParseState.hidLocal.usageMin;
+			const uint32_t reportCount = g_HIDParseState.hidGlobal.reportCount;
+
+			if (usageMin > g_HIDParseState.hidLocal.usageMax || !reportCount)
+				return;
+
+			const uint32_t usageMax = g_HIDParseState.hidLocal.usageMax - usageMin < reportCount ?
+				g_HIDParseState.hidLocal.usageMax : usageMin + reportCount - 1;
+
+			if (preset && preset == g_presetIndex.preset)
+			{
+				if (g_HIDParseState.joyNum && g_HIDParseState.joyNum <= HID_PARSER_MAX_PADS)
+					CreateIndexedRangeMapping(rep, preset, usageMin, usageMax, startbit);
+
+				return;
+			}
+
+			for (uint32_t i = 0; i <= usageMax - usageMin; i++)
+			{
+				g_HIDParseState.hidLocal.usage = usageMin + i; // used as global variable for parameter passing
+				CreateMapping(rep, preset, startbit);
+
+				startbit += g_HIDParseState.hidGlobal.reportSize;
+			}
+		}
+	}
+}
+
+void CreateUsageMapping(HID_REPORT* rep, const JoyPreset* preset)
+{
+	uint16_t startbit = g_HIDParseState.startBit;
+
+	// need to make a seg for each found usage, usages beyond Report Count have no field
+	for (uint8_t i = 0; i < g_HIDParseState.usagesCount && i < g_HIDParseState.hidGlobal.reportCount; i++)
+	{
+		if (g_HIDParseState.appUsagePage == REPORT_USAGE_PAGE_GENERIC_DESKTOP)
+		{
+			if (g_HIDParseState.appUsage == REPORT_USAGE_MOUSE)
+			{
+				HID_SEG* segment = CreateSeg(rep, startbit);
+
+				if (!segment)
+					return;
+
+				startbit += g_HIDParseState.hidGlobal.reportSize;
+
+				if (g_HIDParseState.hidGlobal.usagePage == REPORT_USAGE_PAGE_GENERIC_DESKTOP)
+				{
+					segment->outputChannel = MAP_MOUSE;
+					switch (g_HIDParseState.usages[i])
+					{
+					case REPORT_USAGE_X:
+						// Mouse - value field
+						segment->outputControl = MAP_MOUSE_X;
+						segment->inputType = MAP_TYPE_SCALE;
+						break;
+
+					case REPORT_USAGE_Y:
+						// Mouse - value field
+						segment->outputControl = MAP_MOUSE_Y;
+						segment->inputType = MAP_TYPE_SCALE;
+						break;
+
+					case REPORT_USAGE_WHEEL:
+						// Mouse - value field
+						segment->outputControl = MAP_MOUSE_WHEEL;
+						segment->inputType = MAP_TYPE_SCALE;
+						break;
+					}
+				}
+			}
+			else if (g_HIDParseState.appUsage == REPORT_USAGE_JOYSTICK || g_HIDParseState.appUsage == REPORT_USAGE_GAMEPAD)
+			{
+				g_HIDParseState.hidLocal.usage = g_HIDParseState.usages[i]; // used as global variable for parameter passing
+				CreateMapping(rep, preset, startbit);
+
+				startbit += g_HIDParseState.hidGlobal.reportSize;
+			}
+		}
+	}
+}
+
+void CreateArrayMapping(HID_REPORT* rep)
+{
+	uint16_t startbit = g_HIDParseState.startBit;
+
+	if (g_HIDParseState.appUsagePage == REPORT_USAGE_PAGE_GENERIC_DESKTOP &&
+		g_HIDParseState.appUsage == REPORT_USAGE_KEYBOARD &&
+		g_HIDParseState.hidGlobal.usagePage == REPORT_USAGE_PAGE_KEYBOARD)
+	{
+		// need to make a seg for each report array item
+		for (uint8_t i = 0; i < g_HIDParseState.hidGlobal.reportCount; i++)
+		{
+			HID_SEG* segment = CreateSeg(rep, startbit);
+
+			if (!segment)
+				return;
+
+			segment->outputChannel = MAP_KEYBOARD;
+			segment->inputType = MAP_TYPE_ARRAY;
+
+			startbit += g_HIDParseState.hidGlobal.reportSize;
+		}
+	}
+}
+
+void DumpHID(HID_REPORT* report)
+{
+	while (report)
+	{
+		HID_SEG* seg = (HID_SEG*)arena_ptr(report->segments);
+
+		printf("Report: usage %x, length %u: \n",  report->appUsage, report->length);
+
+		while (seg)
+		{
+			printf("startBit %u, inputType %hx, inputParam %x, outputChannel %hx, outputControl %hx, size %hx, count %hx\n",
+				seg->startBit, seg->inputType, seg->inputParam, 
+				seg->outputChannel, seg->outputControl,
+				seg->reportSize, seg->reportCount);
+
+			seg = (HID_SEG*)arena_ptr(seg->next);
+		}
+
+		report = (HID_REPORT*)arena_ptr(report->next);
+	}
+}
+
+// Descriptor parser state shared by ParseReportDescriptor() items
+typedef struct DescriptorState
+{
+	const JoyPreset* preset;
+	HID_REPORT* currHidReport;
+	uint8_t collectionDepth;
+} DescriptorState;
+
+DescriptorState g_descriptorState = {};
+
+static bool ParseItem(HID_ITEM* item)
+{
+	HID_GLOBAL* hidGlobal = &g_HIDParseState.hidGlobal;
+	HID_LOCAL* hidLocal = &g_HIDParseState.hidLocal;
+
+	const JoyPreset* preset = g_descriptorState.preset;
+	HID_REPORT*& currHidReport = g_descriptorState.currHidReport;
+	uint8_t& collectionDepth = g_descriptorState.collectionDepth;
+
+	if (item->format != HID_ITEM_FORMAT_SHORT)
+	{
+		return false; // Long HID items not supported.
+	}
+
+	switch (item->type)
+	{
+	case HID_TYPE_MAIN:
+		if (item->tag == HID_MAIN_ITEM_TAG_INPUT)
+		{
+			// Report length is kept in 16 bits, segments past it would be read beyond received report
+			if (g_HIDParseState.startBit + (uint32_t)hidGlobal->reportSize * hidGlobal->reportCount > UINT16_MAX)
+				return false;
+
+			if (
+				g_HIDParseState.appUsagePage == REPORT_USAGE_PAGE_GENERIC_DESKTOP &&
+					(
+					g_HIDParseState.appUsage == REPORT_USAGE_JOYSTICK ||
+					g_HIDParseState.appUsage == REPORT_USAGE_GAMEPAD ||
+					g_HIDParseState.appUsage == REPORT_USAGE_KEYBOARD ||
+					g_HIDParseState.appUsage == REPORT_USAGE_MOUSE
+					)
+				)
+			{
+				if (currHidReport == nullptr)
+				{
+					// Start new report within descriptor
+					uint8_t* memory = arena_alloc(sizeof(HID_REPORT));
+
+					if (!memory)
+						return false;
+
+					currHidReport = new(memory) HID_REPORT{};
+					currHidReport->reportID = hidGlobal->reportID;
+					currHidReport->segments = ARENA_REF_NONE;
+
+					currHidReport->next = g_reports; // Add new report to list head. Note: For report parsing lookup better to add to list tail.
+					g_reports = arena_ref_of(currHidReport);
+
+					currHidReport->appUsagePage = g_HIDParseState.appUsagePage;
+					currHidReport->appUsage = g_HIDParseState.appUsage;
+				}
+
+				if (ItemUData(item) & HID_INPUT_VARIABLE)
+				{
+					// we found some discrete usages, get to it
+					if (g_HIDParseState.usagesCount)
+					{
+						CreateUsageMapping(currHidReport, preset);
+					}
+					// if no usages found, maybe a bitfield
+					else if (hidLocal->usageMin != 0xFFFF && hidLocal->usageMax != 0xFFFF &&
+						hidGlobal->reportSize == 1)
+					{
+						CreateBitfieldMapping(currHidReport, preset);
+					}
+					else
+					{
+						// Input Variable MAIN item with no usages / usage min/max declared.
+					}
+				}
+				else // Item is array style, whole range appears in every segment
+				{
+					CreateArrayMapping(currHidReport);
+				}
+
+				if (g_HIDParseState.arenaFull)
+					return false;
+			}
+
+			g_HIDParseState.startBit += (uint16_t)hidGlobal->reportSize * (uint16_t)hidGlobal->reportCount;
+
+			if (currHidReport)
+				currHidReport->length = g_HIDParseState.startBit;
+		}
+		else if (item->tag == HID_MAIN_ITEM_TAG_COLLECTION_START)
+		{
+			collectionDepth++;
+
+			if (ItemUData(item) == HID_COLLECTION_APPLICATION_)
+			{
+				// Make a note of this application collection's usage/page
+				// (so we know what sort of device this is)
+				g_HIDParseState.appUsage = hidLocal->usage;
+
+				g_HIDParseState.appUsagePage = hidGlobal->usagePage;
+
+				// Every joystick / gamepad collection is separate pad, Report IDs inside it belong to the same pad.
+				if (g_HIDParseState.appUsagePage == REPORT_USAGE_PAGE_GENERIC_DESKTOP &&
+					(g_HIDParseState.appUsage == REPORT_USAGE_JOYSTICK || g_HIDParseState.appUsage == REPORT_USAGE_GAMEPAD) &&
+					g_HIDParseState.joyNum < UINT8_MAX)
+				{
+					g_HIDParseState.joyNum++;
+				}
+			}
+		}
+		else if (item->tag == HID_MAIN_ITEM_TAG_COLLECTION_END)
+		{
+			collectionDepth--;
+
+			// Only advance app if we're at the root level
+			if (collectionDepth == 0)
+			{
+				g_HIDParseState.appUsage = 0x00;
+				g_HIDParseState.appUsagePage = 0x00;
+			}
+		}
+
+		// Output and Feature MAIN items are ignored.
+
+		g_HIDParseState.usagesCount = 0; // reset parser state / LOCAL Usage list after MAIN Input item 
+		// Local items → Main item → Local items are discarded
+		hidLocal->usage = 0x00;
+		hidLocal->usageMax = 0xFFFF;
+		hidLocal->usageMin = 0xFFFF;
+		break;
+
+	case HID_TYPE_GLOBAL:
+		switch (item->tag)
+		{
+		case HID_GLOBAL_ITEM_TAG_REPORT_ID:
+			g_interface_uses_reports = true;
+			// report id
+			g_HIDParseState.startBit = 0;
+			g_HIDParseState.startBit += item->size * 8; // Report starts with report ID
+
+			hidGlobal->reportID = ItemUData(item);
+			currHidReport = nullptr; // start new report
+			break;
+
+		case HID_GLOBAL_ITEM_TAG_LOGICAL_MINIMUM:
+			hidGlobal->logicalMinimum = ItemSData(item);
+			break;
+
+		case HID_GLOBAL_ITEM_TAG_LOGICAL_MAXIMUM:
+			if (hidGlobal->logicalMinimum < 0)
+				hidGlobal->logicalMaximum = ItemSData(item);
+			else
+				hidGlobal->logicalMaximum = ItemUData(item);
+			break;
+
+		case HID_GLOBAL_ITEM_TAG_PHYSICAL_MINIMUM:
+			hidGlobal->physicalMinimum = ItemSData(item);
+			break;
+
+		case HID_GLOBAL_ITEM_TAG_PHYSICAL_MAXIMUM:
+			if (hidGlobal->physicalMinimum < 0)
+				hidGlobal->physicalMaximum = ItemSData(item);
+			else
+				hidGlobal->physicalMaximum = ItemUData(item);
+			break;
+
+		case HID_GLOBAL_ITEM_TAG_REPORT_SIZE:
+			hidGlobal->reportSize = ItemUData(item);
+			break;
+
+		case HID_GLOBAL_ITEM_TAG_REPORT_COUNT:
+			hidGlobal->reportCount = ItemUData(item);
+			break;
+
+		case HID_GLOBAL_ITEM_TAG_USAGE_PAGE:
+			hidGlobal->usagePage = ItemUData(item);
+			break;
+
+		default:
+			break;
+		}
+
+		break;
+
+	case HID_TYPE_LOCAL:
+		if (item->tag == HID_LOCAL_ITEM_TAG_USAGE)
+		{
+			hidLocal->usage = ItemUData(item);
+
+			if (g_HIDParseState.usagesCount < MAX_USAGE_NUM)
+			{
+				g_HIDParseState.usages[g_HIDParseState.usagesCount] = ItemUData(item);
+				g_HIDParseState.usagesCount++;
+			}
+		}
+		else if (item->tag == HID_LOCAL_ITEM_TAG_USAGE_MIN)
+			hidLocal->usageMin = ItemUData(item);
+		else if (item->tag == HID_LOCAL_ITEM_TAG_USAGE_MAX)
+			hidLocal->usageMax = ItemUData(item);
+
+		break;
+	}
+
+	return true;
+}
+
+bool ParseReportDescriptor(const uint8_t* descriptor, const uint16_t len, const JoyPreset* preset)
+{
+	hid_parser_reset_state();
+
+	g_descriptorState = {};
+	g_descriptorState.preset = preset;
+
+	BuildPresetIndex(preset);
+
+	g_HIDParseState.hidLocal.usageMax = 0xFFFF;
+	g_HIDParseState.hidLocal.usageMin = 0xFFFF;
+
+	HID_ITEM item;
+
+	const uint8_t* start = descriptor;
+	const uint8_t* end = start + len;
+
+	while ((start = fetch_item(start, end, &item)))
+	{
+		if (!ParseItem(&item))
+			return false;
+
+		if (start == end)
+			return true;
+	}
+
+	return false;
+}
+
+// Compiled decoder image header, arena contents follow
+typedef struct DecoderImageHeader
+{
+	uint8_t version;
+	uint8_t usesReports;
+	arena_ref reports;
+	uint16_t arenaUsed;
+	uint16_t layout; // Struct sizes: image is not valid for firmware with other parser structs layout
+} DecoderImageHeader;
+
+// Bump when the same descriptor parses to other reports or segments, images of older firmware are parsed again.
+// 2: pad number per application collection. 3: inclusive Usage Maximum clamped to Report Count, 16-bit report length.
+#define DECODER_IMAGE_VERSION 3
+#define DECODER_IMAGE_LAYOUT ((sizeof(HID_REPORT) << 8) | sizeof(HID_SEG))
+
+size_t hid_parser_export(uint8_t* image, const size_t size)
+{
+	const size_t used = arena_used();
+
+	if (g_reports == ARENA_REF_NONE || size < sizeof(DecoderImageHeader) + used)
+		return 0;
+
+	DecoderImageHeader header = {};
+	header.version = DECODER_IMAGE_VERSION;
+	header.usesReports = g_interface_uses_reports;
+	header.reports = g_reports;
+	header.arenaUsed = (uint16_t)used;
+	header.layout = DECODER_IMAGE_LAYOUT;
+
+	memcpy(image, &header, sizeof(header));
+	memcpy(image + sizeof(header), arena_buffer, used);
+
+	return sizeof(header) + used;
+}
+
+static bool image_ref_valid(const arena_ref ref, const size_t size, const size_t align, const uint16_t used)
+{
+	return ref % align == 0 && (uint32_t)ref + size <= used;
+}
+
+// Imported image comes from flash: every reference must point to a whole aligned node inside loaded arena
+// and every segment must lie inside its report, lists are walked with node limit against reference loops.
+static bool image_valid(const uint16_t used)
+{
+	uint16_t nodes = used / sizeof(HID_SEG);
+
+	for (arena_ref ref = g_reports; ref != ARENA_REF_NONE;)
+	{
+		if (!nodes-- || !image_ref_valid(ref, sizeof(HID_REPORT), alignof(HID_REPORT), used))
+			return false;
+
+		const HID_REPORT* report = (const HID_REPORT*)arena_ptr(ref);
+
+		for (arena_ref seg_ref = report->segments; seg_ref != ARENA_REF_NONE;)
+		{
+			if (!nodes-- || !image_ref_valid(seg_ref, sizeof(HID_SEG), alignof(HID_SEG), used))
+				return false;
+
+			const HID_SEG* segment = (const HID_SEG*)arena_ptr(seg_ref);
+			const uint32_t bits = segment->inputType == MAP_TYPE_BITFIELD ? segment->reportCount : segment->reportSize;
+
+			if (segment->reportSize > 32 || segment->pad >= HID_PARSER_MAX_PADS || segment->startBit + bits > report->length)
+				return false;
+
+			seg_ref = segment->next;
+		}
+
+		ref = report->next;
+	}
+
+	return true;
+}
+
+bool hid_parser_import(const uint8_t* image, const size_t size)
+{
+	DecoderImageHeader header;
+
+	if (size < sizeof(header))
+		return false;
+
+	memcpy(&header, image, sizeof(header));
+
+	if (header.version != DECODER_IMAGE_VERSION || header.layout != DECODER_IMAGE_LAYOUT ||
+		size != sizeof(header) + header.arenaUsed || header.reports >= header.arenaUsed)
+		return false;
+
+	hid_parser_reset_state();
+
+	if (!arena_load(image + sizeof(header), header.arenaUsed))
+		return false;
+
+	g_interface_uses_reports = header.usesReports;
+	g_reports = header.reports;
+
+	if (!image_valid(header.arenaUsed))
+	{
+		hid_parser_reset_state();
+		return false;
+	}
+
+	return true;
+}
+
+bool hid_parser_uses_report_ids()
+{
+	return g_interface_uses_reports;
+}
+
+uint8_t hid_parser_pads()
+{
+	uint8_t pads = 0;
+
+	for (HID_REPORT* report = (HID_REPORT*)arena_ptr(g_reports); report; report = (HID_REPORT*)arena_ptr(report->next))
+		pads |= report->pads;
+
+	uint8_t count = 0;
+
+	while (pads >> count)
+		count++;
+
+	return count;
+}
+
+uint16_t hid_parser_reports(hid_parser_report_info* reports, const uint16_t max)
+{
+	uint16_t count = 0;
+
+	for (HID_REPORT* report = (HID_REPORT*)arena_ptr(g_reports); report; report = (HID_REPORT*)arena_ptr(report->next), count++)
+	{
+		if (count < max)
+		{
+			reports[count].reportID = report->reportID;
+			reports[count].appUsage = report->appUsage;
+			reports[count].appUsagePage = report->appUsagePage;
+			reports[count].length = report->length;
+			reports[count].pads = report->pads;
+		}
+	}
+
+	return count;
+}
+
+uint16_t hid_parser_segments(const uint16_t report_index, hid_parser_segment_info* segments, const uint16_t max)
+{
+	HID_REPORT* report = (HID_REPORT*)arena_ptr(g_reports);
+
+	for (uint16_t i = 0; i < report_index && report; i++)
+		report = (HID_REPORT*)arena_ptr(report->next);
+
+	if (!report)
+		return 0;
+
+	uint16_t count = 0;
+
+	for (HID_SEG* segment = (HID_SEG*)arena_ptr(report->segments); segment; segment = (HID_SEG*)arena_ptr(segment->next), count++)
+	{
+		if (count < max)
+		{
+			hid_parser_segment_info* info = &segments[count];
+			info->startBit = segment->startBit;
+			info->reportSize = segment->reportSize;
+			info->reportCount = segment->reportCount;
+			info->logicalMinimum = segment->logicalMinimum;
+			info->logicalMaximum = segment->logicalMaximum;
+			info->outputChannel = segment->outputChannel;
+			info->outputControl = segment->outputControl;
+			info->inputType = segment->inputType;
+			info->inputParam = segment->inputParam;
+			info->pad = segment->pad;
+		}
+	}
+
+	return count;
+}
+
+uint32_t hid_parser_hash(const uint8_t* descriptor, const uint16_t len, const JoyPreset* preset)
+{
+	uint32_t hash = hash_bytes(2166136261u, descriptor, len);
+
+	// Field by field: struct padding is not initialized
+	for (; preset && preset->inputType != MAP_TYPE_NONE; preset++)
+	{
+		hash = hash_bytes(hash, &preset->number, sizeof(preset->number));
+		hash = hash_bytes(hash, &preset->inputUsagePage, sizeof(preset->inputUsagePage));
+		hash = hash_bytes(hash, &preset->inputUsage, sizeof(preset->inputUsage));
+		hash = hash_bytes(hash, &preset->outputChannel, sizeof(preset->outputChannel));
+		hash = hash_bytes(hash, &preset->outputControl, sizeof(preset->outputControl));
+		hash = hash_bytes(hash, &preset->inputType, sizeof(preset->inputType));
+		hash = hash_bytes(hash, &preset->inputParam, sizeof(preset->inputParam));
+	}
+
+	return hash;
+}
+
+static inline preset_value_type range_type(const int16_t minimum, const uint16_t maximum)
+{
+	preset_value_type source_type = VALUE_TYPE_CUSTOM;
+
+	if ((minimum == 0) && (maximum == UINT8_MAX))
+		source_type = VALUE_TYPE_UINT8;
+	else if ((minimum == INT8_MIN) && (maximum == INT8_MAX))
+		source_type = VALUE_TYPE_INT8;
+	else if ((minimum == 0) && (maximum == UINT16_MAX))
+		source_type = VALUE_TYPE_UINT16;
+	if ((minimum == INT16_MIN) && (maximum == INT16_MAX))
+		source_type = VALUE_TYPE_INT16;
+
+	return source_type;
+}
+
+uint32_t HOT_PATH(convert_range)(const uint32_t value, const int16_t minimum, const uint16_t maximum, const preset_value_type target_type)
+{
+	const preset_value_type source_type = range_type(minimum, maximum);
+
+	// uint16 -> uint16
+	// int16 -> int16
+	// uint8 -> uint8
+	// int8 -> int8
+	if (source_type == target_type)
+		return value;
+
+	// Unsigned arithmetic: same result bits as signed for values in range, no overflow for fields wider than range.
+	if (source_type == VALUE_TYPE_INT8)
+	{
+		if (target_type == VALUE_TYPE_UINT8) // int8 -> uint8
+			return value + 128;
+		else if (target_type == VALUE_TYPE_UINT16) // int8 -> uint16
+			return (value + 128) << 8;
+		else if (target_type == VALUE_TYPE_INT16) // int8 -> int16
+			return value << 8;
+	}
+	else if (source_type == VALUE_TYPE_UINT8)
+	{
+		if (target_type == VALUE_TYPE_INT8) // uint8 -> int8
+			return value - 0x80;
+		else if (target_type == VALUE_TYPE_UINT16) // uint8 -> uint16
+			return value << 8;
+		else if (target_type == VALUE_TYPE_INT16) // uint8 -> int16
+			return (value << 8) - 0x8000;
+	}
+	else if (source_type == VALUE_TYPE_INT16)
+	{
+		if (target_type == VALUE_TYPE_UINT8) // int16 -> uint8
+			return ((int32_t)value + 0x8000) >> 8;
+		if (target_type == VALUE_TYPE_INT8) // int16 -> int8
+			return ((int32_t)value) >> 8;
+		else if (target_type == VALUE_TYPE_UINT16) // int16 -> uint16
+			return value + 0x8000;
+	}
+	else if (source_type == VALUE_TYPE_UINT16)
+	{
+		if (target_type == VALUE_TYPE_UINT8)// uint16 -> uint8
+			return value >> 8;
+		else if (target_type == VALUE_TYPE_INT8) // uint16 -> int8
+			return ((int32_t)(value >> 8)) - 0x80;
+		else if (target_type == VALUE_TYPE_INT16)// uint16 -> int16
+			return value - 0x8000;
+	}
+
+	// uint32_t and int32_t input types not implemented.
+	// Custom input ranges (e.g. 0..1023) and custom target: neutral value instead of assert,
+	// descriptor comes from device and must not stop USB core.
+	if (target_type == VALUE_TYPE_UINT8)
+		return 0x80;
+	else if (target_type == VALUE_TYPE_UINT16)
+		return 0x8000;
+
+	return 0;
+}
+
+#define SetKey(key, report) (report->keyboard.keys[key >> 3] |= 1 << (key & 0x07))
+
+typedef struct Mouse
+{
+	int16_t dx, dy, dz;
+	uint8_t buttons;
+	bool changed;
+} Mouse;
+
+static Mouse g_mouse;
+
+void MouseSet(uint8_t button, bool state)
+{
+	if (state)
+		g_mouse.buttons |= 1 << button;
+	else
+		g_mouse.buttons &= ~(1 << button);
+
+	g_mouse.changed = true;
+}
+
+void MouseMove(int32_t dx, int32_t dy, int32_t dz)
+{
+	// 16-bit deltas, wider fields are truncated
+	g_mouse.dx += (int16_t)dx;
+	g_mouse.dy += (int16_t)dy;
+	g_mouse.dz += (int16_t)dz;
+
+	g_mouse.changed = true;
+}
+
+// Portable field extraction: bits may be across any byte alignment
+static inline uint32_t extract_field(const uint8_t* data, const uint16_t start_bit, const uint8_t size, const bool sign)
+{
+	uint32_t value = 0;
+	uint16_t currentBit = start_bit;
+
+	for (uint8_t i = 0; i < size; i++)
+	{
+		// Calculate byte position and bit offset within the byte
+		const uint8_t shiftbits = currentBit % 8;
+		const uint8_t startbyte = currentBit / 8;
+
+		// Extract the bit
+		const uint8_t bit = (data[startbyte] >> shiftbits) & 0x01;
+
+		// Add the bit to the result
+		value |= (uint32_t)bit << i;
+
+		currentBit++;
+	}
+
+	// if it's a signed integer we need to extend the sign
+	if (sign && size)
+		value = SIGNEX(value, size - 1);
+
+	return value;
+}
+
+// map_to_uint8() of field value clamped to logical range: fields wider than range or empty range
+// from malformed descriptor don't overflow or divide by zero.
+static inline uint8_t map_field_to_uint8(const uint32_t value, const bool sign, const int16_t minimum, const uint16_t maximum)
+{
+	if (maximum <= minimum)
+		return 0;
+
+	if (sign)
+	{
+		const int32_t v = (int32_t)value < minimum ? minimum : ((int32_t)value > maximum ? maximum : (int32_t)value);
+
+		return map_to_uint8(v, minimum, maximum);
+	}
+
+	const uint32_t v = value < (uint32_t)minimum ? minimum : (value > maximum ? maximum : value);
+
+	return map_to_uint8(v, minimum, maximum);
+}
+
+#if HID_PARSER_INTERP
+// Axis to uint8 handled by hid_interp_axis(): 8 / 16-bit field of matching convert_range() source type.
+static inline bool interp_axis(const HID_SEG* segment)
+{
+	if (segment->inputParam != VALUE_TYPE_UINT8 || !hid_interp_fits(segment->startBit, segment->reportSize))
+		return false;
+
+	const preset_value_type source_type = range_type(segment->logicalMinimum, segment->logicalMaximum);
+
+	if (source_type == VALUE_TYPE_UINT8 || source_type == VALUE_TYPE_INT8)
+		return segment->reportSize == 8;
+
+	if (source_type == VALUE_TYPE_UINT16 || source_type == VALUE_TYPE_INT16)
+		return segment->reportSize == 16;
+
+	return false;
+}
+#endif
+
+void HOT_PATH(processSeg)(HID_SEG* segment, HID_REPORT* report, const uint8_t* data, gamepad_callback_t gamepad_callback)
+{
+	if (segment->inputType == MAP_TYPE_BITFIELD)
+	{
+		const uint16_t endbit = segment->startBit + segment->reportCount;
+		uint8_t key_index = segment->outputControl;
+
+		for (uint16_t cnt = segment->startBit; cnt < endbit; cnt++)
+		{
+			bool pressed = false;
+
+			// find byte
+			const uint8_t* currByte = data + ((cnt) >> 3);
+
+			// find bit
+			if (*currByte & (0x01 << (cnt & 0x07)))
+				pressed = true;
+
+			if (segment->outputChannel == MAP_KEYBOARD)
+			{
+				if (pressed)
+					SetKey(key_index, report);
+			}
+			else if (segment->outputChannel == MAP_MOUSE)
+			{
+				switch (key_index)
+				{
+				case MAP_MOUSE_BUTTON1:
+					MouseSet(0, pressed);
+					break;
+				case MAP_MOUSE_BUTTON2:
+					MouseSet(1, pressed);
+					break;
+				case MAP_MOUSE_BUTTON3:
+					MouseSet(2, pressed);
+					break;
+				case MAP_MOUSE_BUTTON4:
+					MouseSet(3, pressed);
+					break;
+				case MAP_MOUSE_BUTTON5:
+					MouseSet(4, pressed);
+					break;
+				}
+			}
+
+			key_index++;
+		}
+	}
+	else if (segment->inputType) // i.e. not MAP_TYPE_NONE
+	{
+		const bool sign = segment->logicalMinimum < 0;
+
+#if HID_PARSER_INTERP
+		if (segment->inputType == MAP_TYPE_AXIS && segment->outputChannel == MAP_GAMEPAD && interp_axis(segment))
+		{
+			if (gamepad_callback)
+				gamepad_callback(segment->pad, segment->outputControl, hid_interp_axis(data, segment->startBit, segment->reportSize, sign));
+
+			return;
+		}
+
+		const uint32_t value = hid_interp_fits(segment->startBit, segment->reportSize) ?
+			hid_interp_field(data, segment->startBit, segment->reportSize, sign) :
+			extract_field(data, segment->startBit, segment->reportSize, sign);
+#else
+		const uint32_t value = extract_field(data, segment->startBit, segment->reportSize, sign);
+#endif
+
+		bool triggered = false;
+
+		// Received HID value should be re-interpreted depending on Logical Minimum / Logical Maximum and Report Size in USB HID report descriptor.
+		// Example:
+		// Minimum 0xFF (-1), Maximum 0x01 (1), Report Size 0x08: value is signed int8_t in -1..1 range.
+		// Minimum 0x81 (-127), Maximum 0x7F (127), Report Size 0x08: value is signed int8_t in -127..127 range.
+		// Minimum 0x00 (0), Maximum 0xFF (255), Report Size 0x08: value is signed uint8_t in 0..255 range.
+
+		// Note: Logical Minimum/Maximum can describe 16/32-bit ranges but require extended encoding
+		// (0x81 for 16-bit, 0x82 for 32-bit), can be checked with Report Size.
+
+		// Note: InputParam field in JoyPreset user presets is written assuming REPORT_USAGE_X / Y / Z / Rz
+		// are unsigned 8-bit values in 0..255 range.
+		// In practice they can be signed in -1..1 range for example, or 0..12000 / 0..65535 / -32768..32767 range with 16-bit ReportSize, or even 32-bit.
+
+		// Map received value to 0..255 range depending on Logical Minimum / Logical Maximum.
+		// ToDo: only map values with currSeg->InputUsage == REPORT_USAGE_X/Y
+		if (segment->inputType == MAP_TYPE_THRESHOLD_ABOVE)
+		{
+			const uint8_t mapped_value = map_field_to_uint8(value, sign, segment->logicalMinimum, segment->logicalMaximum);
+
+			triggered = (mapped_value > segment->inputParam);
+		}
+		else if (segment->inputType == MAP_TYPE_THRESHOLD_BELOW)
+		{
+			const uint8_t mapped_value = map_field_to_uint8(value, sign, segment->logicalMinimum, segment->logicalMaximum);
+
+			triggered = (mapped_value < segment->inputParam);
+		}
+		else if (segment->inputType == MAP_TYPE_EQUAL)
+		{
+			triggered = (value == segment->inputParam);
+		}
+
+		if (triggered)
+		{
+			if (segment->outputChannel == MAP_KEYBOARD)
+			{
+				SetKey(segment->outputControl, report);
+			}
+
+			if (segment->outputChannel == MAP_GAMEPAD)
+			{
+				if(gamepad_callback)
+					gamepad_callback(segment->pad, segment->outputControl, 1);
+			}
+		}
+		else if (segment->inputType == MAP_TYPE_AXIS)
+		{
+			if (segment->outputChannel == MAP_GAMEPAD)
+			{
+				const uint8_t axis_value = convert_range(value, segment->logicalMinimum, segment->logicalMaximum, (preset_value_type)segment->inputParam);
+
+				if(gamepad_callback)
+					gamepad_callback(segment->pad, segment->outputControl, axis_value);
+			}
+		}
+		else if (segment->inputType == MAP_TYPE_SCALE)
+		{
+			if (segment->outputChannel == MAP_MOUSE)
+			{
+				switch (segment->outputControl)
+				{
+				case MAP_MOUSE_X:
+					MouseMove((int32_t)value, 0, 0);
+					break;
+				case MAP_MOUSE_Y:
+					MouseMove(0, (int32_t)value, 0);
+					break;
+				case MAP_MOUSE_WHEEL:
+					MouseMove(0, 0, (int32_t)value);
+					break;
+				}
+			}
+		}
+		else if (segment->inputType == MAP_TYPE_ARRAY)
+		{
+			if (segment->outputChannel == MAP_KEYBOARD)
+			{
+				if (value)
+					SetKey((uint8_t)value, report);
+			}
+		}
+	}
+}
+
+HID_REPORT* HOT_PATH(find_report_parser)(HID_REPORT* head, uint8_t reportID)
+{
+	while (head)
+	{
+		if (head->reportID == reportID)
+			return head;
+
+		head = (HID_REPORT*)arena_ptr(head->next);
+	}
+
+	return nullptr;
+}
+
+static inline HID_REPORT* find_report(const uint8_t* report)
+{
+	if (g_interface_uses_reports)
+		return find_report_parser((HID_REPORT*)arena_ptr(g_reports), report[0]); // first byte of report will be the report number
+
+	return (HID_REPORT*)arena_ptr(g_reports);
+}
+
+uint8_t HOT_PATH(hid_parser_report_pads)(const uint8_t* report, const uint32_t len)
+{
+	if (!len)
+		return 0;
+
+	HID_REPORT* reportDesc = find_report(report);
+
+	return reportDesc ? reportDesc->pads : 0;
+}
+
+bool HOT_PATH(ParseReport)(const uint8_t* report, const uint32_t len,
+	gamepad_callback_t gamepad_callback, keyboard_callback_t keyboard_callback, mouse_callback_t mouse_callback)
+{
+	if (!len)
+	{
+		TRACE_ERROR(TRACE_EVENT_REPORT_TOO_SHORT, len, 0, 0);
+		return false;
+	}
+
+	HID_REPORT* reportDesc = find_report(report);
+
+	if (reportDesc == nullptr)
+	{
+		TRACE_ERROR(TRACE_EVENT_INVALID_REPORT, report[0], len, 0);
+		return false;
+	}
+
+	if (len < ((reportDesc->length + 7u) >> 3))
+	{
+		TRACE_ERROR(TRACE_EVENT_REPORT_TOO_SHORT, len, reportDesc->length, reportDesc->reportID);
+		return false;
+	}
+
+	HID_SEG* segment = (HID_SEG*)arena_ptr(reportDesc->segments);
+
+	while (segment)
+	{
+		processSeg(segment, reportDesc, report, gamepad_callback);
+		segment = (HID_SEG*)arena_ptr(segment->next);
+	}
+
+	if (keyboard_callback)
+	{
+		keyboard_state* keyboard = &reportDesc->keyboard;
+
+		for (uint8_t byte = 0; byte < KEYBOARD_STATE_SIZE; byte++)
+		{
+			// XOR to see if any bits are different
+			const uint8_t xorred = keyboard->keys[byte] ^ keyboard->old_keys[byte];
+
+			if (xorred)
+			{
+				for (uint8_t bit = 0; bit < 8; bit++)
+				{
+					if (xorred & (1 << bit))
+					{
+						const uint8_t hid_code = (byte << 3) | bit;
+						const bool pressed = keyboard->keys[byte] & (1 << bit);
+
+						keyboard_callback(hid_code, pressed);
+					}
+				}
+			}
+		}
+
+		memcpy(keyboard->old_keys, keyboard->keys, KEYBOARD_STATE_SIZE);
+		memset(keyboard->keys, 0, KEYBOARD_STATE_SIZE);
+	}
+
+	if (mouse_callback)
+	{
+		if (g_mouse.changed)
+		{
+			mouse_callback(g_mouse.dx, g_mouse.dy, g_mouse.dz, g_mouse.buttons);
+
+			g_mouse = {};
+		}
+	}
+
+	return true;
+}
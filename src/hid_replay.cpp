@@ -0,0 +1,253 @@
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <stdint.h>
+#include <stdio.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "hid_parser.h"
+#include "hid_gamecube_mapping.h"
+#include "hid_capture_log.h"
+#include "pad_conditioning.h"
+
+/*
+Host replay of HID captures (src/hid_capture.h) through ParseReportDescriptor() / ParseReport().
+
+Usage:
+	HID_Replay capture.log [--realtime] [--quiet] [--profile index] [--output file] [--expect file]
+
+Reads HIDCAP dump from UART log, parses descriptor of every report interface and decodes reports
+with firmware GameCube mapping and pad profile (canonical_pad.h, default profile 0),
+at maximum speed or with original report timing (--realtime).
+Prints resulting GCReport stream, one line per report:
+	<t us> <dev> <inst> <GCReport bytes hex>
+and decode throughput. With --expect fails if GCReport stream differs from expected stream file.
+
+Like firmware, parser holds single descriptor: interleaved reports of several interfaces reparse descriptor
+on every interface switch. Throughput counts ParseReport() and mapping time only.
+*/
+
+typedef struct replay_options
+{
+	const char* capture = nullptr;
+	bool realtime = false;
+	bool quiet = false;
+	const char* output = nullptr;
+	const char* expect = nullptr;
+	int profile = 0;
+} replay_options;
+
+static canonical_pad g_pad;
+
+static void gamepad_callback(uint8_t pad, uint32_t control_type, uint32_t value)
+{
+	if (pad == 0) // First pad of multi-pad device, adapter Joybus port slot
+		canonical_pad_apply(&g_pad, control_type, value);
+}
+
+static std::string format_gc_report(const hid_capture_log_report& report, const GCReport& gc)
+{
+	char line[64];
+	int length = snprintf(line, sizeof(line), "%u %u %u ", report.timestamp, report.dev_addr, report.instance);
+
+	const uint8_t* bytes = (const uint8_t*)&gc;
+
+	for (size_t i = 0; i < sizeof(GCReport); i++)
+		length += snprintf(line + length, sizeof(line) - length, "%02x", bytes[i]);
+
+	return line;
+}
+
+// Returns count of mismatched lines, -1 if expected stream can't be read.
+static int compare_stream(const char* path, const std::vector<std::string>& stream)
+{
+	FILE* file = fopen(path, "r");
+
+	if (!file)
+	{
+		fprintf(stderr, "Can't read expected stream %s\n", path);
+		return -1;
+	}
+
+	std::vector<std::string> expected;
+	char line[256];
+
+	while (fgets(line, sizeof(line), file))
+	{
+		line[strcspn(line, "\r\n")] = 0;
+
+		if (line[0] && line[0] != '#')
+			expected.push_back(line);
+	}
+
+	fclose(file);
+
+	int mismatches = 0;
+
+	for (size_t i = 0; i < stream.size() || i < expected.size(); i++)
+	{
+		const char* actual_line = i < stream.size() ? stream[i].c_str() : "<missing>";
+		const char* expected_line = i < expected.size() ? expected[i].c_str() : "<missing>";
+
+		if (strcmp(actual_line, expected_line))
+		{
+			if (mismatches < 10)
+				fprintf(stderr, "MISMATCH report %zu: %s, expected %s\n", i, actual_line, expected_line);
+
+			mismatches++;
+		}
+	}
+
+	return mismatches;
+}
+
+static bool parse_options(int argc, char** argv, replay_options& options)
+{
+	for (int i = 1; i < argc; i++)
+	{
+		const char* arg = argv[i];
+		const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+
+		if (!strcmp(arg, "--realtime"))
+		{
+			options.realtime = true;
+			continue;
+		}
+
+		if (!strcmp(arg, "--quiet"))
+		{
+			options.quiet = true;
+			continue;
+		}
+
+		if (arg[0] != '-')
+		{
+			if (options.capture)
+				return false;
+
+			options.capture = arg;
+			continue;
+		}
+
+		if (!value)
+			return false;
+
+		if (!strcmp(arg, "--output"))
+			options.output = value;
+		else if (!strcmp(arg, "--expect"))
+			options.expect = value;
+		else if (!strcmp(arg, "--profile"))
+			options.profile = atoi(value);
+		else
+			return false;
+
+		i++;
+	}
+
+	return options.capture != nullptr;
+}
+
+int main(int argc, char** argv)
+{
+	replay_options options;
+
+	if (!parse_options(argc, argv, options))
+	{
+		fprintf(stderr, "Usage: %s capture.log [--realtime] [--quiet] [--profile index] [--output file] [--expect file]\n", argv[0]);
+		return 2;
+	}
+
+	pad_profiles_init();
+
+	if (!pad_profile_select((uint8_t)options.profile))
+	{
+		fprintf(stderr, "No profile %d\n", options.profile);
+		return 2;
+	}
+
+	std::vector<hid_capture_log_descriptor> descriptors;
+	std::vector<hid_capture_log_report> reports;
+
+	if (!hid_capture_log_read(options.capture, descriptors, reports))
+		return 1;
+
+	std::vector<std::string> stream;
+	stream.reserve(reports.size());
+
+	const hid_capture_log_descriptor* parsed = nullptr;
+	uint32_t decoded = 0, skipped = 0, descriptor_parses = 0;
+	double decode_ns = 0;
+
+	const auto replay_start = std::chrono::steady_clock::now();
+	const uint32_t first_timestamp = reports.empty() ? 0 : reports[0].timestamp;
+
+	for (const hid_capture_log_report& report : reports)
+	{
+		if (options.realtime)
+			std::this_thread::sleep_until(replay_start + std::chrono::microseconds(report.timestamp - first_timestamp));
+
+		const hid_capture_log_descriptor* descriptor = hid_capture_log_find_descriptor(descriptors, report.dev_addr, report.instance);
+
+		if (descriptor && descriptor != parsed)
+		{
+			parsed = ParseReportDescriptor(descriptor->data.data(), (uint16_t)descriptor->data.size(), hid_to_gamecube_mapping) ? descriptor : nullptr;
+			descriptor_parses++;
+			pad_conditioning_slot_reset(0); // Mount of captured device: stick centre is calibrated from its first rest report
+		}
+
+		if (!descriptor || descriptor != parsed)
+		{
+			skipped++; // No descriptor captured or not a gamepad
+			continue;
+		}
+
+		const auto start = std::chrono::steady_clock::now();
+
+		g_pad = neutralCanonicalPad;
+		ParseReport(report.data.data(), (uint32_t)report.data.size(), gamepad_callback);
+		const GCReport gc = pad_profile_report(&g_pad, PAD_SOURCE_HID);
+
+		decode_ns += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+		decoded++;
+
+		stream.push_back(format_gc_report(report, gc));
+	}
+
+	FILE* output = options.output ? fopen(options.output, "w") : (options.quiet ? nullptr : stdout);
+
+	if (options.output && !output)
+	{
+		fprintf(stderr, "Can't write %s\n", options.output);
+		return 1;
+	}
+
+	if (output)
+	{
+		for (const std::string& line : stream)
+			fprintf(output, "%s\n", line.c_str());
+
+		if (output != stdout)
+			fclose(output);
+	}
+
+	fprintf(stderr, "%zu descriptors, %zu reports: %u decoded, %u skipped, %u descriptor parses\n",
+		descriptors.size(), reports.size(), decoded, skipped, descriptor_parses);
+
+	if (decoded)
+		fprintf(stderr, "Decode: %.1f ns/report, %.0f reports/s\n", decode_ns / decoded, decoded * 1e9 / decode_ns);
+
+	if (options.expect)
+	{
+		const int mismatches = compare_stream(options.expect, stream);
+
+		if (mismatches)
+		{
+			fprintf(stderr, "%d GCReport stream mismatches against %s\n", mismatches < 0 ? 0 : mismatches, options.expect);
+			return 1;
+		}
+	}
+
+	return 0;
+}
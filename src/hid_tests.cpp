@@ -1,351 +1,814 @@
-#include <cassert>
-#include <stdio.h>
-
-#include "hid_dumps.h"
-#include "hid_parser.h"
-
-#include "hid_gamecube_mapping.h"
-
-typedef struct generic_gamepad_t
-{
-	bool start;
-	bool u, d, l, r;
-	bool a, b, x, y;
-	bool l1, r1, l2, r2;
-	uint8_t al, ar;
-	uint8_t lx, ly, rx, ry;
-} generic_gamepad;
-
-static generic_gamepad g_gamepad;
-
-typedef struct generic_mouse_t
-{
-	uint16_t x, y;
-	int16_t z;
-	uint8_t buttons;
-} generic_mouse;
-
-static generic_mouse g_mouse;
-
-typedef struct generic_keyboard_t
-{
-	bool keys[256];
-} generic_keyboard;
-
-static generic_keyboard g_keyboard;
-
-static void keyboard_callback(uint8_t hid_code, bool state)
-{
-	g_keyboard.keys[hid_code] = state;
-}
-
-static void mouse_callback(int16_t dx, int16_t dy, int16_t dz, uint8_t buttons)
-{
-	g_mouse.x += dx;
-	g_mouse.y += dy;
-	g_mouse.z += dz;
-
-	g_mouse.buttons = buttons;
-}
-
-static void gamepad_callback(uint32_t control_type, uint32_t value)
-{
-	const GamecubeMappings mapping = (GamecubeMappings)control_type;
-	printf("gamepad_callback: type=%d, value=%d\n", control_type, value);
-
-	if (mapping == MAP_GAMECUBE_BUTTON_A)
-		g_gamepad.a = true;
-	else if(mapping == MAP_GAMECUBE_BUTTON_B)
-		g_gamepad.b = true;
-	else if(mapping == MAP_GAMECUBE_BUTTON_X)
-		g_gamepad.x = true;
-	else if(mapping == MAP_GAMECUBE_BUTTON_Y)
-		g_gamepad.y = true;
-	else if(mapping == MAP_GAMECUBE_BUTTON_START)
-		g_gamepad.start = true;
-	else if(mapping == MAP_GAMECUBE_R)
-		g_gamepad.r = true;
-	else if(mapping == MAP_GAMECUBE_L)
-		g_gamepad.l = true;
-	else if(mapping == MAP_GAMECUBE_D)
-		g_gamepad.d = true;
-	else if(mapping == MAP_GAMECUBE_U)
-		g_gamepad.u = true;
-	else if(mapping == MAP_GAMECUBE_BUTTON_Z)
-		g_gamepad.r1 = true;
-	else if(mapping == MAP_GAMECUBE_BUTTON_R)
-		g_gamepad.r2 = true;
-	else if(mapping == MAP_GAMECUBE_BUTTON_L)
-		g_gamepad.l2 = true;
-	else if(mapping == MAP_GAMECUBE_AXIS_X)
-		g_gamepad.lx = value;
-	else if(mapping == MAP_GAMECUBE_AXIS_Y)
-		g_gamepad.ly = value;
-	else if(mapping == MAP_GAMECUBE_AXIS_CX)
-		g_gamepad.rx = value;
-	else if(mapping == MAP_GAMECUBE_AXIS_CY)
-		g_gamepad.ry = value;
-	else if(mapping == MAP_GAMECUBE_AXIS_L)
-		g_gamepad.al = value;
-	else if(mapping == MAP_GAMECUBE_AXIS_R)
-		g_gamepad.ar = value;
-}
-
-#ifdef WIN32
-int main()
-#else
-int tests_main()
-#endif
-{
-	// uint16 -> uint16 (passthrough)
-	assert(0x0000 == convert_range(0x0000, 0x0000, 0xFFFF, VALUE_TYPE_UINT16));
-	assert(0x4000 == convert_range(0x4000, 0x0000, 0xFFFF, VALUE_TYPE_UINT16));
-	assert(0x8000 == convert_range(0x8000, 0x0000, 0xFFFF, VALUE_TYPE_UINT16));
-	assert(0xC000 == convert_range(0xC000, 0x0000, 0xFFFF, VALUE_TYPE_UINT16));
-	assert(0xFFFF == convert_range(0xFFFF, 0x0000, 0xFFFF, VALUE_TYPE_UINT16));
-
-	// int16 -> int16 (passthrough)
-	assert(-32768 == convert_range(-32768, INT16_MIN, INT16_MAX, VALUE_TYPE_INT16));
-	assert(-16384 == convert_range(-16384, INT16_MIN, INT16_MAX, VALUE_TYPE_INT16));
-	assert(     0 == convert_range(     0, INT16_MIN, INT16_MAX, VALUE_TYPE_INT16));
-	assert( 16384 == convert_range( 16384, INT16_MIN, INT16_MAX, VALUE_TYPE_INT16));
-	assert( 32767 == convert_range( 32767, INT16_MIN, INT16_MAX, VALUE_TYPE_INT16));
-
-	// uint8 -> uint8 (passthrough)
-	assert(0x00 == convert_range(0x00, 0, UINT8_MAX, VALUE_TYPE_UINT8));
-	assert(0x40 == convert_range(0x40, 0, UINT8_MAX, VALUE_TYPE_UINT8));
-	assert(0x80 == convert_range(0x80, 0, UINT8_MAX, VALUE_TYPE_UINT8));
-	assert(0xC0 == convert_range(0xC0, 0, UINT8_MAX, VALUE_TYPE_UINT8));
-	assert(0xFF == convert_range(0xFF, 0, UINT8_MAX, VALUE_TYPE_UINT8));
-
-	// int8 -> int8 (passthrough)
-	assert(-128 == convert_range(-128, INT8_MIN, INT8_MAX, VALUE_TYPE_INT8));
-	assert( -64 == convert_range( -64, INT8_MIN, INT8_MAX, VALUE_TYPE_INT8));
-	assert(   0 == convert_range(   0, INT8_MIN, INT8_MAX, VALUE_TYPE_INT8));
-	assert(  64 == convert_range(  64, INT8_MIN, INT8_MAX, VALUE_TYPE_INT8));
-	assert( 127 == convert_range( 127, INT8_MIN, INT8_MAX, VALUE_TYPE_INT8));
-
-	// int8 -> uint8
-	assert(0x00 == convert_range(-128, INT8_MIN, INT8_MAX, VALUE_TYPE_UINT8));
-	assert(0x40 == convert_range( -64, INT8_MIN, INT8_MAX, VALUE_TYPE_UINT8));
-	assert(0x80 == convert_range(   0, INT8_MIN, INT8_MAX, VALUE_TYPE_UINT8));
-	assert(0xC0 == convert_range(  64, INT8_MIN, INT8_MAX, VALUE_TYPE_UINT8));
-	assert(0xFF == convert_range( 127, INT8_MIN, INT8_MAX, VALUE_TYPE_UINT8));
-
-	// uint8 -> int8
-	assert(-128 == convert_range(0x00, 0, UINT8_MAX, VALUE_TYPE_INT8));
-	assert( -64 == convert_range(0x40, 0, UINT8_MAX, VALUE_TYPE_INT8));
-	assert(   0 == convert_range(0x80, 0, UINT8_MAX, VALUE_TYPE_INT8));
-	assert(  64 == convert_range(0xC0, 0, UINT8_MAX, VALUE_TYPE_INT8));
-	assert( 127 == convert_range(0xFF, 0, UINT8_MAX, VALUE_TYPE_INT8));
-
-	// uint8 -> uint16 (bit shift)
-	assert(0x0000 == convert_range(0x00, 0, UINT8_MAX, VALUE_TYPE_UINT16));
-	assert(0x4000 == convert_range(0x40, 0, UINT8_MAX, VALUE_TYPE_UINT16));
-	assert(0x8000 == convert_range(0x80, 0, UINT8_MAX, VALUE_TYPE_UINT16));
-	assert(0xC000 == convert_range(0xC0, 0, UINT8_MAX, VALUE_TYPE_UINT16));
-	assert(0xFF00 == convert_range(0xFF, 0, UINT8_MAX, VALUE_TYPE_UINT16));
-
-	// uint8 -> int16 (bit shift)
-	assert(-32768 == convert_range(0x00, 0, UINT8_MAX, VALUE_TYPE_INT16));
-	assert(-16384 == convert_range(0x40, 0, UINT8_MAX, VALUE_TYPE_INT16));
-	assert(     0 == convert_range(0x80, 0, UINT8_MAX, VALUE_TYPE_INT16));
-	assert( 16384 == convert_range(0xC0, 0, UINT8_MAX, VALUE_TYPE_INT16));
-	assert(0x7F00 == convert_range(0xFF, 0, UINT8_MAX, VALUE_TYPE_INT16));
-
-	// int8 -> uint16
-	assert(0x0000 == convert_range(-128, INT8_MIN, INT8_MAX, VALUE_TYPE_UINT16));
-	assert(0x4000 == convert_range( -64, INT8_MIN, INT8_MAX, VALUE_TYPE_UINT16));
-	assert(0x8000 == convert_range(   0, INT8_MIN, INT8_MAX, VALUE_TYPE_UINT16));
-	assert(0xC000 == convert_range(  64, INT8_MIN, INT8_MAX, VALUE_TYPE_UINT16));
-	assert(0xFF00 == convert_range( 127, INT8_MIN, INT8_MAX, VALUE_TYPE_UINT16));
-
-	// int8->int16 (bit shift)
-	assert(-32768 == convert_range(-128, INT8_MIN, INT8_MAX, VALUE_TYPE_INT16));
-	assert(-16384 == convert_range( -64, INT8_MIN, INT8_MAX, VALUE_TYPE_INT16));
-	assert(     0 == convert_range(   0, INT8_MIN, INT8_MAX, VALUE_TYPE_INT16));
-	assert( 16384 == convert_range(  64, INT8_MIN, INT8_MAX, VALUE_TYPE_INT16));
-	assert(0x7F00 == convert_range( 127, INT8_MIN, INT8_MAX, VALUE_TYPE_INT16));
-
-	// uint16 -> uint8 (bit shift >>)
-	assert(0x00 == convert_range(0x0000, 0x0000, UINT16_MAX, VALUE_TYPE_UINT8));
-	assert(0x40 == convert_range(0x4000, 0x0000, UINT16_MAX, VALUE_TYPE_UINT8));
-	assert(0x80 == convert_range(0x8000, 0x0000, UINT16_MAX, VALUE_TYPE_UINT8));
-	assert(0xC0 == convert_range(0xC000, 0x0000, UINT16_MAX, VALUE_TYPE_UINT8));
-	assert(0xFF == convert_range(0xFFFF, 0x0000, UINT16_MAX, VALUE_TYPE_UINT8));
-
-	// uint16 -> int8
-	assert(-128 == convert_range(0x0000, 0x0000, UINT16_MAX, VALUE_TYPE_INT8));
-	assert( -64 == convert_range(0x4000, 0x0000, UINT16_MAX, VALUE_TYPE_INT8));
-	assert(   0 == convert_range(0x8000, 0x0000, UINT16_MAX, VALUE_TYPE_INT8));
-	assert(  64 == convert_range(0xC000, 0x0000, UINT16_MAX, VALUE_TYPE_INT8));
-	assert( 127 == convert_range(0xFFFF, 0x0000, UINT16_MAX, VALUE_TYPE_INT8));
-
-	// int16 -> uint8
-	assert(0x00 == convert_range(-32768, INT16_MIN, INT16_MAX, VALUE_TYPE_UINT8));
-	assert(0x40 == convert_range(-16384, INT16_MIN, INT16_MAX, VALUE_TYPE_UINT8));
-	assert(0x80 == convert_range(     0, INT16_MIN, INT16_MAX, VALUE_TYPE_UINT8));
-	assert(0xC0 == convert_range( 16384, INT16_MIN, INT16_MAX, VALUE_TYPE_UINT8));
-	assert(0xFF == convert_range( 32767, INT16_MIN, INT16_MAX, VALUE_TYPE_UINT8));
-
-	// int16 -> int8
-	assert(-128 == convert_range(-32768, INT16_MIN, INT16_MAX, VALUE_TYPE_INT8));
-	assert( -64 == convert_range(-16384, INT16_MIN, INT16_MAX, VALUE_TYPE_INT8));
-	assert(   0 == convert_range(     0, INT16_MIN, INT16_MAX, VALUE_TYPE_INT8));
-	assert(  64 == convert_range( 16384, INT16_MIN, INT16_MAX, VALUE_TYPE_INT8));
-	assert( 127 == convert_range( 32767, INT16_MIN, INT16_MAX, VALUE_TYPE_INT8));
-
-	// uint16 -> int16
-	assert(-32768 == convert_range(0x0000, 0x0000, UINT16_MAX, VALUE_TYPE_INT16));
-	assert(-16384 == convert_range(0x4000, 0x0000, UINT16_MAX, VALUE_TYPE_INT16));
-	assert(     0 == convert_range(0x8000, 0x0000, UINT16_MAX, VALUE_TYPE_INT16));
-	assert( 16384 == convert_range(0xC000, 0x0000, UINT16_MAX, VALUE_TYPE_INT16));
-	assert( 32767 == convert_range(0xFFFF, 0x0000, UINT16_MAX, VALUE_TYPE_INT16));
-
-	// int16 -> uint16
-	assert(0x0000 == convert_range(-32768, INT16_MIN, INT16_MAX, VALUE_TYPE_UINT16));
-	assert(0x4000 == convert_range(-16384, INT16_MIN, INT16_MAX, VALUE_TYPE_UINT16));
-	assert(0x8000 == convert_range(     0, INT16_MIN, INT16_MAX, VALUE_TYPE_UINT16));
-	assert(0xC000 == convert_range( 16384, INT16_MIN, INT16_MAX, VALUE_TYPE_UINT16));
-	assert(0xFFFF == convert_range( 32767, INT16_MIN, INT16_MAX, VALUE_TYPE_UINT16));
-
-	assert(0x80 == map_to_uint8((int32_t)   0, INT8_MIN, INT8_MAX));
-	assert(0xC0 == map_to_uint8((int32_t)  64, INT8_MIN, INT8_MAX));
-	assert(0x40 == map_to_uint8((int32_t) -64, INT8_MIN, INT8_MAX));
-	assert(0x00 == map_to_uint8((int32_t)-128, INT8_MIN, INT8_MAX));
-	assert(0xFF == map_to_uint8((int32_t) 127, INT8_MIN, INT8_MAX));
-
-	assert(0x80 == map_to_uint8((int32_t)     0, INT16_MIN, INT16_MAX));
-	assert(0xC0 == map_to_uint8((int32_t) 16384 + 64, INT16_MIN, INT16_MAX));
-	assert(0x40 == map_to_uint8((int32_t)-16384, INT16_MIN, INT16_MAX));
-	assert(0x00 == map_to_uint8((int32_t)-32768, INT16_MIN, INT16_MAX));
-	assert(0xFF == map_to_uint8((int32_t) 32767, INT16_MIN, INT16_MAX));
-
-	assert(0x80 == map_to_uint8(     0, INT16_MIN, INT16_MAX));
-	assert(0xC0 == map_to_uint8( 16384 + 64, INT16_MIN, INT16_MAX));
-	assert(0x40 == map_to_uint8(-16384, INT16_MIN, INT16_MAX));
-	assert(0x00 == map_to_uint8(-32768, INT16_MIN, INT16_MAX));
-	assert(0xFF == map_to_uint8( 32767, INT16_MIN, INT16_MAX));
-
-	// Sony DualShock 4
-	ParseReportDescriptor(dualshock4_hid_report_descriptor, sizeof(dualshock4_hid_report_descriptor), hid_to_gamecube_mapping);
-
-	ParseReportDescriptor(my_dualshock_4_hid_report_descriptor, sizeof(my_dualshock_4_hid_report_descriptor), hid_to_gamecube_mapping);
-	g_gamepad = {};
-	ParseReport(my_dualshock_4_hid_report_x_o_pressed, sizeof(my_dualshock_4_hid_report_x_o_pressed), gamepad_callback);
-
-	assert(g_gamepad.a);
-	assert(g_gamepad.b);
-	assert(g_gamepad.al == 0x00);
-	assert(g_gamepad.ar == 0x00);
-	assert(g_gamepad.lx == 0x7e);
-	assert(g_gamepad.ly == 0x83);
-	assert(g_gamepad.rx == 0x7e);
-	assert(g_gamepad.ry == 0x7f);
-
-	g_gamepad = {};
-	ParseReport(my_dualshock_4_hid_report_u_x_pressed, sizeof(my_dualshock_4_hid_report_u_x_pressed), gamepad_callback);
-	assert(g_gamepad.u);
-	assert(g_gamepad.a);
-
-	g_gamepad = {};
-	ParseReport(my_dualshock_4_hid_report_options_r2_max_pressed, sizeof(my_dualshock_4_hid_report_options_r2_max_pressed), gamepad_callback);
-	assert(g_gamepad.start);
-	assert(g_gamepad.r2);
-	assert(g_gamepad.ar == 0xFF);
-
-	g_gamepad = {};
-	ParseReport(my_dualshock_4_hid_report_lx_rx_min, sizeof(my_dualshock_4_hid_report_lx_rx_min), gamepad_callback);
-	assert(g_gamepad.lx == 0x00);
-	assert(g_gamepad.rx == 0x00);
-
-	ParseReportDescriptor(dualshock_4_hid_report_descriptor_gimx_fr_wiki, sizeof(dualshock_4_hid_report_descriptor_gimx_fr_wiki), hid_to_gamecube_mapping);
-	g_gamepad = {};
-	ParseReport(dualshock_4_hid_report_gimx_fr_wiki, sizeof(dualshock_4_hid_report_gimx_fr_wiki), gamepad_callback);
-
-	assert(g_gamepad.al == 0x00);
-	assert(g_gamepad.ar == 0x00);
-	assert(g_gamepad.lx == 0x81);
-	assert(g_gamepad.ly == 0x80);
-	assert(g_gamepad.rx == 0x83);
-	assert(g_gamepad.ry == 0x7a);
-
-	// Sony DualShock 3
-	ParseReportDescriptor(dualshock_3_hid_report_descriptor, sizeof(dualshock_3_hid_report_descriptor), hid_to_gamecube_mapping);
-	g_gamepad = {};
-
-	// Sony PS5 DualSence
-	ParseReportDescriptor(dualsence_hid_report_descriptor, sizeof(dualsence_hid_report_descriptor), hid_to_gamecube_mapping);
-	g_gamepad = {};
-	ParseReport(dualsence_hid_report_idle, sizeof(dualsence_hid_report_idle), gamepad_callback);
-
-	g_gamepad = {};
-	ParseReport(dualsence_hid_report_x_o_pressed, sizeof(dualsence_hid_report_x_o_pressed), gamepad_callback);
-	assert(g_gamepad.a);
-	assert(g_gamepad.b);
-
-	g_gamepad = {};
-	ParseReport(dualsence_hid_report_u_x_pressed, sizeof(dualsence_hid_report_u_x_pressed), gamepad_callback);
-	assert(g_gamepad.u);
-	assert(g_gamepad.a);
-
-	g_gamepad = {};
-	ParseReport(dualsence_hid_report_options_r2_max_pressed, sizeof(dualsence_hid_report_options_r2_max_pressed), gamepad_callback);
-	assert(g_gamepad.start);
-	assert(g_gamepad.r2);
-	assert(g_gamepad.ar == 0xFF);
-
-	g_gamepad = {};
-	ParseReport(dualsence_hid_report_lx_rx_min, sizeof(dualsence_hid_report_lx_rx_min), gamepad_callback);
-	assert(g_gamepad.lx == 0x08);
-	assert(g_gamepad.rx == 0x01);
-
-	// HID keyboard
-	ParseReportDescriptor(keyboard_report_descriptor, sizeof(keyboard_report_descriptor), nullptr);
-	g_keyboard = {};
-
-	ParseReport(keyboard_report_a_pressed, sizeof(keyboard_report_a_pressed), nullptr, keyboard_callback);
-	assert(g_keyboard.keys[0x04] == true);
-
-	ParseReport(keyboard_report_none_pressed, sizeof(keyboard_report_none_pressed), nullptr, keyboard_callback);
-	assert(g_keyboard.keys[0x04] == false);
-
-	// HID mouse
-	ParseReportDescriptor(mouse_report_descriptor, sizeof(mouse_report_descriptor), nullptr);
-	g_mouse = {};
-
-	ParseReport(mouse_report_1, sizeof(mouse_report_1), nullptr, nullptr, mouse_callback);
-	assert(g_mouse.buttons == 0x00);
-	assert(g_mouse.x == g_mouse.y == g_mouse.z == 0x0000);
-
-	ParseReport(mouse_report_2, sizeof(mouse_report_2), nullptr, nullptr, mouse_callback);
-	assert(g_mouse.buttons & 0x01);
-
-	ParseReport(mouse_report_3, sizeof(mouse_report_3), nullptr, nullptr, mouse_callback);
-	assert(g_mouse.buttons & 0x02);
-
-	ParseReport(mouse_report_4, sizeof(mouse_report_4), nullptr, nullptr, mouse_callback);
-	assert(g_mouse.buttons == 0x00);
-	assert(g_mouse.z == -1);
-
-	// HID gamepad to keyboard mapping
-	const uint8_t HID_KEY_A = 0x04;
-
-	const JoyPreset gamepad_to_keyboard_mapping[] =
-	{
-		// Map gamepad button 2 to keyboard A key
-		{ 1, REPORT_USAGE_PAGE_BUTTON, 2, MAP_KEYBOARD, HID_KEY_A, MAP_TYPE_THRESHOLD_ABOVE, 0 },
-		// null record to mark end
-		{ 0, 0, 0, 0, 0, 0, 0 }
-	};
-
-	ParseReportDescriptor(my_dualshock_4_hid_report_descriptor, sizeof(my_dualshock_4_hid_report_descriptor), gamepad_to_keyboard_mapping);
-
-	ParseReport(my_dualshock_4_hid_report_u_x_pressed, sizeof(my_dualshock_4_hid_report_u_x_pressed), gamepad_callback, keyboard_callback);
-	assert(g_keyboard.keys[HID_KEY_A] == true);
-
-	ParseReport(my_dualshock_4_hid_report_idle, sizeof(my_dualshock_4_hid_report_idle), gamepad_callback, keyboard_callback);
-	assert(g_keyboard.keys[HID_KEY_A] == false);
-
-	return 0;
+﻿#include <cassert>
+#include <cstring>
+#include <stdio.h>
+
+#include "hid_dumps.h"
+#include "hid_parser.h"
+
+#include "hid_gamecube_mapping.h"
+
+typedef struct generic_gamepad_t
+{
+	bool start;
+	bool u, d, l, r;
+	bool a, b, x, y;
+	bool l1, r1, l2, r2;
+	uint8_t al, ar;
+	uint8_t lx, ly, rx, ry;
+} generic_gamepad;
+
+static generic_gamepad g_gamepad;
+
+typedef struct generic_mouse_t
+{
+	uint16_t x, y;
+	int16_t z;
+	uint8_t buttons;
+} generic_mouse;
+
+static generic_mouse g_mouse;
+
+typedef struct generic_keyboard_t
+{
+	bool keys[256];
+} generic_keyboard;
+
+static generic_keyboard g_keyboard;
+
+static void keyboard_callback(uint8_t hid_code, bool state)
+{
+	g_keyboard.keys[hid_code] = state;
+}
+
+static void mouse_callback(int16_t dx, int16_t dy, int16_t dz, uint8_t buttons)
+{
+	g_mouse.x += dx;
+	g_mouse.y += dy;
+	g_mouse.z += dz;
+
+	g_mouse.buttons = buttons;
+}
+
+static void gamepad_callback(uint8_t pad, uint32_t control_type, uint32_t value)
+{
+	const PadControls control = (PadControls)control_type;
+	printf("gamepad_callback: pad=%d, type=%d, value=%d\n", pad, control_type, value);
+
+	if (control == PAD_BUTTON_SOUTH)
+		g_gamepad.a = true;
+	else if(control == PAD_BUTTON_EAST)
+		g_gamepad.b = true;
+	else if(control == PAD_BUTTON_WEST)
+		g_gamepad.x = true;
+	else if(control == PAD_BUTTON_NORTH)
+		g_gamepad.y = true;
+	else if(control == PAD_BUTTON_START)
+		g_gamepad.start = true;
+	else if(control == PAD_BUTTON_RIGHT)
+		g_gamepad.r = true;
+	else if(control == PAD_BUTTON_LEFT)
+		g_gamepad.l = true;
+	else if(control == PAD_BUTTON_DOWN)
+		g_gamepad.d = true;
+	else if(control == PAD_BUTTON_UP)
+		g_gamepad.u = true;
+	else if(control == PAD_BUTTON_L1)
+		g_gamepad.l1 = true;
+	else if(control == PAD_BUTTON_R1)
+		g_gamepad.r1 = true;
+	else if(control == PAD_BUTTON_R2)
+		g_gamepad.r2 = true;
+	else if(control == PAD_BUTTON_L2)
+		g_gamepad.l2 = true;
+	else if(control == PAD_AXIS_LX)
+		g_gamepad.lx = value;
+	else if(control == PAD_AXIS_LY)
+		g_gamepad.ly = value;
+	else if(control == PAD_AXIS_RX)
+		g_gamepad.rx = value;
+	else if(control == PAD_AXIS_RY)
+		g_gamepad.ry = value;
+	else if(control == PAD_AXIS_LT)
+		g_gamepad.al = value;
+	else if(control == PAD_AXIS_RT)
+		g_gamepad.ar = value;
+}
+
+#if defined(WIN32) || defined(HID_PARSER_TESTS_MAIN)
+static canonical_pad g_multi_pads[2];
+
+static void multi_pad_callback(uint8_t pad, uint32_t control_type, uint32_t value)
+{
+	assert(pad < 2);
+	canonical_pad_apply(&g_multi_pads[pad], control_type, value);
+}
+
+// Two pads adapter: gamepad application collection with Report ID per pad, 8 buttons and X axis each
+static const uint8_t two_pads_hid_report_descriptor[] =
+{
+	0x05, 0x01, // Usage Page (Generic Desktop)
+	0x09, 0x05, // Usage (Game Pad)
+	0xA1, 0x01, // Collection (Application)
+	0x85, 0x01, //   Report ID (1)
+	0x05, 0x09, //   Usage Page (Button)
+	0x19, 0x01, //   Usage Minimum (1)
+	0x29, 0x08, //   Usage Maximum (8)
+	0x15, 0x00, //   Logical Minimum (0)
+	0x25, 0x01, //   Logical Maximum (1)
+	0x75, 0x01, //   Report Size (1)
+	0x95, 0x08, //   Report Count (8)
+	0x81, 0x02, //   Input (Data, Variable, Absolute)
+	0x05, 0x01, //   Usage Page (Generic Desktop)
+	0x09, 0x30, //   Usage (X)
+	0x26, 0xFF, 0x00, // Logical Maximum (255)
+	0x75, 0x08, //   Report Size (8)
+	0x95, 0x01, //   Report Count (1)
+	0x81, 0x02, //   Input (Data, Variable, Absolute)
+	0xC0,       // End Collection
+	0x09, 0x05, // Usage (Game Pad)
+	0xA1, 0x01, // Collection (Application)
+	0x85, 0x02, //   Report ID (2)
+	0x05, 0x09, //   Usage Page (Button)
+	0x19, 0x01, //   Usage Minimum (1)
+	0x29, 0x08, //   Usage Maximum (8)
+	0x25, 0x01, //   Logical Maximum (1)
+	0x75, 0x01, //   Report Size (1)
+	0x95, 0x08, //   Report Count (8)
+	0x81, 0x02, //   Input (Data, Variable, Absolute)
+	0x05, 0x01, //   Usage Page (Generic Desktop)
+	0x09, 0x30, //   Usage (X)
+	0x26, 0xFF, 0x00, // Logical Maximum (255)
+	0x75, 0x08, //   Report Size (8)
+	0x95, 0x01, //   Report Count (1)
+	0x81, 0x02, //   Input (Data, Variable, Absolute)
+	0xC0        // End Collection
+};
+
+int main()
+#else
+int tests_main()
+#endif
+{
+	// uint16 -> uint16 (passthrough)
+	assert(0x0000 == convert_range(0x0000, 0x0000, 0xFFFF, VALUE_TYPE_UINT16));
+	assert(0x4000 == convert_range(0x4000, 0x0000, 0xFFFF, VALUE_TYPE_UINT16));
+	assert(0x8000 == convert_range(0x8000, 0x0000, 0xFFFF, VALUE_TYPE_UINT16));
+	assert(0xC000 == convert_range(0xC000, 0x0000, 0xFFFF, VALUE_TYPE_UINT16));
+	assert(0xFFFF == convert_range(0xFFFF, 0x0000, 0xFFFF, VALUE_TYPE_UINT16));
+
+	// int16 -> int16 (passthrough)
+	assert(-32768 == convert_range(-32768, INT16_MIN, INT16_MAX, VALUE_TYPE_INT16));
+	assert(-16384 == convert_range(-16384, INT16_MIN, INT16_MAX, VALUE_TYPE_INT16));
+	assert(     0 == convert_range(     0, INT16_MIN, INT16_MAX, VALUE_TYPE_INT16));
+	assert( 16384 == convert_range( 16384, INT16_MIN, INT16_MAX, VALUE_TYPE_INT16));
+	assert( 32767 == convert_range( 32767, INT16_MIN, INT16_MAX, VALUE_TYPE_INT16));
+
+	// uint8 -> uint8 (passthrough)
+	assert(0x00 == convert_range(0x00, 0, UINT8_MAX, VALUE_TYPE_UINT8));
+	assert(0x40 == convert_range(0x40, 0, UINT8_MAX, VALUE_TYPE_UINT8));
+	assert(0x80 == convert_range(0x80, 0, UINT8_MAX, VALUE_TYPE_UINT8));
+	assert(0xC0 == convert_range(0xC0, 0, UINT8_MAX, VALUE_TYPE_UINT8));
+	assert(0xFF == convert_range(0xFF, 0, UINT8_MAX, VALUE_TYPE_UINT8));
+
+	// int8 -> int8 (passthrough)
+	assert(-128 == convert_range(-128, INT8_MIN, INT8_MAX, VALUE_TYPE_INT8));
+	assert( -64 == convert_range( -64, INT8_MIN, INT8_MAX, VALUE_TYPE_INT8));
+	assert(   0 == convert_range(   0, INT8_MIN, INT8_MAX, VALUE_TYPE_INT8));
+	assert(  64 == convert_range(  64, INT8_MIN, INT8_MAX, VALUE_TYPE_INT8));
+	assert( 127 == convert_range( 127, INT8_MIN, INT8_MAX, VALUE_TYPE_INT8));
+
+	// int8 -> uint8
+	assert(0x00 == convert_range(-128, INT8_MIN, INT8_MAX, VALUE_TYPE_UINT8));
+	assert(0x40 == convert_range( -64, INT8_MIN, INT8_MAX, VALUE_TYPE_UINT8));
+	assert(0x80 == convert_range(   0, INT8_MIN, INT8_MAX, VALUE_TYPE_UINT8));
+	assert(0xC0 == convert_range(  64, INT8_MIN, INT8_MAX, VALUE_TYPE_UINT8));
+	assert(0xFF == convert_range( 127, INT8_MIN, INT8_MAX, VALUE_TYPE_UINT8));
+
+	// uint8 -> int8
+	assert(-128 == convert_range(0x00, 0, UINT8_MAX, VALUE_TYPE_INT8));
+	assert( -64 == convert_range(0x40, 0, UINT8_MAX, VALUE_TYPE_INT8));
+	assert(   0 == convert_range(0x80, 0, UINT8_MAX, VALUE_TYPE_INT8));
+	assert(  64 == convert_range(0xC0, 0, UINT8_MAX, VALUE_TYPE_INT8));
+	assert( 127 == convert_range(0xFF, 0, UINT8_MAX, VALUE_TYPE_INT8));
+
+	// uint8 -> uint16 (bit shift)
+	assert(0x0000 == convert_range(0x00, 0, UINT8_MAX, VALUE_TYPE_UINT16));
+	assert(0x4000 == convert_range(0x40, 0, UINT8_MAX, VALUE_TYPE_UINT16));
+	assert(0x8000 == convert_range(0x80, 0, UINT8_MAX, VALUE_TYPE_UINT16));
+	assert(0xC000 == convert_range(0xC0, 0, UINT8_MAX, VALUE_TYPE_UINT16));
+	assert(0xFF00 == convert_range(0xFF, 0, UINT8_MAX, VALUE_TYPE_UINT16));
+
+	// uint8 -> int16 (bit shift)
+	assert(-32768 == convert_range(0x00, 0, UINT8_MAX, VALUE_TYPE_INT16));
+	assert(-16384 == convert_range(0x40, 0, UINT8_MAX, VALUE_TYPE_INT16));
+	assert(     0 == convert_range(0x80, 0, UINT8_MAX, VALUE_TYPE_INT16));
+	assert( 16384 == convert_range(0xC0, 0, UINT8_MAX, VALUE_TYPE_INT16));
+	assert(0x7F00 == convert_range(0xFF, 0, UINT8_MAX, VALUE_TYPE_INT16));
+
+	// int8 -> uint16
+	assert(0x0000 == convert_range(-128, INT8_MIN, INT8_MAX, VALUE_TYPE_UINT16));
+	assert(0x4000 == convert_range( -64, INT8_MIN, INT8_MAX, VALUE_TYPE_UINT16));
+	assert(0x8000 == convert_range(   0, INT8_MIN, INT8_MAX, VALUE_TYPE_UINT16));
+	assert(0xC000 == convert_range(  64, INT8_MIN, INT8_MAX, VALUE_TYPE_UINT16));
+	assert(0xFF00 == convert_range( 127, INT8_MIN, INT8_MAX, VALUE_TYPE_UINT16));
+
+	// int8->int16 (bit shift)
+	assert(-32768 == convert_range(-128, INT8_MIN, INT8_MAX, VALUE_TYPE_INT16));
+	assert(-16384 == convert_range( -64, INT8_MIN, INT8_MAX, VALUE_TYPE_INT16));
+	assert(     0 == convert_range(   0, INT8_MIN, INT8_MAX, VALUE_TYPE_INT16));
+	assert( 16384 == convert_range(  64, INT8_MIN, INT8_MAX, VALUE_TYPE_INT16));
+	assert(0x7F00 == convert_range( 127, INT8_MIN, INT8_MAX, VALUE_TYPE_INT16));
+
+	// uint16 -> uint8 (bit shift >>)
+	assert(0x00 == convert_range(0x0000, 0x0000, UINT16_MAX, VALUE_TYPE_UINT8));
+	assert(0x40 == convert_range(0x4000, 0x0000, UINT16_MAX, VALUE_TYPE_UINT8));
+	assert(0x80 == convert_range(0x8000, 0x0000, UINT16_MAX, VALUE_TYPE_UINT8));
+	assert(0xC0 == convert_range(0xC000, 0x0000, UINT16_MAX, VALUE_TYPE_UINT8));
+	assert(0xFF == convert_range(0xFFFF, 0x0000, UINT16_MAX, VALUE_TYPE_UINT8));
+
+	// uint16 -> int8
+	assert(-128 == convert_range(0x0000, 0x0000, UINT16_MAX, VALUE_TYPE_INT8));
+	assert( -64 == convert_range(0x4000, 0x0000, UINT16_MAX, VALUE_TYPE_INT8));
+	assert(   0 == convert_range(0x8000, 0x0000, UINT16_MAX, VALUE_TYPE_INT8));
+	assert(  64 == convert_range(0xC000, 0x0000, UINT16_MAX, VALUE_TYPE_INT8));
+	assert( 127 == convert_range(0xFFFF, 0x0000, UINT16_MAX, VALUE_TYPE_INT8));
+
+	// int16 -> uint8
+	assert(0x00 == convert_range(-32768, INT16_MIN, INT16_MAX, VALUE_TYPE_UINT8));
+	assert(0x40 == convert_range(-16384, INT16_MIN, INT16_MAX, VALUE_TYPE_UINT8));
+	assert(0x80 == convert_range(     0, INT16_MIN, INT16_MAX, VALUE_TYPE_UINT8));
+	assert(0xC0 == convert_range( 16384, INT16_MIN, INT16_MAX, VALUE_TYPE_UINT8));
+	assert(0xFF == convert_range( 32767, INT16_MIN, INT16_MAX, VALUE_TYPE_UINT8));
+
+	// int16 -> int8
+	assert(-128 == convert_range(-32768, INT16_MIN, INT16_MAX, VALUE_TYPE_INT8));
+	assert( -64 == convert_range(-16384, INT16_MIN, INT16_MAX, VALUE_TYPE_INT8));
+	assert(   0 == convert_range(     0, INT16_MIN, INT16_MAX, VALUE_TYPE_INT8));
+	assert(  64 == convert_range( 16384, INT16_MIN, INT16_MAX, VALUE_TYPE_INT8));
+	assert( 127 == convert_range( 32767, INT16_MIN, INT16_MAX, VALUE_TYPE_INT8));
+
+	// uint16 -> int16
+	assert(-32768 == convert_range(0x0000, 0x0000, UINT16_MAX, VALUE_TYPE_INT16));
+	assert(-16384 == convert_range(0x4000, 0x0000, UINT16_MAX, VALUE_TYPE_INT16));
+	assert(     0 == convert_range(0x8000, 0x0000, UINT16_MAX, VALUE_TYPE_INT16));
+	assert( 16384 == convert_range(0xC000, 0x0000, UINT16_MAX, VALUE_TYPE_INT16));
+	assert( 32767 == convert_range(0xFFFF, 0x0000, UINT16_MAX, VALUE_TYPE_INT16));
+
+	// int16 -> uint16
+	assert(0x0000 == convert_range(-32768, INT16_MIN, INT16_MAX, VALUE_TYPE_UINT16));
+	assert(0x4000 == convert_range(-16384, INT16_MIN, INT16_MAX, VALUE_TYPE_UINT16));
+	assert(0x8000 == convert_range(     0, INT16_MIN, INT16_MAX, VALUE_TYPE_UINT16));
+	assert(0xC000 == convert_range( 16384, INT16_MIN, INT16_MAX, VALUE_TYPE_UINT16));
+	assert(0xFFFF == convert_range( 32767, INT16_MIN, INT16_MAX, VALUE_TYPE_UINT16));
+
+	assert(0x80 == map_to_uint8((int32_t)   0, INT8_MIN, INT8_MAX));
+	assert(0xC0 == map_to_uint8((int32_t)  64, INT8_MIN, INT8_MAX));
+	assert(0x40 == map_to_uint8((int32_t) -64, INT8_MIN, INT8_MAX));
+	assert(0x00 == map_to_uint8((int32_t)-128, INT8_MIN, INT8_MAX));
+	assert(0xFF == map_to_uint8((int32_t) 127, INT8_MIN, INT8_MAX));
+
+	assert(0x80 == map_to_uint8((int32_t)     0, INT16_MIN, INT16_MAX));
+	assert(0xC0 == map_to_uint8((int32_t) 16384 + 64, INT16_MIN, INT16_MAX));
+	assert(0x40 == map_to_uint8((int32_t)-16384, INT16_MIN, INT16_MAX));
+	assert(0x00 == map_to_uint8((int32_t)-32768, INT16_MIN, INT16_MAX));
+	assert(0xFF == map_to_uint8((int32_t) 32767, INT16_MIN, INT16_MAX));
+
+	assert(0x80 == map_to_uint8(     0, INT16_MIN, INT16_MAX));
+	assert(0xC0 == map_to_uint8( 16384 + 64, INT16_MIN, INT16_MAX));
+	assert(0x40 == map_to_uint8(-16384, INT16_MIN, INT16_MAX));
+	assert(0x00 == map_to_uint8(-32768, INT16_MIN, INT16_MAX));
+	assert(0xFF == map_to_uint8( 32767, INT16_MIN, INT16_MAX));
+
+	// Sony DualShock 4
+	ParseReportDescriptor(dualshock4_hid_report_descriptor, sizeof(dualshock4_hid_report_descriptor), hid_to_gamecube_mapping);
+
+	ParseReportDescriptor(my_dualshock_4_hid_report_descriptor, sizeof(my_dualshock_4_hid_report_descriptor), hid_to_gamecube_mapping);
+	assert(hid_parser_pads() == 1);
+	g_gamepad = {};
+	ParseReport(my_dualshock_4_hid_report_x_o_pressed, sizeof(my_dualshock_4_hid_report_x_o_pressed), gamepad_callback);
+
+	assert(g_gamepad.a);
+	assert(g_gamepad.b);
+	assert(g_gamepad.al == 0x00);
+	assert(g_gamepad.ar == 0x00);
+	assert(g_gamepad.lx == 0x7e);
+	assert(g_gamepad.ly == 0x83);
+	assert(g_gamepad.rx == 0x7e);
+	assert(g_gamepad.ry == 0x7f);
+
+	g_gamepad = {};
+	ParseReport(my_dualshock_4_hid_report_u_x_pressed, sizeof(my_dualshock_4_hid_report_u_x_pressed), gamepad_callback);
+	assert(g_gamepad.u);
+	assert(g_gamepad.a);
+
+	g_gamepad = {};
+	ParseReport(my_dualshock_4_hid_report_options_r2_max_pressed, sizeof(my_dualshock_4_hid_report_options_r2_max_pressed), gamepad_callback);
+	assert(g_gamepad.start);
+	assert(g_gamepad.r2);
+	assert(g_gamepad.ar == 0xFF);
+
+	g_gamepad = {};
+	ParseReport(my_dualshock_4_hid_report_lx_rx_min, sizeof(my_dualshock_4_hid_report_lx_rx_min), gamepad_callback);
+	assert(g_gamepad.lx == 0x00);
+	assert(g_gamepad.rx == 0x00);
+
+	ParseReportDescriptor(dualshock_4_hid_report_descriptor_gimx_fr_wiki, sizeof(dualshock_4_hid_report_descriptor_gimx_fr_wiki), hid_to_gamecube_mapping);
+	g_gamepad = {};
+	ParseReport(dualshock_4_hid_report_gimx_fr_wiki, sizeof(dualshock_4_hid_report_gimx_fr_wiki), gamepad_callback);
+
+	assert(g_gamepad.al == 0x00);
+	assert(g_gamepad.ar == 0x00);
+	assert(g_gamepad.lx == 0x81);
+	assert(g_gamepad.ly == 0x80);
+	assert(g_gamepad.rx == 0x83);
+	assert(g_gamepad.ry == 0x7a);
+
+	// Sony DualShock 3
+	ParseReportDescriptor(dualshock_3_hid_report_descriptor, sizeof(dualshock_3_hid_report_descriptor), hid_to_gamecube_mapping);
+	g_gamepad = {};
+
+	// Sony PS5 DualSence
+	ParseReportDescriptor(dualsence_hid_report_descriptor, sizeof(dualsence_hid_report_descriptor), hid_to_gamecube_mapping);
+	g_gamepad = {};
+	ParseReport(dualsence_hid_report_idle, sizeof(dualsence_hid_report_idle), gamepad_callback);
+
+	g_gamepad = {};
+	ParseReport(dualsence_hid_report_x_o_pressed, sizeof(dualsence_hid_report_x_o_pressed), gamepad_callback);
+	assert(g_gamepad.a);
+	assert(g_gamepad.b);
+
+	g_gamepad = {};
+	ParseReport(dualsence_hid_report_u_x_pressed, sizeof(dualsence_hid_report_u_x_pressed), gamepad_callback);
+	assert(g_gamepad.u);
+	assert(g_gamepad.a);
+
+	g_gamepad = {};
+	ParseReport(dualsence_hid_report_options_r2_max_pressed, sizeof(dualsence_hid_report_options_r2_max_pressed), gamepad_callback);
+	assert(g_gamepad.start);
+	assert(g_gamepad.r2);
+	assert(g_gamepad.ar == 0xFF);
+
+	g_gamepad = {};
+	ParseReport(dualsence_hid_report_lx_rx_min, sizeof(dualsence_hid_report_lx_rx_min), gamepad_callback);
+	assert(g_gamepad.lx == 0x08);
+	assert(g_gamepad.rx == 0x01);
+
+	// Compiled decoder image: export, replace parser state, import
+	static uint8_t decoder_image[2048];
+
+	ParseReportDescriptor(dualsence_hid_report_descriptor, sizeof(dualsence_hid_report_descriptor), hid_to_gamecube_mapping);
+	const size_t decoder_image_size = hid_parser_export(decoder_image, sizeof(decoder_image));
+	assert(decoder_image_size);
+	assert(!hid_parser_export(decoder_image, decoder_image_size - 1));
+
+	ParseReportDescriptor(keyboard_report_descriptor, sizeof(keyboard_report_descriptor), nullptr);
+	assert(!hid_parser_import(decoder_image, decoder_image_size - 1));
+
+	// Corrupted image, header: version, usesReports, reports (arena_ref), arenaUsed, layout
+	static uint8_t bad_image[sizeof(decoder_image)];
+	uint16_t arena_used_bytes;
+	memcpy(&arena_used_bytes, decoder_image + 4, 2);
+
+	memcpy(bad_image, decoder_image, decoder_image_size);
+	bad_image[0]--; // Image of older parser version
+	assert(!hid_parser_import(bad_image, decoder_image_size));
+
+	memcpy(bad_image, decoder_image, decoder_image_size);
+	const uint16_t bad_ref = arena_used_bytes - 4; // Report node past arena end
+	memcpy(bad_image + 2, &bad_ref, 2);
+	assert(!hid_parser_import(bad_image, decoder_image_size));
+
+	memcpy(bad_image, decoder_image, decoder_image_size);
+	const uint16_t cut_used = arena_used_bytes - 4; // Last allocated node cut
+	memcpy(bad_image + 4, &cut_used, 2);
+	assert(!hid_parser_import(bad_image, decoder_image_size - 4));
+
+	assert(hid_parser_import(decoder_image, decoder_image_size));
+
+	g_gamepad = {};
+	ParseReport(dualsence_hid_report_x_o_pressed, sizeof(dualsence_hid_report_x_o_pressed), gamepad_callback);
+	assert(g_gamepad.a);
+	assert(g_gamepad.b);
+
+	assert(hid_parser_hash(dualsence_hid_report_descriptor, sizeof(dualsence_hid_report_descriptor), hid_to_gamecube_mapping) ==
+		hid_parser_hash(dualsence_hid_report_descriptor, sizeof(dualsence_hid_report_descriptor), hid_to_gamecube_mapping));
+	assert(hid_parser_hash(dualsence_hid_report_descriptor, sizeof(dualsence_hid_report_descriptor), hid_to_gamecube_mapping) !=
+		hid_parser_hash(dualsence_hid_report_descriptor, sizeof(dualsence_hid_report_descriptor), nullptr));
+
+	// Descriptor truncated in the middle of item
+	assert(!ParseReportDescriptor(dualsence_hid_report_descriptor, 3, hid_to_gamecube_mapping)); // Usage Page (2 bytes), Usage (1 of 2 bytes)
+
+	// HID keyboard
+	ParseReportDescriptor(keyboard_report_descriptor, sizeof(keyboard_report_descriptor), nullptr);
+	g_keyboard = {};
+
+	ParseReport(keyboard_report_a_pressed, sizeof(keyboard_report_a_pressed), nullptr, keyboard_callback);
+	assert(g_keyboard.keys[0x04] == true);
+
+	ParseReport(keyboard_report_none_pressed, sizeof(keyboard_report_none_pressed), nullptr, keyboard_callback);
+	assert(g_keyboard.keys[0x04] == false);
+
+	// HID mouse
+	ParseReportDescriptor(mouse_report_descriptor, sizeof(mouse_report_descriptor), nullptr);
+	g_mouse = {};
+
+	ParseReport(mouse_report_1, sizeof(mouse_report_1), nullptr, nullptr, mouse_callback);
+	assert(g_mouse.buttons == 0x00);
+	assert(g_mouse.x == g_mouse.y == g_mouse.z == 0x0000);
+
+	ParseReport(mouse_report_2, sizeof(mouse_report_2), nullptr, nullptr, mouse_callback);
+	assert(g_mouse.buttons & 0x01);
+
+	ParseReport(mouse_report_3, sizeof(mouse_report_3), nullptr, nullptr, mouse_callback);
+	assert(g_mouse.buttons & 0x02);
+
+	ParseReport(mouse_report_4, sizeof(mouse_report_4), nullptr, nullptr, mouse_callback);
+	assert(g_mouse.buttons == 0x00);
+	assert(g_mouse.z == -1);
+
+	// HID gamepad to keyboard mapping
+	const uint8_t HID_KEY_A = 0x04;
+
+	const JoyPreset gamepad_to_keyboard_mapping[] =
+	{
+		// Map gamepad button 2 to keyboard A key
+		{ 1, REPORT_USAGE_PAGE_BUTTON, 2, MAP_KEYBOARD, HID_KEY_A, MAP_TYPE_THRESHOLD_ABOVE, 0 },
+		// null record to mark end
+		{ 0, 0, 0, 0, 0, 0, 0 }
+	};
+
+	ParseReportDescriptor(my_dualshock_4_hid_report_descriptor, sizeof(my_dualshock_4_hid_report_descriptor), gamepad_to_keyboard_mapping);
+
+	ParseReport(my_dualshock_4_hid_report_u_x_pressed, sizeof(my_dualshock_4_hid_report_u_x_pressed), gamepad_callback, keyboard_callback);
+	assert(g_keyboard.keys[HID_KEY_A] == true);
+
+	ParseReport(my_dualshock_4_hid_report_idle, sizeof(my_dualshock_4_hid_report_idle), gamepad_callback, keyboard_callback);
+	assert(g_keyboard.keys[HID_KEY_A] == false);
+
+	// Preset table too large for index: linear search, matching preset at table end
+	static JoyPreset large_mapping[300];
+
+	for (uint16_t i = 0; i < 298; i++)
+		large_mapping[i] = { 9, REPORT_USAGE_PAGE_BUTTON, 2, MAP_KEYBOARD, HID_KEY_A, MAP_TYPE_THRESHOLD_ABOVE, 0 };
+
+	large_mapping[298] = gamepad_to_keyboard_mapping[0];
+	large_mapping[299] = {};
+
+	ParseReportDescriptor(my_dualshock_4_hid_report_descriptor, sizeof(my_dualshock_4_hid_report_descriptor), large_mapping);
+
+	ParseReport(my_dualshock_4_hid_report_u_x_pressed, sizeof(my_dualshock_4_hid_report_u_x_pressed), gamepad_callback, keyboard_callback);
+	assert(g_keyboard.keys[HID_KEY_A] == true);
+
+	// Preset table edited in place: index of previous keys is not reused
+	const uint8_t HID_KEY_B = 0x05;
+
+	static JoyPreset edited_mapping[300];
+
+	edited_mapping[0] = { 1, REPORT_USAGE_PAGE_BUTTON, 1, MAP_KEYBOARD, HID_KEY_B, MAP_TYPE_THRESHOLD_ABOVE, 0 }; // Square
+	edited_mapping[1] = { 1, REPORT_USAGE_PAGE_BUTTON, 3, MAP_KEYBOARD, HID_KEY_A, MAP_TYPE_THRESHOLD_ABOVE, 0 }; // Circle
+	edited_mapping[2] = { 1, REPORT_USAGE_PAGE_BUTTON, 4, MAP_KEYBOARD, HID_KEY_B, MAP_TYPE_THRESHOLD_ABOVE, 0 }; // Triangle
+	edited_mapping[3] = {};
+
+	ParseReportDescriptor(my_dualshock_4_hid_report_descriptor, sizeof(my_dualshock_4_hid_report_descriptor), edited_mapping);
+	g_keyboard = {};
+
+	ParseReport(my_dualshock_4_hid_report_u_x_pressed, sizeof(my_dualshock_4_hid_report_u_x_pressed), gamepad_callback, keyboard_callback);
+	assert(g_keyboard.keys[HID_KEY_A] == false && g_keyboard.keys[HID_KEY_B] == false);
+
+	// Same count, keys reordered: stale index would start at a usage beyond the button range and miss Cross
+	edited_mapping[0] = { 1, REPORT_USAGE_PAGE_BUTTON, 100, MAP_KEYBOARD, HID_KEY_B, MAP_TYPE_THRESHOLD_ABOVE, 0 };
+	edited_mapping[1] = { 1, REPORT_USAGE_PAGE_BUTTON, 2, MAP_KEYBOARD, HID_KEY_A, MAP_TYPE_THRESHOLD_ABOVE, 0 }; // Cross
+	edited_mapping[2] = { 1, REPORT_USAGE_PAGE_BUTTON, 100, MAP_KEYBOARD, HID_KEY_B, MAP_TYPE_THRESHOLD_ABOVE, 0 };
+
+	ParseReportDescriptor(my_dualshock_4_hid_report_descriptor, sizeof(my_dualshock_4_hid_report_descriptor), edited_mapping);
+	g_keyboard = {};
+
+	ParseReport(my_dualshock_4_hid_report_u_x_pressed, sizeof(my_dualshock_4_hid_report_u_x_pressed), gamepad_callback, keyboard_callback);
+	assert(g_keyboard.keys[HID_KEY_A] == true && g_keyboard.keys[HID_KEY_B] == false);
+
+	// Same table grown past index size: linear search, matching preset at table end
+	for (uint16_t i = 0; i < 298; i++)
+		edited_mapping[i] = { 1, REPORT_USAGE_PAGE_BUTTON, 3, MAP_KEYBOARD, HID_KEY_B, MAP_TYPE_THRESHOLD_ABOVE, 0 };
+
+	edited_mapping[298] = { 1, REPORT_USAGE_PAGE_BUTTON, 2, MAP_KEYBOARD, HID_KEY_A, MAP_TYPE_THRESHOLD_ABOVE, 0 };
+	edited_mapping[299] = {};
+
+	ParseReportDescriptor(my_dualshock_4_hid_report_descriptor, sizeof(my_dualshock_4_hid_report_descriptor), edited_mapping);
+	g_keyboard = {};
+
+	ParseReport(my_dualshock_4_hid_report_idle, sizeof(my_dualshock_4_hid_report_idle), gamepad_callback, keyboard_callback);
+	assert(g_keyboard.keys[HID_KEY_A] == false);
+
+	ParseReport(my_dualshock_4_hid_report_u_x_pressed, sizeof(my_dualshock_4_hid_report_u_x_pressed), gamepad_callback, keyboard_callback);
+	assert(g_keyboard.keys[HID_KEY_A] == true && g_keyboard.keys[HID_KEY_B] == false);
+
+	// Multi-pad device: every gamepad collection is separate pad, JOY_PRESET_ANY_PAD presets map all of them
+	const JoyPreset any_pad_mapping[] =
+	{
+		{ JOY_PRESET_ANY_PAD, REPORT_USAGE_PAGE_BUTTON, 2, MAP_GAMEPAD, PAD_BUTTON_SOUTH, MAP_TYPE_THRESHOLD_ABOVE, 0 },
+		{ JOY_PRESET_ANY_PAD, REPORT_USAGE_PAGE_GENERIC_DESKTOP, REPORT_USAGE_X, MAP_GAMEPAD, PAD_AXIS_LX, MAP_TYPE_AXIS, VALUE_TYPE_UINT8 },
+		{ 2, REPORT_USAGE_PAGE_BUTTON, 1, MAP_GAMEPAD, PAD_BUTTON_EAST, MAP_TYPE_THRESHOLD_ABOVE, 0 }, // Second pad only
+		{ 0, 0, 0, 0, 0, 0, 0 }
+	};
+
+	const uint8_t pad_1_report[] = { 0x01, 0x03, 0x20 }; // Buttons 1, 2; X
+	const uint8_t pad_2_report[] = { 0x02, 0x03, 0x10 };
+	const uint8_t unknown_report[] = { 0x03, 0x03, 0x10 };
+
+	assert(ParseReportDescriptor(two_pads_hid_report_descriptor, sizeof(two_pads_hid_report_descriptor), any_pad_mapping));
+	assert(hid_parser_pads() == 2);
+	assert(hid_parser_report_pads(pad_1_report, sizeof(pad_1_report)) == 0x01);
+	assert(hid_parser_report_pads(pad_2_report, sizeof(pad_2_report)) == 0x02);
+	assert(hid_parser_report_pads(unknown_report, sizeof(unknown_report)) == 0x00);
+
+	g_multi_pads[0] = g_multi_pads[1] = neutralCanonicalPad;
+	assert(ParseReport(pad_1_report, sizeof(pad_1_report), multi_pad_callback));
+	assert(g_multi_pads[0].buttons == 1u << PAD_BUTTON_SOUTH && PAD_AXIS(&g_multi_pads[0], PAD_AXIS_LX) == 0x20);
+	assert(g_multi_pads[1].buttons == 0 && PAD_AXIS(&g_multi_pads[1], PAD_AXIS_LX) == neutralCanonicalPad.axes[0]);
+
+	assert(ParseReport(pad_2_report, sizeof(pad_2_report), multi_pad_callback));
+	assert(g_multi_pads[1].buttons == (1u << PAD_BUTTON_SOUTH | 1u << PAD_BUTTON_EAST) && PAD_AXIS(&g_multi_pads[1], PAD_AXIS_LX) == 0x10);
+	assert(PAD_AXIS(&g_multi_pads[0], PAD_AXIS_LX) == 0x20);
+
+	// Pad number counts application collections: Report IDs inside one gamepad collection are the same pad
+	const uint8_t split_reports_hid_report_descriptor[] =
+	{
+		0x05, 0x01, // Usage Page (Generic Desktop)
+		0x09, 0x05, // Usage (Game Pad)
+		0xA1, 0x01, // Collection (Application)
+		0x85, 0x01, //   Report ID (1)
+		0x05, 0x09, //   Usage Page (Button)
+		0x19, 0x01, //   Usage Minimum (1)
+		0x29, 0x08, //   Usage Maximum (8)
+		0x15, 0x00, //   Logical Minimum (0)
+		0x25, 0x01, //   Logical Maximum (1)
+		0x75, 0x01, //   Report Size (1)
+		0x95, 0x08, //   Report Count (8)
+		0x81, 0x02, //   Input (Data, Variable, Absolute)
+		0x85, 0x02, //   Report ID (2)
+		0x05, 0x01, //   Usage Page (Generic Desktop)
+		0x09, 0x30, //   Usage (X)
+		0x26, 0xFF, 0x00, // Logical Maximum (255)
+		0x75, 0x08, //   Report Size (8)
+		0x95, 0x01, //   Report Count (1)
+		0x81, 0x02, //   Input (Data, Variable, Absolute)
+		0xC0        // End Collection
+	};
+
+	const JoyPreset first_pad_mapping[] =
+	{
+		{ 1, REPORT_USAGE_PAGE_BUTTON, 2, MAP_GAMEPAD, PAD_BUTTON_SOUTH, MAP_TYPE_THRESHOLD_ABOVE, 0 },
+		{ 1, REPORT_USAGE_PAGE_GENERIC_DESKTOP, REPORT_USAGE_X, MAP_GAMEPAD, PAD_AXIS_LX, MAP_TYPE_AXIS, VALUE_TYPE_UINT8 },
+		{ 0, 0, 0, 0, 0, 0, 0 }
+	};
+
+	const uint8_t split_buttons_report[] = { 0x01, 0x02 }; // Button 2
+	const uint8_t split_axis_report[] = { 0x02, 0x30 }; // X
+
+	assert(ParseReportDescriptor(split_reports_hid_report_descriptor, sizeof(split_reports_hid_report_descriptor), first_pad_mapping));
+	assert(hid_parser_pads() == 1);
+	assert(hid_parser_report_pads(split_buttons_report, sizeof(split_buttons_report)) == 0x01);
+	assert(hid_parser_report_pads(split_axis_report, sizeof(split_axis_report)) == 0x01);
+
+	g_multi_pads[0] = neutralCanonicalPad;
+	assert(ParseReport(split_buttons_report, sizeof(split_buttons_report), multi_pad_callback));
+	assert(ParseReport(split_axis_report, sizeof(split_axis_report), multi_pad_callback));
+	assert(g_multi_pads[0].buttons == 1u << PAD_BUTTON_SOUTH && PAD_AXIS(&g_multi_pads[0], PAD_AXIS_LX) == 0x30);
+
+	// Malformed descriptors: usage range longer than Report Count, report length not whole bytes
+	const uint8_t usage_range_hid_report_descriptor[] =
+	{
+		0x05, 0x01, // Usage Page (Generic Desktop)
+		0x09, 0x05, // Usage (Game Pad)
+		0xA1, 0x01, // Collection (Application)
+		0x05, 0x09, //   Usage Page (Button)
+		0x15, 0x00, //   Logical Minimum (0)
+		0x25, 0x01, //   Logical Maximum (1)
+		0x75, 0x01, //   Report Size (1)
+		0x19, 0x02, //   Usage Minimum (2)
+		0x29, 0x02, //   Usage Maximum (2), inclusive
+		0x95, 0x01, //   Report Count (1)
+		0x81, 0x02, //   Input (Data, Variable, Absolute)
+		0x19, 0x01, //   Usage Minimum (1)
+		0x2A, 0xFE, 0xFF, // Usage Maximum (65534), fields for Report Count only
+		0x95, 0x07, //   Report Count (7)
+		0x81, 0x02, //   Input (Data, Variable, Absolute)
+		0x75, 0x04, //   Report Size (4)
+		0x95, 0x01, //   Report Count (1)
+		0x81, 0x03, //   Input (Constant), 12 bits report
+		0xC0        // End Collection
+	};
+
+	const uint8_t range_first_report[] = { 0x01, 0x00 }; // Button 2 of first Input
+	const uint8_t range_second_report[] = { 0x04, 0x00 }; // Button 2 of second Input
+
+	assert(ParseReportDescriptor(usage_range_hid_report_descriptor, sizeof(usage_range_hid_report_descriptor), any_pad_mapping));
+	assert(hid_parser_segments(0, nullptr, 0) == 2);
+
+	g_multi_pads[0] = neutralCanonicalPad;
+	assert(ParseReport(range_first_report, sizeof(range_first_report), multi_pad_callback));
+	assert(g_multi_pads[0].buttons == 1u << PAD_BUTTON_SOUTH);
+
+	g_multi_pads[0] = neutralCanonicalPad;
+	assert(ParseReport(range_second_report, sizeof(range_second_report), multi_pad_callback));
+	assert(g_multi_pads[0].buttons == 1u << PAD_BUTTON_SOUTH);
+
+	assert(!ParseReport(range_second_report, 1, multi_pad_callback)); // 12 bits don't fit 1 byte
+	assert(!ParseReport(range_second_report, 0, multi_pad_callback));
+
+	// Usage Maximum is inclusive: DualShock 4 Usage Minimum (1) .. Usage Maximum (14), button 14 (touchpad click) maps
+	const JoyPreset button_14_mapping[] =
+	{
+		{ JOY_PRESET_ANY_PAD, REPORT_USAGE_PAGE_BUTTON, 2, MAP_GAMEPAD, PAD_BUTTON_EAST, MAP_TYPE_THRESHOLD_ABOVE, 0 }, // Cross
+		{ JOY_PRESET_ANY_PAD, REPORT_USAGE_PAGE_BUTTON, 14, MAP_GAMEPAD, PAD_BUTTON_SOUTH, MAP_TYPE_THRESHOLD_ABOVE, 0 },
+		{ 0, 0, 0, 0, 0, 0, 0 }
+	};
+
+	uint8_t button_14_report[sizeof(my_dualshock_4_hid_report_idle)];
+	memcpy(button_14_report, my_dualshock_4_hid_report_idle, sizeof(button_14_report));
+	button_14_report[7] |= 0x02; // Buttons start at bit 4 of byte 5: button 14 is bit 17
+
+	assert(ParseReportDescriptor(my_dualshock_4_hid_report_descriptor, sizeof(my_dualshock_4_hid_report_descriptor), button_14_mapping));
+
+	// Indexed range mapping places field of usage at its offset in range, not at range start
+	g_multi_pads[0] = neutralCanonicalPad;
+	assert(ParseReport(button_14_report, sizeof(button_14_report), multi_pad_callback));
+	assert(g_multi_pads[0].buttons == 1u << PAD_BUTTON_SOUTH);
+
+	g_multi_pads[0] = neutralCanonicalPad;
+	assert(ParseReport(my_dualshock_4_hid_report_x_o_pressed, sizeof(my_dualshock_4_hid_report_x_o_pressed), multi_pad_callback));
+	assert(g_multi_pads[0].buttons == 1u << PAD_BUTTON_EAST);
+
+	// Default mapping: last button of 12 button pad range is R3
+	const uint8_t twelve_buttons_hid_report_descriptor[] =
+	{
+		0x05, 0x01, // Usage Page (Generic Desktop)
+		0x09, 0x05, // Usage (Game Pad)
+		0xA1, 0x01, // Collection (Application)
+		0x05, 0x09, //   Usage Page (Button)
+		0x19, 0x01, //   Usage Minimum (1)
+		0x29, 0x0C, //   Usage Maximum (12)
+		0x15, 0x00, //   Logical Minimum (0)
+		0x25, 0x01, //   Logical Maximum (1)
+		0x75, 0x01, //   Report Size (1)
+		0x95, 0x0C, //   Report Count (12)
+		0x81, 0x02, //   Input (Data, Variable, Absolute)
+		0x75, 0x04, //   Report Size (4)
+		0x95, 0x01, //   Report Count (1)
+		0x81, 0x03, //   Input (Constant)
+		0xC0        // End Collection
+	};
+
+	const uint8_t r3_report[] = { 0x00, 0x08 }; // Button 12
+
+	assert(ParseReportDescriptor(twelve_buttons_hid_report_descriptor, sizeof(twelve_buttons_hid_report_descriptor), hid_to_gamecube_mapping));
+
+	g_multi_pads[0] = neutralCanonicalPad;
+	assert(ParseReport(r3_report, sizeof(r3_report), multi_pad_callback));
+	assert(g_multi_pads[0].buttons == 1u << PAD_BUTTON_R3);
+
+	// Report length is 16 bits: Input item past 65535 bits fails the parse
+	const uint8_t long_report_hid_report_descriptor[] =
+	{
+		0x05, 0x01, // Usage Page (Generic Desktop)
+		0x09, 0x05, // Usage (Game Pad)
+		0xA1, 0x01, // Collection (Application)
+		0x05, 0x09, //   Usage Page (Button)
+		0x19, 0x01, //   Usage Minimum (1)
+		0x29, 0x08, //   Usage Maximum (8)
+		0x15, 0x00, //   Logical Minimum (0)
+		0x25, 0x01, //   Logical Maximum (1)
+		0x75, 0x01, //   Report Size (1)
+		0x95, 0x08, //   Report Count (8)
+		0x81, 0x02, //   Input (Data, Variable, Absolute)
+		0x75, 0xFF, //   Report Size (255)
+		0x95, 0xFF, //   Report Count (255)
+		0x81, 0x03, //   Input (Constant), 65033 bits report
+		0xC0        // End Collection
+	};
+
+	uint8_t overflow_hid_report_descriptor[sizeof(long_report_hid_report_descriptor) + 4];
+	memcpy(overflow_hid_report_descriptor, long_report_hid_report_descriptor, sizeof(long_report_hid_report_descriptor) - 1);
+
+	const uint8_t overflow_input[] = { 0x95, 0x02, 0x81, 0x03, 0xC0 }; // Report Count (2), Input (Constant): 65543 bits
+	memcpy(overflow_hid_report_descriptor + sizeof(long_report_hid_report_descriptor) - 1, overflow_input, sizeof(overflow_input));
+
+	assert(ParseReportDescriptor(long_report_hid_report_descriptor, sizeof(long_report_hid_report_descriptor), hid_to_gamecube_mapping));
+	assert(!ParseReportDescriptor(overflow_hid_report_descriptor, sizeof(overflow_hid_report_descriptor), hid_to_gamecube_mapping));
+
+	// convert_range(): unsigned arithmetic, neutral value for custom ranges
+	assert(convert_range((uint32_t)-128, -128, 127, VALUE_TYPE_UINT8) == 0);
+	assert(convert_range(0xFFFF, 0, 0xFFFF, VALUE_TYPE_UINT8) == 0xFF);
+	assert(convert_range(512, 0, 1023, VALUE_TYPE_UINT8) == 0x80);
+	assert(convert_range(512, 0, 1023, VALUE_TYPE_UINT16) == 0x8000);
+	assert(convert_range(512, 0, 1023, VALUE_TYPE_INT8) == 0);
+
+	// Threshold mapping clamps field to logical range: value past Logical Maximum is full press, not wrapped
+	const uint8_t short_range_hid_report_descriptor[] =
+	{
+		0x05, 0x01, // Usage Page (Generic Desktop)
+		0x09, 0x05, // Usage (Game Pad)
+		0xA1, 0x01, // Collection (Application)
+		0x09, 0x30, //   Usage (X)
+		0x15, 0x00, //   Logical Minimum (0)
+		0x25, 0x64, //   Logical Maximum (100)
+		0x75, 0x08, //   Report Size (8)
+		0x95, 0x01, //   Report Count (1)
+		0x81, 0x02, //   Input (Data, Variable, Absolute)
+		0xC0        // End Collection
+	};
+
+	const JoyPreset x_threshold_mapping[] =
+	{
+		{ JOY_PRESET_ANY_PAD, REPORT_USAGE_PAGE_GENERIC_DESKTOP, REPORT_USAGE_X, MAP_GAMEPAD, PAD_BUTTON_RIGHT, MAP_TYPE_THRESHOLD_ABOVE, 0xC0 },
+		{ JOY_PRESET_ANY_PAD, REPORT_USAGE_PAGE_GENERIC_DESKTOP, REPORT_USAGE_X, MAP_GAMEPAD, PAD_BUTTON_LEFT, MAP_TYPE_THRESHOLD_BELOW, 0x40 },
+		{ 0, 0, 0, 0, 0, 0, 0 }
+	};
+
+	const uint8_t x_past_maximum_report[] = { 150 };
+	const uint8_t x_centre_report[] = { 50 };
+	const uint8_t x_minimum_report[] = { 0 };
+
+	assert(ParseReportDescriptor(short_range_hid_report_descriptor, sizeof(short_range_hid_report_descriptor), x_threshold_mapping));
+
+	g_multi_pads[0] = neutralCanonicalPad;
+	assert(ParseReport(x_past_maximum_report, sizeof(x_past_maximum_report), multi_pad_callback));
+	assert(g_multi_pads[0].buttons == 1u << PAD_BUTTON_RIGHT);
+
+	g_multi_pads[0] = neutralCanonicalPad;
+	assert(ParseReport(x_centre_report, sizeof(x_centre_report), multi_pad_callback));
+	assert(g_multi_pads[0].buttons == 0);
+
+	g_multi_pads[0] = neutralCanonicalPad;
+	assert(ParseReport(x_minimum_report, sizeof(x_minimum_report), multi_pad_callback));
+	assert(g_multi_pads[0].buttons == 1u << PAD_BUTTON_LEFT);
+
+	// Canonical pad to GameCube profiles
+	pad_profiles_init();
+	assert(pad_profile_active() == 0);
+	assert(!pad_profile_select(pad_profiles_count));
+
+	canonical_pad pad = neutralCanonicalPad;
+	canonical_pad_apply(&pad, PAD_BUTTON_SOUTH, 1);
+	canonical_pad_apply(&pad, PAD_BUTTON_R1, 1);
+	canonical_pad_apply(&pad, PAD_AXIS_LY, 0x00); // HID Up
+	canonical_pad_apply(&pad, PAD_AXIS_LT, 0xF0);
+
+	GCReport gc = pad_profile_report(&pad, PAD_SOURCE_HID);
+	assert(gc.a && gc.z && !gc.b && !gc.l && !gc.start);
+	assert(gc.yStick == 0x80 + 100 && gc.analogL == 0xF0 && gc.xStick == 0x80); // HID stick conditioning: GameCube range
+
+	// default: digital-only triggers (Mega Drive Z / C) click L / R, analog L / R stay released
+	canonical_pad digital = neutralCanonicalPad;
+	canonical_pad_apply(&digital, PAD_BUTTON_L2, 1);
+	canonical_pad_apply(&digital, PAD_BUTTON_R2, 1);
+
+	gc = pad_profile_report(&digital, PAD_SOURCE_MEGA_DRIVE);
+	assert(gc.l && gc.r && gc.analogL == 0 && gc.analogR == 0);
+
+	// SELECT + START switches to next profile once per press, chord is not passed through
+	canonical_pad chord = neutralCanonicalPad;
+	canonical_pad_apply(&chord, PAD_BUTTON_SELECT, 1);
+	canonical_pad_apply(&chord, PAD_BUTTON_START, 1);
+
+	gc = pad_profile_report(&chord, PAD_SOURCE_HID);
+	assert(pad_profile_active() == 1 && !gc.start);
+	gc = pad_profile_report(&chord, PAD_SOURCE_HID);
+	assert(pad_profile_active() == 1);
+
+	// trigger_click: L click above threshold, digital L2 of analog trigger does not click
+	gc = pad_profile_report(&pad, PAD_SOURCE_HID);
+	assert(gc.l && gc.analogL == 0xF0);
+
+	pad.axes[PAD_AXIS_LT - PAD_AXIS_LX] = 0x80;
+	gc = pad_profile_report(&pad, PAD_SOURCE_HID);
+	assert(!gc.l && gc.analogL == 0x80);
+
+	canonical_pad_apply(&pad, PAD_BUTTON_L2, 1);
+	gc = pad_profile_report(&pad, PAD_SOURCE_HID);
+	assert(!gc.l && gc.analogL == 0x80);
+
+	// trigger_click, digital-only triggers (Mega Drive Z / C, HID pads without trigger axes): L / R click and full analog press
+	gc = pad_profile_report(&digital, PAD_SOURCE_MEGA_DRIVE);
+	assert(gc.l && gc.r && gc.analogL == 0xFF && gc.analogR == 0xFF);
+
+	gc = pad_profile_report(&digital, PAD_SOURCE_HID);
+	assert(gc.l && gc.r && gc.analogL == 0xFF && gc.analogR == 0xFF);
+
+	// Chord of Mega Drive source (Joybus core) does not switch profiles
+	gc = pad_profile_report(&chord, PAD_SOURCE_MEGA_DRIVE);
+	assert(pad_profile_active() == 1);
+
+	// Chord cycles back to first profile
+	for (uint8_t i = 1; i < pad_profiles_count; i++)
+	{
+		pad_profile_report(&neutralCanonicalPad, PAD_SOURCE_HID);
+		pad_profile_report(&chord, PAD_SOURCE_HID);
+	}
+
+	assert(pad_profile_active() == 0);
+	gc = pad_profile_report(&pad, PAD_SOURCE_HID);
+	assert(gc.l && gc.analogL == 0x80);
+
+	return 0;
 }
\ No newline at end of file
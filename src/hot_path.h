@@ -0,0 +1,20 @@
+#pragma once
+
+/*
+Code placement for Joybus reply path and report decoder.
+
+With RAM_HOT_PATHS functions defined with HOT_PATH(name) are linked into .time_critical sections,
+copied to SRAM at boot and never fetched through XIP cache: a cache miss refilled from QSPI flash
+can't delay Joybus reply.
+Decoder tables are RAM resident already: hid_to_gamecube_mapping is not const,
+report segments are allocated in the arena.
+
+Run tools/ram_budget.py on firmware ELF to list code placed in RAM.
+*/
+
+#if RAM_HOT_PATHS && PICO_ON_DEVICE
+#include "pico/platform.h"
+#define HOT_PATH(func_name) __time_critical_func(func_name)
+#else
+#define HOT_PATH(func_name) func_name
+#endif
@@ -0,0 +1,58 @@
+#include "interp_model.h"
+
+static uint32_t shift_mask(const interp_model* interp, uint8_t lane)
+{
+	const uint32_t ctrl = interp->ctrl[lane];
+	const uint8_t shift = (ctrl >> INTERP_CTRL_SHIFT_LSB) & 0x1F;
+	const uint8_t mask_lsb = (ctrl >> INTERP_CTRL_MASK_LSB_LSB) & 0x1F;
+	const uint8_t mask_msb = (ctrl >> INTERP_CTRL_MASK_MSB_LSB) & 0x1F;
+
+	if (mask_lsb > mask_msb)
+		return 0;
+
+	const uint32_t mask = (UINT32_MAX >> (31 - mask_msb)) & (UINT32_MAX << mask_lsb);
+	uint32_t value = (interp->accum[lane] >> shift) & mask;
+
+	if ((ctrl & INTERP_CTRL_SIGNED_BITS) && (value & (1u << mask_msb)))
+		value |= UINT32_MAX << mask_msb;
+
+	return value;
+}
+
+uint32_t interp_model_peek(const interp_model* interp, uint8_t result)
+{
+	if (result == INTERP_PEEK_FULL)
+		return interp->base[2] + shift_mask(interp, 0) + shift_mask(interp, 1);
+
+	const uint32_t ctrl = interp->ctrl[result];
+
+	if (result == 0 && interp->clamp && (ctrl & INTERP_CTRL_CLAMP_BITS))
+	{
+		const uint32_t value = shift_mask(interp, 0);
+
+		if (ctrl & INTERP_CTRL_SIGNED_BITS)
+		{
+			if ((int32_t)value < (int32_t)interp->base[0])
+				return interp->base[0];
+			if ((int32_t)value > (int32_t)interp->base[1])
+				return interp->base[1];
+		}
+		else
+		{
+			if (value < interp->base[0])
+				return interp->base[0];
+			if (value > interp->base[1])
+				return interp->base[1];
+		}
+
+		return value;
+	}
+
+	if (ctrl & INTERP_CTRL_ADD_RAW_BITS)
+		return interp->accum[result] + interp->base[result];
+
+	return shift_mask(interp, result) + interp->base[result];
+}
+
+// Interpolators of parser core for hid_interp.h host builds: INTERP0, INTERP1
+interp_model hid_interp_models[2] = { { {}, {}, {}, false }, { {}, {}, {}, true } };
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <stdint.h>
+
+/*
+Software model of RP2040 SIO interpolator (RP2040 datasheet, 2.3.1.6) for host builds and tests
+of interpolator backed code (hid_interp.h).
+
+Modeled per lane: logical right shift, mask MASK_LSB..MASK_MSB, sign extension from MASK_MSB, BASE add,
+ADD_RAW, clamp of lane 0 between BASE0 and BASE1 (INTERP1 only), FULL result.
+Not modeled: CROSS_INPUT, CROSS_RESULT, BLEND, FORCE_MSB, POP accumulator writeback.
+*/
+
+// CTRL_LANE0 / CTRL_LANE1 fields
+#define INTERP_CTRL_SHIFT_LSB 0
+#define INTERP_CTRL_MASK_LSB_LSB 5
+#define INTERP_CTRL_MASK_MSB_LSB 10
+#define INTERP_CTRL_SIGNED_BITS 0x00008000u
+#define INTERP_CTRL_ADD_RAW_BITS 0x00040000u
+#define INTERP_CTRL_CLAMP_BITS 0x00400000u // Lane 0 of INTERP1
+
+#define INTERP_PEEK_FULL 2
+
+typedef struct interp_model
+{
+	uint32_t accum[2];
+	uint32_t base[3];
+	uint32_t ctrl[2];
+	bool clamp; // INTERP1
+} interp_model;
+
+// PEEK_LANE0, PEEK_LANE1 or PEEK_FULL.
+uint32_t interp_model_peek(const interp_model* interp, uint8_t result);
@@ -0,0 +1,90 @@
+#include "irq_affinity.h"
+
+#include <stdio.h>
+
+#include "pico/stdlib.h"
+#include "hardware/irq.h"
+#include "hardware/sync.h"
+#include "hardware/structs/systick.h"
+
+// Joybus core keeps PIO0 events only
+static constexpr uint32_t CORE0_IRQ_MASK = (1u << PIO0_IRQ_0) | (1u << PIO0_IRQ_1);
+
+static const char* const irq_names[] =
+{
+	"TIMER_IRQ_0", "TIMER_IRQ_1", "TIMER_IRQ_2", "TIMER_IRQ_3",
+	"PWM_IRQ_WRAP", "USBCTRL_IRQ", "XIP_IRQ",
+	"PIO0_IRQ_0", "PIO0_IRQ_1", "PIO1_IRQ_0", "PIO1_IRQ_1",
+	"DMA_IRQ_0", "DMA_IRQ_1", "IO_IRQ_BANK0", "IO_IRQ_QSPI",
+	"SIO_IRQ_PROC0", "SIO_IRQ_PROC1", "CLOCKS_IRQ",
+	"SPI0_IRQ", "SPI1_IRQ", "UART0_IRQ", "UART1_IRQ",
+	"ADC_IRQ_FIFO", "I2C0_IRQ", "I2C1_IRQ", "RTC_IRQ"
+};
+
+static uint32_t enabled_irqs()
+{
+	uint32_t mask = 0;
+
+	for (uint irq = 0; irq < count_of(irq_names); irq++)
+	{
+		if (irq_is_enabled(irq))
+			mask |= 1u << irq;
+	}
+
+	return mask;
+}
+
+#if IRQ_ISOLATION
+static volatile uint32_t g_core1_irqs;
+
+void irq_affinity_isolate_core0()
+{
+	const uint32_t moved = enabled_irqs() & ~CORE0_IRQ_MASK;
+
+	irq_set_mask_enabled(moved, false);
+	g_core1_irqs = moved;
+}
+
+void irq_affinity_core1_init()
+{
+	// Interrupt lines still asserted are taken right after enabling: nothing is lost while in transit
+	irq_set_mask_enabled(g_core1_irqs, true);
+}
+#endif
+
+static volatile bool g_snapshot_taken;
+static uint32_t g_core0_foreign_irqs;
+static bool g_core0_systick_irq;
+static bool g_checked;
+
+void irq_affinity_snapshot()
+{
+	g_core0_foreign_irqs = enabled_irqs() & ~CORE0_IRQ_MASK;
+	g_core0_systick_irq = systick_hw->csr & M0PLUS_SYST_CSR_TICKINT_BITS;
+
+	__dmb();
+	g_snapshot_taken = true;
+}
+
+void irq_affinity_check()
+{
+	if (g_checked || !g_snapshot_taken)
+		return;
+
+	g_checked = true;
+	__dmb();
+
+	const uint32_t foreign = g_core0_foreign_irqs;
+
+	for (uint irq = 0; irq < count_of(irq_names); irq++)
+	{
+		if (foreign & (1u << irq))
+			printf("IRQ affinity: %s enabled on core0\n", irq_names[irq]);
+	}
+
+	if (g_core0_systick_irq)
+		printf("IRQ affinity: SysTick interrupt enabled on core0\n");
+
+	if (!foreign)
+		printf("IRQ affinity: core0 handles PIO0 interrupts only\n");
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+/*
+Interrupt core affinity.
+
+NVIC is per core: interrupt is taken by every core which enabled it, and SDK enables IRQs
+on the core initializing the peripheral. Default alarm pool (sleep_ms / add_alarm_in_ms on any core)
+is initialized on core0 at boot, so its timer interrupt could preempt Joybus reply.
+
+With IRQ_ISOLATION irq_affinity_isolate_core0() disables every IRQ on core0 except PIO0
+and hands them to core1, irq_affinity_core1_init() enables them on core1.
+irq_affinity_snapshot() records IRQs still enabled on core0 regardless of IRQ_ISOLATION,
+irq_affinity_check() reports them from core1 once stdio is up.
+*/
+
+#if IRQ_ISOLATION
+// Call on core0 before launching core1.
+void irq_affinity_isolate_core0();
+
+// Call on core1 before initializing peripherals.
+void irq_affinity_core1_init();
+#else
+inline void irq_affinity_isolate_core0() {}
+inline void irq_affinity_core1_init() {}
+#endif
+
+// Record IRQs enabled on core0 and SysTick interrupt state. Call on core0 before entering Joybus mode.
+void irq_affinity_snapshot();
+
+// Print IRQs enabled on core0 besides PIO0 once, after snapshot is taken. Call from core1 loop.
+void irq_affinity_check();
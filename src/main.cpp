@@ -1,3 +1,5 @@
+#include <string.h>
+
 #include "pico/stdlib.h"
 #include "pico/multicore.h"
 #include "pico/sync.h"
@@ -9,22 +11,44 @@
 
 #include "hid_parser.h"
 #include "hid_gamecube_mapping.h"
+#include "canonical_pad.h"
+#include "pad_conditioning.h"
+#include "trace.h"
+#include "profiler.h"
+#include "hot_path.h"
+#include "irq_affinity.h"
+#include "hid_capture.h"
+#include "decoder_cache.h"
+#include "hid_decoders.h"
+#include "report_rate.h"
+#include "usb_polling.h"
+#include "mount_timeline.h"
+#include "boot_timeline.h"
+#include "rumble.h"
+#include "controller_slots.h"
+#include "pio_usb_host.h"
 
 #include "ps3.h"
 
 #include "sega_mega_drive.h"
 #include "communication_protocols/joybus.hpp"
+#include "communication_protocols/joybus/capture.hpp"
+#include "communication_protocols/joybus/reply_stats.hpp"
 
 // Minimal frequency required for stable USB Host support on RP2040 is 144 MHz (multiple of 48 MHz USB clock).
 // GameCube JoyBus support pio program timings are for 25 MHz clock.
 // JoyBus pio program clock divider set to 6 (150/6).
 // 125 MHz with pio divider set to 5 working with DualShock 4, Xbox Series Model 1914 Controller; Xbox 360 controller unstable, DualSense attachment not detected (VBUS below 5V issue).
+// PIO-USB host port needs multiple of 12 MHz: 120 MHz with pio divider set to 5 (pio_usb_host.h).
+#if PIO_USB_HOST
+const int FREQUENCY_MHZ = 120;
+#else
 const int FREQUENCY_MHZ = 150;
+#endif
 
 const uint8_t TRIGGER_CLICK_TRESHOLD = 32;
 
-GCReport globalGCState = defaultGcReport;
-spin_lock_t* shared_data_lock = nullptr;
+volatile bool inputs_ready = false; // Set by core1 when controller slots, pad profiles and Mega Drive GPIO are initialized
 bool usb_gamepad_connected = false;
 
 enum usb_hid_device_type
@@ -34,7 +58,23 @@ enum usb_hid_device_type
 	USB_HID_DEVICE_DUALSHOCK3
 };
 
-usb_hid_device_type g_device_type[CFG_TUH_DEVICE_MAX] = {};
+usb_hid_device_type g_device_type[USB_DEVICE_ADDRESSES] = {};
+hid_decoder_t g_decoder[USB_DEVICE_ADDRESSES] = {}; // Generated decoder, nullptr - generic parser
+uint8_t g_device_slot[USB_DEVICE_ADDRESSES] = {}; // First controller slot of HID device pads
+uint8_t g_device_pads[USB_DEVICE_ADDRESSES] = {}; // Controller slots claimed by HID device
+
+// Generic parser state (arena, decoder cache image) is global: one mounted device at a time decodes with ParseReport()
+static uint8_t g_parser_dev_addr = 0; // 0 - free
+
+canonical_pad g_pads[CONTROLLER_SLOTS] = { neutralCanonicalPad, neutralCanonicalPad, neutralCanonicalPad, neutralCanonicalPad };
+
+static void ps3_init_complete(uint8_t dev_addr, bool success)
+{
+	if(!success)
+		TU_LOG1("[DS3] Enable command failed\n");
+
+	mount_timeline_event(dev_addr, MOUNT_EVENT_INIT_DONE);
+}
 
 void tuh_hid_mount_cb(uint8_t dev_addr, uint8_t instance,
 					  uint8_t const* desc_report, uint16_t desc_len)
@@ -44,148 +84,223 @@ void tuh_hid_mount_cb(uint8_t dev_addr, uint8_t instance,
 	uint16_t vid, pid;
     tuh_vid_pid_get(dev_addr, &vid, &pid);
 
-	if(ps3_usb_match(vid, pid))
+	const bool ps3 = ps3_usb_match(vid, pid);
+
+	mount_timeline_mount(dev_addr, ps3 ? PAD_SOURCE_DUALSHOCK3 : PAD_SOURCE_HID);
+
+	if(!ps3 && !desc_report)
 	{
-		if(ps3_usb_init(dev_addr, instance))
-			g_device_type[dev_addr] = USB_HID_DEVICE_DUALSHOCK3;
-		else
+		TU_LOG1("[HID] Descriptor larger than enumeration buffer (%d bytes)\n", CFG_TUH_ENUMERATION_BUFSIZE);
+
+		return;
+	}
+
+	// Queue first report receive before descriptor parsing and init transfers:
+	// report callback runs from USB host task after this callback returns, device type is set by then.
+	tuh_hid_receive_report(dev_addr, instance);
+	mount_timeline_event(dev_addr, MOUNT_EVENT_ARMED);
+
+	hid_capture_descriptor(dev_addr, instance, vid, pid, desc_report, desc_len);
+
+	usb_hid_device_type type = USB_HID_DEVICE_STANDARD;
+	uint8_t pads = 1; // Generated decoders and DualShock 3 are single pad
+
+	if(ps3)
+	{
+		if(!ps3_usb_init(dev_addr, instance, ps3_init_complete))
 			return;
+
+		type = USB_HID_DEVICE_DUALSHOCK3;
 	}
 	else
 	{
-		if (desc_report)
-		{
-			TU_LOG1("[HID] Using built-in descriptor (%d bytes)\n", desc_len);
+		TU_LOG1("[HID] Using built-in descriptor (%d bytes)\n", desc_len);
+
+		const uint32_t hash = hid_parser_hash(desc_report, desc_len, hid_to_gamecube_mapping);
 
-			if(ParseReportDescriptor(desc_report, desc_len, hid_to_gamecube_mapping))
-				g_device_type[dev_addr] = USB_HID_DEVICE_STANDARD;
-			else
-				return;
+		g_decoder[dev_addr] = hid_decoder_find(vid, pid, hash);
+
+		if(g_decoder[dev_addr])
+			TU_LOG1("[HID] Using generated decoder\n");
+		else if(g_parser_dev_addr)
+		{
+			TU_LOG1("[HID] Generic parser is used by device %d\n", g_parser_dev_addr);
+			return;
 		}
 		else
 		{
-			TU_LOG1("[HID] Descriptor too large (%d bytes)\n", desc_len);
+			if(!decoder_cache_load(vid, pid, hash))
+			{
+				if(!ParseReportDescriptor(desc_report, desc_len, hid_to_gamecube_mapping))
+					return;
 
-			return;
+				decoder_cache_store(vid, pid, hash);
+			}
+
+			g_parser_dev_addr = dev_addr;
+			pads = hid_parser_pads();
+
+			if(pads < 1)
+				pads = 1;
+			else if(pads > CONTROLLER_SLOTS)
+				pads = CONTROLLER_SLOTS;
 		}
 	}
 
-	usb_gamepad_connected = true;
+	const uint8_t slot = controller_slots_claim(pads);
 
-	tuh_hid_receive_report(dev_addr, instance); // Queue first report receive
+	if(slot == CONTROLLER_SLOTS)
+	{
+		TU_LOG1("[HID] No free controller slot for %d pads\n", pads);
+
+		if(g_parser_dev_addr == dev_addr)
+			g_parser_dev_addr = 0;
+
+		g_decoder[dev_addr] = nullptr;
+
+		return;
+	}
+
+	for(uint8_t i = 0; i < pads; i++)
+	{
+		g_pads[slot + i] = neutralCanonicalPad;
+		pad_conditioning_slot_reset(slot + i); // Stick centre is calibrated again from first rest report
+	}
+
+	g_device_slot[dev_addr] = slot;
+	g_device_pads[dev_addr] = pads;
+	g_device_type[dev_addr] = type;
+
+	rumble_hid_mount(dev_addr, instance, vid, pid);
+
+	usb_gamepad_connected = true;
 }
 
 void tuh_hid_umount_cb(uint8_t dev_addr, uint8_t instance)
 {
 	TU_LOG1("HID device removed\n");
 
-	g_device_type[dev_addr] = USB_HID_DEVICE_NONE;
+	if(g_device_type[dev_addr] != USB_HID_DEVICE_NONE)
+		controller_slots_release(g_device_slot[dev_addr], g_device_pads[dev_addr]);
 
-	usb_gamepad_connected = false;
-}
+	if(g_parser_dev_addr == dev_addr)
+		g_parser_dev_addr = 0;
 
-GCReport g_gamepad = defaultGcReport;
+	g_device_type[dev_addr] = USB_HID_DEVICE_NONE;
+	g_decoder[dev_addr] = nullptr;
+	g_device_pads[dev_addr] = 0;
 
-static void gamepad_callback(uint32_t control_type, uint32_t value)
-{
-	const GamecubeMappings mapping = (GamecubeMappings)control_type;
+	report_rate_unmount(dev_addr, instance);
+	mount_timeline_unmount(dev_addr);
+	rumble_unmount(dev_addr, instance);
 
-	const char* gc_controls_names[] = {"A", "B", "X", "Y", "START", "R", "L", "D", "U", "Z", "R", "L", "AXIS_X", "AXIS_Y", "AXIS_CX", "AXIS_CY", "AXIS_L", "AXIS_R"};
+	usb_gamepad_connected = controller_slots_claimed() != 0; // Pad on other port stays
+}
 
-	if(control_type < MAP_GAMECUBE_AXIS_X)
-	{
-		TU_LOG2("gamepad_callback: type=%s, value=%d\n", gc_controls_names[control_type], value);
-	}
+// ParseReport() pad of generic parser device to its controller slot
+static void HOT_PATH(gamepad_callback)(uint8_t pad, uint32_t control_type, uint32_t value)
+{
+	TRACE_DEBUG(TRACE_EVENT_GAMEPAD_CONTROL, control_type, value, pad);
 
-	if (mapping == MAP_GAMECUBE_BUTTON_A)
-		g_gamepad.a = true;
-	else if(mapping == MAP_GAMECUBE_BUTTON_B)
-		g_gamepad.b = true;
-	else if(mapping == MAP_GAMECUBE_BUTTON_X)
-		g_gamepad.x = true;
-	else if(mapping == MAP_GAMECUBE_BUTTON_Y)
-		g_gamepad.y = true;
-	else if(mapping == MAP_GAMECUBE_BUTTON_START)
-		g_gamepad.start = true;
-	else if(mapping == MAP_GAMECUBE_R)
-		g_gamepad.dRight = true;
-	else if(mapping == MAP_GAMECUBE_L)
-		g_gamepad.dLeft = true;
-	else if(mapping == MAP_GAMECUBE_D)
-		g_gamepad.dDown = true;
-	else if(mapping == MAP_GAMECUBE_U)
-		g_gamepad.dUp = true;
-	else if(mapping == MAP_GAMECUBE_BUTTON_Z)
-		g_gamepad.z = true;
-	else if(mapping == MAP_GAMECUBE_BUTTON_R)
-		g_gamepad.r = true;
-	else if(mapping == MAP_GAMECUBE_BUTTON_L)
-		g_gamepad.l = true;
-	else if(mapping == MAP_GAMECUBE_AXIS_X)
-		g_gamepad.xStick = value;
-	else if(mapping == MAP_GAMECUBE_AXIS_Y)
-		g_gamepad.yStick = UINT8_MAX - value;
-	else if(mapping == MAP_GAMECUBE_AXIS_CX)
-		g_gamepad.cxStick = value;
-	else if(mapping == MAP_GAMECUBE_AXIS_CY)
-		g_gamepad.cyStick = UINT8_MAX - value;
-	else if(mapping == MAP_GAMECUBE_AXIS_L) // Note: DualShock 4 / DualSence also maps to L2/R2 triggers press
-		g_gamepad.analogL = value;
-	else if(mapping == MAP_GAMECUBE_AXIS_R)
-		g_gamepad.analogR = value;
+	if (pad < g_device_pads[g_parser_dev_addr])
+		canonical_pad_apply(&g_pads[g_device_slot[g_parser_dev_addr] + pad], control_type, value);
 }
 
-void tuh_hid_report_received_cb(uint8_t dev_addr,
+void HOT_PATH(tuh_hid_report_received_cb)(uint8_t dev_addr,
 								uint8_t instance,
 								uint8_t const* report,
 								uint16_t len)
 {
+	report_rate_record(dev_addr, instance);
+	hid_capture_report(dev_addr, instance, report, len);
+
+	if(g_device_type[dev_addr] == USB_HID_DEVICE_NONE)
+		return; // Unsupported device, first receive was queued before mount failed
+
+	mount_timeline_event(dev_addr, MOUNT_EVENT_FIRST_REPORT);
+
+	// Copy report out of endpoint buffer and queue the next receive before decoding,
+	// so slow decode doesn't make the device miss polling interval
+	static uint8_t report_copy[CFG_TUH_HID_EPIN_BUFSIZE];
+
+	if(len > sizeof(report_copy))
+		len = sizeof(report_copy);
+
+	memcpy(report_copy, report, len);
+	report = report_copy;
+
+	usb_polling_receive(dev_addr, instance, tuh_hid_receive_report);
+
+	const uint8_t slot = g_device_slot[dev_addr];
+
 	if(g_device_type[dev_addr] == USB_HID_DEVICE_DUALSHOCK3)
 	{
 		ps3_hid_report_t* ps3 = ps3_usb_parse_report(report, len);
 
 		if(ps3)
 		{
-			g_gamepad = defaultGcReport;
-
-			g_gamepad.a = ps3->button_cross;
-			g_gamepad.b = ps3->button_circle;
-			g_gamepad.x = ps3->button_square;
-			g_gamepad.y = ps3->button_triangle;
-			g_gamepad.start = ps3->button_start;
-			
-			g_gamepad.dLeft = ps3->dpad_left;
-			g_gamepad.dRight = ps3->dpad_right;
-			g_gamepad.dDown = ps3->dpad_down;
-			g_gamepad.dUp = ps3->dpad_up;
-
-			g_gamepad.l = ps3->trigger_l2_analog > TRIGGER_CLICK_TRESHOLD;
-			g_gamepad.r = ps3->trigger_r2_analog > TRIGGER_CLICK_TRESHOLD;	
-			//g_gamepad.l = ps3->trigger_l1;
-			//g_gamepad.r = ps3->trigger_r1;
-			g_gamepad.z = ps3->trigger_r1;
-			
-			g_gamepad.xStick = ps3->joy_left_x;
-			g_gamepad.yStick = UINT8_MAX - ps3->joy_left_y;
-			g_gamepad.cxStick = ps3->joy_right_x;
-			g_gamepad.cyStick = UINT8_MAX - ps3->joy_right_y;
-			g_gamepad.analogL = ps3->trigger_l2_analog;
-			g_gamepad.analogR = ps3->trigger_r2_analog;
+			canonical_pad& pad = g_pads[slot];
+
+			pad.buttons =
+				(uint32_t)ps3->button_cross << PAD_BUTTON_SOUTH |
+				(uint32_t)ps3->button_circle << PAD_BUTTON_EAST |
+				(uint32_t)ps3->button_square << PAD_BUTTON_WEST |
+				(uint32_t)ps3->button_triangle << PAD_BUTTON_NORTH |
+				(uint32_t)ps3->trigger_l1 << PAD_BUTTON_L1 |
+				(uint32_t)ps3->trigger_r1 << PAD_BUTTON_R1 |
+				(uint32_t)(ps3->trigger_l2_analog > TRIGGER_CLICK_TRESHOLD) << PAD_BUTTON_L2 |
+				(uint32_t)(ps3->trigger_r2_analog > TRIGGER_CLICK_TRESHOLD) << PAD_BUTTON_R2 |
+				(uint32_t)ps3->button_select << PAD_BUTTON_SELECT |
+				(uint32_t)ps3->button_start << PAD_BUTTON_START |
+				(uint32_t)ps3->stick_click_left << PAD_BUTTON_L3 |
+				(uint32_t)ps3->stick_click_right << PAD_BUTTON_R3 |
+				(uint32_t)ps3->dpad_up << PAD_BUTTON_UP |
+				(uint32_t)ps3->dpad_down << PAD_BUTTON_DOWN |
+				(uint32_t)ps3->dpad_left << PAD_BUTTON_LEFT |
+				(uint32_t)ps3->dpad_right << PAD_BUTTON_RIGHT;
+
+			PAD_AXIS(&pad, PAD_AXIS_LX) = ps3->joy_left_x;
+			PAD_AXIS(&pad, PAD_AXIS_LY) = UINT8_MAX - ps3->joy_left_y;
+			PAD_AXIS(&pad, PAD_AXIS_RX) = ps3->joy_right_x;
+			PAD_AXIS(&pad, PAD_AXIS_RY) = UINT8_MAX - ps3->joy_right_y;
+			PAD_AXIS(&pad, PAD_AXIS_LT) = ps3->trigger_l2_analog;
+			PAD_AXIS(&pad, PAD_AXIS_RT) = ps3->trigger_r2_analog;
+
+			controller_slot_publish(slot, pad_profile_report(&pad, PAD_SOURCE_DUALSHOCK3, slot));
 		}
 	}
-	else if (g_device_type[dev_addr] = USB_HID_DEVICE_STANDARD)
+	else if (g_device_type[dev_addr] == USB_HID_DEVICE_STANDARD)
 	{
-		g_gamepad = defaultGcReport;
-	
-		ParseReport(report, len, gamepad_callback);
-	}
+		if(g_decoder[dev_addr])
+		{
+			g_pads[slot] = neutralCanonicalPad;
+			g_decoder[dev_addr](report, len, &g_pads[slot]); // Single pad devices only
+			controller_slot_publish(slot, pad_profile_report(&g_pads[slot], PAD_SOURCE_HID, slot));
+		}
+		else
+		{
+			// Multi-pad devices: report updates pads it maps only, other pads keep state from their reports
+			const uint8_t pads = hid_parser_report_pads(report, len);
+
+			for(uint8_t pad = 0; pad < g_device_pads[dev_addr]; pad++)
+			{
+				if(pads & (1 << pad))
+					g_pads[slot + pad] = neutralCanonicalPad;
+			}
+
+			ParseReport(report, len, gamepad_callback);
+
+			for(uint8_t pad = 0; pad < g_device_pads[dev_addr]; pad++)
+			{
+				if(pads & (1 << pad))
+					controller_slot_publish(slot + pad, pad_profile_report(&g_pads[slot + pad], PAD_SOURCE_HID, slot + pad));
+			}
+		}
 
-	spin_lock_unsafe_blocking(shared_data_lock);
-	globalGCState = g_gamepad;
-	spin_unlock_unsafe(shared_data_lock);
+		decoder_cache_report_decoded();
+	}
 
-	// Queue the next receive immediately to maintain polling
-	tuh_hid_receive_report(dev_addr, instance);
+	mount_timeline_event(dev_addr, MOUNT_EVENT_PUBLISHED);
 }
 
 // Callback invoked when a device is mounted
@@ -200,48 +315,46 @@ void tuh_umount_cb(uint8_t dev_addr)
 	printf("A device with address %d was unmounted\r\n", dev_addr);
 }
 
-GCReport getControllerState()
+GCReport HOT_PATH(getControllerState)()
 {
+	if(!inputs_ready)
+		return defaultGcReport;
+
+	boot_timeline_event(BOOT_EVENT_FIRST_INPUT_REPLY);
+
 	if(usb_gamepad_connected)
-	{
-		spin_lock_unsafe_blocking(shared_data_lock);
-		GCReport report = globalGCState;
-		spin_unlock_unsafe(shared_data_lock);
-		return report;
-	}
+		return controller_slot_read_joybus();
 	else
 	{
 		const smd_state_t smd = getSegaMegaDriveReport();
 
-		GCReport gcReport = defaultGcReport;
-
-		gcReport.a = smd.a;
-		gcReport.b = smd.b;
-		gcReport.x = smd.x;
-		gcReport.y = smd.y;
-		gcReport.l = smd.z;
-		gcReport.r = smd.c;
-
-		gcReport.start = smd.start;
-
-		gcReport.dLeft = smd.left;
-		gcReport.dRight = smd.right;
-		gcReport.dDown = smd.down;
-		gcReport.dUp = smd.up;
-		gcReport.z = smd.mode;
-
-		return gcReport;
+		canonical_pad pad = neutralCanonicalPad;
+
+		pad.buttons =
+			(uint32_t)smd.a << PAD_BUTTON_SOUTH |
+			(uint32_t)smd.b << PAD_BUTTON_EAST |
+			(uint32_t)smd.x << PAD_BUTTON_WEST |
+			(uint32_t)smd.y << PAD_BUTTON_NORTH |
+			(uint32_t)smd.z << PAD_BUTTON_L2 |
+			(uint32_t)smd.c << PAD_BUTTON_R2 |
+			(uint32_t)smd.mode << PAD_BUTTON_R1 |
+			(uint32_t)smd.start << PAD_BUTTON_START |
+			(uint32_t)smd.up << PAD_BUTTON_UP |
+			(uint32_t)smd.down << PAD_BUTTON_DOWN |
+			(uint32_t)smd.left << PAD_BUTTON_LEFT |
+			(uint32_t)smd.right << PAD_BUTTON_RIGHT;
+
+		return pad_profile_report(&pad, PAD_SOURCE_MEGA_DRIVE);
 	}
 }
 
 #include "xinput_host.h"
 
 //Since https://github.com/hathach/tinyusb/pull/2222, we can add in custom vendor drivers easily
+// XInput driver, wrapped together with HID driver when polling interval override is enabled (src/usb_polling.h)
 usbh_class_driver_t const* usbh_app_driver_get_cb(uint8_t* driver_count)
 {
-	*driver_count = 1;
-
-	return &usbh_xinput_driver;
+	return usb_polling_drivers(driver_count);
 }
 
 static inline uint8_t int16_to_u8_biased(int16_t x)
@@ -249,124 +362,254 @@ static inline uint8_t int16_to_u8_biased(int16_t x)
 	return (uint8_t)((uint32_t)(x + 32768) >> 8);
 }
 
-void tuh_xinput_report_received_cb(uint8_t dev_addr, uint8_t instance, xinputh_interface_t const* xid_itf, uint16_t len)
+#define XINPUT_INSTANCES 4 // Xbox 360 wireless receiver
+
+static uint8_t g_xinput_slot[USB_DEVICE_ADDRESSES][XINPUT_INSTANCES]; // Claimed controller slot + 1, 0 - none
+
+// Controller slot of XInput pad, CONTROLLER_SLOTS if none.
+static inline uint8_t xinput_slot(uint8_t dev_addr, uint8_t instance)
 {
-	const xinput_gamepad_t *pad = &xid_itf->pad;
-	const char* type_str;
+	if (dev_addr >= USB_DEVICE_ADDRESSES || instance >= XINPUT_INSTANCES || !g_xinput_slot[dev_addr][instance])
+		return CONTROLLER_SLOTS;
 
+	return g_xinput_slot[dev_addr][instance] - 1;
+}
+
+void HOT_PATH(tuh_xinput_report_received_cb)(uint8_t dev_addr, uint8_t instance, xinputh_interface_t const* xid_itf, uint16_t len)
+{
 	if (xid_itf->last_xfer_result == XFER_RESULT_SUCCESS)
+		report_rate_record(dev_addr, instance);
+
+	// Copy parsed pad state and queue the next receive before mapping
+	const xinput_gamepad_t pad_copy = xid_itf->pad;
+	const xinput_gamepad_t *pad = &pad_copy;
+	const bool new_pad_data = xid_itf->last_xfer_result == XFER_RESULT_SUCCESS && xid_itf->connected && xid_itf->new_pad_data;
+
+	usb_polling_receive(dev_addr, instance, tuh_xinput_receive_report);
+
+	if (new_pad_data)
 	{
-		switch (xid_itf->type)
-		{
-			case 1: type_str = "Xbox One";          break;
-			case 2: type_str = "Xbox 360 Wireless"; break;
-			case 3: type_str = "Xbox 360 Wired";    break;
-			case 4: type_str = "Xbox OG";           break;
-			default: type_str = "Unknown";
-		}
+		mount_timeline_event(dev_addr, MOUNT_EVENT_FIRST_REPORT);
+
+		// Type: 1 - Xbox One, 2 - Xbox 360 Wireless, 3 - Xbox 360 Wired, 4 - Xbox OG
+		TRACE_DEBUG(TRACE_EVENT_XINPUT_REPORT, pad->wButtons,
+			(dev_addr & 0x0F) | (instance & 0x0F) << 4 | (uint32_t)xid_itf->type << 8 | (uint32_t)pad->bLeftTrigger << 16 | (uint32_t)pad->bRightTrigger << 24,
+			int16_to_u8_biased(pad->sThumbLX) | int16_to_u8_biased(pad->sThumbLY) << 8 | int16_to_u8_biased(pad->sThumbRX) << 16 | (uint32_t)int16_to_u8_biased(pad->sThumbRY) << 24);
+
+		canonical_pad canonical;
+		const uint16_t buttons = pad->wButtons;
+
+		canonical.buttons =
+			(uint32_t)((buttons & XINPUT_GAMEPAD_A) != 0) << PAD_BUTTON_SOUTH |
+			(uint32_t)((buttons & XINPUT_GAMEPAD_B) != 0) << PAD_BUTTON_EAST |
+			(uint32_t)((buttons & XINPUT_GAMEPAD_X) != 0) << PAD_BUTTON_WEST |
+			(uint32_t)((buttons & XINPUT_GAMEPAD_Y) != 0) << PAD_BUTTON_NORTH |
+			(uint32_t)((buttons & XINPUT_GAMEPAD_LEFT_SHOULDER) != 0) << PAD_BUTTON_L1 |
+			(uint32_t)((buttons & XINPUT_GAMEPAD_RIGHT_SHOULDER) != 0) << PAD_BUTTON_R1 |
+			(uint32_t)(pad->bLeftTrigger > TRIGGER_CLICK_TRESHOLD) << PAD_BUTTON_L2 |
+			(uint32_t)(pad->bRightTrigger > TRIGGER_CLICK_TRESHOLD) << PAD_BUTTON_R2 |
+			(uint32_t)((buttons & XINPUT_GAMEPAD_BACK) != 0) << PAD_BUTTON_SELECT |
+			(uint32_t)((buttons & XINPUT_GAMEPAD_START) != 0) << PAD_BUTTON_START |
+			(uint32_t)((buttons & XINPUT_GAMEPAD_LEFT_THUMB) != 0) << PAD_BUTTON_L3 |
+			(uint32_t)((buttons & XINPUT_GAMEPAD_RIGHT_THUMB) != 0) << PAD_BUTTON_R3 |
+			(uint32_t)((buttons & XINPUT_GAMEPAD_GUIDE) != 0) << PAD_BUTTON_HOME |
+			(uint32_t)((buttons & XINPUT_GAMEPAD_DPAD_UP) != 0) << PAD_BUTTON_UP |
+			(uint32_t)((buttons & XINPUT_GAMEPAD_DPAD_DOWN) != 0) << PAD_BUTTON_DOWN |
+			(uint32_t)((buttons & XINPUT_GAMEPAD_DPAD_LEFT) != 0) << PAD_BUTTON_LEFT |
+			(uint32_t)((buttons & XINPUT_GAMEPAD_DPAD_RIGHT) != 0) << PAD_BUTTON_RIGHT;
+
+		PAD_AXIS(&canonical, PAD_AXIS_LX) = int16_to_u8_biased(pad->sThumbLX);
+		PAD_AXIS(&canonical, PAD_AXIS_LY) = int16_to_u8_biased(pad->sThumbLY);
+		PAD_AXIS(&canonical, PAD_AXIS_RX) = int16_to_u8_biased(pad->sThumbRX);
+		PAD_AXIS(&canonical, PAD_AXIS_RY) = int16_to_u8_biased(pad->sThumbRY);
+		PAD_AXIS(&canonical, PAD_AXIS_LT) = pad->bLeftTrigger;
+		PAD_AXIS(&canonical, PAD_AXIS_RT) = pad->bRightTrigger;
+
+		// Wireless receiver pads publish to own slots
+		const uint8_t slot = xinput_slot(dev_addr, instance);
+		controller_slot_publish(slot, pad_profile_report(&canonical, PAD_SOURCE_XINPUT, slot));
+
+		mount_timeline_event(dev_addr, MOUNT_EVENT_PUBLISHED);
+	}
+}
+
+// XInput mount init transfers, next one is queued when previous one is sent
+enum xinput_init_step : uint8_t
+{
+	XINPUT_INIT_LED_0,
+	XINPUT_INIT_LED_1,
+	XINPUT_INIT_RUMBLE_OFF,
+	XINPUT_INIT_SENDING, // Last init transfer is queued
+	XINPUT_INIT_DONE // Later sent reports are rumble only
+};
+
+static uint8_t g_xinput_init_step[USB_DEVICE_ADDRESSES][XINPUT_INSTANCES];
+
+static void xinput_init_next(uint8_t dev_addr, uint8_t instance)
+{
+	if (dev_addr >= USB_DEVICE_ADDRESSES || instance >= XINPUT_INSTANCES)
+		return;
 
-		if (xid_itf->connected && xid_itf->new_pad_data)
+	uint8_t& step = g_xinput_init_step[dev_addr][instance];
+	bool queued = false;
+
+	if (step == XINPUT_INIT_DONE)
+		return;
+
+	// Transfer that can't be queued is skipped
+	while (step < XINPUT_INIT_SENDING && !queued)
+	{
+		switch (step++)
 		{
-			TU_LOG2("[%02x, %02x], Type: %s, Buttons %04x, LT: %02x RT: %02x, LX: %d, LY: %d, RX: %d, RY: %d\n",
-				dev_addr, instance, type_str, pad->wButtons, pad->bLeftTrigger, pad->bRightTrigger, pad->sThumbLX, pad->sThumbLY, pad->sThumbRX, pad->sThumbRY);
-
-			GCReport gc = defaultGcReport;
-			const uint16_t buttons = pad->wButtons;
-
-			gc.a = (buttons & XINPUT_GAMEPAD_A) != 0;
-			gc.b = (buttons & XINPUT_GAMEPAD_B) != 0;
-			gc.x = (buttons & XINPUT_GAMEPAD_X) != 0;
-			gc.y = (buttons & XINPUT_GAMEPAD_Y) != 0;
-			gc.start = (buttons & (XINPUT_GAMEPAD_START | XINPUT_GAMEPAD_GUIDE)) != 0;
-			
-			gc.dLeft = (buttons & XINPUT_GAMEPAD_DPAD_LEFT) != 0;
-			gc.dRight = (buttons & XINPUT_GAMEPAD_DPAD_RIGHT) != 0;
-			gc.dDown = (buttons & XINPUT_GAMEPAD_DPAD_DOWN) != 0;
-			gc.dUp = (buttons & XINPUT_GAMEPAD_DPAD_UP) != 0;
-
-			gc.l = pad->bLeftTrigger > TRIGGER_CLICK_TRESHOLD;
-			gc.r = pad->bRightTrigger > TRIGGER_CLICK_TRESHOLD;	
-			//gc.l = (buttons & XINPUT_GAMEPAD_LEFT_SHOULDER) != 0;
-			//gc.r = (buttons & XINPUT_GAMEPAD_RIGHT_SHOULDER) != 0;
-			gc.z = (buttons & XINPUT_GAMEPAD_RIGHT_SHOULDER) != 0;
-			
-			gc.xStick = int16_to_u8_biased(pad->sThumbLX);
-			gc.yStick = int16_to_u8_biased(pad->sThumbLY);
-			gc.cxStick = int16_to_u8_biased(pad->sThumbRX);
-			gc.cyStick = int16_to_u8_biased(pad->sThumbRY);
-			gc.analogL = pad->bLeftTrigger;
-			gc.analogR = pad->bRightTrigger;
-
-			spin_lock_unsafe_blocking(shared_data_lock);
-			globalGCState = gc;
-			spin_unlock_unsafe(shared_data_lock);
+		case XINPUT_INIT_LED_0:
+			queued = tuh_xinput_set_led(dev_addr, instance, 0, false);
+			break;
+		case XINPUT_INIT_LED_1:
+			queued = tuh_xinput_set_led(dev_addr, instance, 1, false);
+			break;
+		case XINPUT_INIT_RUMBLE_OFF:
+			queued = tuh_xinput_set_rumble(dev_addr, instance, 0, 0, false);
+			break;
 		}
 	}
 
-	tuh_xinput_receive_report(dev_addr, instance);
+	if (!queued)
+	{
+		step = XINPUT_INIT_DONE;
+		mount_timeline_event(dev_addr, MOUNT_EVENT_INIT_DONE);
+		rumble_xinput_mount(dev_addr, instance); // After rumble off init transfer, so it can't override console state
+	}
+}
+
+void tuh_xinput_report_sent_cb(uint8_t dev_addr, uint8_t instance, uint8_t const*, uint16_t)
+{
+	rumble_sent(dev_addr, instance);
+	xinput_init_next(dev_addr, instance);
 }
 
 void tuh_xinput_mount_cb(uint8_t dev_addr, uint8_t instance, const xinputh_interface_t *xinput_itf)
 {
 	TU_LOG1("XInput Mounted %02x %d\n", dev_addr, instance);
-	// If this is a Xbox 360 Wireless controller we need to wait for a connection packet
-	// on the in pipe before setting LEDs etc. So just start getting data until a controller is connected.
-	if (xinput_itf->type == XBOX360_WIRELESS && xinput_itf->connected == false)
+
+	mount_timeline_mount(dev_addr, PAD_SOURCE_XINPUT);
+
+	// Mount callback runs again when wireless pad connects: pad keeps its slot
+	if (dev_addr < USB_DEVICE_ADDRESSES && instance < XINPUT_INSTANCES && !g_xinput_slot[dev_addr][instance])
 	{
-		tuh_xinput_receive_report(dev_addr, instance);
+		const uint8_t slot = controller_slots_claim(1);
 
-		return;
+		if (slot < CONTROLLER_SLOTS)
+		{
+			g_xinput_slot[dev_addr][instance] = slot + 1;
+			pad_conditioning_slot_reset(slot); // Stick centre is calibrated again from first rest report
+		}
+		else
+			TU_LOG1("[XInput] No free controller slot\n");
 	}
 
-	tuh_xinput_set_led(dev_addr, instance, 0, true);
-	tuh_xinput_set_led(dev_addr, instance, 1, true);
-	tuh_xinput_set_rumble(dev_addr, instance, 0, 0, true);
+	// Queue first report receive before LED / rumble transfers
 	tuh_xinput_receive_report(dev_addr, instance);
+	mount_timeline_event(dev_addr, MOUNT_EVENT_ARMED);
 
-	usb_gamepad_connected = true;
+	// If this is a Xbox 360 Wireless controller we need to wait for a connection packet
+	// on the in pipe before setting LEDs etc. So just start getting data until a controller is connected.
+	if (xinput_itf->type == XBOX360_WIRELESS && xinput_itf->connected == false)
+		return;
+
+	if (dev_addr < USB_DEVICE_ADDRESSES && instance < XINPUT_INSTANCES)
+		g_xinput_init_step[dev_addr][instance] = XINPUT_INIT_LED_0;
+
+	xinput_init_next(dev_addr, instance);
+
+	usb_gamepad_connected = controller_slots_claimed() != 0; // No slot claimed when all slots are taken
 }
 
 void tuh_xinput_umount_cb(uint8_t dev_addr, uint8_t instance)
 {
 	TU_LOG1("XInput Unmounted %02x %d\n", dev_addr, instance);
 
-	usb_gamepad_connected = false;
+	if (dev_addr < USB_DEVICE_ADDRESSES && instance < XINPUT_INSTANCES)
+		g_xinput_init_step[dev_addr][instance] = XINPUT_INIT_DONE;
+
+	const uint8_t slot = xinput_slot(dev_addr, instance);
+
+	if (slot < CONTROLLER_SLOTS)
+	{
+		controller_slots_release(slot, 1);
+		g_xinput_slot[dev_addr][instance] = 0;
+	}
+
+	report_rate_unmount(dev_addr, instance);
+	mount_timeline_unmount(dev_addr);
+	rumble_unmount(dev_addr, instance);
+
+	usb_gamepad_connected = controller_slots_claimed() != 0; // Pad on other port stays
 }
 
 void core1_main(void)
 {
-	if (!tuh_init(BOARD_TUH_RHPORT))
+	irq_affinity_core1_init(); // Take over interrupts isolated from Joybus core
+
+	// Joybus core is already answering console with neutral reports
+	stdio_uart_init();
+	stdio_init_all();
+
+	printf("SMD2GC Sega Mega Drive / USB HID to GameCube adapter\nhttps://github.com/proboterror/SMD2GC\n");
+
+	trace_init();
+
+	controller_slots_init();
+
+	pad_profiles_init();
+
+	initSegaMegaDrive();
+
+	__dmb();
+	inputs_ready = true;
+	boot_timeline_event(BOOT_EVENT_INPUTS_READY);
+
+	decoder_cache_init();
+
+	if (!pio_usb_host_start())
 	{
 		printf("Failed to initialize TinyUSB Host\n");
 		return;
 	}
 
+	profiler_start();
+
 	while(true)
 	{
 		tuh_task();
+		trace_task(); // Drain trace rings to UART while USB host is idle
+		CommunicationProtocols::Joybus::captureTask();
+		CommunicationProtocols::Joybus::replyStatsTask();
+		profiler_task();
+		hid_capture_task();
+		decoder_cache_task();
+		report_rate_task();
+		usb_polling_task();
+		mount_timeline_task();
+		boot_timeline_task();
+		rumble_task();
+		irq_affinity_check();
+		pad_profile_task();
 		tight_loop_contents(); // sleep_us(100);
 	}
 }
 
 int main()
 {
-	set_sys_clock_khz(1000 * FREQUENCY_MHZ, true);
+	set_sys_clock_khz(1000 * FREQUENCY_MHZ, true); // Joybus PIO clock divider assumes 150 MHz (120 MHz with PIO_USB_HOST)
 
-	stdio_uart_init();
-	stdio_init_all();
-
-	printf("SMD2GC Sega Mega Drive / USB HID to GameCube adapter\nhttps://github.com/proboterror/SMD2GC\n");
-
-	uint lock_num = spin_lock_claim_unused(true);  // Low-level: returns uint ID; panic if none free
-	if (lock_num == (uint)-1) // No free locks (rare, but check)
-	{
-		panic("No free spinlocks available!");
-	}
-	shared_data_lock = spin_lock_init(lock_num);   // High-level: convert uint to spin_lock_t*
+	// Everything else is initialized by core1 while Joybus core answers console
+	irq_affinity_isolate_core0();
 
 	multicore_launch_core1(core1_main);
 
-	initSegaMegaDrive();
+	profiler_start();
+
+	irq_affinity_snapshot();
 
 	CommunicationProtocols::Joybus::enterMode(
 			[]() {
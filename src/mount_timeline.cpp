@@ -0,0 +1,105 @@
+#include "mount_timeline.h"
+
+#if MOUNT_TIMELINE
+
+#include <stdio.h>
+
+#include "pico/stdlib.h"
+
+#include "canonical_pad.h"
+#include "hot_path.h"
+
+typedef struct mount_timeline
+{
+	uint32_t time_us[MOUNT_EVENTS];
+	uint8_t recorded; // Bit per mount_timeline_event
+	uint8_t source;
+	bool init_pending; // Source has init transfers
+	bool printed;
+} mount_timeline;
+
+static mount_timeline g_timelines[USB_DEVICE_ADDRESSES];
+
+void mount_timeline_attach(uint8_t dev_addr)
+{
+	if (dev_addr >= USB_DEVICE_ADDRESSES || (g_timelines[dev_addr].recorded & (1u << MOUNT_EVENT_ATTACH)))
+		return; // Next interface of same device
+
+	g_timelines[dev_addr] = {};
+	g_timelines[dev_addr].time_us[MOUNT_EVENT_ATTACH] = time_us_32();
+	g_timelines[dev_addr].recorded = 1u << MOUNT_EVENT_ATTACH;
+}
+
+void mount_timeline_mount(uint8_t dev_addr, uint8_t source)
+{
+	if (dev_addr >= USB_DEVICE_ADDRESSES)
+		return;
+
+	mount_timeline_attach(dev_addr);
+
+	g_timelines[dev_addr].source = source;
+	g_timelines[dev_addr].init_pending = source != PAD_SOURCE_HID;
+
+	mount_timeline_event(dev_addr, MOUNT_EVENT_MOUNT);
+}
+
+void HOT_PATH(mount_timeline_event)(uint8_t dev_addr, uint8_t event)
+{
+	if (dev_addr >= USB_DEVICE_ADDRESSES)
+		return;
+
+	mount_timeline* timeline = &g_timelines[dev_addr];
+
+	if (!timeline->recorded || (timeline->recorded & (1u << event)))
+		return;
+
+	timeline->time_us[event] = time_us_32();
+	timeline->recorded |= 1u << event;
+}
+
+void mount_timeline_unmount(uint8_t dev_addr)
+{
+	if (dev_addr < USB_DEVICE_ADDRESSES)
+		g_timelines[dev_addr] = {};
+}
+
+static void print_time(const mount_timeline* timeline, const char* name, uint8_t event)
+{
+	if (timeline->recorded & (1u << event))
+		printf(" %s=%lu", name, (unsigned long)(timeline->time_us[event] - timeline->time_us[MOUNT_EVENT_ATTACH]));
+	else
+		printf(" %s=-", name);
+}
+
+void mount_timeline_task()
+{
+	static const char* source_names[] = { "hid", "dualshock3", "xinput" };
+
+	const uint32_t now = time_us_32();
+
+	for (uint8_t dev_addr = 0; dev_addr < USB_DEVICE_ADDRESSES; dev_addr++)
+	{
+		mount_timeline* timeline = &g_timelines[dev_addr];
+
+		if (!(timeline->recorded & (1u << MOUNT_EVENT_MOUNT)) || timeline->printed)
+			continue;
+
+		const bool published = timeline->recorded & (1u << MOUNT_EVENT_PUBLISHED);
+		const bool init_done = !timeline->init_pending || (timeline->recorded & (1u << MOUNT_EVENT_INIT_DONE));
+
+		if (!(published && init_done) && now - timeline->time_us[MOUNT_EVENT_ATTACH] < MOUNT_TIMELINE_TIMEOUT_MS * 1000)
+			continue;
+
+		timeline->printed = true;
+
+		printf("MOUNT_TIMELINE dev=%u source=%s", dev_addr, timeline->source < PAD_ANALOG_SOURCES ? source_names[timeline->source] : "-");
+		print_time(timeline, "mount_us", MOUNT_EVENT_MOUNT);
+		print_time(timeline, "armed_us", MOUNT_EVENT_ARMED);
+		print_time(timeline, "first_report_us", MOUNT_EVENT_FIRST_REPORT);
+		print_time(timeline, "published_us", MOUNT_EVENT_PUBLISHED);
+		print_time(timeline, "init_done_us", MOUNT_EVENT_INIT_DONE);
+		printf("\n");
+	}
+}
+
+#endif
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "tusb_config.h"
+
+/*
+Hot-plug timeline: time from attach to first published GCReport per device.
+
+Attach is the first class driver open() of the device (polling override wrappers, src/usb_polling.h),
+or class mount callback when wrappers are not built. Bus reset, debounce and enumeration before it are fixed by TinyUSB.
+Mount callbacks queue the first report receive before descriptor parsing and device init transfers,
+init transfers (DualShock 3 enable, XInput LED / rumble) complete asynchronously.
+
+Prints over stdio UART once first report is published and init transfers are done:
+	MOUNT_TIMELINE dev=<n> source=hid|dualshock3|xinput mount_us=<n> armed_us=<n> first_report_us=<n> published_us=<n> init_done_us=<n|->
+Times are relative to attach.
+*/
+
+#define MOUNT_TIMELINE_TIMEOUT_MS 2000 // Print incomplete timeline
+
+enum mount_timeline_event : uint8_t
+{
+	MOUNT_EVENT_ATTACH,
+	MOUNT_EVENT_MOUNT, // Class mount callback
+	MOUNT_EVENT_ARMED, // First report receive queued
+	MOUNT_EVENT_FIRST_REPORT,
+	MOUNT_EVENT_PUBLISHED, // First GCReport published to Joybus core
+	MOUNT_EVENT_INIT_DONE, // Last init transfer completed
+	MOUNT_EVENTS
+};
+
+#if MOUNT_TIMELINE
+// Start timeline of device. Call from class driver open().
+void mount_timeline_attach(uint8_t dev_addr);
+
+// Record class mount, source - PadSources (canonical_pad.h). Starts timeline if attach was not recorded.
+void mount_timeline_mount(uint8_t dev_addr, uint8_t source);
+
+// Record first occurrence of event.
+void mount_timeline_event(uint8_t dev_addr, uint8_t event);
+
+// Forget device. Call from unmount callbacks.
+void mount_timeline_unmount(uint8_t dev_addr);
+
+// Print complete timelines. Call from core1 loop.
+void mount_timeline_task();
+#else
+inline void mount_timeline_attach(uint8_t) {}
+inline void mount_timeline_mount(uint8_t, uint8_t) {}
+inline void mount_timeline_event(uint8_t, uint8_t) {}
+inline void mount_timeline_unmount(uint8_t) {}
+inline void mount_timeline_task() {}
+#endif
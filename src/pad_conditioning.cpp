@@ -0,0 +1,180 @@
+#include "pad_conditioning.h"
+
+#include <math.h>
+
+#include "hot_path.h"
+
+const pad_conditioning pad_conditionings[PAD_ANALOG_SOURCES] =
+{
+	// PAD_SOURCE_HID: DualShock 4 / DualSense sticks rest within few units of center
+	{ { 8, 0, 120, 100, 74 }, { 0, 0, UINT8_MAX, UINT8_MAX, 1.0f } },
+	// PAD_SOURCE_DUALSHOCK3
+	{ { 10, 0, 120, 100, 74 }, { 0, 0, UINT8_MAX, UINT8_MAX, 1.0f } },
+	// PAD_SOURCE_XINPUT: XINPUT_GAMEPAD_LEFT_THUMB_DEADZONE (7849), XINPUT_GAMEPAD_TRIGGER_THRESHOLD (30)
+	{ { 31, 0, 124, 100, 74 }, { 30, 0, UINT8_MAX, UINT8_MAX, 1.0f } },
+};
+
+#define GAIN_ONE (1 << PAD_CONDITIONING_GAIN_BITS)
+
+static_assert((PAD_CONDITIONING_SLOTS & (PAD_CONDITIONING_SLOTS - 1)) == 0, "PAD_CONDITIONING_SLOTS must be power of 2");
+
+typedef struct pad_slot_calibration
+{
+	bool calibrated;
+	int8_t center[4]; // Rest offset of LX, LY, RX, RY
+} pad_slot_calibration;
+
+static pad_conditioning_tables g_tables[PAD_ANALOG_SOURCES];
+static pad_slot_calibration g_calibrations[PAD_CONDITIONING_SLOTS];
+static uint32_t g_gate_reciprocal[129]; // (PAD_CONDITIONING_GATE_STEPS << 16) / larger stick offset
+
+static float stick_radius(const pad_stick_conditioning* stick, float radius)
+{
+	if (radius <= stick->deadzone)
+		return 0.0f;
+
+	float travel = (radius - stick->deadzone) / (stick->outer - stick->deadzone);
+
+	if (travel > 1.0f)
+		travel = 1.0f;
+
+	return stick->anti_deadzone + travel * (stick->range - stick->anti_deadzone);
+}
+
+// Octagon with corners (range, 0) and (gate, gate): distance to edge along ray at angle with tangent t to axis, per range.
+static float gate_radius(const pad_stick_conditioning* stick, float t)
+{
+	if (!stick->gate)
+		return 1.0f;
+
+	const float angle = atanf(t);
+
+	return 1.0f / (cosf(angle) - sinf(angle) * (1.0f - (float)stick->range / stick->gate));
+}
+
+static uint16_t to_gain(float gain)
+{
+	const float scaled = gain * GAIN_ONE + 0.5f;
+
+	return scaled >= UINT16_MAX ? UINT16_MAX : (uint16_t)scaled;
+}
+
+void pad_conditioning_compute(const pad_conditioning* conditioning, pad_conditioning_tables* tables)
+{
+	for (uint16_t i = 1; i <= 128; i++)
+		g_gate_reciprocal[i] = ((uint32_t)PAD_CONDITIONING_GATE_STEPS << 16) / i;
+
+	const pad_stick_conditioning* stick = &conditioning->stick;
+
+	for (uint16_t i = 0; i < PAD_CONDITIONING_RADIUS_STEPS; i++)
+	{
+		// Middle of squared radius step
+		const float radius = sqrtf((float)((i << PAD_CONDITIONING_RADIUS_SHIFT) + (1 << (PAD_CONDITIONING_RADIUS_SHIFT - 1))));
+		tables->stick_gain[i] = to_gain(stick_radius(stick, radius) / radius);
+	}
+
+	for (uint8_t i = 0; i <= PAD_CONDITIONING_GATE_STEPS; i++)
+		tables->gate_gain[i] = to_gain(gate_radius(stick, (float)i / PAD_CONDITIONING_GATE_STEPS));
+
+	const pad_trigger_conditioning* trigger = &conditioning->trigger;
+
+	for (uint16_t i = 0; i < 256; i++)
+	{
+		if (i <= trigger->deadzone)
+		{
+			tables->trigger[i] = 0;
+			continue;
+		}
+
+		float travel = (float)(i - trigger->deadzone) / (trigger->outer - trigger->deadzone);
+
+		if (travel > 1.0f)
+			travel = 1.0f;
+
+		const float value = trigger->anti_deadzone + powf(travel, trigger->curve) * (trigger->range - trigger->anti_deadzone);
+		tables->trigger[i] = (uint8_t)(value + 0.5f);
+	}
+}
+
+void pad_conditioning_init()
+{
+	for (uint8_t i = 0; i < PAD_ANALOG_SOURCES; i++)
+		pad_conditioning_compute(&pad_conditionings[i], &g_tables[i]);
+}
+
+static inline uint8_t offset_axis(int32_t sign, uint32_t offset)
+{
+	if (offset > 127)
+		offset = sign < 0 ? 128 : 127;
+
+	return (uint8_t)(sign < 0 ? 128 - offset : 128 + offset);
+}
+
+static inline void condition_stick(uint8_t* x, uint8_t* y, const pad_conditioning_tables* tables)
+{
+	const int32_t dx = (int32_t)*x - 128;
+	const int32_t dy = (int32_t)*y - 128;
+	const uint32_t ax = dx < 0 ? -dx : dx;
+	const uint32_t ay = dy < 0 ? -dy : dy;
+	const uint32_t larger = ax > ay ? ax : ay;
+
+	if (!larger)
+		return;
+
+	const uint32_t smaller = ax > ay ? ay : ax;
+	const uint32_t tangent = (smaller * g_gate_reciprocal[larger] + (1 << 15)) >> 16;
+	const uint32_t radius_squared = ax * ax + ay * ay;
+	const uint32_t gain = ((uint32_t)tables->stick_gain[radius_squared >> PAD_CONDITIONING_RADIUS_SHIFT] * tables->gate_gain[tangent]
+		+ (GAIN_ONE >> 1)) >> PAD_CONDITIONING_GAIN_BITS;
+
+	*x = offset_axis(dx, (ax * gain + (GAIN_ONE >> 1)) >> PAD_CONDITIONING_GAIN_BITS);
+	*y = offset_axis(dy, (ay * gain + (GAIN_ONE >> 1)) >> PAD_CONDITIONING_GAIN_BITS);
+}
+
+void HOT_PATH(pad_condition_tables)(canonical_pad* pad, const pad_conditioning_tables* tables)
+{
+	condition_stick(&PAD_AXIS(pad, PAD_AXIS_LX), &PAD_AXIS(pad, PAD_AXIS_LY), tables);
+	condition_stick(&PAD_AXIS(pad, PAD_AXIS_RX), &PAD_AXIS(pad, PAD_AXIS_RY), tables);
+
+	PAD_AXIS(pad, PAD_AXIS_LT) = tables->trigger[PAD_AXIS(pad, PAD_AXIS_LT)];
+	PAD_AXIS(pad, PAD_AXIS_RT) = tables->trigger[PAD_AXIS(pad, PAD_AXIS_RT)];
+}
+
+void pad_conditioning_slot_reset(uint8_t slot)
+{
+	g_calibrations[slot & (PAD_CONDITIONING_SLOTS - 1)] = {};
+}
+
+static void HOT_PATH(calibrate_center)(canonical_pad* pad, pad_slot_calibration* calibration)
+{
+	if (!calibration->calibrated)
+	{
+		for (uint8_t i = 0; i < 4; i++)
+		{
+			const int32_t offset = (int32_t)pad->axes[i] - 128;
+
+			if (offset < -PAD_CONDITIONING_CENTER_MAX || offset > PAD_CONDITIONING_CENTER_MAX)
+				return; // Stick is held
+		}
+
+		for (uint8_t i = 0; i < 4; i++)
+			calibration->center[i] = (int8_t)(pad->axes[i] - 128);
+
+		calibration->calibrated = true;
+	}
+
+	for (uint8_t i = 0; i < 4; i++)
+	{
+		const int32_t value = (int32_t)pad->axes[i] - calibration->center[i];
+		pad->axes[i] = (uint8_t)(value < 0 ? 0 : value > UINT8_MAX ? UINT8_MAX : value);
+	}
+}
+
+void HOT_PATH(pad_condition)(canonical_pad* pad, uint8_t source, uint8_t slot)
+{
+	if (source >= PAD_ANALOG_SOURCES)
+		return;
+
+	calibrate_center(pad, &g_calibrations[slot & (PAD_CONDITIONING_SLOTS - 1)]);
+	pad_condition_tables(pad, &g_tables[source]);
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "canonical_pad.h"
+
+/*
+Analog stick and trigger conditioning of canonical pad, per input source.
+
+Real GameCube sticks span about +-100 around center inside octagonal gate, USB pads report full 0..255 range
+inside round gate. Stick: radial deadzone, anti-deadzone, saturation at outer radius, scaling to GameCube range
+and octagonal gate shaping. Trigger: deadzone, anti-deadzone, saturation, response curve, scaling.
+
+Parameters (pad_conditionings[] in pad_conditioning.cpp) are computed with float math once at boot into lookup tables:
+- stick: output / input radius gain by squared input radius and gate gain by octant angle tangent;
+- trigger: 256 entries per axis.
+Per report cost is a few table lookups and fixed point multiplies, no float math or division.
+
+Parameters are per source type. Stick centre is calibrated per controller slot, so every pad (both ports,
+every pad of multi-pad device) keeps its own: first report after pad_conditioning_slot_reset() with every stick axis
+within PAD_CONDITIONING_CENTER_MAX of 128 sets slot centre, later reports of slot are shifted by it before conditioning.
+Sticks held off centre at mount are not taken as centre, slot stays uncalibrated until sticks rest.
+*/
+
+#define PAD_CONDITIONING_RADIUS_SHIFT 5 // Stick gain table index: squared radius >> shift
+#define PAD_CONDITIONING_RADIUS_STEPS ((2 * 128 * 128 >> PAD_CONDITIONING_RADIUS_SHIFT) + 1)
+#define PAD_CONDITIONING_GATE_STEPS 64 // Gate gain table index: tangent of angle to nearest axis * steps
+#define PAD_CONDITIONING_GAIN_BITS 12 // Q4.12 gains
+#define PAD_CONDITIONING_SLOTS 8 // Controller slots with own stick centre, power of 2
+#define PAD_CONDITIONING_CENTER_MAX 16 // Largest stick rest offset calibrated as centre
+
+typedef struct pad_stick_conditioning
+{
+	uint8_t deadzone; // Input radius reported as center, 0..127
+	uint8_t anti_deadzone; // Output radius right after deadzone, GameCube units
+	uint8_t outer; // Input radius of full deflection
+	uint8_t range; // Output radius of full deflection on axes, GameCube controller: 100
+	uint8_t gate; // Octagonal gate diagonal corner per axis, GameCube controller: 74; 0 - round gate
+} pad_stick_conditioning;
+
+typedef struct pad_trigger_conditioning
+{
+	uint8_t deadzone; // Input reported as released
+	uint8_t anti_deadzone; // Output right after deadzone
+	uint8_t outer; // Input of full press
+	uint8_t range; // Output of full press
+	float curve; // Response exponent, 1.0 - linear
+} pad_trigger_conditioning;
+
+typedef struct pad_conditioning
+{
+	pad_stick_conditioning stick;
+	pad_trigger_conditioning trigger;
+} pad_conditioning;
+
+typedef struct pad_conditioning_tables
+{
+	uint16_t stick_gain[PAD_CONDITIONING_RADIUS_STEPS]; // Output / input radius
+	uint16_t gate_gain[PAD_CONDITIONING_GATE_STEPS + 1]; // Gate radius / range
+	uint8_t trigger[256];
+} pad_conditioning_tables;
+
+// Parameters per PadSources with analog controls.
+extern const pad_conditioning pad_conditionings[PAD_ANALOG_SOURCES];
+
+// Compute lookup tables of pad_conditionings[]. Called by pad_profiles_init().
+void pad_conditioning_init();
+
+// Compute lookup tables of parameters.
+void pad_conditioning_compute(const pad_conditioning* conditioning, pad_conditioning_tables* tables);
+
+// Condition sticks and triggers of canonical pad in place.
+void pad_condition_tables(canonical_pad* pad, const pad_conditioning_tables* tables);
+
+// Forget stick centre of controller slot. Call on core1 when pad is mounted to slot.
+void pad_conditioning_slot_reset(uint8_t slot);
+
+// Condition sticks and triggers of canonical pad reported by source to controller slot in place. Call on core1.
+void pad_condition(canonical_pad* pad, uint8_t source, uint8_t slot);
@@ -0,0 +1,243 @@
+#include <cassert>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "pad_conditioning.h"
+
+/*
+Test of stick / trigger conditioning lookup tables (pad_conditioning.h) against float reference:
+every stick position and trigger value of shipped per-source parameters and of parameter sets
+with anti-deadzone, round gate and response curves.
+*/
+
+#define STICK_TOLERANCE 1.5 // Squared radius and gate angle steps of lookup tables
+#define TRIGGER_TOLERANCE 1
+
+typedef struct conditioning_test_case
+{
+	const char* name;
+	pad_conditioning conditioning;
+} conditioning_test_case;
+
+static const conditioning_test_case g_cases[] =
+{
+	{ "anti_deadzone", { { 12, 20, 118, 100, 74 }, { 10, 30, 230, 255, 1.0f } } },
+	{ "round_gate", { { 6, 0, 127, 110, 0 }, { 0, 0, 255, 200, 2.0f } } },
+	{ "no_deadzone", { { 0, 0, 127, 127, 0 }, { 0, 0, 255, 255, 0.5f } } },
+};
+
+// Distance from center to gate edge along direction (ux, uy): octagon with corners (range, 0) and (gate, gate).
+static double reference_gate(const pad_stick_conditioning& stick, double ux, double uy)
+{
+	if (!stick.gate)
+		return stick.range;
+
+	double a = fabs(ux), b = fabs(uy);
+
+	if (b > a)
+	{
+		const double t = a;
+		a = b;
+		b = t;
+	}
+
+	// Ray t * (a, b) crosses edge (range, 0) + s * (gate - range, gate)
+	const double ex = stick.gate - stick.range, ey = stick.gate;
+	const double det = -a * ey + b * ex;
+
+	return -stick.range * ey / det;
+}
+
+static void reference_stick(const pad_stick_conditioning& stick, uint8_t x, uint8_t y, double& out_x, double& out_y)
+{
+	const double dx = x - 128.0, dy = y - 128.0;
+	const double radius = sqrt(dx * dx + dy * dy);
+
+	out_x = out_y = 128.0;
+
+	if (radius <= stick.deadzone)
+		return;
+
+	const double travel = fmin((radius - stick.deadzone) / (stick.outer - stick.deadzone), 1.0);
+	const double output = stick.anti_deadzone + travel * (stick.range - stick.anti_deadzone);
+	const double gate = reference_gate(stick, dx / radius, dy / radius) / stick.range;
+
+	out_x = fmin(fmax(128.0 + dx / radius * output * gate, 0.0), 255.0);
+	out_y = fmin(fmax(128.0 + dy / radius * output * gate, 0.0), 255.0);
+}
+
+static double reference_trigger(const pad_trigger_conditioning& trigger, uint8_t value)
+{
+	if (value <= trigger.deadzone)
+		return 0.0;
+
+	const double travel = fmin((double)(value - trigger.deadzone) / (trigger.outer - trigger.deadzone), 1.0);
+
+	return trigger.anti_deadzone + pow(travel, trigger.curve) * (trigger.range - trigger.anti_deadzone);
+}
+
+static void test_conditioning(const char* name, const pad_conditioning& conditioning)
+{
+	static pad_conditioning_tables tables;
+	pad_conditioning_compute(&conditioning, &tables);
+
+	const pad_stick_conditioning& stick = conditioning.stick;
+	double max_error = 0.0;
+	uint32_t checked = 0;
+
+	for (uint16_t x = 0; x < 256; x++)
+	{
+		for (uint16_t y = 0; y < 256; y++)
+		{
+			const double dx = x - 128.0, dy = y - 128.0;
+			const double radius = sqrt(dx * dx + dy * dy);
+
+			// Anti-deadzone step: squared radius step of deadzone edge can go either way
+			if (stick.anti_deadzone && fabs(radius - stick.deadzone) < 1.0)
+				continue;
+
+			canonical_pad pad = neutralCanonicalPad;
+			PAD_AXIS(&pad, PAD_AXIS_LX) = (uint8_t)x;
+			PAD_AXIS(&pad, PAD_AXIS_LY) = (uint8_t)y;
+			PAD_AXIS(&pad, PAD_AXIS_RX) = (uint8_t)y;
+			PAD_AXIS(&pad, PAD_AXIS_RY) = (uint8_t)x;
+			pad_condition_tables(&pad, &tables);
+
+			double ref_x, ref_y;
+			reference_stick(stick, (uint8_t)x, (uint8_t)y, ref_x, ref_y);
+
+			const double error = fmax(fabs(PAD_AXIS(&pad, PAD_AXIS_LX) - ref_x), fabs(PAD_AXIS(&pad, PAD_AXIS_LY) - ref_y));
+
+			if (error > STICK_TOLERANCE || PAD_AXIS(&pad, PAD_AXIS_RX) != PAD_AXIS(&pad, PAD_AXIS_LY) || PAD_AXIS(&pad, PAD_AXIS_RY) != PAD_AXIS(&pad, PAD_AXIS_LX))
+			{
+				printf("%s: stick %u,%u -> %u,%u, reference %.2f,%.2f\n", name, x, y,
+					PAD_AXIS(&pad, PAD_AXIS_LX), PAD_AXIS(&pad, PAD_AXIS_LY), ref_x, ref_y);
+				assert(false);
+			}
+
+			max_error = fmax(max_error, error);
+			checked++;
+		}
+	}
+
+	// Center and deadzone stay centered, full deflection reaches range on axes and gate corner on diagonals
+	canonical_pad pad = neutralCanonicalPad;
+	pad_condition_tables(&pad, &tables);
+	assert(PAD_AXIS(&pad, PAD_AXIS_LX) == 128 && PAD_AXIS(&pad, PAD_AXIS_LY) == 128);
+
+	if (stick.deadzone)
+	{
+		PAD_AXIS(&pad, PAD_AXIS_LX) = 128 + stick.deadzone - 1;
+		pad_condition_tables(&pad, &tables);
+		assert(PAD_AXIS(&pad, PAD_AXIS_LX) == 128 && PAD_AXIS(&pad, PAD_AXIS_LY) == 128);
+	}
+
+	pad = neutralCanonicalPad;
+	PAD_AXIS(&pad, PAD_AXIS_LX) = 255;
+	pad_condition_tables(&pad, &tables);
+	assert(PAD_AXIS(&pad, PAD_AXIS_LX) == (stick.range > 127 ? 255 : 128 + stick.range) && PAD_AXIS(&pad, PAD_AXIS_LY) == 128);
+
+	if (stick.gate)
+	{
+		pad = neutralCanonicalPad;
+		PAD_AXIS(&pad, PAD_AXIS_LX) = 128 + 90;
+		PAD_AXIS(&pad, PAD_AXIS_LY) = 128 - 90;
+		pad_condition_tables(&pad, &tables);
+		assert(abs(PAD_AXIS(&pad, PAD_AXIS_LX) - (128 + stick.gate)) <= 1 && abs(PAD_AXIS(&pad, PAD_AXIS_LY) - (128 - stick.gate)) <= 1);
+	}
+
+	double max_trigger_error = 0.0;
+
+	for (uint16_t value = 0; value < 256; value++)
+	{
+		pad = neutralCanonicalPad;
+		PAD_AXIS(&pad, PAD_AXIS_LT) = (uint8_t)value;
+		PAD_AXIS(&pad, PAD_AXIS_RT) = (uint8_t)(255 - value);
+		pad_condition_tables(&pad, &tables);
+
+		const double error = fmax(fabs(PAD_AXIS(&pad, PAD_AXIS_LT) - reference_trigger(conditioning.trigger, (uint8_t)value)),
+			fabs(PAD_AXIS(&pad, PAD_AXIS_RT) - reference_trigger(conditioning.trigger, (uint8_t)(255 - value))));
+
+		if (error > TRIGGER_TOLERANCE)
+		{
+			printf("%s: trigger %u -> %u, reference %.2f\n", name, value, PAD_AXIS(&pad, PAD_AXIS_LT), reference_trigger(conditioning.trigger, (uint8_t)value));
+			assert(false);
+		}
+
+		max_trigger_error = fmax(max_trigger_error, error);
+	}
+
+	printf("%s: %u stick positions, max error %.2f; triggers max error %.2f\n", name, checked, max_error, max_trigger_error);
+}
+
+int main()
+{
+	static const char* source_names[PAD_ANALOG_SOURCES] = { "hid", "dualshock3", "xinput" };
+
+	for (uint8_t source = 0; source < PAD_ANALOG_SOURCES; source++)
+		test_conditioning(source_names[source], pad_conditionings[source]);
+
+	for (const conditioning_test_case& test : g_cases)
+		test_conditioning(test.name, test.conditioning);
+
+	// Sources without analog controls pass through
+	pad_conditioning_init();
+
+	canonical_pad pad = neutralCanonicalPad;
+	PAD_AXIS(&pad, PAD_AXIS_LX) = 0;
+	PAD_AXIS(&pad, PAD_AXIS_LT) = 255;
+	pad_condition(&pad, PAD_SOURCE_MEGA_DRIVE, 0);
+	assert(PAD_AXIS(&pad, PAD_AXIS_LX) == 0 && PAD_AXIS(&pad, PAD_AXIS_LT) == 255);
+
+	pad_condition(&pad, PAD_SOURCE_HID, 0);
+	assert(PAD_AXIS(&pad, PAD_AXIS_LX) == 128 - pad_conditionings[PAD_SOURCE_HID].stick.range);
+
+	// Stick centre per controller slot: two pads of one source resting off centre in opposite directions
+	static pad_conditioning_tables hid_tables;
+	pad_conditioning_compute(&pad_conditionings[PAD_SOURCE_HID], &hid_tables);
+
+	pad_conditioning_slot_reset(1);
+	pad_conditioning_slot_reset(2);
+
+	canonical_pad rest_1 = neutralCanonicalPad;
+	PAD_AXIS(&rest_1, PAD_AXIS_LX) = 128 + 12; // Beyond HID deadzone (8) without calibration
+	canonical_pad rest_2 = neutralCanonicalPad;
+	PAD_AXIS(&rest_2, PAD_AXIS_LX) = 128 - 12;
+
+	pad = rest_1;
+	pad_condition(&pad, PAD_SOURCE_HID, 1);
+	assert(PAD_AXIS(&pad, PAD_AXIS_LX) == 128);
+	pad = rest_2;
+	pad_condition(&pad, PAD_SOURCE_HID, 2);
+	assert(PAD_AXIS(&pad, PAD_AXIS_LX) == 128);
+
+	// Same input, slot centres shift it apart
+	canonical_pad moved = neutralCanonicalPad;
+	PAD_AXIS(&moved, PAD_AXIS_LX) = 128 + 40;
+
+	canonical_pad moved_1 = moved;
+	pad_condition(&moved_1, PAD_SOURCE_HID, 1);
+	canonical_pad moved_2 = moved;
+	pad_condition(&moved_2, PAD_SOURCE_HID, 2);
+	assert(PAD_AXIS(&moved_1, PAD_AXIS_LX) < PAD_AXIS(&moved_2, PAD_AXIS_LX));
+
+	canonical_pad expected = neutralCanonicalPad;
+	PAD_AXIS(&expected, PAD_AXIS_LX) = 128 + 40 - 12;
+	pad_condition_tables(&expected, &hid_tables);
+	assert(PAD_AXIS(&moved_1, PAD_AXIS_LX) == PAD_AXIS(&expected, PAD_AXIS_LX));
+
+	// Stick held at mount is not taken as centre
+	pad_conditioning_slot_reset(3);
+	pad = moved;
+	pad_condition(&pad, PAD_SOURCE_HID, 3);
+	canonical_pad uncalibrated = moved;
+	pad_condition_tables(&uncalibrated, &hid_tables);
+	assert(PAD_AXIS(&pad, PAD_AXIS_LX) == PAD_AXIS(&uncalibrated, PAD_AXIS_LX));
+
+	pad = rest_1;
+	pad_condition(&pad, PAD_SOURCE_HID, 3);
+	assert(PAD_AXIS(&pad, PAD_AXIS_LX) == 128);
+
+	return 0;
+}
@@ -0,0 +1,74 @@
+#include "pio_usb_host.h"
+
+#if PIO_USB_HOST
+
+#include <stdio.h>
+
+#include "pico/stdlib.h"
+#include "hardware/dma.h"
+#include "hardware/pio.h"
+#include "tusb.h"
+#include "host/hcd.h"
+#include "pio_usb.h"
+
+#define PIO_USB_SM_TX 0
+#define PIO_USB_SM_RX 1
+#define PIO_USB_SM_EOP 2
+
+static bool resources_free()
+{
+	PIO pio = pio_get_instance(PIO_USB_PIO);
+
+	for (uint sm = PIO_USB_SM_TX; sm <= PIO_USB_SM_EOP; sm++)
+	{
+		if (pio_sm_is_claimed(pio, sm))
+		{
+			printf("PIO-USB: pio%u state machine %u is claimed\n", PIO_USB_PIO, sm);
+			return false;
+		}
+	}
+
+	if (dma_channel_is_claimed(PIO_USB_DMA_CHANNEL))
+	{
+		printf("PIO-USB: DMA channel %u is claimed\n", PIO_USB_DMA_CHANNEL);
+		return false;
+	}
+
+	return true;
+}
+
+bool pio_usb_host_start()
+{
+	if (!resources_free())
+		return false;
+
+	pio_usb_configuration_t config = PIO_USB_DEFAULT_CONFIG;
+	config.pin_dp = PIO_USB_DP_PIN;
+	config.pio_tx_num = PIO_USB_PIO;
+	config.sm_tx = PIO_USB_SM_TX;
+	config.tx_ch = PIO_USB_DMA_CHANNEL;
+	config.pio_rx_num = PIO_USB_PIO;
+	config.sm_rx = PIO_USB_SM_RX;
+	config.sm_eop = PIO_USB_SM_EOP;
+	config.pinout = PIO_USB_PINOUT_DPDM;
+
+	tuh_configure(PIO_USB_RHPORT, TUH_CFGID_RPI_PIO_USB_CONFIGURATION, &config);
+
+	if (!tuh_init(BOARD_TUH_RHPORT))
+		return false;
+
+	if (!tuh_init(PIO_USB_RHPORT))
+		printf("PIO-USB: failed to start port on GPIO %u, running native port only\n", PIO_USB_DP_PIN);
+
+	return true;
+}
+
+uint8_t pio_usb_host_port(uint8_t dev_addr)
+{
+	hcd_devtree_info_t info;
+	hcd_devtree_get_info(dev_addr, &info);
+
+	return info.rhport;
+}
+
+#endif
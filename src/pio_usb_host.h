@@ -0,0 +1,44 @@
+#pragma once
+
+#include <stdint.h>
+
+/*
+Second USB host port with Pico-PIO-USB on spare GPIOs.
+
+Native USB-C port stays TinyUSB root port BOARD_TUH_RHPORT (0), PIO-USB adds root port PIO_USB_RHPORT (1)
+with D+ on PIO_USB_DP_PIN, D- on next GPIO. TinyUSB runs both root ports (tusb_config.h: CFG_TUSB_RHPORT0_MODE
+and CFG_TUH_RPI_PIO_USB), its rp2040 port must be built with native and Pico-PIO-USB host controller drivers together.
+Devices on both ports go through the same mount / report callbacks and fill controller slots (controller_slots.h).
+
+Resources are kept away from Joybus core:
+- PIO1 state machines 0..2 (TX, RX, EOP) and their programs: Joybus owns PIO0 (state machine 0, capture on a spare one);
+- DMA channel PIO_USB_DMA_CHANNEL, the highest one: trace and Joybus capture claim lowest free channels;
+- PIO1 interrupt and 1 ms frame timer are started on core1, core0 keeps PIO0 interrupt only (irq_affinity.h);
+- system clock is 120 MHz (PIO-USB needs multiple of 12 MHz), Joybus PIO integer divider 5 gives 24 MHz state machine
+  clock: 4.17 us bit cell, within Joybus timing tolerance (Joybus_PIO_Timing_120MHz test). Fractional divider 4.8 would
+  give 25 MHz on average with bit edges jittering by one state machine clock.
+pio_usb_host_start() refuses to start if any state machine or DMA channel is already claimed.
+
+REPORT_RATE lines (report_rate.h) carry port=<n> (root port) to compare report rate per port.
+*/
+
+#define PIO_USB_PIO 1
+#define PIO_USB_DMA_CHANNEL 11
+#define PIO_USB_RHPORT 1
+
+#ifndef PIO_USB_DP_PIN
+#define PIO_USB_DP_PIN 10
+#endif
+
+#if PIO_USB_HOST
+// Start TinyUSB host on native port, configure Pico-PIO-USB and start second port. Call on core1.
+bool pio_usb_host_start();
+
+// Host root port of device: 0 - native, PIO_USB_RHPORT - PIO-USB.
+uint8_t pio_usb_host_port(uint8_t dev_addr);
+#else
+#include "tusb.h"
+
+inline bool pio_usb_host_start() { return tuh_init(BOARD_TUH_RHPORT); }
+inline uint8_t pio_usb_host_port(uint8_t) { return 0; }
+#endif
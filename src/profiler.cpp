@@ -0,0 +1,156 @@
+#include "profiler.h"
+
+#if PROFILER
+
+#include <stdio.h>
+#include <string.h>
+
+#include "pico/stdlib.h"
+#include "hardware/irq.h"
+#include "hardware/sync.h"
+#include "hardware/timer.h"
+
+// Linker script symbols: end of image in flash, RAM section holding code copied from flash (__not_in_flash / time critical)
+extern char __flash_binary_end;
+extern char __data_start__;
+extern char __data_end__;
+
+typedef struct profiler_histogram
+{
+	uint16_t flash[PROFILER_FLASH_BUCKETS];
+	uint16_t ram[PROFILER_RAM_BUCKETS];
+	uint32_t other; // ROM, stack or PC out of covered regions
+	uint32_t samples;
+} profiler_histogram;
+
+static profiler_histogram g_histograms[2];
+static profiler_histogram g_snapshot;
+
+static int g_alarms[2] = { -1, -1 };
+
+static uint8_t g_flash_shift;
+static uint8_t g_ram_shift;
+
+static uint8_t bucket_shift(uint32_t size, uint32_t buckets)
+{
+	uint8_t shift = 2; // Thumb instructions are 2 bytes, 4-byte buckets at most
+	while ((size >> shift) >= buckets)
+		shift++;
+
+	return shift;
+}
+
+static inline void increment(uint16_t* counter)
+{
+	if (*counter != UINT16_MAX)
+		(*counter)++;
+}
+
+extern "C" void profiler_sample(const uint32_t* frame)
+{
+	const uint core = get_core_num();
+	const uint alarm = g_alarms[core];
+
+	timer_hw->intr = 1u << alarm; // Clear alarm interrupt
+
+	profiler_histogram* histogram = &g_histograms[core];
+
+	// Vary period a bit to avoid locking to periodic loops like 1 ms USB frames
+	timer_hw->alarm[alarm] = timer_hw->timerawl + PROFILER_PERIOD_US + (histogram->samples & 0x0F);
+
+	// Exception frame: r0, r1, r2, r3, r12, lr, pc, xpsr
+	const uint32_t pc = frame[6];
+
+	if (pc >= XIP_BASE && pc < (uint32_t)&__flash_binary_end)
+		increment(&histogram->flash[(pc - XIP_BASE) >> g_flash_shift]);
+	else if (pc >= (uint32_t)&__data_start__ && pc < (uint32_t)&__data_end__)
+		increment(&histogram->ram[(pc - (uint32_t)&__data_start__) >> g_ram_shift]);
+	else
+		histogram->other++;
+
+	histogram->samples++;
+}
+
+// SDK runs thread mode on main stack, so SP on entry points to exception frame.
+// Tail call keeps EXC_RETURN in LR, profiler_sample return completes the exception.
+static void __attribute__((naked)) profiler_irq_handler()
+{
+	__asm volatile(
+		"mov r0, sp\n"
+		"ldr r1, =profiler_sample\n"
+		"bx r1\n"
+		".ltorg\n"
+	);
+}
+
+void profiler_start()
+{
+	const uint core = get_core_num();
+
+	g_flash_shift = bucket_shift((uint32_t)&__flash_binary_end - XIP_BASE, PROFILER_FLASH_BUCKETS);
+	g_ram_shift = bucket_shift((uint32_t)&__data_end__ - (uint32_t)&__data_start__, PROFILER_RAM_BUCKETS);
+
+	const int alarm = hardware_alarm_claim_unused(false);
+
+	if (alarm < 0)
+	{
+		printf("Profiler: no free timer alarm for core %u\n", core);
+		return;
+	}
+
+	g_alarms[core] = alarm;
+
+	// NVIC is per core: alarm interrupt enabled here only fires on this core
+	const uint irq = TIMER_IRQ_0 + alarm;
+	irq_set_exclusive_handler(irq, profiler_irq_handler);
+	hw_set_bits(&timer_hw->inte, 1u << alarm);
+	irq_set_enabled(irq, true);
+
+	timer_hw->alarm[alarm] = timer_hw->timerawl + PROFILER_PERIOD_US;
+}
+
+static void dump(uint core)
+{
+	// Take snapshot first: printing is slow and histograms keep counting
+	const uint32_t irq_state = save_and_disable_interrupts();
+	memcpy(&g_snapshot, &g_histograms[core], sizeof(profiler_histogram));
+	memset(&g_histograms[core], 0, sizeof(profiler_histogram));
+	restore_interrupts(irq_state);
+
+	printf("PROF BEGIN core=%u period_us=%u samples=%lu other=%lu flash_base=%08lx flash_shift=%u ram_base=%08lx ram_shift=%u\n",
+		core, PROFILER_PERIOD_US, (unsigned long)g_snapshot.samples, (unsigned long)g_snapshot.other,
+		(unsigned long)XIP_BASE, g_flash_shift, (unsigned long)(uint32_t)&__data_start__, g_ram_shift);
+
+	for (uint32_t i = 0; i < PROFILER_FLASH_BUCKETS; i++)
+	{
+		if (g_snapshot.flash[i])
+			printf("F %lu %u\n", (unsigned long)i, g_snapshot.flash[i]);
+	}
+
+	for (uint32_t i = 0; i < PROFILER_RAM_BUCKETS; i++)
+	{
+		if (g_snapshot.ram[i])
+			printf("R %lu %u\n", (unsigned long)i, g_snapshot.ram[i]);
+	}
+
+	printf("PROF END\n");
+}
+
+void profiler_task()
+{
+	static uint32_t last_dump_ms = 0;
+	const uint32_t now_ms = to_ms_since_boot(get_absolute_time());
+
+	if (now_ms - last_dump_ms < PROFILER_DUMP_MS)
+		return;
+
+	last_dump_ms = now_ms;
+
+	for (uint core = 0; core < 2; core++)
+	{
+		if (g_alarms[core] >= 0)
+			dump(core);
+	}
+}
+
+#endif
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <stdint.h>
+
+/*
+Sampling profiler for both cores.
+
+A hardware timer alarm per core interrupts every PROFILER_PERIOD_US and records interrupted PC
+into per-core histogram buckets covering firmware image in flash and code copied to RAM.
+profiler_task() dumps and clears histograms every PROFILER_DUMP_MS over stdio UART.
+Map buckets to symbols with tools/profiler_report.py and the firmware ELF.
+
+Note: profiler interrupt on core0 disturbs Joybus timing, use for CPU share measurements only.
+*/
+
+#ifndef PROFILER_PERIOD_US
+#define PROFILER_PERIOD_US 250
+#endif
+
+#ifndef PROFILER_DUMP_MS
+#define PROFILER_DUMP_MS 5000
+#endif
+
+#define PROFILER_FLASH_BUCKETS 1024
+#define PROFILER_RAM_BUCKETS 256
+
+#if PROFILER
+// Start sampling current core. Call once on each core.
+void profiler_start();
+
+// Dump histograms when PROFILER_DUMP_MS elapsed. Call from core1 loop.
+void profiler_task();
+#else
+inline void profiler_start() {}
+inline void profiler_task() {}
+#endif
@@ -0,0 +1,97 @@
+#include "report_rate.h"
+
+#if REPORT_RATE_STATS
+
+#include <stdio.h>
+
+#include "pico/stdlib.h"
+
+#include "hot_path.h"
+#include "pio_usb_host.h"
+
+#define FRAME_US 1000
+
+typedef struct report_rate
+{
+	uint32_t last_us;
+	uint32_t reports; // Current window
+	uint32_t missed;
+	uint32_t max_gap_us;
+	uint32_t total_missed; // Since mount
+	uint8_t interval_ms; // Shortest gap since mount, 0 - single report received
+	bool active;
+} report_rate;
+
+static report_rate g_rates[USB_DEVICE_ADDRESSES][REPORT_RATE_INSTANCES];
+static uint32_t g_window_start_us;
+
+void HOT_PATH(report_rate_record)(uint8_t dev_addr, uint8_t instance)
+{
+	if (dev_addr >= USB_DEVICE_ADDRESSES || instance >= REPORT_RATE_INSTANCES)
+		return;
+
+	const uint32_t now = time_us_32();
+	report_rate* rate = &g_rates[dev_addr][instance];
+
+	if (rate->active)
+	{
+		const uint32_t gap = now - rate->last_us;
+		const uint32_t frames = (gap + FRAME_US / 2) / FRAME_US;
+
+		if (frames)
+		{
+			if (!rate->interval_ms || frames < rate->interval_ms)
+				rate->interval_ms = frames < UINT8_MAX ? (uint8_t)frames : UINT8_MAX;
+
+			const uint32_t missed = frames / rate->interval_ms - 1;
+			rate->missed += missed;
+			rate->total_missed += missed;
+		}
+
+		if (gap > rate->max_gap_us)
+			rate->max_gap_us = gap;
+	}
+	else
+		*rate = { 0, 0, 0, 0, 0, 0, true };
+
+	rate->last_us = now;
+	rate->reports++;
+}
+
+void report_rate_unmount(uint8_t dev_addr, uint8_t instance)
+{
+	if (dev_addr < USB_DEVICE_ADDRESSES && instance < REPORT_RATE_INSTANCES)
+		g_rates[dev_addr][instance].active = false;
+}
+
+void report_rate_task()
+{
+	const uint32_t now = time_us_32();
+	const uint32_t elapsed = now - g_window_start_us;
+
+	if (elapsed < REPORT_RATE_WINDOW_MS * 1000)
+		return;
+
+	g_window_start_us = now;
+
+	for (uint8_t dev_addr = 0; dev_addr < USB_DEVICE_ADDRESSES; dev_addr++)
+	{
+		for (uint8_t instance = 0; instance < REPORT_RATE_INSTANCES; instance++)
+		{
+			report_rate* rate = &g_rates[dev_addr][instance];
+
+			if (!rate->active)
+				continue;
+
+			printf("REPORT_RATE dev=%u inst=%u port=%u reports=%lu rate_hz=%lu interval_ms=%u missed=%lu max_gap_us=%lu total_missed=%lu\n",
+				dev_addr, instance, pio_usb_host_port(dev_addr), (unsigned long)rate->reports, (unsigned long)((uint64_t)rate->reports * 1000000 / elapsed),
+				rate->interval_ms, (unsigned long)rate->missed, (unsigned long)rate->max_gap_us, (unsigned long)rate->total_missed);
+
+			rate->reports = 0;
+			rate->missed = 0;
+			rate->max_gap_us = 0;
+		}
+	}
+}
+
+#endif
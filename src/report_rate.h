@@ -0,0 +1,42 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "tusb_config.h"
+
+/*
+USB report rate statistics per device and interface.
+
+Report callbacks record arrival time of every received report. Gap between reports is rounded to 1 ms
+full speed frames, shortest gap since mount is taken as device polling interval and every longer gap
+counts gap / interval - 1 missed intervals.
+Port is USB host port of device, always 0 without PIO_USB_HOST (pio_usb_host.h).
+Pads reporting only on state change (NAK while idle) show missed intervals while idle:
+check rate with sticks moving or with pads reporting every interval (DualShock 4, DualSense).
+
+Recording and printing run on core1 (USB host task and core1 loop), no locking.
+
+Prints over stdio UART every REPORT_RATE_WINDOW_MS:
+	REPORT_RATE dev=<n> inst=<n> port=<n> reports=<n> rate_hz=<n> interval_ms=<n> missed=<n> max_gap_us=<n> total_missed=<n>
+*/
+
+#ifndef REPORT_RATE_WINDOW_MS
+#define REPORT_RATE_WINDOW_MS 1000
+#endif
+
+#define REPORT_RATE_INSTANCES 2
+
+#if REPORT_RATE_STATS
+// Record report arrival. Call first thing in report received callbacks.
+void report_rate_record(uint8_t dev_addr, uint8_t instance);
+
+// Forget interface. Call from unmount callbacks.
+void report_rate_unmount(uint8_t dev_addr, uint8_t instance);
+
+// Print statistics when REPORT_RATE_WINDOW_MS elapsed. Call from core1 loop.
+void report_rate_task();
+#else
+inline void report_rate_record(uint8_t, uint8_t) {}
+inline void report_rate_unmount(uint8_t, uint8_t) {}
+inline void report_rate_task() {}
+#endif
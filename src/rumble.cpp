@@ -0,0 +1,201 @@
+#include "rumble.h"
+
+#if RUMBLE
+
+#include <string.h>
+
+#include "pico/stdlib.h"
+#include "tusb.h"
+#include "xinput_host.h"
+
+#include "ps3.h"
+
+#define SONY_VID 0x054C
+#define DUALSHOCK4_PID 0x05C4
+#define DUALSHOCK4_V2_PID 0x09CC
+#define DUALSENSE_PID 0x0CE6
+
+#define REPORT_SIZE 64
+
+enum rumble_protocol : uint8_t
+{
+	RUMBLE_PROTOCOL_NONE,
+	RUMBLE_PROTOCOL_XINPUT,
+	RUMBLE_PROTOCOL_DUALSHOCK3,
+	RUMBLE_PROTOCOL_DUALSHOCK4,
+	RUMBLE_PROTOCOL_DUALSENSE
+};
+
+typedef struct rumble_device
+{
+	uint8_t protocol; // rumble_protocol
+	uint8_t dev_addr;
+	uint8_t instance;
+	bool on; // Last sent state
+	bool in_flight;
+	uint32_t sent_us;
+	uint8_t report[REPORT_SIZE]; // Output report, kept until transfer completes
+} rumble_device;
+
+volatile uint32_t rumble_mailbox;
+
+static rumble_device g_devices[USB_DEVICE_ADDRESSES];
+
+// Linux hid-sony sixaxis_output_report: rumble, LED 1 on, LED blink settings
+static const uint8_t dualshock3_output_report[] =
+{
+	0x01, // Report ID
+	0x00, 0xFF, 0x00, 0xFF, 0x00, // Padding, weak motor duration, weak motor on, strong motor duration, strong motor force
+	0x00, 0x00, 0x00, 0x00,
+	0x02, // LEDs bitmap
+	0xFF, 0x27, 0x10, 0x00, 0x32,
+	0xFF, 0x27, 0x10, 0x00, 0x32,
+	0xFF, 0x27, 0x10, 0x00, 0x32,
+	0xFF, 0x27, 0x10, 0x00, 0x32,
+	0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+#define DUALSHOCK4_OUTPUT_REPORT_SIZE 32
+#define DUALSENSE_OUTPUT_REPORT_SIZE 63
+
+static void mount(uint8_t dev_addr, uint8_t instance, uint8_t protocol)
+{
+	for (const rumble_device& device : g_devices)
+	{
+		if (device.protocol == protocol && device.dev_addr == dev_addr && device.instance == instance)
+			return; // Already registered
+	}
+
+	rumble_unmount(dev_addr, instance);
+
+	for (rumble_device& device : g_devices)
+	{
+		if (device.protocol == RUMBLE_PROTOCOL_NONE)
+		{
+			device = {};
+			device.protocol = protocol;
+			device.dev_addr = dev_addr;
+			device.instance = instance;
+
+			return;
+		}
+	}
+}
+
+void rumble_hid_mount(uint8_t dev_addr, uint8_t instance, uint16_t vid, uint16_t pid)
+{
+	if (ps3_usb_match(vid, pid))
+		mount(dev_addr, instance, RUMBLE_PROTOCOL_DUALSHOCK3);
+	else if (vid == SONY_VID && (pid == DUALSHOCK4_PID || pid == DUALSHOCK4_V2_PID))
+		mount(dev_addr, instance, RUMBLE_PROTOCOL_DUALSHOCK4);
+	else if (vid == SONY_VID && pid == DUALSENSE_PID)
+		mount(dev_addr, instance, RUMBLE_PROTOCOL_DUALSENSE);
+}
+
+void rumble_xinput_mount(uint8_t dev_addr, uint8_t instance)
+{
+	mount(dev_addr, instance, RUMBLE_PROTOCOL_XINPUT);
+}
+
+void rumble_unmount(uint8_t dev_addr, uint8_t instance)
+{
+	for (rumble_device& device : g_devices)
+	{
+		if (device.protocol != RUMBLE_PROTOCOL_NONE && device.dev_addr == dev_addr && device.instance == instance)
+			device.protocol = RUMBLE_PROTOCOL_NONE;
+	}
+}
+
+void rumble_sent(uint8_t dev_addr, uint8_t instance)
+{
+	for (rumble_device& device : g_devices)
+	{
+		if (device.protocol != RUMBLE_PROTOCOL_NONE && device.dev_addr == dev_addr && device.instance == instance)
+			device.in_flight = false;
+	}
+}
+
+// Queue output report, false if endpoint or control pipe is busy.
+static bool send(rumble_device* device, bool on)
+{
+	const uint8_t strong = on ? RUMBLE_STRONG_MOTOR : 0;
+	const uint8_t weak = on ? RUMBLE_WEAK_MOTOR : 0;
+	uint8_t* report = device->report;
+
+	switch (device->protocol)
+	{
+	case RUMBLE_PROTOCOL_XINPUT:
+		return tuh_xinput_set_rumble(device->dev_addr, device->instance, strong, weak, false);
+
+	case RUMBLE_PROTOCOL_DUALSHOCK3:
+		memcpy(report, dualshock3_output_report, sizeof(dualshock3_output_report));
+		report[3] = weak ? 1 : 0;
+		report[5] = strong;
+
+		return tuh_hid_set_report(device->dev_addr, device->instance, report[0], HID_REPORT_TYPE_OUTPUT, report, sizeof(dualshock3_output_report));
+
+	case RUMBLE_PROTOCOL_DUALSHOCK4:
+		memset(report, 0, DUALSHOCK4_OUTPUT_REPORT_SIZE);
+		report[0] = 0x05; // Report ID
+		report[1] = 0x01; // Valid flags: motors only, light bar unchanged
+		report[2] = 0x04;
+		report[4] = weak;
+		report[5] = strong;
+
+		// Report ID is sent as first byte by TinyUSB
+		return tuh_hid_send_report(device->dev_addr, device->instance, report[0], report + 1, DUALSHOCK4_OUTPUT_REPORT_SIZE - 1);
+
+	case RUMBLE_PROTOCOL_DUALSENSE:
+		memset(report, 0, DUALSENSE_OUTPUT_REPORT_SIZE);
+		report[0] = 0x02; // Report ID
+		report[1] = 0x03; // Valid flags 0: compatible vibration, haptics select
+		report[3] = weak;
+		report[4] = strong;
+
+		return tuh_hid_send_report(device->dev_addr, device->instance, report[0], report + 1, DUALSENSE_OUTPUT_REPORT_SIZE - 1);
+	}
+
+	return false;
+}
+
+void rumble_task()
+{
+	const bool on = rumble_mailbox & 1;
+	const uint32_t now = time_us_32();
+
+	for (rumble_device& device : g_devices)
+	{
+		if (device.protocol == RUMBLE_PROTOCOL_NONE)
+			continue;
+
+		if (device.in_flight)
+		{
+			if (now - device.sent_us < RUMBLE_TRANSFER_TIMEOUT_MS * 1000)
+				continue;
+
+			device.in_flight = false;
+		}
+
+		if (device.on == on || now - device.sent_us < RUMBLE_MIN_INTERVAL_MS * 1000)
+			continue;
+
+		if (send(&device, on))
+		{
+			device.on = on;
+			device.in_flight = true;
+			device.sent_us = now;
+		}
+	}
+}
+
+void tuh_hid_report_sent_cb(uint8_t dev_addr, uint8_t idx, uint8_t const*, uint16_t)
+{
+	rumble_sent(dev_addr, idx);
+}
+
+void tuh_hid_set_report_complete_cb(uint8_t dev_addr, uint8_t idx, uint8_t, uint8_t, uint16_t)
+{
+	rumble_sent(dev_addr, idx);
+}
+
+#endif
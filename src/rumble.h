@@ -0,0 +1,57 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "tusb_config.h"
+
+/*
+Console rumble forwarding to USB pads.
+
+Joybus core posts rumble bit of every poll to a single word mailbox (sequence << 1 | on), written only
+when state changes: no lock, no USB call on reply path. Core1 takes the latest state, so changes between
+two rumble_task() calls are coalesced, and sends it to every pad with rumble support as asynchronous transfer:
+- XInput: tuh_xinput_set_rumble();
+- DualShock 3: output report 0x01 by SET_REPORT control transfer;
+- DualShock 4: output report 0x05, DualSense: output report 0x02 on interrupt OUT endpoint.
+One transfer per pad is in flight, pad state is updated at most every RUMBLE_MIN_INTERVAL_MS.
+*/
+
+#define RUMBLE_MIN_INTERVAL_MS 20
+#define RUMBLE_TRANSFER_TIMEOUT_MS 200 // Completion callback missed, send again
+#define RUMBLE_STRONG_MOTOR 0xFF // GameCube pad has a single motor
+#define RUMBLE_WEAK_MOTOR 0x00
+
+#if RUMBLE
+extern volatile uint32_t rumble_mailbox;
+
+// Post console rumble state. Call on Joybus core for every poll.
+inline void rumble_post(bool on)
+{
+	const uint32_t mailbox = rumble_mailbox;
+
+	if ((mailbox & 1) != on)
+		rumble_mailbox = ((mailbox & ~1u) + 2) | on;
+}
+
+// Register HID pad, ignored if VID/PID has no known rumble output report. Call from tuh_hid_mount_cb().
+void rumble_hid_mount(uint8_t dev_addr, uint8_t instance, uint16_t vid, uint16_t pid);
+
+// Register XInput pad, repeated calls are ignored. Call once LED / rumble off init transfers are done.
+void rumble_xinput_mount(uint8_t dev_addr, uint8_t instance);
+
+// Forget pad. Call from unmount callbacks.
+void rumble_unmount(uint8_t dev_addr, uint8_t instance);
+
+// Transfer completed. Call from tuh_xinput_report_sent_cb(), HID callbacks are defined in rumble.cpp.
+void rumble_sent(uint8_t dev_addr, uint8_t instance);
+
+// Send latest state to pads. Call from core1 loop.
+void rumble_task();
+#else
+inline void rumble_post(bool) {}
+inline void rumble_hid_mount(uint8_t, uint8_t, uint16_t, uint16_t) {}
+inline void rumble_xinput_mount(uint8_t, uint8_t) {}
+inline void rumble_unmount(uint8_t, uint8_t) {}
+inline void rumble_sent(uint8_t, uint8_t) {}
+inline void rumble_task() {}
+#endif
@@ -0,0 +1,111 @@
+#include <cassert>
+#include <string.h>
+
+#include "pico/stdlib.h"
+#include "tusb.h"
+
+#include "rumble.h"
+
+/*
+Test of rumble output reports (rumble.cpp) sent to DualShock 3, DualShock 4 and DualSense pads:
+motor bytes of every report for console rumble on and off. USB transfers are captured by stand-ins below.
+*/
+
+typedef struct sent_report
+{
+	uint8_t dev_addr;
+	uint8_t report_id;
+	uint8_t report_type;
+	uint8_t data[64];
+	uint16_t len;
+} sent_report;
+
+static sent_report g_sent;
+static unsigned g_sent_count = 0;
+
+static void capture(uint8_t dev_addr, uint8_t report_id, uint8_t report_type, const void* report, uint16_t len)
+{
+	assert(len <= sizeof(g_sent.data));
+
+	g_sent = {};
+	g_sent.dev_addr = dev_addr;
+	g_sent.report_id = report_id;
+	g_sent.report_type = report_type;
+	g_sent.len = len;
+	memcpy(g_sent.data, report, len);
+	g_sent_count++;
+}
+
+bool tuh_hid_set_report(uint8_t dev_addr, uint8_t, uint8_t report_id, uint8_t report_type, void* report, uint16_t len)
+{
+	capture(dev_addr, report_id, report_type, report, len);
+	return true;
+}
+
+bool tuh_hid_send_report(uint8_t dev_addr, uint8_t, uint8_t report_id, const void* report, uint16_t len)
+{
+	capture(dev_addr, report_id, HID_REPORT_TYPE_OUTPUT, report, len);
+	return true;
+}
+
+// ps3.cpp DualShock 3 enable request, not used by rumble
+bool tuh_control_xfer(tuh_xfer_t*)
+{
+	return false;
+}
+
+// Post console rumble state and run rumble task after minimum interval, returns report sent to dev_addr.
+static const sent_report& rumble(bool on, uint8_t dev_addr)
+{
+	sleep_ms(RUMBLE_MIN_INTERVAL_MS + 1);
+
+	const unsigned count = g_sent_count;
+	rumble_post(on);
+	rumble_task();
+
+	assert(g_sent_count == count + 1 && g_sent.dev_addr == dev_addr);
+
+	tuh_hid_set_report_complete_cb(dev_addr, 0, g_sent.report_id, g_sent.report_type, g_sent.len);
+	tuh_hid_report_sent_cb(dev_addr, 0, g_sent.data, g_sent.len);
+
+	return g_sent;
+}
+
+int main()
+{
+	// DualShock 3: SET_REPORT 0x01, weak motor duration / on, strong motor duration / force
+	rumble_hid_mount(1, 0, 0x054C, 0x0268);
+
+	const sent_report& dualshock3 = rumble(true, 1);
+	assert(dualshock3.report_id == 0x01 && dualshock3.report_type == HID_REPORT_TYPE_OUTPUT && dualshock3.data[0] == 0x01);
+	assert(dualshock3.data[2] == 0xFF && dualshock3.data[3] == (RUMBLE_WEAK_MOTOR ? 1 : 0));
+	assert(dualshock3.data[4] == 0xFF && dualshock3.data[5] == RUMBLE_STRONG_MOTOR);
+	assert(dualshock3.data[10] == 0x02); // LED 1
+
+	rumble(false, 1);
+	assert(g_sent.data[2] == 0xFF && g_sent.data[3] == 0 && g_sent.data[4] == 0xFF && g_sent.data[5] == 0);
+	rumble_unmount(1, 0);
+
+	// DualShock 4: output report 0x05 without Report ID, motors only
+	rumble_hid_mount(2, 0, 0x054C, 0x05C4);
+
+	const sent_report& dualshock4 = rumble(true, 2);
+	assert(dualshock4.report_id == 0x05 && dualshock4.data[0] == 0x01);
+	assert(dualshock4.data[3] == RUMBLE_WEAK_MOTOR && dualshock4.data[4] == RUMBLE_STRONG_MOTOR);
+
+	rumble(false, 2);
+	assert(g_sent.data[3] == 0 && g_sent.data[4] == 0);
+	rumble_unmount(2, 0);
+
+	// DualSense: output report 0x02 without Report ID, compatible vibration
+	rumble_hid_mount(3, 0, 0x054C, 0x0CE6);
+
+	const sent_report& dualsense = rumble(true, 3);
+	assert(dualsense.report_id == 0x02 && dualsense.data[0] == 0x03);
+	assert(dualsense.data[2] == RUMBLE_WEAK_MOTOR && dualsense.data[3] == RUMBLE_STRONG_MOTOR);
+
+	rumble(false, 3);
+	assert(g_sent.data[2] == 0 && g_sent.data[3] == 0);
+
+	return 0;
+}
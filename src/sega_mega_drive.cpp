@@ -3,6 +3,7 @@
 #include "pico/stdlib.h"
 
 #include "sega_mega_drive.h"
+#include "hot_path.h"
 
 /*
 	GPIO pins connection to Sega Mega Drive Controller DB9 Male connector:
@@ -53,7 +54,7 @@ void initSegaMegaDrive()
 	Questionable:
 	https://segaretro.org/Sega_Mega_Drive/Control_pad_inputs
 */
-smd_state_t getSegaMegaDriveReport()
+smd_state_t HOT_PATH(getSegaMegaDriveReport)()
 {
 	static uint32_t last_update_time = 0;
 	uint32_t current_time = time_us_32();
@@ -96,7 +97,7 @@ smd_state_t getSegaMegaDriveReport()
 	If data is read without this wait, there is no guarantee that the data will be correct.
 	Moreover, the 2usec time is equivalent to 4 nop, including the 68000's prefetch.
 */
-			sleep_us(2); // Short delay to stabilise outputs in controller.
+			busy_wait_us_32(2); // Short delay to stabilise outputs in controller.
 
 			smd_data[i] = gpio_get(SMD_DATA_PIN0)
 						| gpio_get(SMD_DATA_PIN1) << 1
@@ -0,0 +1,14 @@
+#pragma once
+
+#include "pico/types.h"
+
+#define GPIO_IN false
+#define GPIO_OUT true
+
+// Inputs read pull level, nothing is connected to simulated GPIO
+void gpio_init(uint gpio);
+void gpio_set_dir(uint gpio, bool out);
+void gpio_pull_up(uint gpio);
+void gpio_disable_pulls(uint gpio);
+void gpio_put(uint gpio, bool value);
+bool gpio_get(uint gpio);
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "pico/types.h"
+
+/*
+FIFO level model of Joybus state machine (src/sim/sim_pio.h): RX FIFO is fed with console command bytes,
+words put to TX FIFO in output mode are decoded into reply bytes. Instructions are not executed.
+*/
+
+typedef struct pio_hw
+{
+	volatile uint32_t fdebug;
+} pio_hw_t;
+
+typedef pio_hw_t* PIO;
+
+extern pio_hw_t sim_pio0_hw;
+#define pio0 (&sim_pio0_hw)
+
+#define PIO_FDEBUG_RXSTALL_LSB 0
+#define PIO_FDEBUG_RXUNDER_LSB 8
+#define PIO_FDEBUG_TXOVER_LSB 16
+#define PIO_FDEBUG_TXSTALL_LSB 24
+
+typedef struct pio_program
+{
+	const uint16_t* instructions;
+	uint8_t length;
+	int8_t origin;
+} pio_program_t;
+
+typedef struct pio_sm_config
+{
+	float clkdiv;
+} pio_sm_config;
+
+static inline void sm_config_set_in_pins(pio_sm_config*, uint) {}
+static inline void sm_config_set_out_pins(pio_sm_config*, uint, uint) {}
+static inline void sm_config_set_set_pins(pio_sm_config*, uint, uint) {}
+static inline void sm_config_set_clkdiv(pio_sm_config* config, float div) { config->clkdiv = div; }
+static inline void sm_config_set_out_shift(pio_sm_config*, bool, bool, uint) {}
+static inline void sm_config_set_in_shift(pio_sm_config*, bool, bool, uint) {}
+
+static inline uint pio_encode_jmp(uint addr) { return addr; } // Unconditional JMP opcode is 0
+
+uint pio_add_program(PIO pio, const pio_program_t* program);
+void pio_gpio_init(PIO pio, uint pin);
+void pio_sm_claim(PIO pio, uint sm);
+void pio_sm_init(PIO pio, uint sm, uint initial_pc, const pio_sm_config* config);
+void pio_sm_set_config(PIO pio, uint sm, const pio_sm_config* config);
+void pio_sm_set_enabled(PIO pio, uint sm, bool enabled);
+void pio_sm_clear_fifos(PIO pio, uint sm);
+void pio_sm_restart(PIO pio, uint sm);
+void pio_sm_clkdiv_restart(PIO pio, uint sm);
+void pio_sm_exec(PIO pio, uint sm, uint instr);
+uint32_t pio_sm_get_blocking(PIO pio, uint sm);
+void pio_sm_put_blocking(PIO pio, uint sm, uint32_t data);
@@ -0,0 +1,8 @@
+#pragma once
+
+#include "tusb.h"
+
+typedef struct usbh_class_driver
+{
+	const char* name;
+} usbh_class_driver_t;
@@ -0,0 +1,15 @@
+#pragma once
+
+#include "hardware/pio.h"
+
+// Entry points of pio/my_pio.pio, keep in sync with pioasm output
+#define save_offset_inmode 0u
+#define save_offset_outmode 6u
+
+static const pio_program_t save_program = { nullptr, 17, -1 };
+
+static inline pio_sm_config save_program_get_default_config(uint)
+{
+	pio_sm_config config = { 1.0f };
+	return config;
+}
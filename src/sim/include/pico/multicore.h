@@ -0,0 +1,4 @@
+#pragma once
+
+// Core1 entry runs on its own thread
+void multicore_launch_core1(void (*entry)(void));
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <stdio.h>
+
+#include "pico/types.h"
+#include "hardware/gpio.h"
+
+#define PICO_ERROR_TIMEOUT -1
+
+// Simulator time: microseconds since process start
+uint32_t time_us_32();
+uint64_t time_us_64();
+
+void sleep_us(uint64_t us);
+void sleep_ms(uint32_t ms);
+void busy_wait_us_32(uint32_t us);
+void tight_loop_contents();
+
+bool set_sys_clock_khz(uint32_t freq_khz, bool required);
+
+bool stdio_init_all();
+int getchar_timeout_us(uint32_t timeout_us);
+
+[[noreturn]] void panic(const char* fmt, ...);
@@ -0,0 +1,15 @@
+#pragma once
+
+#include "pico/types.h"
+
+typedef struct sim_spin_lock spin_lock_t;
+
+uint spin_lock_claim_unused(bool required);
+spin_lock_t* spin_lock_init(uint lock_num);
+void spin_lock_unsafe_blocking(spin_lock_t* lock);
+void spin_unlock_unsafe(spin_lock_t* lock);
+
+// Core threads share memory through std::atomic fences
+#include <atomic>
+
+static inline void __dmb() { std::atomic_thread_fence(std::memory_order_seq_cst); }
@@ -0,0 +1,10 @@
+#pragma once
+
+// Simulator stand-in for Pico SDK headers (src/sim): only what firmware sources use.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef unsigned int uint;
+
+#define __force_inline inline __attribute__((always_inline))
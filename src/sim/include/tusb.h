@@ -0,0 +1,111 @@
+#pragma once
+
+/*
+Simulator stand-in for TinyUSB host (src/sim/sim_tusb.h): HID devices on up to two ports are attached from
+recorded or synthetic traffic, their reports are delivered from tuh_task() on core1 thread.
+*/
+
+#include <stddef.h>
+
+#include "pico/types.h"
+#include "tusb_config.h"
+
+#define TU_LOG1(...) do {} while (0)
+
+#ifndef CFG_TUH_HID_EPIN_BUFSIZE
+#define CFG_TUH_HID_EPIN_BUFSIZE 64
+#endif
+
+#define tu_htole16(x) (x)
+
+typedef enum
+{
+	XFER_RESULT_SUCCESS = 0,
+	XFER_RESULT_FAILED,
+	XFER_RESULT_STALLED,
+	XFER_RESULT_TIMEOUT,
+	XFER_RESULT_INVALID
+} xfer_result_t;
+
+enum
+{
+	TUSB_REQ_RCPT_DEVICE = 0,
+	TUSB_REQ_RCPT_INTERFACE,
+	TUSB_REQ_RCPT_ENDPOINT,
+	TUSB_REQ_RCPT_OTHER
+};
+
+enum
+{
+	TUSB_REQ_TYPE_STANDARD = 0,
+	TUSB_REQ_TYPE_CLASS,
+	TUSB_REQ_TYPE_VENDOR,
+	TUSB_REQ_TYPE_INVALID
+};
+
+enum
+{
+	TUSB_DIR_OUT = 0,
+	TUSB_DIR_IN = 1
+};
+
+enum
+{
+	HID_REQ_CONTROL_GET_REPORT = 0x01,
+	HID_REQ_CONTROL_SET_REPORT = 0x09
+};
+
+enum
+{
+	HID_REPORT_TYPE_INVALID = 0,
+	HID_REPORT_TYPE_INPUT,
+	HID_REPORT_TYPE_OUTPUT,
+	HID_REPORT_TYPE_FEATURE
+};
+
+typedef struct tusb_control_request
+{
+	struct
+	{
+		uint8_t recipient : 5;
+		uint8_t type : 2;
+		uint8_t direction : 1;
+	} bmRequestType_bit;
+	uint8_t bRequest;
+	uint16_t wValue;
+	uint16_t wIndex;
+	uint16_t wLength;
+} tusb_control_request_t;
+
+struct tuh_xfer_s;
+typedef struct tuh_xfer_s tuh_xfer_t;
+typedef void (*tuh_xfer_cb_t)(tuh_xfer_t* xfer);
+
+struct tuh_xfer_s
+{
+	uint8_t daddr;
+	uint8_t ep_addr;
+	xfer_result_t result;
+	const tusb_control_request_t* setup;
+	uint32_t actual_len;
+	uint8_t* buffer;
+	tuh_xfer_cb_t complete_cb;
+	uintptr_t user_data;
+};
+
+bool tuh_init(uint8_t rhport);
+void tuh_task();
+bool tuh_vid_pid_get(uint8_t dev_addr, uint16_t* vid, uint16_t* pid);
+bool tuh_control_xfer(tuh_xfer_t* xfer);
+bool tuh_hid_receive_report(uint8_t dev_addr, uint8_t instance);
+bool tuh_hid_send_report(uint8_t dev_addr, uint8_t instance, uint8_t report_id, const void* report, uint16_t len);
+bool tuh_hid_set_report(uint8_t dev_addr, uint8_t instance, uint8_t report_id, uint8_t report_type, void* report, uint16_t len);
+
+// Application callbacks, defined by firmware
+void tuh_mount_cb(uint8_t dev_addr);
+void tuh_umount_cb(uint8_t dev_addr);
+void tuh_hid_mount_cb(uint8_t dev_addr, uint8_t instance, uint8_t const* desc_report, uint16_t desc_len);
+void tuh_hid_umount_cb(uint8_t dev_addr, uint8_t instance);
+void tuh_hid_report_received_cb(uint8_t dev_addr, uint8_t instance, uint8_t const* report, uint16_t len);
+void tuh_hid_report_sent_cb(uint8_t dev_addr, uint8_t instance, uint8_t const* report, uint16_t len);
+void tuh_hid_set_report_complete_cb(uint8_t dev_addr, uint8_t instance, uint8_t report_id, uint8_t report_type, uint16_t len);
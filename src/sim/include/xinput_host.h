@@ -0,0 +1,56 @@
+#pragma once
+
+#include "host/usbh.h"
+
+// Types of lib/tusb_xinput used by firmware, no XInput device is simulated
+
+#define XINPUT_GAMEPAD_DPAD_UP 0x0001
+#define XINPUT_GAMEPAD_DPAD_DOWN 0x0002
+#define XINPUT_GAMEPAD_DPAD_LEFT 0x0004
+#define XINPUT_GAMEPAD_DPAD_RIGHT 0x0008
+#define XINPUT_GAMEPAD_START 0x0010
+#define XINPUT_GAMEPAD_BACK 0x0020
+#define XINPUT_GAMEPAD_LEFT_THUMB 0x0040
+#define XINPUT_GAMEPAD_RIGHT_THUMB 0x0080
+#define XINPUT_GAMEPAD_LEFT_SHOULDER 0x0100
+#define XINPUT_GAMEPAD_RIGHT_SHOULDER 0x0200
+#define XINPUT_GAMEPAD_GUIDE 0x0400
+#define XINPUT_GAMEPAD_A 0x1000
+#define XINPUT_GAMEPAD_B 0x2000
+#define XINPUT_GAMEPAD_X 0x4000
+#define XINPUT_GAMEPAD_Y 0x8000
+
+typedef enum
+{
+	XINPUT_UNKNOWN = 0,
+	XBOXONE,
+	XBOX360_WIRELESS,
+	XBOX360_WIRED,
+	XBOXOG
+} xinput_type_t;
+
+typedef struct xinput_gamepad
+{
+	uint16_t wButtons;
+	uint8_t bLeftTrigger;
+	uint8_t bRightTrigger;
+	int16_t sThumbLX;
+	int16_t sThumbLY;
+	int16_t sThumbRX;
+	int16_t sThumbRY;
+} xinput_gamepad_t;
+
+typedef struct xinputh_interface
+{
+	xinput_gamepad_t pad;
+	xinput_type_t type;
+	uint8_t connected;
+	uint8_t new_pad_data;
+	xfer_result_t last_xfer_result;
+} xinputh_interface_t;
+
+extern const usbh_class_driver_t usbh_xinput_driver;
+
+static inline bool tuh_xinput_receive_report(uint8_t, uint8_t) { return true; }
+static inline bool tuh_xinput_set_led(uint8_t, uint8_t, uint8_t, bool) { return true; }
+static inline bool tuh_xinput_set_rumble(uint8_t, uint8_t, uint8_t, uint8_t, bool) { return true; }
@@ -0,0 +1,459 @@
+#include "pio_emulator.h"
+
+#include <string.h>
+
+enum
+{
+	OP_JMP = 0,
+	OP_WAIT,
+	OP_IN,
+	OP_OUT,
+	OP_PUSH_PULL,
+	OP_MOV,
+	OP_IRQ,
+	OP_SET
+};
+
+static bool fifo_push(pio_emu_fifo* fifo, uint32_t data)
+{
+	if (fifo->count == PIO_EMU_FIFO_DEPTH)
+		return false;
+
+	fifo->data[(fifo->head + fifo->count) % PIO_EMU_FIFO_DEPTH] = data;
+	fifo->count++;
+
+	return true;
+}
+
+static bool fifo_pop(pio_emu_fifo* fifo, uint32_t* data)
+{
+	if (!fifo->count)
+		return false;
+
+	*data = fifo->data[fifo->head];
+	fifo->head = (fifo->head + 1) % PIO_EMU_FIFO_DEPTH;
+	fifo->count--;
+
+	return true;
+}
+
+static inline uint32_t bit_mask(uint8_t count)
+{
+	return count >= 32 ? 0xFFFFFFFFu : (1u << count) - 1;
+}
+
+static inline uint32_t rotate_right(uint32_t value, uint8_t shift)
+{
+	shift &= 31;
+	return shift ? (value >> shift) | (value << (32 - shift)) : value;
+}
+
+static inline uint32_t reverse_bits(uint32_t value)
+{
+	uint32_t result = 0;
+
+	for (int i = 0; i < 32; i++, value >>= 1)
+		result = (result << 1) | (value & 1);
+
+	return result;
+}
+
+// Write count bits of value to pins or pindirs starting at base, wrapping at GPIO 31
+static void write_pins(uint32_t* target, uint8_t base, uint8_t count, uint32_t value)
+{
+	const uint32_t mask = bit_mask(count);
+	const uint32_t rotated_mask = rotate_right(mask, (uint8_t)(32 - base));
+	const uint32_t rotated_value = rotate_right(value & mask, (uint8_t)(32 - base));
+
+	*target = (*target & ~rotated_mask) | rotated_value;
+}
+
+static inline uint32_t read_pins(uint32_t gpio_in, uint8_t base)
+{
+	return rotate_right(gpio_in, base);
+}
+
+pio_emu_config pio_emu_default_config(uint8_t length)
+{
+	pio_emu_config config;
+	memset(&config, 0, sizeof(config));
+
+	config.wrap_target = 0;
+	config.wrap = (uint8_t)(length - 1);
+	config.out_count = 32;
+	config.in_shift_right = true;
+	config.push_threshold = 32;
+	config.out_shift_right = true;
+	config.pull_threshold = 32;
+
+	return config;
+}
+
+void pio_emu_restart(pio_emu_sm* sm)
+{
+	sm->isr = 0;
+	sm->isr_count = 0;
+	sm->osr_count = 32; // Empty
+	sm->delay = 0;
+	sm->stalled = false;
+	memset(&sm->tx, 0, sizeof(sm->tx));
+	memset(&sm->rx, 0, sizeof(sm->rx));
+}
+
+void pio_emu_init(pio_emu_sm* sm, const uint16_t* program, uint8_t length, const pio_emu_config* config, uint8_t pc)
+{
+	memset(sm, 0, sizeof(*sm));
+
+	sm->program = program;
+	sm->length = length;
+	sm->config = *config;
+	sm->pc = pc;
+
+	pio_emu_restart(sm);
+}
+
+bool pio_emu_put(pio_emu_sm* sm, uint32_t data)
+{
+	return fifo_push(&sm->tx, data);
+}
+
+bool pio_emu_get(pio_emu_sm* sm, uint32_t* data)
+{
+	return fifo_pop(&sm->rx, data);
+}
+
+static void shift_in(pio_emu_sm* sm, uint32_t data, uint8_t count)
+{
+	data &= bit_mask(count);
+
+	if (count == 32)
+		sm->isr = data;
+	else if (sm->config.in_shift_right)
+		sm->isr = (sm->isr >> count) | (data << (32 - count));
+	else
+		sm->isr = (sm->isr << count) | data;
+
+	sm->isr_count = (uint8_t)(sm->isr_count + count > 32 ? 32 : sm->isr_count + count);
+}
+
+static uint32_t shift_out(pio_emu_sm* sm, uint8_t count)
+{
+	uint32_t data;
+
+	if (count == 32)
+	{
+		data = sm->osr;
+		sm->osr = 0;
+	}
+	else if (sm->config.out_shift_right)
+	{
+		data = sm->osr & bit_mask(count);
+		sm->osr >>= count;
+	}
+	else
+	{
+		data = sm->osr >> (32 - count);
+		sm->osr <<= count;
+	}
+
+	sm->osr_count = (uint8_t)(sm->osr_count + count > 32 ? 32 : sm->osr_count + count);
+
+	return data;
+}
+
+static uint32_t mov_source(const pio_emu_sm* sm, uint8_t source, uint32_t gpio_in)
+{
+	switch (source)
+	{
+	case 0: return read_pins(gpio_in, sm->config.in_base);
+	case 1: return sm->x;
+	case 2: return sm->y;
+	case 5: return sm->tx.count == 0 ? 0xFFFFFFFFu : 0; // STATUS, default STATUS_TX_LESSTHAN 1
+	case 6: return sm->isr;
+	case 7: return sm->osr;
+	default: return 0; // NULL / reserved
+	}
+}
+
+// Returns false when instruction stalls
+static bool execute(pio_emu_sm* sm, uint16_t instruction, uint32_t gpio_in, bool* jumped)
+{
+	const uint8_t opcode = instruction >> 13;
+	const uint8_t arg1 = (instruction >> 5) & 0x07;
+	const uint8_t arg2 = instruction & 0x1F;
+	const uint8_t count = arg2 ? arg2 : 32;
+
+	*jumped = false;
+
+	switch (opcode)
+	{
+	case OP_JMP:
+	{
+		bool condition = false;
+
+		switch (arg1)
+		{
+		case 0: condition = true; break;
+		case 1: condition = sm->x == 0; break;
+		case 2: condition = sm->x != 0; sm->x--; break;
+		case 3: condition = sm->y == 0; break;
+		case 4: condition = sm->y != 0; sm->y--; break;
+		case 5: condition = sm->x != sm->y; break;
+		case 6: condition = (gpio_in >> sm->config.jmp_pin) & 1; break;
+		case 7: condition = sm->osr_count < sm->config.pull_threshold; break;
+		}
+
+		if (condition)
+		{
+			sm->pc = arg2;
+			*jumped = true;
+		}
+
+		return true;
+	}
+
+	case OP_WAIT:
+	{
+		const bool polarity = (instruction >> 7) & 1;
+		const uint8_t source = (instruction >> 5) & 0x03;
+		bool level;
+
+		if (source == 0)
+			level = (gpio_in >> arg2) & 1;
+		else if (source == 1)
+			level = (read_pins(gpio_in, sm->config.in_base) >> arg2) & 1;
+		else
+		{
+			const uint8_t irq = arg2 & 0x07;
+			level = (sm->irq_flags >> irq) & 1;
+
+			if (level && polarity)
+				sm->irq_flags &= ~(1u << irq); // Wait 1 irq clears flag
+		}
+
+		return level == polarity;
+	}
+
+	case OP_IN:
+	{
+		if (sm->config.autopush && sm->isr_count + count >= sm->config.push_threshold && sm->rx.count == PIO_EMU_FIFO_DEPTH)
+			return false;
+
+		uint32_t data = 0;
+
+		switch (arg1)
+		{
+		case 0: data = read_pins(gpio_in, sm->config.in_base); break;
+		case 1: data = sm->x; break;
+		case 2: data = sm->y; break;
+		case 6: data = sm->isr; break;
+		case 7: data = sm->osr; break;
+		default: break; // NULL
+		}
+
+		shift_in(sm, data, count);
+
+		if (sm->config.autopush && sm->isr_count >= sm->config.push_threshold)
+		{
+			fifo_push(&sm->rx, sm->isr);
+			sm->isr = 0;
+			sm->isr_count = 0;
+		}
+
+		return true;
+	}
+
+	case OP_OUT:
+	{
+		if (sm->config.autopull && sm->osr_count >= sm->config.pull_threshold)
+		{
+			uint32_t data;
+
+			if (!fifo_pop(&sm->tx, &data))
+				return false;
+
+			sm->osr = data;
+			sm->osr_count = 0;
+		}
+
+		const uint32_t data = shift_out(sm, count);
+
+		switch (arg1)
+		{
+		case 0: write_pins(&sm->pins, sm->config.out_base, sm->config.out_count < count ? sm->config.out_count : count, data); break;
+		case 1: sm->x = data; break;
+		case 2: sm->y = data; break;
+		case 4: write_pins(&sm->pindirs, sm->config.out_base, sm->config.out_count < count ? sm->config.out_count : count, data); break;
+		case 5: sm->pc = (uint8_t)(data & 0x1F); *jumped = true; break;
+		case 6: sm->isr = data; sm->isr_count = count; break;
+		case 7: execute(sm, (uint16_t)data, gpio_in, jumped); *jumped = true; break;
+		default: break; // NULL
+		}
+
+		return true;
+	}
+
+	case OP_PUSH_PULL:
+	{
+		const bool is_pull = (instruction >> 7) & 1;
+		const bool if_flag = (instruction >> 6) & 1;
+		const bool block = (instruction >> 5) & 1;
+
+		if (is_pull)
+		{
+			if (if_flag && sm->osr_count < sm->config.pull_threshold)
+				return true; // IFEMPTY: OSR not empty
+
+			uint32_t data;
+
+			if (fifo_pop(&sm->tx, &data))
+				sm->osr = data;
+			else if (block)
+				return false;
+			else
+				sm->osr = sm->x; // Non-blocking pull from empty FIFO copies X
+
+			sm->osr_count = 0;
+		}
+		else
+		{
+			if (if_flag && sm->isr_count < sm->config.push_threshold)
+				return true; // IFFULL: ISR not full
+
+			if (!fifo_push(&sm->rx, sm->isr) && block)
+				return false;
+
+			sm->isr = 0;
+			sm->isr_count = 0;
+		}
+
+		return true;
+	}
+
+	case OP_MOV:
+	{
+		const uint8_t op = (instruction >> 3) & 0x03;
+		uint32_t data = mov_source(sm, instruction & 0x07, gpio_in);
+
+		if (op == 1)
+			data = ~data;
+		else if (op == 2)
+			data = reverse_bits(data);
+
+		switch (arg1)
+		{
+		case 0: write_pins(&sm->pins, sm->config.out_base, sm->config.out_count, data); break;
+		case 1: sm->x = data; break;
+		case 2: sm->y = data; break;
+		case 4: execute(sm, (uint16_t)data, gpio_in, jumped); *jumped = true; break;
+		case 5: sm->pc = (uint8_t)(data & 0x1F); *jumped = true; break;
+		case 6: sm->isr = data; sm->isr_count = 0; break;
+		case 7: sm->osr = data; sm->osr_count = 0; break;
+		default: break;
+		}
+
+		return true;
+	}
+
+	case OP_IRQ:
+	{
+		const bool clear = (instruction >> 6) & 1;
+		const bool wait = (instruction >> 5) & 1;
+		const uint8_t irq = arg2 & 0x07;
+
+		if (clear)
+		{
+			sm->irq_flags &= ~(1u << irq);
+			return true;
+		}
+
+		if (!sm->stalled)
+			sm->irq_flags |= 1u << irq;
+
+		return !wait || !((sm->irq_flags >> irq) & 1); // Nothing else clears the flag: wait stalls forever
+	}
+
+	case OP_SET:
+		switch (arg1)
+		{
+		case 0: write_pins(&sm->pins, sm->config.set_base, sm->config.set_count, arg2); break;
+		case 1: sm->x = arg2; break;
+		case 2: sm->y = arg2; break;
+		case 4: write_pins(&sm->pindirs, sm->config.set_base, sm->config.set_count, arg2); break;
+		default: break;
+		}
+
+		return true;
+	}
+
+	return true;
+}
+
+static void apply_sideset(pio_emu_sm* sm, uint16_t instruction)
+{
+	const uint8_t bits = sm->config.sideset_bits;
+
+	if (!bits)
+		return;
+
+	const uint8_t field = (instruction >> (13 - bits)) & bit_mask(bits);
+	uint8_t value_bits = bits;
+
+	if (sm->config.sideset_optional)
+	{
+		if (!(field >> (bits - 1)))
+			return;
+
+		value_bits--;
+	}
+
+	const uint32_t value = field & bit_mask(value_bits);
+
+	write_pins(sm->config.sideset_pindirs ? &sm->pindirs : &sm->pins, sm->config.sideset_base, value_bits, value);
+}
+
+static inline uint8_t delay_of(const pio_emu_sm* sm, uint16_t instruction)
+{
+	return (instruction >> 8) & bit_mask((uint8_t)(5 - sm->config.sideset_bits));
+}
+
+void pio_emu_exec(pio_emu_sm* sm, uint16_t instruction, uint32_t gpio_in)
+{
+	bool jumped;
+
+	sm->stalled = false;
+	sm->delay = 0;
+
+	apply_sideset(sm, instruction);
+	execute(sm, instruction, gpio_in, &jumped);
+}
+
+void pio_emu_step(pio_emu_sm* sm, uint32_t gpio_in)
+{
+	sm->cycles++;
+
+	if (sm->delay)
+	{
+		sm->delay--;
+		return;
+	}
+
+	const uint16_t instruction = sm->program[sm->pc];
+	bool jumped;
+
+	if (!sm->stalled)
+		apply_sideset(sm, instruction); // Side-set takes effect on the first cycle, even if stalled
+
+	if (!execute(sm, instruction, gpio_in, &jumped))
+	{
+		sm->stalled = true;
+		sm->stall_cycles++;
+		return;
+	}
+
+	sm->stalled = false;
+	sm->delay = delay_of(sm, instruction);
+
+	if (!jumped)
+		sm->pc = sm->pc == sm->config.wrap ? sm->config.wrap_target : (uint8_t)(sm->pc + 1);
+}
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <stdint.h>
+
+/*
+Cycle accurate model of a single RP2040 PIO state machine for host timing tests.
+
+Executes program words as assembled by pioasm: every instruction takes one state machine clock
+plus its delay, WAIT and blocking PUSH / PULL stall without consuming delay. All opcodes are decoded;
+IRQ flags are local to the state machine, there is no other state machine to raise them.
+GPIO levels are passed to every step, driven pins are read back from pins / pindirs.
+Clock divider and input synchronizer are left to the caller, see src/sim/pio_timing.cpp.
+*/
+
+#define PIO_EMU_FIFO_DEPTH 4
+
+typedef struct pio_emu_config
+{
+	uint8_t wrap_target;
+	uint8_t wrap;
+
+	uint8_t in_base;
+	uint8_t out_base;
+	uint8_t out_count;
+	uint8_t set_base;
+	uint8_t set_count;
+	uint8_t sideset_base;
+	uint8_t sideset_bits; // Including enable bit
+	bool sideset_optional;
+	bool sideset_pindirs;
+	uint8_t jmp_pin;
+
+	bool in_shift_right;
+	bool autopush;
+	uint8_t push_threshold; // 1..32
+	bool out_shift_right;
+	bool autopull;
+	uint8_t pull_threshold; // 1..32
+} pio_emu_config;
+
+typedef struct pio_emu_fifo
+{
+	uint32_t data[PIO_EMU_FIFO_DEPTH];
+	uint8_t head;
+	uint8_t count;
+} pio_emu_fifo;
+
+typedef struct pio_emu_sm
+{
+	const uint16_t* program; // Loaded at offset 0
+	uint8_t length;
+	pio_emu_config config;
+
+	uint8_t pc;
+	uint32_t x;
+	uint32_t y;
+	uint32_t isr;
+	uint32_t osr;
+	uint8_t isr_count;
+	uint8_t osr_count;
+	uint8_t delay;
+	bool stalled;
+	uint8_t irq_flags;
+
+	pio_emu_fifo tx;
+	pio_emu_fifo rx;
+
+	uint32_t pins; // Output levels
+	uint32_t pindirs; // 1 - output
+
+	uint64_t cycles;
+	uint64_t stall_cycles;
+} pio_emu_sm;
+
+// Default config as returned by pio_get_default_sm_config(), wrap over whole program.
+pio_emu_config pio_emu_default_config(uint8_t length);
+
+// Load program and config, restart at pc. Pins, FIFOs and scratch registers are cleared.
+void pio_emu_init(pio_emu_sm* sm, const uint16_t* program, uint8_t length, const pio_emu_config* config, uint8_t pc);
+
+// Same as pio_sm_restart() and pio_sm_clear_fifos(): clear shift counters, delay, stall and FIFOs.
+void pio_emu_restart(pio_emu_sm* sm);
+
+// Execute instruction immediately, like pio_sm_exec().
+void pio_emu_exec(pio_emu_sm* sm, uint16_t instruction, uint32_t gpio_in);
+
+// Advance one state machine clock with given synchronized GPIO input levels.
+void pio_emu_step(pio_emu_sm* sm, uint32_t gpio_in);
+
+// FIFO access from the CPU side. Return false when full / empty.
+bool pio_emu_put(pio_emu_sm* sm, uint32_t data);
+bool pio_emu_get(pio_emu_sm* sm, uint32_t* data);
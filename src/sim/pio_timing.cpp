@@ -0,0 +1,429 @@
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <stdint.h>
+#include <stdio.h>
+#include <vector>
+
+#include "my_pio.pio.h" // pioasm output of pio/my_pio.pio, PICO_NO_HARDWARE
+
+#include "communication_protocols/joybus/encoder.hpp"
+#include "communication_protocols/joybus/gcReport.hpp"
+
+#include "pio_emulator.h"
+
+/*
+Joybus PIO program timing check on the PIO emulator (pio_emulator.h).
+
+Usage:
+	Joybus_PIO_Timing [--sys-khz 150000] [--clkdiv 6] [--console-bit-ns 4000] [--console-low0-ns 3000]
+	                  [--console-low1-ns 1000] [--console-stop-ns 1000] [--firmware-delay-ns 4000]
+	                  [--input-sync-cycles 2] [--tolerance-percent 5] [--min-sample-margin-ns 250]
+
+Runs pio/my_pio.pio the way enterMode() does: console probe, origin and poll waveforms are driven
+into the input program, received bytes are answered --firmware-delay-ns later (probe adds the 6 us
+busy wait of enterMode()) by restarting the state machine in output mode with convertToPio() words.
+
+Measured per command: input sample distance to the nearest console edge, reply bit cell and low times,
+stop bit, gap between console stop bit and reply, and time the state machine drives the line while
+console holds it low. Fails when received or replied bytes are wrong, cell or low times are off nominal
+Joybus timing (4 us cell, 3 us / 1 us low) by more than --tolerance-percent, sample margin is below limit
+or line is driven against console.
+*/
+
+static const uint8_t DATA_PIN = 0; // in / out / set base
+
+typedef struct timing_options
+{
+	uint32_t sys_khz = 150000;
+	double clkdiv = 6.0;
+	uint32_t console_bit_ns = 4000;
+	uint32_t console_low0_ns = 3000;
+	uint32_t console_low1_ns = 1000;
+	uint32_t console_stop_ns = 1000;
+	uint32_t firmware_delay_ns = 4000;
+	uint32_t input_sync_cycles = 2;
+	double tolerance_percent = 5.0;
+	uint32_t min_sample_margin_ns = 250;
+} timing_options;
+
+typedef struct joybus_transfer
+{
+	const char* name;
+	std::vector<uint8_t> command;
+	std::vector<uint8_t> reply;
+	uint32_t extra_delay_ns; // Firmware wait before reply
+} joybus_transfer;
+
+typedef struct low_pulse
+{
+	double fall_ns;
+	double rise_ns;
+} low_pulse;
+
+typedef struct range
+{
+	double min = INFINITY;
+	double max = -INFINITY;
+
+	void add(double value)
+	{
+		min = value < min ? value : min;
+		max = value > max ? value : max;
+	}
+
+	bool empty() const
+	{
+		return min > max;
+	}
+} range;
+
+typedef struct transfer_result
+{
+	std::vector<uint8_t> received;
+	std::vector<uint8_t> replied;
+	double sample_margin_ns = INFINITY;
+	range cell_ns;
+	range low0_ns;
+	range low1_ns;
+	double stop_low_ns = 0;
+	double reply_gap_ns = 0;
+	double contention_ns = 0;
+	bool replied_in_time = false;
+} transfer_result;
+
+// Console low pulses of command with stop bit, starting at start_ns
+static std::vector<low_pulse> console_waveform(const std::vector<uint8_t>& command, double start_ns, const timing_options& options)
+{
+	std::vector<low_pulse> pulses;
+	double t = start_ns;
+
+	for (uint8_t byte : command)
+	{
+		for (int bit = 7; bit >= 0; bit--)
+		{
+			const uint32_t low = (byte >> bit) & 1 ? options.console_low1_ns : options.console_low0_ns;
+			pulses.push_back({ t, t + low });
+			t += options.console_bit_ns;
+		}
+	}
+
+	pulses.push_back({ t, t + options.console_stop_ns });
+
+	return pulses;
+}
+
+static bool console_low(const std::vector<low_pulse>& pulses, double t)
+{
+	for (const low_pulse& pulse : pulses)
+	{
+		if (t >= pulse.fall_ns && t < pulse.rise_ns)
+			return true;
+	}
+
+	return false;
+}
+
+static double nearest_edge_distance(const std::vector<low_pulse>& pulses, double t)
+{
+	double distance = INFINITY;
+
+	for (const low_pulse& pulse : pulses)
+	{
+		distance = fmin(distance, fabs(t - pulse.fall_ns));
+		distance = fmin(distance, fabs(t - pulse.rise_ns));
+	}
+
+	return distance;
+}
+
+static transfer_result run_transfer(pio_emu_sm* sm, const joybus_transfer& transfer, const timing_options& options)
+{
+	transfer_result result;
+
+	const double sys_ns = 1e6 / options.sys_khz;
+	const uint32_t divider = (uint32_t)lround(options.clkdiv * 256); // 16.8 fixed point like SMx_CLKDIV
+	const double start_ns = 10000;
+
+	const std::vector<low_pulse> console = console_waveform(transfer.command, start_ns, options);
+	const double console_end_ns = console.back().rise_ns;
+
+	uint32_t words[8];
+	int words_count = 0;
+	convertToPio(transfer.reply.data(), (int)transfer.reply.size(), words, words_count);
+
+	std::vector<bool> line_history; // Line level per sys cycle, for input synchronizer delay
+	std::vector<low_pulse> reply_pulses;
+	double reply_start_ns = -1; // State machine restarted in output mode
+	double firmware_due_ns = -1;
+	double fall_ns = 0;
+	int words_queued = 0;
+	bool reply_driven = false;
+	bool previous_line = true;
+	uint32_t divider_accumulator = 0;
+
+	const double timeout_ns = console_end_ns + 1e6;
+
+	for (uint64_t cycle = 0;; cycle++)
+	{
+		const double t = cycle * sys_ns;
+
+		if (t > timeout_ns)
+			break;
+
+		const bool sm_drives = (sm->pindirs >> DATA_PIN) & 1;
+		const bool sm_low = sm_drives && !((sm->pins >> DATA_PIN) & 1);
+		const bool console_drives_low = console_low(console, t);
+		const bool line = !(console_drives_low || sm_low);
+
+		if (sm_drives && console_drives_low && !sm_low)
+			result.contention_ns += sys_ns;
+
+		if (reply_start_ns >= 0 && line != previous_line)
+		{
+			if (!line)
+				fall_ns = t;
+			else
+				reply_pulses.push_back({ fall_ns, t });
+		}
+
+		previous_line = line;
+		line_history.push_back(line);
+
+		// State machine clock enable from fractional divider
+		divider_accumulator += 256;
+
+		if (divider_accumulator >= divider)
+		{
+			divider_accumulator -= divider;
+
+			const size_t synced = cycle >= options.input_sync_cycles ? cycle - options.input_sync_cycles : 0;
+			const uint32_t gpio_in = line_history[synced] ? 1u << DATA_PIN : 0;
+
+			const uint16_t instruction = sm->program[sm->pc];
+			const bool samples_pins = !sm->delay && (instruction & 0xE0E0) == 0x4000; // IN PINS
+
+			if (samples_pins && reply_start_ns < 0)
+				result.sample_margin_ns = fmin(result.sample_margin_ns, nearest_edge_distance(console, synced * sys_ns));
+
+			pio_emu_step(sm, gpio_in);
+		}
+
+		// Firmware: pop received bytes, answer once the whole command arrived
+		uint32_t data;
+
+		while (pio_emu_get(sm, &data))
+			result.received.push_back((uint8_t)data);
+
+		if (firmware_due_ns < 0 && reply_start_ns < 0 && result.received.size() >= transfer.command.size())
+			firmware_due_ns = t + options.firmware_delay_ns + transfer.extra_delay_ns;
+
+		if (firmware_due_ns >= 0 && t >= firmware_due_ns)
+		{
+			firmware_due_ns = -1;
+			reply_start_ns = t;
+
+			pio_emu_restart(sm);
+			pio_emu_exec(sm, (uint16_t)(save_offset_outmode), line ? 1u << DATA_PIN : 0); // JMP outmode
+		}
+
+		while (reply_start_ns >= 0 && words_queued < words_count && pio_emu_put(sm, words[words_queued]))
+			words_queued++;
+
+		reply_driven = reply_driven || (reply_start_ns >= 0 && sm_drives);
+
+		// Reply done: back in input mode, line released
+		if (reply_driven && words_queued == words_count && !((sm->pindirs >> DATA_PIN) & 1) && line)
+		{
+			result.replied_in_time = true;
+			break;
+		}
+	}
+
+	if (reply_pulses.empty())
+		return result;
+
+	const double nominal_cell = 4000.0;
+
+	std::vector<uint8_t> bits;
+
+	for (size_t i = 0; i < reply_pulses.size(); i++)
+	{
+		const double low = reply_pulses[i].rise_ns - reply_pulses[i].fall_ns;
+		const uint8_t bit = low < nominal_cell / 2;
+
+		bits.push_back(bit);
+
+		if (i + 1 == reply_pulses.size())
+		{
+			result.stop_low_ns = low; // Stop bit
+			break;
+		}
+
+		result.cell_ns.add(reply_pulses[i + 1].fall_ns - reply_pulses[i].fall_ns);
+		(bit ? result.low1_ns : result.low0_ns).add(low);
+	}
+
+	for (size_t i = 0; i + 8 <= bits.size(); i += 8)
+	{
+		uint8_t byte = 0;
+
+		for (size_t j = 0; j < 8; j++)
+			byte = (uint8_t)(byte << 1 | bits[i + j]);
+
+		result.replied.push_back(byte);
+	}
+
+	result.reply_gap_ns = reply_pulses[0].fall_ns - console_end_ns;
+
+	return result;
+}
+
+static void print_bytes(const std::vector<uint8_t>& bytes)
+{
+	for (uint8_t byte : bytes)
+		printf("%02x", byte);
+}
+
+static bool within(const range& measured, double nominal, double tolerance_percent)
+{
+	const double limit = nominal * tolerance_percent / 100.0;
+
+	return measured.empty() || (measured.min >= nominal - limit && measured.max <= nominal + limit);
+}
+
+static bool check(const joybus_transfer& transfer, const transfer_result& result, const timing_options& options)
+{
+	bool ok = true;
+
+	printf("%-6s rx ", transfer.name);
+	print_bytes(result.received);
+	printf(" reply ");
+	print_bytes(result.replied);
+	printf("\n       sample margin %.0f ns, cell %.0f..%.0f ns, low0 %.0f..%.0f ns, low1 %.0f..%.0f ns, stop low %.0f ns, reply gap %.0f ns, contention %.0f ns\n",
+		result.sample_margin_ns, result.cell_ns.min, result.cell_ns.max, result.low0_ns.min, result.low0_ns.max,
+		result.low1_ns.min, result.low1_ns.max, result.stop_low_ns, result.reply_gap_ns, result.contention_ns);
+
+	if (result.received != transfer.command)
+	{
+		printf("FAIL %s: received bytes differ from command\n", transfer.name);
+		ok = false;
+	}
+
+	if (!result.replied_in_time || result.replied != transfer.reply)
+	{
+		printf("FAIL %s: reply bytes differ\n", transfer.name);
+		ok = false;
+	}
+
+	if (!within(result.cell_ns, 4000, options.tolerance_percent) || !within(result.low0_ns, 3000, options.tolerance_percent) ||
+		!within(result.low1_ns, 1000, options.tolerance_percent))
+	{
+		printf("FAIL %s: reply bit timing off nominal by more than %.1f%%\n", transfer.name, options.tolerance_percent);
+		ok = false;
+	}
+
+	if (result.sample_margin_ns < options.min_sample_margin_ns)
+	{
+		printf("FAIL %s: input sample %.0f ns from console edge, limit %u ns\n", transfer.name, result.sample_margin_ns, options.min_sample_margin_ns);
+		ok = false;
+	}
+
+	if (result.contention_ns > 0)
+	{
+		printf("FAIL %s: line driven high for %.0f ns while console holds it low\n", transfer.name, result.contention_ns);
+		ok = false;
+	}
+
+	return ok;
+}
+
+static bool parse_options(int argc, char** argv, timing_options& options)
+{
+	for (int i = 1; i < argc; i++)
+	{
+		const char* arg = argv[i];
+		const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+
+		if (!value)
+			return false;
+
+		if (!strcmp(arg, "--sys-khz"))
+			options.sys_khz = (uint32_t)atoi(value);
+		else if (!strcmp(arg, "--clkdiv"))
+			options.clkdiv = atof(value);
+		else if (!strcmp(arg, "--console-bit-ns"))
+			options.console_bit_ns = (uint32_t)atoi(value);
+		else if (!strcmp(arg, "--console-low0-ns"))
+			options.console_low0_ns = (uint32_t)atoi(value);
+		else if (!strcmp(arg, "--console-low1-ns"))
+			options.console_low1_ns = (uint32_t)atoi(value);
+		else if (!strcmp(arg, "--console-stop-ns"))
+			options.console_stop_ns = (uint32_t)atoi(value);
+		else if (!strcmp(arg, "--firmware-delay-ns"))
+			options.firmware_delay_ns = (uint32_t)atoi(value);
+		else if (!strcmp(arg, "--input-sync-cycles"))
+			options.input_sync_cycles = (uint32_t)atoi(value);
+		else if (!strcmp(arg, "--tolerance-percent"))
+			options.tolerance_percent = atof(value);
+		else if (!strcmp(arg, "--min-sample-margin-ns"))
+			options.min_sample_margin_ns = (uint32_t)atoi(value);
+		else
+			return false;
+
+		i++;
+	}
+
+	return options.sys_khz > 0 && options.clkdiv >= 1.0 && options.clkdiv < 65536.0;
+}
+
+int main(int argc, char** argv)
+{
+	timing_options options;
+
+	if (!parse_options(argc, argv, options))
+	{
+		fprintf(stderr, "Usage: %s [--sys-khz khz] [--clkdiv div] [--console-bit-ns ns] [--console-low0-ns ns] [--console-low1-ns ns] "
+			"[--console-stop-ns ns] [--firmware-delay-ns ns] [--input-sync-cycles n] [--tolerance-percent p] [--min-sample-margin-ns ns]\n", argv[0]);
+		return 2;
+	}
+
+	const uint8_t* poll_reply = (const uint8_t*)&defaultGcReport;
+
+	const joybus_transfer transfers[] = {
+		{ "probe", { 0x00 }, { 0x09, 0x00, 0x03 }, 6000 }, // busy_wait_us_32(6) in enterMode()
+		{ "origin", { 0x41 }, { 0x00, 0x80, 128, 128, 128, 128, 0, 0, 0, 0 }, 0 },
+		{ "poll", { 0x40, 0x03, 0x00 }, std::vector<uint8_t>(poll_reply, poll_reply + sizeof(GCReport)), 0 },
+	};
+
+	const uint8_t length = (uint8_t)(sizeof(save_program_instructions) / sizeof(save_program_instructions[0]));
+
+	// Same config as enterMode()
+	pio_emu_config config = pio_emu_default_config(length);
+	config.wrap_target = save_wrap_target;
+	config.wrap = save_wrap;
+	config.in_base = DATA_PIN;
+	config.out_base = DATA_PIN;
+	config.out_count = 1;
+	config.set_base = DATA_PIN;
+	config.set_count = 1;
+	config.out_shift_right = true;
+	config.autopull = false;
+	config.pull_threshold = 32;
+	config.in_shift_right = false;
+	config.autopush = true;
+	config.push_threshold = 8;
+
+	pio_emu_sm sm;
+	pio_emu_init(&sm, save_program_instructions, length, &config, save_offset_inmode);
+
+	printf("sys clock %.3f MHz, clkdiv %.2f: state machine clock %.3f MHz\n",
+		options.sys_khz / 1000.0, options.clkdiv, options.sys_khz / 1000.0 / options.clkdiv);
+
+	bool ok = true;
+
+	for (const joybus_transfer& transfer : transfers)
+		ok = check(transfer, run_transfer(&sm, transfer, options), options) && ok;
+
+	return ok ? 0 : 1;
+}
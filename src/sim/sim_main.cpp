@@ -0,0 +1,444 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <stdint.h>
+#include <stdio.h>
+#include <thread>
+#include <vector>
+
+#include "pico/stdlib.h"
+
+#include "controller_slots.h"
+#include "hid_capture_log.h"
+#include "hid_dumps.h"
+#include "sim_pio.h"
+#include "sim_tusb.h"
+
+/*
+Host simulator of the whole adapter: src/main.cpp with TinyUSB host, spinlock, core1 launch
+and Joybus PIO FIFO replaced by stand-ins (src/sim/include). Firmware core0 and core1 run on threads,
+simulated console on the main thread issues probe / origin / poll commands at configured rates.
+
+Usage:
+	SMD2GC_Sim [--capture uart.log] [--duration-ms 3000] [--poll-hz 120] [--probe-hz 0] [--origin-hz 0]
+	           [--usb-hz 250] [--change-ms 20] [--mount-ms 100] [--reply-timeout-us 2000]
+	           [--max-age-us n] [--max-drop-percent n] [--second-pid pid --second-published 0|1]
+
+Pad traffic is replayed from HID capture (src/hid_capture.h), first captured interface,
+or generated for DualShock 4: report every 1 / --usb-hz s, left stick X changes every --change-ms.
+
+With --second-pid DualShock 4 with given PID (hex) is mounted on second port 50 ms later, holding Cross:
+05c4 decodes with generated decoder, other PIDs need generic parser already used by first pad.
+Fails if held Cross reaches console (second pad overwrote Joybus slot) or if second pad slot
+is / isn't published against --second-published.
+
+Input is a change of GCReport published to Joybus core. Input age is time from publishing
+to end of the first poll reply carrying it; input replaced before any poll replied with it is dropped.
+Fails if 99th percentile input age or dropped inputs share exceed given limits.
+Host thread scheduling adds noise to absolute times, compare runs on the same machine.
+*/
+
+int firmware_main(); // src/main.cpp main()
+
+typedef struct sim_options
+{
+	const char* capture = nullptr;
+	uint32_t duration_ms = 0;
+	double poll_hz = 120.0;
+	double probe_hz = 0.0;
+	double origin_hz = 0.0;
+	double usb_hz = 250.0;
+	uint32_t change_ms = 20;
+	uint32_t mount_ms = 100;
+	uint32_t reply_timeout_us = 2000;
+	uint32_t max_age_us = 0;
+	double max_drop_percent = -1.0;
+	uint16_t second_pid = 0;
+	int second_published = -1;
+} sim_options;
+
+typedef struct sim_console_stats
+{
+	uint32_t polls = 0;
+	uint32_t probes = 0;
+	uint32_t origins = 0;
+	uint32_t missed = 0; // No reply within timeout
+	uint32_t bad = 0; // Reply of unexpected length
+	std::vector<uint32_t> poll_latencies_us;
+} sim_console_stats;
+
+typedef struct sim_input_stats
+{
+	std::vector<sim_input> inputs;
+	size_t next = 0; // First input not observed or dropped yet
+	uint32_t observed = 0;
+	uint32_t dropped = 0;
+	std::vector<uint32_t> ages_us;
+} sim_input_stats;
+
+static bool synthetic_device(const sim_options& options, sim_hid_device& device)
+{
+	device.vid = 0x054C;
+	device.pid = 0x09CC;
+	device.descriptor.assign(my_dualshock_4_hid_report_descriptor, my_dualshock_4_hid_report_descriptor + sizeof(my_dualshock_4_hid_report_descriptor));
+
+	const double period_us = 1e6 / options.usb_hz;
+	const uint32_t length_us = options.duration_ms * 1000;
+
+	for (uint32_t i = 0; i * period_us < length_us; i++)
+	{
+		sim_hid_report report;
+		report.time_us = (uint32_t)(i * period_us);
+		report.data.assign(my_dualshock_4_hid_report_idle, my_dualshock_4_hid_report_idle + sizeof(my_dualshock_4_hid_report_idle));
+		report.data[1] = (uint8_t)((report.time_us / (options.change_ms * 1000) + 1) * 53); // Left stick X, every value differs from previous one
+
+		device.reports.push_back(report);
+	}
+
+	return true;
+}
+
+// Idle DualShock 4 holding Cross on second port
+static void second_device(const sim_options& options, sim_hid_device& device)
+{
+	device.vid = 0x054C;
+	device.pid = options.second_pid;
+	device.descriptor.assign(my_dualshock_4_hid_report_descriptor, my_dualshock_4_hid_report_descriptor + sizeof(my_dualshock_4_hid_report_descriptor));
+	device.mount_us = (options.mount_ms + 50) * 1000;
+
+	const double period_us = 1e6 / options.usb_hz;
+	const uint32_t length_us = options.duration_ms * 1000;
+
+	for (uint32_t i = 0; i * period_us < length_us; i++)
+	{
+		sim_hid_report report;
+		report.time_us = (uint32_t)(i * period_us);
+		report.data.assign(my_dualshock_4_hid_report_idle, my_dualshock_4_hid_report_idle + sizeof(my_dualshock_4_hid_report_idle));
+		report.data[5] |= 0x20; // Cross
+
+		device.reports.push_back(report);
+	}
+}
+
+static bool captured_device(const sim_options& options, sim_hid_device& device)
+{
+	std::vector<hid_capture_log_descriptor> descriptors;
+	std::vector<hid_capture_log_report> reports;
+
+	if (!hid_capture_log_read(options.capture, descriptors, reports))
+		return false;
+
+	if (descriptors.empty())
+	{
+		fprintf(stderr, "No HID descriptor in %s\n", options.capture);
+		return false;
+	}
+
+	const hid_capture_log_descriptor& descriptor = descriptors[0];
+
+	device.vid = descriptor.vid;
+	device.pid = descriptor.pid;
+	device.descriptor = descriptor.data;
+
+	uint32_t first_timestamp = 0;
+
+	for (const hid_capture_log_report& captured : reports)
+	{
+		if (captured.dev_addr != descriptor.dev_addr || captured.instance != descriptor.instance)
+			continue;
+
+		if (device.reports.empty())
+			first_timestamp = captured.timestamp;
+
+		sim_hid_report report;
+		report.time_us = captured.timestamp - first_timestamp;
+		report.data = captured.data;
+
+		device.reports.push_back(report);
+	}
+
+	return true;
+}
+
+static void track_inputs(sim_input_stats& stats, const uint8_t* reply, uint32_t reply_us)
+{
+	sim_tusb_inputs(stats.inputs, stats.inputs.size());
+
+	// Latest input published before reply with the same state
+	size_t match = stats.inputs.size();
+
+	for (size_t i = stats.next; i < stats.inputs.size() && (int32_t)(stats.inputs[i].published_us - reply_us) <= 0; i++)
+	{
+		if (!memcmp(&stats.inputs[i].state, reply, sizeof(GCReport)))
+			match = i;
+	}
+
+	if (match == stats.inputs.size())
+		return;
+
+	stats.dropped += (uint32_t)(match - stats.next);
+	stats.observed++;
+	stats.ages_us.push_back(reply_us - stats.inputs[match].published_us);
+	stats.next = match + 1;
+}
+
+static bool transfer(const uint8_t* command, int command_len, int reply_len, uint8_t* reply, uint32_t& reply_us,
+	const sim_options& options, sim_console_stats& stats)
+{
+	int len = 0;
+
+	sim_pio_send_command(command, command_len);
+
+	if (!sim_pio_wait_reply(reply, 16, len, reply_us, options.reply_timeout_us))
+	{
+		stats.missed++;
+		return false;
+	}
+
+	if (len != reply_len)
+	{
+		stats.bad++;
+		return false;
+	}
+
+	return true;
+}
+
+static void run_console(const sim_options& options, sim_console_stats& console, sim_input_stats& inputs)
+{
+	static const uint8_t PROBE[] = { 0x00 };
+	static const uint8_t ORIGIN[] = { 0x41 };
+	static const uint8_t POLL[] = { 0x40, 0x03, 0x00 };
+
+	uint8_t reply[16];
+	uint32_t reply_us;
+
+	for (int i = 0; i < 1000 && !sim_pio_ready(); i++)
+		sleep_ms(1);
+
+	// Console init sequence
+	console.probes++;
+	transfer(PROBE, sizeof(PROBE), 3, reply, reply_us, options, console);
+	console.origins++;
+	transfer(ORIGIN, sizeof(ORIGIN), 10, reply, reply_us, options, console);
+
+	const auto start = std::chrono::steady_clock::now();
+	const auto end = start + std::chrono::milliseconds(options.duration_ms);
+	const auto poll_period = std::chrono::duration<double, std::micro>(1e6 / options.poll_hz);
+
+	double next_probe_us = options.probe_hz > 0 ? 1e6 / options.probe_hz : -1;
+	double next_origin_us = options.origin_hz > 0 ? 1e6 / options.origin_hz : -1;
+
+	for (uint64_t tick = 1;; tick++)
+	{
+		const auto due = start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(poll_period * (double)tick);
+
+		if (due >= end)
+			break;
+
+		std::this_thread::sleep_until(due);
+
+		const double elapsed_us = std::chrono::duration<double, std::micro>(due - start).count();
+
+		if (next_probe_us >= 0 && elapsed_us >= next_probe_us)
+		{
+			console.probes++;
+			transfer(PROBE, sizeof(PROBE), 3, reply, reply_us, options, console);
+			next_probe_us += 1e6 / options.probe_hz;
+		}
+
+		if (next_origin_us >= 0 && elapsed_us >= next_origin_us)
+		{
+			console.origins++;
+			transfer(ORIGIN, sizeof(ORIGIN), 10, reply, reply_us, options, console);
+			next_origin_us += 1e6 / options.origin_hz;
+		}
+
+		console.polls++;
+		const uint32_t sent_us = time_us_32();
+
+		if (!transfer(POLL, sizeof(POLL), sizeof(GCReport), reply, reply_us, options, console))
+			continue;
+
+		console.poll_latencies_us.push_back(reply_us - sent_us);
+		track_inputs(inputs, reply, reply_us);
+	}
+}
+
+static uint32_t percentile(std::vector<uint32_t> values, double share)
+{
+	if (values.empty())
+		return 0;
+
+	std::sort(values.begin(), values.end());
+
+	return values[std::min(values.size() - 1, (size_t)(share * values.size()))];
+}
+
+static double mean(const std::vector<uint32_t>& values)
+{
+	double sum = 0;
+
+	for (uint32_t value : values)
+		sum += value;
+
+	return values.empty() ? 0 : sum / values.size();
+}
+
+static bool parse_options(int argc, char** argv, sim_options& options)
+{
+	for (int i = 1; i < argc; i++)
+	{
+		const char* arg = argv[i];
+		const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+
+		if (!value)
+			return false;
+
+		if (!strcmp(arg, "--capture"))
+			options.capture = value;
+		else if (!strcmp(arg, "--duration-ms"))
+			options.duration_ms = (uint32_t)atoi(value);
+		else if (!strcmp(arg, "--poll-hz"))
+			options.poll_hz = atof(value);
+		else if (!strcmp(arg, "--probe-hz"))
+			options.probe_hz = atof(value);
+		else if (!strcmp(arg, "--origin-hz"))
+			options.origin_hz = atof(value);
+		else if (!strcmp(arg, "--usb-hz"))
+			options.usb_hz = atof(value);
+		else if (!strcmp(arg, "--change-ms"))
+			options.change_ms = (uint32_t)atoi(value);
+		else if (!strcmp(arg, "--mount-ms"))
+			options.mount_ms = (uint32_t)atoi(value);
+		else if (!strcmp(arg, "--reply-timeout-us"))
+			options.reply_timeout_us = (uint32_t)atoi(value);
+		else if (!strcmp(arg, "--max-age-us"))
+			options.max_age_us = (uint32_t)atoi(value);
+		else if (!strcmp(arg, "--max-drop-percent"))
+			options.max_drop_percent = atof(value);
+		else if (!strcmp(arg, "--second-pid"))
+			options.second_pid = (uint16_t)strtoul(value, nullptr, 16);
+		else if (!strcmp(arg, "--second-published"))
+			options.second_published = atoi(value);
+		else
+			return false;
+
+		i++;
+	}
+
+	return options.poll_hz > 0 && options.usb_hz > 0 && options.change_ms > 0;
+}
+
+int main(int argc, char** argv)
+{
+	sim_options options;
+
+	if (!parse_options(argc, argv, options))
+	{
+		fprintf(stderr, "Usage: %s [--capture uart.log] [--duration-ms ms] [--poll-hz hz] [--probe-hz hz] [--origin-hz hz] "
+			"[--usb-hz hz] [--change-ms ms] [--mount-ms ms] [--reply-timeout-us us] [--max-age-us us] [--max-drop-percent percent] "
+			"[--second-pid pid --second-published 0|1]\n", argv[0]);
+		return 2;
+	}
+
+	static sim_hid_device device;
+
+	if (options.capture)
+	{
+		if (!captured_device(options, device))
+			return 1;
+
+		if (!options.duration_ms)
+			options.duration_ms = options.mount_ms + (device.reports.empty() ? 0 : device.reports.back().time_us / 1000) + 100;
+	}
+	else
+	{
+		if (!options.duration_ms)
+			options.duration_ms = 3000;
+
+		synthetic_device(options, device);
+	}
+
+	device.mount_us = options.mount_ms * 1000;
+	sim_tusb_attach(&device);
+
+	static sim_hid_device second;
+
+	if (options.second_pid)
+	{
+		second_device(options, second);
+		sim_tusb_attach(&second);
+	}
+
+	std::thread(firmware_main).detach(); // Core0, launches core1
+
+	sim_console_stats console;
+	sim_input_stats inputs;
+
+	run_console(options, console, inputs);
+
+	sim_tusb_inputs(inputs.inputs, inputs.inputs.size());
+
+	const uint32_t published = (uint32_t)inputs.inputs.size();
+	const uint32_t pending = published - inputs.observed - inputs.dropped;
+	const double drop_percent = inputs.observed + inputs.dropped ? 100.0 * inputs.dropped / (inputs.observed + inputs.dropped) : 0.0;
+	const uint32_t age_p99 = percentile(inputs.ages_us, 0.99);
+
+	printf("SIM console polls=%u probes=%u origins=%u missed=%u bad=%u reply_mean_us=%.1f reply_p99_us=%u reply_max_us=%u\n",
+		console.polls, console.probes, console.origins, console.missed, console.bad,
+		mean(console.poll_latencies_us), percentile(console.poll_latencies_us, 0.99), percentile(console.poll_latencies_us, 1.0));
+	printf("SIM usb reports=%u skipped=%u\n", sim_tusb_reports_delivered(), sim_tusb_reports_skipped());
+	printf("SIM inputs published=%u observed=%u dropped=%u pending=%u drop_percent=%.2f\n",
+		published, inputs.observed, inputs.dropped, pending, drop_percent);
+	printf("SIM age min_us=%u mean_us=%.1f p50_us=%u p99_us=%u max_us=%u\n",
+		percentile(inputs.ages_us, 0.0), mean(inputs.ages_us), percentile(inputs.ages_us, 0.5), age_p99, percentile(inputs.ages_us, 1.0));
+
+	int status = 0;
+
+	if (options.second_pid)
+	{
+		// First mounted pad claims slot 0 answered to console, second pad the next one
+		const GCReport second_slot = controller_slot_read(1);
+		const bool published = second_slot.a;
+		const bool overwritten = std::any_of(inputs.inputs.begin(), inputs.inputs.end(), [](const sim_input& input) { return input.state.a; });
+
+		printf("SIM second port pid=%04x published=%d joybus_overwritten=%d\n", options.second_pid, published, overwritten);
+
+		if (overwritten)
+		{
+			fprintf(stderr, "FAIL second port pad reached Joybus slot\n");
+			status = 1;
+		}
+
+		if (options.second_published >= 0 && published != (options.second_published != 0))
+		{
+			fprintf(stderr, "FAIL second port pad %s\n", published ? "published" : "not published");
+			status = 1;
+		}
+	}
+
+	if (!inputs.observed)
+	{
+		fprintf(stderr, "FAIL no input reached console\n");
+		status = 1;
+	}
+
+	if (options.max_age_us && age_p99 > options.max_age_us)
+	{
+		fprintf(stderr, "FAIL input age p99 %u us exceeds %u us\n", age_p99, options.max_age_us);
+		status = 1;
+	}
+
+	if (options.max_drop_percent >= 0 && drop_percent > options.max_drop_percent)
+	{
+		fprintf(stderr, "FAIL dropped inputs %.2f%% exceed %.2f%%\n", drop_percent, options.max_drop_percent);
+		status = 1;
+	}
+
+	// Firmware threads never return
+	fflush(stdout);
+	fflush(stderr);
+	_Exit(status);
+}
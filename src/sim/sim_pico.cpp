@@ -0,0 +1,318 @@
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdarg>
+#include <cstdlib>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "pico/stdlib.h"
+#include "pico/multicore.h"
+#include "pico/stdio_uart.h"
+#include "pico/sync.h"
+#include "hardware/pio.h"
+#include "my_pio.pio.h"
+
+#include "sim_pio.h"
+
+// Time
+
+static const auto g_start = std::chrono::steady_clock::now();
+
+uint64_t time_us_64()
+{
+	return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - g_start).count();
+}
+
+uint32_t time_us_32()
+{
+	return (uint32_t)time_us_64();
+}
+
+void sleep_us(uint64_t us)
+{
+	std::this_thread::sleep_for(std::chrono::microseconds(us));
+}
+
+void sleep_ms(uint32_t ms)
+{
+	std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+void busy_wait_us_32(uint32_t us)
+{
+	const uint64_t end = time_us_64() + us;
+
+	while (time_us_64() < end)
+		;
+}
+
+void tight_loop_contents()
+{
+	std::this_thread::yield(); // Core1 loop shares host CPU with console thread
+}
+
+bool set_sys_clock_khz(uint32_t, bool)
+{
+	return true;
+}
+
+// Stdio
+
+void stdio_uart_init() {}
+
+bool stdio_init_all()
+{
+	return true;
+}
+
+int getchar_timeout_us(uint32_t)
+{
+	return PICO_ERROR_TIMEOUT;
+}
+
+void panic(const char* fmt, ...)
+{
+	va_list args;
+	va_start(args, fmt);
+	vfprintf(stderr, fmt, args);
+	va_end(args);
+	fprintf(stderr, "\n");
+
+	abort();
+}
+
+// Multicore
+
+void multicore_launch_core1(void (*entry)(void))
+{
+	std::thread(entry).detach();
+}
+
+struct sim_spin_lock
+{
+	std::atomic_flag flag;
+};
+
+static sim_spin_lock g_spin_locks[32];
+static uint g_spin_locks_claimed = 0;
+
+uint spin_lock_claim_unused(bool required)
+{
+	if (g_spin_locks_claimed == 32)
+	{
+		if (required)
+			panic("No free spinlocks");
+
+		return (uint)-1;
+	}
+
+	return g_spin_locks_claimed++;
+}
+
+spin_lock_t* spin_lock_init(uint lock_num)
+{
+	g_spin_locks[lock_num].flag.clear();
+
+	return &g_spin_locks[lock_num];
+}
+
+void spin_lock_unsafe_blocking(spin_lock_t* lock)
+{
+	while (lock->flag.test_and_set(std::memory_order_acquire))
+		;
+}
+
+void spin_unlock_unsafe(spin_lock_t* lock)
+{
+	lock->flag.clear(std::memory_order_release);
+}
+
+// GPIO
+
+static std::atomic<bool> g_gpio_levels[30];
+
+void gpio_init(uint) {}
+void gpio_set_dir(uint, bool) {}
+
+void gpio_pull_up(uint gpio)
+{
+	g_gpio_levels[gpio] = true;
+}
+
+void gpio_disable_pulls(uint gpio)
+{
+	g_gpio_levels[gpio] = false;
+}
+
+void gpio_put(uint gpio, bool value)
+{
+	g_gpio_levels[gpio] = value;
+}
+
+bool gpio_get(uint gpio)
+{
+	return g_gpio_levels[gpio];
+}
+
+// PIO: Joybus state machine 0 only
+
+pio_hw_t sim_pio0_hw;
+
+static std::mutex g_pio_mutex;
+static std::condition_variable g_pio_changed;
+
+static bool g_pio_enabled = false;
+static bool g_pio_ready = false;
+static uint g_pio_offset = 0;
+static bool g_pio_outmode = false;
+static std::deque<uint8_t> g_pio_rx;
+static std::vector<uint8_t> g_pio_reply_bits;
+static std::vector<uint8_t> g_pio_reply;
+static bool g_pio_reply_done = false;
+static uint32_t g_pio_reply_us = 0;
+
+uint pio_add_program(PIO, const pio_program_t*)
+{
+	return g_pio_offset;
+}
+
+void pio_gpio_init(PIO, uint) {}
+void pio_sm_claim(PIO, uint) {}
+void pio_sm_set_config(PIO, uint, const pio_sm_config*) {}
+void pio_sm_restart(PIO, uint) {}
+void pio_sm_clkdiv_restart(PIO, uint) {}
+
+void pio_sm_exec(PIO, uint, uint instr)
+{
+	std::lock_guard<std::mutex> lock(g_pio_mutex);
+
+	// Only forced jumps to program entry points are used
+	g_pio_outmode = instr == g_pio_offset + save_offset_outmode;
+	g_pio_reply_bits.clear();
+}
+
+void pio_sm_init(PIO pio, uint sm, uint initial_pc, const pio_sm_config*)
+{
+	pio_sm_set_enabled(pio, sm, false);
+	pio_sm_clear_fifos(pio, sm);
+	pio_sm_exec(pio, sm, pio_encode_jmp(initial_pc));
+}
+
+void pio_sm_set_enabled(PIO, uint, bool enabled)
+{
+	std::lock_guard<std::mutex> lock(g_pio_mutex);
+
+	g_pio_enabled = enabled;
+	g_pio_ready = g_pio_ready || enabled;
+	g_pio_changed.notify_all();
+}
+
+void pio_sm_clear_fifos(PIO, uint)
+{
+	std::lock_guard<std::mutex> lock(g_pio_mutex);
+
+	g_pio_rx.clear();
+}
+
+uint32_t pio_sm_get_blocking(PIO, uint)
+{
+	std::unique_lock<std::mutex> lock(g_pio_mutex);
+
+	g_pio_changed.wait(lock, [] { return g_pio_enabled && !g_pio_rx.empty(); });
+
+	const uint8_t data = g_pio_rx.front();
+	g_pio_rx.pop_front();
+
+	return data;
+}
+
+void pio_sm_put_blocking(PIO, uint, uint32_t data)
+{
+	std::lock_guard<std::mutex> lock(g_pio_mutex);
+
+	if (!g_pio_outmode)
+		return; // Input program never pulls
+
+	// out X, 1; out Y, 1: output bit, then output enable
+	for (int pair = 0; pair < 16; pair++, data >>= 2)
+	{
+		if (!(data & 2))
+		{
+			// jmp !Y inmode: data bits before stop bit form reply
+			g_pio_reply.clear();
+
+			for (size_t bit = 0; bit + 8 <= g_pio_reply_bits.size(); bit += 8)
+			{
+				uint8_t byte = 0;
+
+				for (size_t i = 0; i < 8; i++)
+					byte = (uint8_t)(byte << 1 | g_pio_reply_bits[bit + i]);
+
+				g_pio_reply.push_back(byte);
+			}
+
+			g_pio_reply_bits.clear();
+			g_pio_outmode = false;
+			g_pio_reply_done = true;
+			g_pio_reply_us = time_us_32();
+			g_pio_changed.notify_all();
+
+			return;
+		}
+
+		g_pio_reply_bits.push_back(data & 1);
+	}
+}
+
+bool sim_pio_ready()
+{
+	std::lock_guard<std::mutex> lock(g_pio_mutex);
+
+	return g_pio_ready;
+}
+
+void sim_pio_send_command(const uint8_t* command, int len)
+{
+	std::lock_guard<std::mutex> lock(g_pio_mutex);
+
+	g_pio_reply_done = false;
+
+	if (!g_pio_enabled || g_pio_outmode)
+		return;
+
+	for (int i = 0; i < len; i++)
+		g_pio_rx.push_back(command[i]);
+
+	g_pio_changed.notify_all();
+}
+
+bool sim_pio_wait_reply(uint8_t* reply, int max_len, int& len, uint32_t& completed_us, uint32_t timeout_us)
+{
+	std::unique_lock<std::mutex> lock(g_pio_mutex);
+
+	if (!g_pio_changed.wait_for(lock, std::chrono::microseconds(timeout_us), [] { return g_pio_reply_done; }))
+		return false;
+
+	len = 0;
+
+	for (uint8_t byte : g_pio_reply)
+	{
+		if (len < max_len)
+			reply[len++] = byte;
+	}
+
+	completed_us = g_pio_reply_us;
+	g_pio_reply_done = false;
+
+	return true;
+}
+
+// Firmware modules without simulated hardware
+
+#include "irq_affinity.h"
+
+void irq_affinity_snapshot() {}
+void irq_affinity_check() {}
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <stdint.h>
+
+/*
+Console side of simulated Joybus state machine (include/hardware/pio.h stand-in).
+
+Command bytes are pushed to RX FIFO at once if state machine waits in input mode,
+otherwise the command is lost like on the wire. Reply is complete when output program
+pulls a bit pair with output enable cleared, after the stop bit.
+*/
+
+// State machine was enabled by enterMode()
+bool sim_pio_ready();
+
+// Push command bytes, stop bit is not pushed by input program
+void sim_pio_send_command(const uint8_t* command, int len);
+
+// Wait for reply to last command. Returns false on timeout.
+bool sim_pio_wait_reply(uint8_t* reply, int max_len, int& len, uint32_t& completed_us, uint32_t timeout_us);
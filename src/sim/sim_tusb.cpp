@@ -0,0 +1,153 @@
+#include "sim_tusb.h"
+
+#include <cstring>
+#include <mutex>
+
+#include "pico/stdlib.h"
+#include "host/usbh.h"
+#include "tusb.h"
+#include "xinput_host.h"
+
+#include "../controller_slots.h"
+
+static const uint8_t SIM_INSTANCE = 0;
+
+const usbh_class_driver_t usbh_xinput_driver = { "XINPUT" };
+
+typedef struct sim_port
+{
+	const sim_hid_device* device;
+	bool mounted;
+	bool receive_queued;
+	size_t next_report;
+} sim_port;
+
+static sim_port g_ports[SIM_TUSB_PORTS] = {}; // Device address is port + 1
+static uint8_t g_port_count = 0;
+static uint32_t g_init_us = 0;
+static uint32_t g_delivered = 0;
+static uint32_t g_skipped = 0;
+
+static std::mutex g_inputs_mutex;
+static std::vector<sim_input> g_inputs;
+static GCReport g_published = defaultGcReport;
+
+bool sim_tusb_attach(const sim_hid_device* device)
+{
+	if (g_port_count >= SIM_TUSB_PORTS)
+		return false;
+
+	g_ports[g_port_count++].device = device;
+
+	return true;
+}
+
+void sim_tusb_inputs(std::vector<sim_input>& inputs, size_t from)
+{
+	std::lock_guard<std::mutex> lock(g_inputs_mutex);
+
+	for (size_t i = from; i < g_inputs.size(); i++)
+		inputs.push_back(g_inputs[i]);
+}
+
+uint32_t sim_tusb_reports_delivered()
+{
+	return g_delivered;
+}
+
+uint32_t sim_tusb_reports_skipped()
+{
+	return g_skipped;
+}
+
+bool tuh_init(uint8_t)
+{
+	g_init_us = time_us_32();
+
+	return true;
+}
+
+static void record_input()
+{
+	const GCReport state = controller_slot_read_joybus();
+
+	if (!memcmp(&state, &g_published, sizeof(GCReport)))
+		return;
+
+	g_published = state;
+
+	std::lock_guard<std::mutex> lock(g_inputs_mutex);
+	g_inputs.push_back({ time_us_32(), state });
+}
+
+static void port_task(sim_port* port, uint8_t dev_addr, uint32_t now)
+{
+	const sim_hid_device* device = port->device;
+
+	if (!port->mounted)
+	{
+		if (now < device->mount_us)
+			return;
+
+		port->mounted = true;
+		tuh_mount_cb(dev_addr);
+		tuh_hid_mount_cb(dev_addr, SIM_INSTANCE, device->descriptor.data(), (uint16_t)device->descriptor.size());
+		return;
+	}
+
+	if (!port->receive_queued || port->next_report >= device->reports.size())
+		return;
+
+	const uint32_t since_mount = now - device->mount_us;
+
+	if (device->reports[port->next_report].time_us > since_mount)
+		return;
+
+	// Latest due report, earlier ones were superseded on the device
+	while (port->next_report + 1 < device->reports.size() && device->reports[port->next_report + 1].time_us <= since_mount)
+	{
+		port->next_report++;
+		g_skipped++;
+	}
+
+	const sim_hid_report& report = device->reports[port->next_report++];
+
+	port->receive_queued = false;
+	g_delivered++;
+	tuh_hid_report_received_cb(dev_addr, SIM_INSTANCE, report.data.data(), (uint16_t)report.data.size());
+
+	record_input();
+}
+
+void tuh_task()
+{
+	const uint32_t now = time_us_32() - g_init_us;
+
+	for (uint8_t i = 0; i < g_port_count; i++)
+		port_task(&g_ports[i], i + 1, now);
+}
+
+bool tuh_vid_pid_get(uint8_t dev_addr, uint16_t* vid, uint16_t* pid)
+{
+	const sim_hid_device* device = dev_addr && dev_addr <= g_port_count ? g_ports[dev_addr - 1].device : nullptr;
+
+	*vid = device ? device->vid : 0;
+	*pid = device ? device->pid : 0;
+
+	return device != nullptr;
+}
+
+bool tuh_control_xfer(tuh_xfer_t*)
+{
+	return true;
+}
+
+bool tuh_hid_receive_report(uint8_t dev_addr, uint8_t)
+{
+	if (!dev_addr || dev_addr > g_port_count)
+		return false;
+
+	g_ports[dev_addr - 1].receive_queued = true;
+
+	return true;
+}
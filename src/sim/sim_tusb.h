@@ -0,0 +1,49 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+#include "communication_protocols/joybus/gcReport.hpp"
+
+/*
+Simulated USB HID devices behind TinyUSB host stand-in (include/tusb.h), one per host port (device address port + 1).
+
+Device is mounted mount_us after tuh_init(). Reports are delivered by tuh_task() on core1 thread
+at their time when firmware has queued report receive; reports which became due while core1 was busy
+are skipped in favour of the latest one, like a device answering IN token with current state.
+Every change of GCReport published by firmware to Joybus core (controller_slot_read_joybus()) is recorded as an input.
+*/
+
+#define SIM_TUSB_PORTS 2
+
+typedef struct sim_hid_report
+{
+	uint32_t time_us; // Since mount
+	std::vector<uint8_t> data;
+} sim_hid_report;
+
+typedef struct sim_hid_device
+{
+	uint16_t vid;
+	uint16_t pid;
+	std::vector<uint8_t> descriptor;
+	uint32_t mount_us;
+	std::vector<sim_hid_report> reports;
+} sim_hid_device;
+
+typedef struct sim_input
+{
+	uint32_t published_us;
+	GCReport state;
+} sim_input;
+
+// Attach device to next port before firmware starts. False if every port is used.
+bool sim_tusb_attach(const sim_hid_device* device);
+
+// Copy inputs published since index.
+void sim_tusb_inputs(std::vector<sim_input>& inputs, size_t from);
+
+// Reports delivered / skipped because core1 was late.
+uint32_t sim_tusb_reports_delivered();
+uint32_t sim_tusb_reports_skipped();
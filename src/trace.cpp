@@ -0,0 +1,200 @@
+#include "trace.h"
+
+#if PICO_ON_DEVICE
+#include "pico/stdlib.h"
+#include "pico/stdio/driver.h"
+#include "pico/stdio_uart.h"
+#include "pico/sync.h"
+#include "hardware/dma.h"
+#include "hardware/sync.h"
+#include "hardware/uart.h"
+#endif
+
+static_assert(sizeof(trace_record) == 16, "trace_record is sent to UART as is");
+static_assert((TRACE_RING_SIZE & (TRACE_RING_SIZE - 1)) == 0, "TRACE_RING_SIZE must be power of 2");
+
+typedef struct trace_ring
+{
+	trace_record records[TRACE_RING_SIZE];
+	volatile uint32_t head; // Advanced by owning core after record is written
+	volatile uint32_t tail; // Advanced by trace_task() after record is sent
+	volatile uint32_t dropped;
+} trace_ring;
+
+static trace_ring g_trace_rings[TRACE_CORES];
+
+#if PICO_ON_DEVICE
+static int g_dma_channel = -1;
+static uint8_t g_dma_ring = 0; // Ring being sent
+static uint32_t g_dma_count = 0; // Records being sent
+
+// Stdio text and trace records share UART data register: text is written between DMA transfers only.
+static critical_section_t g_uart_lock;
+static volatile uint32_t g_stdio_writers = 0; // Cores in stdio out_chars, no DMA transfer is started while nonzero
+static stdio_driver_t g_trace_stdio;
+
+static void trace_stdio_out_chars(const char* buf, int len)
+{
+	critical_section_enter_blocking(&g_uart_lock);
+	g_stdio_writers = g_stdio_writers + 1;
+	critical_section_exit(&g_uart_lock);
+
+	dma_channel_wait_for_finish_blocking(g_dma_channel); // Records in flight are sent whole before text
+	uart_tx_wait_blocking(uart_default);
+
+	stdio_uart.out_chars(buf, len);
+
+	critical_section_enter_blocking(&g_uart_lock);
+	g_stdio_writers = g_stdio_writers - 1;
+	critical_section_exit(&g_uart_lock);
+}
+#endif
+
+static uint32_t g_dropped_sent[TRACE_CORES]; // Drop counts already sent with TRACE_EVENT_DROPPED
+
+void trace_init()
+{
+#if PICO_ON_DEVICE
+	g_dma_channel = dma_claim_unused_channel(false);
+
+	if (g_dma_channel < 0)
+		return;
+
+	critical_section_init(&g_uart_lock);
+
+	// Replace UART stdio driver with one waiting for trace DMA
+	g_trace_stdio = stdio_uart;
+	g_trace_stdio.out_chars = trace_stdio_out_chars;
+	g_trace_stdio.next = nullptr;
+
+	stdio_set_driver_enabled(&stdio_uart, false);
+	stdio_set_driver_enabled(&g_trace_stdio, true);
+#endif
+}
+
+// Returns false if ring is full.
+static bool trace_store(uint8_t event, uint16_t arg0, uint32_t arg1, uint32_t arg2)
+{
+#if PICO_ON_DEVICE
+	const uint8_t core = get_core_num();
+	// Interrupt handler on same core can write event between slot check and head update.
+	const uint32_t irq_state = save_and_disable_interrupts();
+	const uint32_t timestamp = time_us_32();
+#else
+	const uint8_t core = 0;
+	const uint32_t timestamp = 0;
+#endif
+	trace_ring* ring = &g_trace_rings[core];
+
+	const uint32_t head = ring->head;
+	const bool stored = head - ring->tail < TRACE_RING_SIZE;
+
+	if (stored)
+	{
+		trace_record* record = &ring->records[head & (TRACE_RING_SIZE - 1)];
+
+		record->magic = TRACE_MAGIC | core;
+		record->event = event;
+		record->arg0 = arg0;
+		record->timestamp = timestamp;
+		record->arg1 = arg1;
+		record->arg2 = arg2;
+
+#if PICO_ON_DEVICE
+		__dmb(); // Record must be visible to other core / DMA before head update
+#endif
+		ring->head = head + 1;
+	}
+	else
+	{
+		ring->dropped = ring->dropped + 1;
+	}
+
+#if PICO_ON_DEVICE
+	restore_interrupts(irq_state);
+#endif
+
+	return stored;
+}
+
+void trace_write(uint8_t event, uint16_t arg0, uint32_t arg1, uint32_t arg2)
+{
+	trace_store(event, arg0, arg1, arg2);
+}
+
+// Queue drop count of every core to current core ring once it has space again.
+static void trace_send_dropped()
+{
+	for (uint8_t core = 0; core < TRACE_CORES; core++)
+	{
+		const uint32_t dropped = g_trace_rings[core].dropped;
+
+		if (dropped != g_dropped_sent[core] && trace_store(TRACE_EVENT_DROPPED, core, dropped, dropped - g_dropped_sent[core]))
+			g_dropped_sent[core] = dropped;
+	}
+}
+
+void trace_task()
+{
+	trace_send_dropped();
+
+#if PICO_ON_DEVICE
+	if (g_dma_channel < 0)
+		return;
+
+	if (g_dma_count)
+	{
+		if (dma_channel_is_busy(g_dma_channel))
+			return;
+
+		g_trace_rings[g_dma_ring].tail += g_dma_count;
+		g_dma_count = 0;
+		g_dma_ring = (g_dma_ring + 1) % TRACE_CORES; // Round robin between cores
+	}
+
+	for (uint8_t i = 0; i < TRACE_CORES; i++)
+	{
+		const uint8_t index = (g_dma_ring + i) % TRACE_CORES;
+		trace_ring* ring = &g_trace_rings[index];
+
+		const uint32_t tail = ring->tail;
+		const uint32_t pending = ring->head - tail;
+
+		if (pending == 0)
+			continue;
+
+		// Send contiguous part only, wrapped part goes with next transfer.
+		const uint32_t start = tail & (TRACE_RING_SIZE - 1);
+		const uint32_t count = (pending < TRACE_RING_SIZE - start) ? pending : TRACE_RING_SIZE - start;
+
+		dma_channel_config config = dma_channel_get_default_config(g_dma_channel);
+		channel_config_set_transfer_data_size(&config, DMA_SIZE_8);
+		channel_config_set_read_increment(&config, true);
+		channel_config_set_write_increment(&config, false);
+		channel_config_set_dreq(&config, uart_get_dreq(uart_default, true));
+
+		critical_section_enter_blocking(&g_uart_lock);
+
+		if (g_stdio_writers == 0)
+		{
+			g_dma_ring = index;
+			g_dma_count = count;
+
+			dma_channel_configure(g_dma_channel, &config,
+				&uart_get_hw(uart_default)->dr,
+				&ring->records[start],
+				count * sizeof(trace_record),
+				true);
+		}
+
+		critical_section_exit(&g_uart_lock);
+
+		return;
+	}
+#endif
+}
+
+uint32_t trace_dropped(uint8_t core)
+{
+	return g_trace_rings[core].dropped;
+}
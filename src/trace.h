@@ -0,0 +1,86 @@
+#pragma once
+
+#include <stdint.h>
+
+/*
+Binary trace log for hot paths.
+
+printf / TU_LOG block the calling core until every character is shifted out at 115200 baud.
+Trace events are instead stored as fixed-size records (timestamp, event id, arguments)
+in a per-core ring buffer. trace_task() drains the rings to UART with DMA from core1 idle loop,
+so writing an event costs a few dozen cycles and never waits for the UART.
+Stdio output on the same UART waits for the DMA transfer in flight and no transfer starts while text is written,
+so records and text never interleave. Events dropped on full ring are counted and sent as TRACE_EVENT_DROPPED.
+
+Levels above TRACE_LEVEL are removed at compile time.
+Decode UART dumps with tools/trace_decode.py.
+*/
+
+#define TRACE_LEVEL_NONE 0
+#define TRACE_LEVEL_ERROR 1
+#define TRACE_LEVEL_INFO 2
+#define TRACE_LEVEL_DEBUG 3
+
+#ifndef TRACE_LEVEL
+#define TRACE_LEVEL TRACE_LEVEL_ERROR
+#endif
+
+#define TRACE_CORES 2
+#define TRACE_RING_SIZE 64 // Records per core, power of 2
+
+// Record start marker, low bit is core number.
+// Bytes 0xA0 / 0xA1 never appear in ASCII stdio output sharing the same UART.
+#define TRACE_MAGIC 0xA0
+
+// Keep in sync with EVENTS table in tools/trace_decode.py
+enum trace_event : uint8_t
+{
+	TRACE_EVENT_NONE = 0,
+	TRACE_EVENT_INVALID_REPORT,     // arg0: report ID, arg1: report length
+	TRACE_EVENT_REPORT_TOO_SHORT,   // arg0: report length, arg1: expected length in bits, arg2: report ID
+	TRACE_EVENT_ARENA_OUT_OF_SPACE, // arg1: requested size, arg2: arena offset
+	TRACE_EVENT_XINPUT_REPORT,      // arg0: buttons, arg1: dev_addr | instance << 4 | type << 8 | LT << 16 | RT << 24, arg2: LX | LY << 8 | RX << 16 | RY << 24
+	TRACE_EVENT_GAMEPAD_CONTROL,    // arg0: control, arg1: value
+	TRACE_EVENT_DROPPED             // arg0: core, arg1: events dropped since boot, arg2: dropped since previous TRACE_EVENT_DROPPED
+};
+
+// 16 bytes, no padding: sent to UART as is.
+typedef struct trace_record
+{
+	uint8_t magic; // TRACE_MAGIC | core number
+	uint8_t event; // trace_event
+	uint16_t arg0;
+	uint32_t timestamp; // us since boot
+	uint32_t arg1;
+	uint32_t arg2;
+} trace_record;
+
+// Claims DMA channel used to drain trace rings and wraps UART stdio driver. Call once after stdio init.
+void trace_init();
+
+// Store event in current core ring. Event is dropped if ring is full.
+void trace_write(uint8_t event, uint16_t arg0, uint32_t arg1, uint32_t arg2);
+
+// Start DMA transfer of pending records if previous one completed and queue drop counts. Call from idle loop.
+void trace_task();
+
+// Count of events dropped because ring was full.
+uint32_t trace_dropped(uint8_t core);
+
+#if TRACE_LEVEL >= TRACE_LEVEL_ERROR
+#define TRACE_ERROR(event, arg0, arg1, arg2) trace_write(event, arg0, arg1, arg2)
+#else
+#define TRACE_ERROR(event, arg0, arg1, arg2) ((void)0)
+#endif
+
+#if TRACE_LEVEL >= TRACE_LEVEL_INFO
+#define TRACE_INFO(event, arg0, arg1, arg2) trace_write(event, arg0, arg1, arg2)
+#else
+#define TRACE_INFO(event, arg0, arg1, arg2) ((void)0)
+#endif
+
+#if TRACE_LEVEL >= TRACE_LEVEL_DEBUG
+#define TRACE_DEBUG(event, arg0, arg1, arg2) trace_write(event, arg0, arg1, arg2)
+#else
+#define TRACE_DEBUG(event, arg0, arg1, arg2) ((void)0)
+#endif
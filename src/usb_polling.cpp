@@ -0,0 +1,249 @@
+#include "usb_polling.h"
+
+#if USB_POLLING_OVERRIDE
+
+#include <stdio.h>
+#include <string.h>
+
+#include "pico/stdlib.h"
+#include "tusb.h"
+
+#include "mount_timeline.h"
+
+#define DESCRIPTOR_COPY_SIZE 128 // Interface with class and endpoint descriptors
+#define FAILED_MAX 4
+
+typedef struct usb_polling_override
+{
+	uint16_t vid;
+	uint16_t pid;
+	uint8_t interval_ms;
+} usb_polling_override;
+
+// Pads known to report reliably at 1 ms, polled at advertised rate by TinyUSB otherwise
+static const usb_polling_override g_overrides[] =
+{
+	{ 0x054C, 0x05C4, 1 }, // DualShock 4
+	{ 0x054C, 0x09CC, 1 }, // DualShock 4 v2
+	{ 0x054C, 0x0CE6, 1 }, // DualSense
+	{ 0x045E, 0x028E, 1 }, // Xbox 360 wired controller
+};
+
+typedef struct usb_polling_device
+{
+	uint8_t advertised_ms; // 0 - not overridden
+	uint8_t interval_ms;
+	uint8_t errors; // Failed IN transfers in current window
+	bool fallback;
+	uint32_t window_start_us;
+	uint32_t last_receive_us[USB_POLLING_INSTANCES];
+	usb_polling_receive_t pending[USB_POLLING_INSTANCES]; // Deferred by fallback pacing
+	uint16_t vid;
+	uint16_t pid;
+} usb_polling_device;
+
+typedef struct usb_polling_failed
+{
+	uint16_t vid;
+	uint16_t pid;
+} usb_polling_failed;
+
+static usb_polling_device g_devices[USB_DEVICE_ADDRESSES];
+static usb_polling_failed g_failed[FAILED_MAX];
+static uint8_t g_failed_count;
+
+static uint8_t g_descriptor_copy[DESCRIPTOR_COPY_SIZE];
+
+static uint8_t override_interval(uint16_t vid, uint16_t pid)
+{
+	for (uint8_t i = 0; i < g_failed_count; i++)
+		if (g_failed[i].vid == vid && g_failed[i].pid == pid)
+			return 0;
+
+	for (const usb_polling_override& entry : g_overrides)
+		if (entry.vid == vid && entry.pid == pid)
+			return entry.interval_ms;
+
+	return 0;
+}
+
+// Interface descriptors to pass to class driver open(): original or copy with faster interrupt IN endpoints.
+static const tusb_desc_interface_t* patch_interface(uint8_t dev_addr, const tusb_desc_interface_t* desc_itf, uint16_t max_len)
+{
+	uint16_t vid, pid;
+
+	if (dev_addr >= USB_DEVICE_ADDRESSES || max_len > sizeof(g_descriptor_copy) || !tuh_vid_pid_get(dev_addr, &vid, &pid))
+		return desc_itf;
+
+	const uint8_t interval = override_interval(vid, pid);
+
+	if (!interval)
+		return desc_itf;
+
+	memcpy(g_descriptor_copy, desc_itf, max_len);
+
+	usb_polling_device* device = &g_devices[dev_addr];
+
+	for (uint16_t offset = 0; offset + 1 < max_len && g_descriptor_copy[offset]; offset += g_descriptor_copy[offset])
+	{
+		tusb_desc_endpoint_t* desc_ep = (tusb_desc_endpoint_t*)&g_descriptor_copy[offset];
+
+		if (desc_ep->bDescriptorType != TUSB_DESC_ENDPOINT || desc_ep->bmAttributes.xfer != TUSB_XFER_INTERRUPT
+			|| tu_edpt_dir(desc_ep->bEndpointAddress) != TUSB_DIR_IN || desc_ep->bInterval <= interval)
+			continue;
+
+		printf("USB_POLLING dev=%u vid=%04x pid=%04x ep=%02x advertised_ms=%u interval_ms=%u\n",
+			dev_addr, vid, pid, desc_ep->bEndpointAddress, desc_ep->bInterval, interval);
+
+		if (!device->advertised_ms)
+		{
+			*device = {};
+			device->advertised_ms = desc_ep->bInterval;
+			device->interval_ms = interval;
+			device->window_start_us = time_us_32();
+			device->vid = vid;
+			device->pid = pid;
+		}
+
+		desc_ep->bInterval = interval;
+	}
+
+	return (const tusb_desc_interface_t*)g_descriptor_copy;
+}
+
+static void count_error(uint8_t dev_addr, uint8_t ep_addr, xfer_result_t result)
+{
+	if (dev_addr >= USB_DEVICE_ADDRESSES || tu_edpt_dir(ep_addr) != TUSB_DIR_IN)
+		return;
+
+	usb_polling_device* device = &g_devices[dev_addr];
+
+	if (!device->advertised_ms || device->fallback)
+		return;
+
+	const uint32_t now = time_us_32();
+
+	if (now - device->window_start_us > USB_POLLING_FALLBACK_WINDOW_MS * 1000)
+	{
+		device->window_start_us = now;
+		device->errors = 0;
+	}
+
+	if (result == XFER_RESULT_SUCCESS || ++device->errors < USB_POLLING_FALLBACK_ERRORS)
+		return;
+
+	device->fallback = true;
+
+	if (g_failed_count < FAILED_MAX)
+		g_failed[g_failed_count++] = { device->vid, device->pid };
+
+	printf("USB_POLLING dev=%u fallback errors=%u interval_ms=%u\n", dev_addr, device->errors, device->advertised_ms);
+}
+
+static void close_device(uint8_t dev_addr)
+{
+	if (dev_addr < USB_DEVICE_ADDRESSES)
+		g_devices[dev_addr] = {};
+
+	mount_timeline_unmount(dev_addr);
+}
+
+static bool hid_open(uint8_t rhport, uint8_t dev_addr, const tusb_desc_interface_t* desc_itf, uint16_t max_len)
+{
+	mount_timeline_attach(dev_addr);
+
+	return hidh_open(rhport, dev_addr, patch_interface(dev_addr, desc_itf, max_len), max_len);
+}
+
+static bool hid_xfer_cb(uint8_t dev_addr, uint8_t ep_addr, xfer_result_t result, uint32_t xferred_bytes)
+{
+	count_error(dev_addr, ep_addr, result);
+
+	return hidh_xfer_cb(dev_addr, ep_addr, result, xferred_bytes);
+}
+
+static void hid_close(uint8_t dev_addr)
+{
+	close_device(dev_addr);
+	hidh_close(dev_addr);
+}
+
+static bool xinput_open(uint8_t rhport, uint8_t dev_addr, const tusb_desc_interface_t* desc_itf, uint16_t max_len)
+{
+	mount_timeline_attach(dev_addr);
+
+	return usbh_xinput_driver.open(rhport, dev_addr, patch_interface(dev_addr, desc_itf, max_len), max_len);
+}
+
+static bool xinput_xfer_cb(uint8_t dev_addr, uint8_t ep_addr, xfer_result_t result, uint32_t xferred_bytes)
+{
+	count_error(dev_addr, ep_addr, result);
+
+	return usbh_xinput_driver.xfer_cb(dev_addr, ep_addr, result, xferred_bytes);
+}
+
+static void xinput_close(uint8_t dev_addr)
+{
+	close_device(dev_addr);
+	usbh_xinput_driver.close(dev_addr);
+}
+
+// Application drivers are matched before TinyUSB built-in HID driver
+static const usbh_class_driver_t g_drivers[] =
+{
+	{ "HID_POLLING", hidh_init, hidh_deinit, hid_open, hidh_set_config, hid_xfer_cb, hid_close },
+	{ "XINPUT_POLLING", usbh_xinput_driver.init, usbh_xinput_driver.deinit, xinput_open, usbh_xinput_driver.set_config, xinput_xfer_cb, xinput_close },
+};
+
+const usbh_class_driver_t* usb_polling_drivers(uint8_t* driver_count)
+{
+	*driver_count = TU_ARRAY_SIZE(g_drivers);
+
+	return g_drivers;
+}
+
+bool usb_polling_receive(uint8_t dev_addr, uint8_t instance, usb_polling_receive_t receive)
+{
+	if (dev_addr >= USB_DEVICE_ADDRESSES || instance >= USB_POLLING_INSTANCES || !g_devices[dev_addr].fallback)
+		return receive(dev_addr, instance);
+
+	usb_polling_device* device = &g_devices[dev_addr];
+	const uint32_t now = time_us_32();
+
+	if (now - device->last_receive_us[instance] >= device->advertised_ms * 1000u)
+	{
+		device->last_receive_us[instance] = now;
+
+		return receive(dev_addr, instance);
+	}
+
+	device->pending[instance] = receive;
+
+	return true;
+}
+
+void usb_polling_task()
+{
+	const uint32_t now = time_us_32();
+
+	for (uint8_t dev_addr = 0; dev_addr < USB_DEVICE_ADDRESSES; dev_addr++)
+	{
+		usb_polling_device* device = &g_devices[dev_addr];
+
+		if (!device->fallback)
+			continue;
+
+		for (uint8_t instance = 0; instance < USB_POLLING_INSTANCES; instance++)
+		{
+			if (!device->pending[instance] || now - device->last_receive_us[instance] < device->advertised_ms * 1000u)
+				continue;
+
+			const usb_polling_receive_t receive = device->pending[instance];
+			device->pending[instance] = nullptr;
+			device->last_receive_us[instance] = now;
+			receive(dev_addr, instance);
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "tusb_config.h"
+#include "xinput_host.h"
+
+/*
+USB interrupt IN endpoint polling interval override for known pads.
+
+Pads listed in usb_polling.cpp are polled faster than their descriptor bInterval: HID and XInput class drivers
+are wrapped as TinyUSB application drivers, the wrapper open() patches bInterval of interrupt IN endpoints
+in a copy of the interface descriptors before the class driver opens them.
+
+Safety fallback: USB_POLLING_FALLBACK_ERRORS failed IN transfers (errors, timeouts, NAK retries exhausted)
+within USB_POLLING_FALLBACK_WINDOW_MS switch the device back to advertised rate: next receive is queued
+not earlier than advertised interval after the previous one, so the host polls at advertised rate.
+Failed VID/PID is not overridden again until reset.
+
+Prints over stdio UART:
+	USB_POLLING dev=<n> vid=<hex> pid=<hex> ep=<hex> advertised_ms=<n> interval_ms=<n>
+	USB_POLLING dev=<n> fallback errors=<n> interval_ms=<advertised>
+Achieved rate per device: REPORT_RATE lines (src/report_rate.h).
+*/
+
+#define USB_POLLING_INSTANCES 2
+#define USB_POLLING_FALLBACK_ERRORS 8
+#define USB_POLLING_FALLBACK_WINDOW_MS 1000
+
+// tuh_hid_receive_report() or tuh_xinput_receive_report()
+typedef bool (*usb_polling_receive_t)(uint8_t dev_addr, uint8_t instance);
+
+#if USB_POLLING_OVERRIDE
+// Application class drivers: wrapped HID and XInput. Return from usbh_app_driver_get_cb().
+const usbh_class_driver_t* usb_polling_drivers(uint8_t* driver_count);
+
+// Queue next report receive, paced at advertised rate after fallback. Call instead of receive from report callbacks.
+bool usb_polling_receive(uint8_t dev_addr, uint8_t instance, usb_polling_receive_t receive);
+
+// Queue receives deferred by fallback pacing. Call from core1 loop.
+void usb_polling_task();
+#else
+inline const usbh_class_driver_t* usb_polling_drivers(uint8_t* driver_count)
+{
+	*driver_count = 1;
+
+	return &usbh_xinput_driver;
+}
+
+inline bool usb_polling_receive(uint8_t dev_addr, uint8_t instance, usb_polling_receive_t receive) { return receive(dev_addr, instance); }
+inline void usb_polling_task() {}
+#endif
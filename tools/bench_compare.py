@@ -0,0 +1,54 @@
+#!/usr/bin/env python3
+"""
+Compare SMD2GC on-target benchmark results (src/bench_main.cpp) from UART logs.
+
+Usage:
+    bench_compare.py before.log [after.log]
+
+Result line format:
+    BENCH clk_mhz=<MHz> kernel=<name> iterations=<n> us=<total> cycles_per_op=<cycles>
+
+With one log prints cycles per operation, with two logs also the change of the second log.
+"""
+
+import re
+import sys
+
+BENCH = re.compile(r'BENCH clk_mhz=(\d+) kernel=(\S+) iterations=(\d+) us=(\d+) cycles_per_op=([\d.]+)')
+
+
+def read_results(path):
+    results = {}  # (kernel, MHz) -> cycles per op
+
+    with open(path, errors='replace') as source:
+        for line in source:
+            m = BENCH.search(line)
+            if m:
+                results[(m.group(2), int(m.group(1)))] = float(m.group(5))
+
+    return results
+
+
+def main():
+    if len(sys.argv) not in (2, 3):
+        sys.exit(__doc__)
+
+    before = read_results(sys.argv[1])
+    after = read_results(sys.argv[2]) if len(sys.argv) == 3 else None
+
+    for kernel, mhz in sorted(before, key=lambda key: (key[1], key[0])):
+        cycles = before[(kernel, mhz)]
+        line = f'{mhz:4d} MHz  {kernel:<56} {cycles:12.1f}'
+
+        if after is not None:
+            if (kernel, mhz) in after:
+                new_cycles = after[(kernel, mhz)]
+                line += f' {new_cycles:12.1f} {100.0 * (new_cycles - cycles) / cycles:+8.1f}%'
+            else:
+                line += f' {"-":>12}'
+
+        print(line)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,186 @@
+#!/usr/bin/env python3
+"""
+Decode SMD2GC Joybus line captures (include/communication_protocols/joybus/capture.hpp) from UART log.
+
+Usage:
+    joybus_capture_decode.py uart.log [-v]
+
+Capture dump format:
+    JBCAP BEGIN rate=<sample Hz> words=<count> trigger=<word index> command=<hex>
+    <32-bit sample words in hex, first sample is MSB>
+    JBCAP END
+
+Joybus bit is 4 us: 0 - 3 us low / 1 us high, 1 - 1 us low / 3 us high.
+Console stop bit is 1 us low, controller stop bit is 2 us low.
+"""
+
+import argparse
+import re
+import sys
+
+IDLE_US = 6.0  # High time ending a frame
+REPLY_WINDOW_US = 200.0  # Frame starting within this time after a command is its reply
+
+# Command byte: name, command data bits, reply data bits
+COMMANDS = {
+    0x00: ('PROBE', 8, 24),
+    0x40: ('POLL', 24, 64),
+    0x41: ('ORIGIN', 8, 80),
+    0x42: ('CALIBRATE', 24, 80),
+    0xFF: ('RESET', 8, 24),
+}
+
+BEGIN = re.compile(r'JBCAP BEGIN rate=(\d+) words=(\d+) trigger=(\d+) command=([0-9a-fA-F]+)')
+
+
+def read_captures(lines):
+    capture = None
+
+    for line in lines:
+        line = line.strip()
+        m = BEGIN.search(line)
+        if m:
+            capture = {
+                'rate': int(m.group(1)),
+                'trigger': int(m.group(3)) * 32,
+                'command': int(m.group(4), 16),
+                'words': [],
+            }
+        elif capture is not None and line.startswith('JBCAP END'):
+            yield capture
+            capture = None
+        elif capture is not None:
+            capture['words'].extend(int(w, 16) for w in line.split())
+
+
+def samples_from_words(words):
+    for word in words:
+        for bit in range(31, -1, -1):
+            yield (word >> bit) & 1
+
+
+def pulses(samples, us_per_sample):
+    """Yields (fall_us, rise_us) for every low pulse."""
+    fall = None
+    previous = 1
+
+    for i, level in enumerate(samples):
+        if previous == 1 and level == 0:
+            fall = i
+        elif previous == 0 and level == 1 and fall is not None:
+            yield fall * us_per_sample, i * us_per_sample
+            fall = None
+        previous = level
+
+
+def frames(pulse_list):
+    """
+    Splits pulses into frames. Reply may start within a bit time after command stop bit,
+    so frame length is taken from command byte when known, idle time otherwise.
+    """
+    frame = []
+    expected = None  # Data bits in current frame
+    reply_bits = None  # Data bits expected in reply to last command
+
+    for fall, rise in pulse_list:
+        if frame and fall - frame[-1][1] > IDLE_US:
+            yield frame
+            frame = []
+
+        if not frame:
+            expected = reply_bits
+            reply_bits = None
+
+        frame.append((fall, rise))
+
+        if expected is None and len(frame) == 8:
+            command = int(''.join('1' if r - f < 2.0 else '0' for f, r in frame), 2)
+            if command in COMMANDS:
+                expected, reply_bits = COMMANDS[command][1:]
+
+        if expected is not None and len(frame) == expected + 1:
+            yield frame
+            frame = []
+
+    if frame:
+        yield frame
+
+
+def decode_frame(frame):
+    bits = [1 if rise - fall < 2.0 else 0 for fall, rise in frame]
+    data_bits = bits[:-1]  # Last pulse is stop bit
+    data = bytes(
+        int(''.join(str(b) for b in data_bits[i:i + 8]), 2)
+        for i in range(0, len(data_bits) - len(data_bits) % 8, 8)
+    )
+    lows = [rise - fall for fall, rise in frame]
+    cells = [frame[i + 1][0] - frame[i][0] for i in range(len(frame) - 1)]
+    return data, bits, lows, cells
+
+
+def describe(capture, verbose, out):
+    us_per_sample = 1e6 / capture['rate']
+    trigger_us = capture['trigger'] * us_per_sample
+    samples = list(samples_from_words(capture['words']))
+
+    out.write(f"Capture: {len(samples)} samples @ {capture['rate'] / 1e6:g} MHz, "
+              f"trigger command {capture['command']:#04x} at {trigger_us:.2f} us\n")
+
+    last_command = None  # (end_us, data)
+
+    for frame in frames(pulses(samples, us_per_sample)):
+        data, bits, lows, cells = decode_frame(frame)
+        start = frame[0][0]
+        end = frame[-1][1]
+
+        is_reply = last_command is not None and start - last_command[0] < REPLY_WINDOW_US
+
+        if is_reply:
+            latency = start - last_command[0]
+            kind = f'REPLY  latency={latency:6.2f} us'
+            last_command = None
+        else:
+            if last_command is not None:
+                out.write(f'{"":>12}  no reply to {last_command[1].hex()}\n')
+            name = COMMANDS[data[0]][0] if data and data[0] in COMMANDS else 'UNKNOWN'
+            kind = f'CMD    {name}'
+            last_command = (end, data)
+
+        zero_lows = [low for low, bit in zip(lows[:-1], bits[:-1]) if bit == 0]
+        one_lows = [low for low, bit in zip(lows[:-1], bits[:-1]) if bit == 1]
+
+        stats = ''
+        if cells:
+            stats += f' cell {min(cells):.2f}..{max(cells):.2f} us'
+        if zero_lows:
+            stats += f' low0 {min(zero_lows):.2f}..{max(zero_lows):.2f}'
+        if one_lows:
+            stats += f' low1 {min(one_lows):.2f}..{max(one_lows):.2f}'
+        stats += f' stop {lows[-1]:.2f}'
+
+        out.write(f'{start - trigger_us:+12.2f}  {kind} [{data.hex(" ")}] {len(bits) - 1} bits{stats}\n')
+
+        if verbose:
+            for i, (fall, rise) in enumerate(frame):
+                cell = f'{cells[i]:.2f}' if i < len(cells) else '-'
+                out.write(f'{"":>14}bit {i:3d}: {bits[i]} low {rise - fall:.2f} us cell {cell} us\n')
+
+    if last_command is not None:
+        out.write(f'{"":>12}  no reply to {last_command[1].hex()}\n')
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Decode Joybus line captures')
+    parser.add_argument('log', nargs='?', help='UART log file (stdin if omitted)')
+    parser.add_argument('-v', '--verbose', action='store_true', help='print per-bit timings')
+    args = parser.parse_args()
+
+    source = open(args.log, errors='replace') if args.log else sys.stdin
+
+    for capture in read_captures(source):
+        describe(capture, args.verbose, sys.stdout)
+        sys.stdout.write('\n')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,100 @@
+#!/usr/bin/env python3
+"""
+Summarize and compare SMD2GC Joybus poll-to-reply statistics
+(include/communication_protocols/joybus/reply_stats.hpp) from UART logs.
+
+Usage:
+    joybus_reply_stats.py flash.log [ram.log ...]
+
+Window line format:
+    JBSTAT polls=<n> min_ns=<ns> max_ns=<ns> mean_ns=<ns> stddev_ns=<ns> xip_acc=<n> xip_hit=<n>
+
+Windows of every log are pooled. First log is the baseline for the other ones.
+"""
+
+import argparse
+import math
+import re
+import sys
+
+JBSTAT = re.compile(r'JBSTAT polls=(\d+) min_ns=([\d.]+) max_ns=([\d.]+) mean_ns=([\d.]+) '
+                    r'stddev_ns=([\d.]+) xip_acc=(\d+) xip_hit=(\d+)')
+
+
+def pool(path):
+    polls = 0
+    total = 0.0
+    total_squares = 0.0
+    minimum = math.inf
+    maximum = 0.0
+    accesses = 0
+    hits = 0
+    windows = 0
+
+    with open(path, errors='replace') as source:
+        for line in source:
+            m = JBSTAT.search(line)
+            if not m:
+                continue
+            n = int(m.group(1))
+            mean = float(m.group(4))
+            stddev = float(m.group(5))
+
+            windows += 1
+            polls += n
+            total += mean * n
+            total_squares += (stddev * stddev + mean * mean) * n
+            minimum = min(minimum, float(m.group(2)))
+            maximum = max(maximum, float(m.group(3)))
+            accesses += int(m.group(6))
+            hits += int(m.group(7))
+
+    if not polls:
+        return None
+
+    mean = total / polls
+    variance = max(total_squares / polls - mean * mean, 0.0)
+
+    return {
+        'windows': windows,
+        'polls': polls,
+        'min': minimum,
+        'max': maximum,
+        'mean': mean,
+        'variance': variance,
+        'miss_rate': 100.0 * (accesses - hits) / accesses if accesses else 0.0,
+    }
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Compare Joybus poll-to-reply jitter between builds')
+    parser.add_argument('logs', nargs='+', help='UART logs, first one is baseline')
+    args = parser.parse_args()
+
+    baseline = None
+
+    for path in args.logs:
+        stats = pool(path)
+        if stats is None:
+            print(f'{path}: no JBSTAT lines')
+            continue
+
+        stddev = math.sqrt(stats['variance'])
+        print(f"{path}: {stats['polls']} polls in {stats['windows']} windows")
+        print(f"  reply time  min {stats['min']:.0f} ns  max {stats['max']:.0f} ns  "
+              f"mean {stats['mean']:.1f} ns  stddev {stddev:.1f} ns  jitter {stats['max'] - stats['min']:.0f} ns")
+        print(f"  XIP cache miss rate {stats['miss_rate']:.2f}%")
+
+        if baseline is None:
+            baseline = stats
+        elif baseline['variance'] > 0:
+            print(f"  vs baseline: variance x{stats['variance'] / baseline['variance']:.3f}, "
+                  f"mean {stats['mean'] - baseline['mean']:+.1f} ns, "
+                  f"max {stats['max'] - baseline['max']:+.0f} ns")
+
+    if baseline is None:
+        sys.exit(1)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,137 @@
+#!/usr/bin/env python3
+"""
+Map SMD2GC sampling profiler histograms (src/profiler.h) to firmware symbols.
+
+Usage:
+    profiler_report.py SMD2GC.elf uart.log [--top 30] [--core 0]
+    profiler_report.py SMD2GC.elf uart.log --baseline old.elf old.log
+
+Histogram dump format:
+    PROF BEGIN core=<n> period_us=<us> samples=<n> other=<n> flash_base=<hex> flash_shift=<s> ram_base=<hex> ram_shift=<s>
+    F <bucket> <count>
+    R <bucket> <count>
+    PROF END
+
+Bucket covers [base + (bucket << shift), base + ((bucket + 1) << shift)).
+Samples of a bucket shared by several functions are attributed to the symbol at bucket start.
+All dumps in the log are summed.
+"""
+
+import argparse
+import bisect
+import collections
+import re
+import subprocess
+import sys
+
+BEGIN = re.compile(r'PROF BEGIN core=(\d+) period_us=(\d+) samples=(\d+) other=(\d+) '
+                   r'flash_base=([0-9a-fA-F]+) flash_shift=(\d+) ram_base=([0-9a-fA-F]+) ram_shift=(\d+)')
+
+OTHER = '<other: ROM / out of image>'
+
+
+class Symbols:
+    def __init__(self, elf, nm):
+        output = subprocess.run([nm, '-n', '-S', '-C', elf], check=True, capture_output=True, text=True).stdout
+        self.addresses = []
+        self.entries = []
+
+        for line in output.splitlines():
+            parts = line.split(maxsplit=3)
+            # Code copied to RAM is linked into .data section: d / D
+            if len(parts) < 4 or parts[2] not in 'tTwWdD':
+                continue
+            address = int(parts[0], 16) & ~1  # Clear Thumb bit
+            size = int(parts[1], 16)
+            self.addresses.append(address)
+            self.entries.append((address, size, parts[3]))
+
+    def lookup(self, address):
+        i = bisect.bisect_right(self.addresses, address) - 1
+        if i < 0:
+            return f'<unknown {address:#010x}>'
+        start, size, name = self.entries[i]
+        if size and address >= start + size:
+            return f'<gap after {name}>'
+        return name
+
+
+def read_histograms(lines, core_filter):
+    """Yields (core, address, count), summed over all dumps."""
+    header = None
+
+    for line in lines:
+        line = line.strip()
+        m = BEGIN.search(line)
+        if m:
+            header = {
+                'core': int(m.group(1)),
+                'other': int(m.group(4)),
+                'F': (int(m.group(5), 16), int(m.group(6))),
+                'R': (int(m.group(7), 16), int(m.group(8))),
+            }
+            if core_filter is None or header['core'] == core_filter:
+                yield header['core'], None, header['other']
+        elif header is not None and line.startswith('PROF END'):
+            header = None
+        elif header is not None and line[:2] in ('F ', 'R '):
+            if core_filter is not None and header['core'] != core_filter:
+                continue
+            region, bucket, count = line.split()
+            base, shift = header[region]
+            yield header['core'], base + (int(bucket) << shift), int(count)
+
+
+def profile(elf, log, nm, core_filter):
+    symbols = Symbols(elf, nm)
+    shares = collections.defaultdict(collections.Counter)  # core -> symbol -> samples
+
+    with open(log, errors='replace') as source:
+        for core, address, count in read_histograms(source, core_filter):
+            name = OTHER if address is None else symbols.lookup(address)
+            shares[core][name] += count
+
+    return shares
+
+
+def report(shares, baseline, top, out):
+    for core in sorted(shares):
+        counter = shares[core]
+        total = sum(counter.values())
+        if not total:
+            continue
+
+        base_counter = baseline.get(core, collections.Counter()) if baseline is not None else None
+        base_total = sum(base_counter.values()) if base_counter else 0
+
+        out.write(f'Core {core}: {total} samples\n')
+
+        for name, count in counter.most_common(top):
+            share = 100.0 * count / total
+            line = f'{share:7.2f}% {count:8d}  {name}'
+            if base_counter is not None:
+                base_share = 100.0 * base_counter[name] / base_total if base_total else 0.0
+                line = f'{share:7.2f}% {share - base_share:+7.2f}% {count:8d}  {name}'
+            out.write(line + '\n')
+
+        out.write('\n')
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Map profiler histograms to firmware symbols')
+    parser.add_argument('elf', help='firmware ELF the log was captured with')
+    parser.add_argument('log', help='UART log with PROF dumps')
+    parser.add_argument('--baseline', nargs=2, metavar=('ELF', 'LOG'), help='show CPU share change against other build')
+    parser.add_argument('--core', type=int, choices=(0, 1), help='report single core')
+    parser.add_argument('--top', type=int, default=30, help='symbols per core (default 30)')
+    parser.add_argument('--nm', default='arm-none-eabi-nm', help='nm executable')
+    args = parser.parse_args()
+
+    shares = profile(args.elf, args.log, args.nm, args.core)
+    baseline = profile(*args.baseline, args.nm, args.core) if args.baseline else None
+
+    report(shares, baseline, args.top, sys.stdout)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,58 @@
+#!/usr/bin/env python3
+"""
+List SMD2GC firmware functions placed in SRAM (src/hot_path.h) and check them against budget.
+
+Usage:
+    ram_budget.py SMD2GC.elf [--limit 16384] [--readelf arm-none-eabi-readelf]
+
+Functions linked at SRAM addresses are copied from flash at boot: they cost both flash and RAM.
+Exits with error when total code size in SRAM exceeds --limit.
+"""
+
+import argparse
+import subprocess
+import sys
+
+SRAM_BASE = 0x20000000
+SRAM_END = 0x20042000  # Striped SRAM 256 KB + scratch X / Y 4 KB each
+
+
+def ram_functions(elf, readelf):
+    output = subprocess.run([readelf, '-sW', '-C', elf], check=True, capture_output=True, text=True).stdout
+    functions = {}
+
+    for line in output.splitlines():
+        parts = line.split(None, 7)
+        # Num: Value Size Type Bind Vis Ndx Name
+        if len(parts) < 8 or parts[3] != 'FUNC':
+            continue
+        address = int(parts[1], 16) & ~1  # Clear Thumb bit
+        if SRAM_BASE <= address < SRAM_END:
+            functions[address] = (int(parts[2], 0), parts[7])
+
+    return sorted(functions.items())
+
+
+def main():
+    parser = argparse.ArgumentParser(description='List code placed in SRAM')
+    parser.add_argument('elf', help='firmware ELF')
+    parser.add_argument('--limit', type=int, help='fail if code in SRAM exceeds this size in bytes')
+    parser.add_argument('--readelf', default='arm-none-eabi-readelf', help='readelf executable')
+    args = parser.parse_args()
+
+    functions = ram_functions(args.elf, args.readelf)
+    total = sum(size for _, (size, _) in functions)
+
+    print('Code in SRAM:')
+    for address, (size, name) in functions:
+        print(f'  {address:#010x} {size:6d}  {name}')
+    print(f'Total: {total} bytes in {len(functions)} functions' +
+          (f', budget {args.limit} bytes' if args.limit else ''))
+
+    if args.limit and total > args.limit:
+        print(f'error: code in SRAM exceeds budget by {total - args.limit} bytes', file=sys.stderr)
+        sys.exit(1)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,78 @@
+#!/usr/bin/env python3
+"""
+Decode SMD2GC binary trace records (src/trace.h) from UART dump.
+
+Usage:
+    trace_decode.py dump.bin
+    cat /dev/ttyACM0 | trace_decode.py
+
+Records are 16 bytes: magic (0xA0 | core), event, arg0 (u16), timestamp (u32 us), arg1 (u32), arg2 (u32).
+Stdio text sharing the UART is printed as is.
+"""
+
+import struct
+import sys
+
+TRACE_MAGIC = 0xA0
+RECORD = struct.Struct('<BBHIII')
+
+# Keep in sync with trace_event in src/trace.h
+EVENTS = {
+    1: ('INVALID_REPORT', lambda a0, a1, a2: f'report_id={a0:#04x} len={a1}'),
+    2: ('REPORT_TOO_SHORT', lambda a0, a1, a2: f'len={a0} expected_bits={a1} report_id={a2:#04x}'),
+    3: ('ARENA_OUT_OF_SPACE', lambda a0, a1, a2: f'size={a1} offset={a2}'),
+    4: ('XINPUT_REPORT', lambda a0, a1, a2:
+        f'dev={a1 & 0xF} inst={(a1 >> 4) & 0xF} type={(a1 >> 8) & 0xFF} buttons={a0:#06x} '
+        f'LT={(a1 >> 16) & 0xFF} RT={a1 >> 24} '
+        f'LX={a2 & 0xFF} LY={(a2 >> 8) & 0xFF} RX={(a2 >> 16) & 0xFF} RY={a2 >> 24}'),
+    5: ('GAMEPAD_CONTROL', lambda a0, a1, a2: f'control={a0} value={a1}'),
+    6: ('DROPPED', lambda a0, a1, a2: f'core={a0} total={a1} new={a2}'),
+}
+
+
+def decode(data, out):
+    text = bytearray()
+    last_timestamp = [None, None]
+    i = 0
+
+    while i < len(data):
+        byte = data[i]
+
+        if byte & 0xFE == TRACE_MAGIC and i + RECORD.size <= len(data):
+            magic, event, arg0, timestamp, arg1, arg2 = RECORD.unpack_from(data, i)
+
+            if event in EVENTS:
+                if text:
+                    out.write(text.decode('ascii', 'replace'))
+                    text.clear()
+
+                core = magic & 1
+                name, fmt = EVENTS[event]
+                delta = '' if last_timestamp[core] is None else f' (+{(timestamp - last_timestamp[core]) & 0xFFFFFFFF} us)'
+                last_timestamp[core] = timestamp
+
+                out.write(f'[core{core} {timestamp:10d} us{delta}] {name} {fmt(arg0, arg1, arg2)}\n')
+                i += RECORD.size
+                continue
+
+        # Not a record start: stdio text
+        if byte < 0x80:
+            text.append(byte)
+        i += 1
+
+    if text:
+        out.write(text.decode('ascii', 'replace'))
+
+
+def main():
+    if len(sys.argv) > 1:
+        with open(sys.argv[1], 'rb') as f:
+            data = f.read()
+    else:
+        data = sys.stdin.buffer.read()
+
+    decode(data, sys.stdout)
+
+
+if __name__ == '__main__':
+    main()
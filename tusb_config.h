@@ -6,6 +6,11 @@
 //--------------------------------------------------------------------
 // Set the controller mode to Host for the RP2040 USB port (Port 0)
 #define CFG_TUSB_RHPORT0_MODE   OPT_MODE_HOST 
+#if PIO_USB_HOST
+// Second host root port on Pico-PIO-USB (Port 1, src/pio_usb_host.h)
+#define CFG_TUH_RPI_PIO_USB     1
+#define CFG_TUSB_RHPORT1_MODE   OPT_MODE_HOST
+#endif
 #define CFG_TUSB_OS             OPT_OS_PICO
 
 // Debug level (0-3). 0 = no debug output; Level 2: Full control transfer logs (descriptor gets, errors)
@@ -19,6 +24,9 @@
 #define CFG_TUH_DEVICE_MAX          2 // At least 2, 4 is safe
 #define CFG_TUH_HUB                 1 // Support hubs (recommended)
 
+// Per-device tables indexed by dev_addr: 0 while enumerating, 1 .. CFG_TUH_DEVICE_MAX + CFG_TUH_HUB
+#define USB_DEVICE_ADDRESSES        (CFG_TUH_DEVICE_MAX + CFG_TUH_HUB + 1)
+
 // Size of the enumeration buffer (typically 256 bytes is enough)
 #define CFG_TUH_ENUMERATION_BUFSIZE 512
 